@@ -101,4 +101,11 @@ void defineILoggerComponent(pybind11::module_ m, PyDaqIntf<daq::ILoggerComponent
         },
         py::arg("level"),
         "Sets the minimum severity level of messages to be automatically written to the associated sinks bypassing the temporary buffers.");
+    cls.def_property_readonly("dropped_message_count",
+        [](daq::ILoggerComponent *object)
+        {
+            const auto objectPtr = daq::LoggerComponentPtr::Borrow(object);
+            return objectPtr.getDroppedMessageCount();
+        },
+        "Gets the number of messages dropped because the asynchronous message queue was full.");
 }
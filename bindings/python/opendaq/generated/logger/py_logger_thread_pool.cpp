@@ -31,6 +31,11 @@
 
 PyDaqIntf<daq::ILoggerThreadPool, daq::IBaseObject> declareILoggerThreadPool(pybind11::module_ m)
 {
+    py::enum_<daq::LogOverflowPolicy>(m, "LogOverflowPolicy")
+        .value("Block", daq::LogOverflowPolicy::Block)
+        .value("OverrunOldest", daq::LogOverflowPolicy::OverrunOldest)
+        .value("DiscardNew", daq::LogOverflowPolicy::DiscardNew);
+
     return wrapInterface<daq::ILoggerThreadPool, daq::IBaseObject>(m, "ILoggerThreadPool");
 }
 
@@ -39,4 +44,20 @@ void defineILoggerThreadPool(pybind11::module_ m, PyDaqIntf<daq::ILoggerThreadPo
     cls.doc() = "Container for messages queue and backing threads used for asynchronous logging.";
 
     m.def("LoggerThreadPool", &daq::LoggerThreadPool_Create);
+    m.def("LoggerThreadPoolWithPolicy", &daq::LoggerThreadPoolWithPolicy_Create);
+
+    cls.def_property_readonly("overflow_policy",
+        [](daq::ILoggerThreadPool *object)
+        {
+            const auto objectPtr = daq::LoggerThreadPoolPtr::Borrow(object);
+            return objectPtr.getOverflowPolicy();
+        },
+        "Gets the policy applied when the message queue is full.");
+    cls.def_property_readonly("dropped_message_count",
+        [](daq::ILoggerThreadPool *object)
+        {
+            const auto objectPtr = daq::LoggerThreadPoolPtr::Borrow(object);
+            return objectPtr.getDroppedMessageCount();
+        },
+        "Gets the number of messages dropped because the message queue was full.");
 }
@@ -80,6 +80,25 @@ void defineIBlockReader(pybind11::module_ m, PyDaqIntf<daq::IBlockReader, daq::I
         "Copies at maximum the next `count` blocks of unread samples and clock-stamps to the `dataBlocks` and `domainBlocks` buffers."
         "The amount actually read is returned through the `count` parameter.");
 
+    cls.def(
+        "read_into",
+        [](daq::IBlockReader* object, py::array values, const size_t timeoutMs)
+        { return PyTypedReader::readValuesInto(daq::BlockReaderPtr::Borrow(object), values, timeoutMs); },
+        py::arg("values").noconvert(),
+        py::arg("timeout_ms") = 0,
+        "Copies at maximum `len(values)` blocks of unread samples to the preallocated `values` array of shape (blocks, block_size). "
+        "Returns the amount of blocks actually read and the reader status.");
+
+    cls.def(
+        "read_with_domain_into",
+        [](daq::IBlockReader* object, py::array values, py::array domain, const size_t timeoutMs)
+        { return PyTypedReader::readValuesWithDomainInto(daq::BlockReaderPtr::Borrow(object), values, domain, timeoutMs); },
+        py::arg("values").noconvert(),
+        py::arg("domain").noconvert(),
+        py::arg("timeout_ms") = 0,
+        "Copies at maximum `len(values)` blocks of unread samples and clock-stamps to the preallocated `values` and `domain` arrays "
+        "of shape (blocks, block_size). Returns the amount of blocks actually read and the reader status.");
+
     cls.def_property_readonly(
         "block_size",
         [](daq::IBlockReader* object)
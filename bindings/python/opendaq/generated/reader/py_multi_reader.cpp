@@ -60,6 +60,22 @@ void defineIMultiReader(pybind11::module_ m, PyDaqIntf<daq::IMultiReader, daq::I
         },
         py::arg("count"), py::arg("timeout_ms") = 0,
         "Copies at maximum the next `count` unread samples and clock-stamps to the `samples` and `domain` buffers. The amount actually read is returned through the `count` parameter.");
+    cls.def("read_into",
+        [](daq::IMultiReader *object, py::array values, const size_t timeoutMs)
+        {
+            const auto objectPtr = daq::MultiReaderPtr::Borrow(object);
+            return PyTypedReader::readValuesInto(objectPtr, values, timeoutMs);
+        },
+        py::arg("values").noconvert(), py::arg("timeout_ms") = 0,
+        "Copies at maximum `values.shape[1]` unread samples to the preallocated `values` array with a row for each signal. The rows may be strided, the samples of a row must be contiguous. Returns the amount actually read and the reader status.");
+    cls.def("read_with_domain_into",
+        [](daq::IMultiReader *object, py::array values, py::array domain, const size_t timeoutMs)
+        {
+            const auto objectPtr = daq::MultiReaderPtr::Borrow(object);
+            return PyTypedReader::readValuesWithDomainInto(objectPtr, values, domain, timeoutMs);
+        },
+        py::arg("values").noconvert(), py::arg("domain").noconvert(), py::arg("timeout_ms") = 0,
+        "Copies at maximum `values.shape[1]` unread samples and clock-stamps to the preallocated `values` and `domain` arrays with a row for each signal. Returns the amount actually read and the reader status.");
     cls.def("skip_samples",
         [](daq::IMultiReader *object, size_t count)
         {
@@ -64,6 +64,23 @@ void defineIStreamReader(pybind11::module_ m, PyDaqIntf<daq::IStreamReader, daq:
         py::arg("timeout_ms") = 0,
         "Copies at maximum the next `count` unread samples and clock-stamps to the `values` and `stamps` buffers. The amount actually read "
         "is returned through the `count` parameter.");
+    cls.def(
+        "read_into",
+        [](daq::IStreamReader* object, py::array values, const size_t timeoutMs)
+        { return PyTypedReader::readValuesInto(daq::StreamReaderPtr::Borrow(object), values, timeoutMs); },
+        py::arg("values").noconvert(),
+        py::arg("timeout_ms") = 0,
+        "Copies at maximum `len(values)` unread samples to the preallocated `values` array. Returns the amount actually read "
+        "and the reader status.");
+    cls.def(
+        "read_with_domain_into",
+        [](daq::IStreamReader* object, py::array values, py::array domain, const size_t timeoutMs)
+        { return PyTypedReader::readValuesWithDomainInto(daq::StreamReaderPtr::Borrow(object), values, domain, timeoutMs); },
+        py::arg("values").noconvert(),
+        py::arg("domain").noconvert(),
+        py::arg("timeout_ms") = 0,
+        "Copies at maximum `len(values)` unread samples and clock-stamps to the preallocated `values` and `domain` arrays. Returns "
+        "the amount actually read and the reader status.");
     cls.def(
         "skip_samples",
         [](daq::IStreamReader* object, size_t count)
@@ -69,6 +69,27 @@ void defineITailReader(pybind11::module_ m, PyDaqIntf<daq::ITailReader, daq::ISa
         py::arg("count"),
         "Copies at maximum the next `count` unread samples and clock-stamps to the `values` and `stamps` buffers. The amount actually read "
         "is returned through the `count` parameter.");
+    cls.def(
+        "read_into",
+        [](daq::ITailReader* object, py::array values)
+        {
+            const auto objectPtr = daq::TailReaderPtr::Borrow(object);
+            return PyTypedReader::readValuesInto(objectPtr, values, 0);
+        },
+        py::arg("values").noconvert(),
+        "Copies at maximum `len(values)` last unread samples to the preallocated `values` array. Returns the amount actually read "
+        "and the reader status.");
+    cls.def(
+        "read_with_domain_into",
+        [](daq::ITailReader* object, py::array values, py::array domain)
+        {
+            const auto objectPtr = daq::TailReaderPtr::Borrow(object);
+            return PyTypedReader::readValuesWithDomainInto(objectPtr, values, domain, 0);
+        },
+        py::arg("values").noconvert(),
+        py::arg("domain").noconvert(),
+        "Copies at maximum `len(values)` last unread samples and clock-stamps to the preallocated `values` and `domain` arrays. "
+        "Returns the amount actually read and the reader status.");
     cls.def_property_readonly(
         "history_size",
         [](daq::ITailReader* object)
@@ -133,4 +133,16 @@ void defineITailReaderBuilder(pybind11::module_ m, PyDaqIntf<daq::ITailReaderBui
             objectPtr.setSkipEvents(skipEvents);
         },
         "Gets the skip events / Sets the skip events");
+    cls.def_property("copy_samples",
+        [](daq::ITailReaderBuilder *object)
+        {
+            const auto objectPtr = daq::TailReaderBuilderPtr::Borrow(object);
+            return objectPtr.getCopySamples();
+        },
+        [](daq::ITailReaderBuilder *object, const bool copySamples)
+        {
+            const auto objectPtr = daq::TailReaderBuilderPtr::Borrow(object);
+            objectPtr.setCopySamples(copySamples);
+        },
+        "Gets whether the reader copies the received samples into a ring buffer / Sets whether the reader copies the received samples into a ring buffer");
 }
@@ -55,6 +55,16 @@ void defineTimeStreamReader(pybind11::module_ m, py::class_<daq::TimeReader<daq:
         py::arg("count"),
         py::arg("timeout_ms") = 0,
         "Returns the next `count` unread samples and clock-stamps.");
+
+    cls.def(
+        "read_with_timestamps_into",
+        [](daq::TimeReader<daq::StreamReaderPtr>* object, py::array values, py::array timestamps, const size_t timeoutMs)
+        { return PyTypedReader::readValuesWithDomainInto(*object, values, timestamps, timeoutMs); },
+        py::arg("values").noconvert(),
+        py::arg("timestamps").noconvert(),
+        py::arg("timeout_ms") = 0,
+        "Copies at maximum `len(values)` unread samples and clock-stamps to the preallocated `values` and `timestamps` arrays. "
+        "The `timestamps` array is a datetime64[ns] or int64 array. Returns the amount actually read and the reader status.");
 }
 
 void defineTimeTailReader(pybind11::module_ m, py::class_<daq::TimeReader<daq::TailReaderPtr>> cls)
@@ -75,6 +85,16 @@ void defineTimeTailReader(pybind11::module_ m, py::class_<daq::TimeReader<daq::T
         py::arg("count"),
         py::arg("timeout_ms") = 0,
         "Returns the next `count` last unread samples and clock-stamps.");
+
+    cls.def(
+        "read_with_timestamps_into",
+        [](daq::TimeReader<daq::TailReaderPtr>* object, py::array values, py::array timestamps, const size_t timeoutMs)
+        { return PyTypedReader::readValuesWithDomainInto(*object, values, timestamps, timeoutMs); },
+        py::arg("values").noconvert(),
+        py::arg("timestamps").noconvert(),
+        py::arg("timeout_ms") = 0,
+        "Copies at maximum `len(values)` last unread samples and clock-stamps to the preallocated `values` and `timestamps` arrays. "
+        "The `timestamps` array is a datetime64[ns] or int64 array. Returns the amount actually read and the reader status.");
 }
 
 void defineTimeBlockReader(pybind11::module_ m, py::class_<daq::TimeReader<daq::BlockReaderPtr>> cls)
@@ -95,6 +115,16 @@ void defineTimeBlockReader(pybind11::module_ m, py::class_<daq::TimeReader<daq::
         py::arg("count"),
         py::arg("timeout_ms") = 0,
         "Returns the next `count` unread blocks of samples and clock-stamps.");
+
+    cls.def(
+        "read_with_timestamps_into",
+        [](daq::TimeReader<daq::BlockReaderPtr>* object, py::array values, py::array timestamps, const size_t timeoutMs)
+        { return PyTypedReader::readValuesWithDomainInto(*object, values, timestamps, timeoutMs); },
+        py::arg("values").noconvert(),
+        py::arg("timestamps").noconvert(),
+        py::arg("timeout_ms") = 0,
+        "Copies at maximum `len(values)` unread blocks of samples and clock-stamps to the preallocated `values` and `timestamps` arrays. "
+        "The `timestamps` array is a datetime64[ns] or int64 array. Returns the amount actually read and the reader status.");
 }
 
 void defineTimeMultiReader(pybind11::module_ m, py::class_<daq::TimeReader<daq::MultiReaderPtr>> cls)
@@ -115,4 +145,14 @@ void defineTimeMultiReader(pybind11::module_ m, py::class_<daq::TimeReader<daq::
         py::arg("count"),
         py::arg("timeout_ms") = 0,
         "Returns the next `count` unread samples and clock-stamps.");
+
+    cls.def(
+        "read_with_timestamps_into",
+        [](daq::TimeReader<daq::MultiReaderPtr>* object, py::array values, py::array timestamps, const size_t timeoutMs)
+        { return PyTypedReader::readValuesWithDomainInto(*object, values, timestamps, timeoutMs); },
+        py::arg("values").noconvert(),
+        py::arg("timestamps").noconvert(),
+        py::arg("timeout_ms") = 0,
+        "Copies at maximum `values.shape[1]` unread samples and clock-stamps to the preallocated `values` and `timestamps` arrays. "
+        "The `timestamps` array is a datetime64[ns] or int64 array. Returns the amount actually read and the reader status.");
 }
\ No newline at end of file
@@ -36,7 +36,7 @@ PyDaqIntf<daq::IScheduler, daq::IBaseObject> declareIScheduler(pybind11::module_
 
 void defineIScheduler(pybind11::module_ m, PyDaqIntf<daq::IScheduler, daq::IBaseObject> cls)
 {
-    cls.doc() = "A thread-pool scheduler that supports scheduling one-off functions as well as dependency graphs.";
+    cls.doc() = "A thread-pool scheduler that supports scheduling one-off functions, periodic work, as well as dependency graphs.";
 
     m.def("Scheduler", &daq::Scheduler_Create);
 
@@ -85,4 +85,12 @@ void defineIScheduler(pybind11::module_ m, PyDaqIntf<daq::IScheduler, daq::IBase
             return objectPtr.isMultiThreaded();
         },
         "Returns whether more than one worker thread is used.");
+    cls.def("schedule_timer",
+        [](daq::IScheduler *object, daq::IWork* work, const size_t delayUs, const size_t periodUs)
+        {
+            const auto objectPtr = daq::SchedulerPtr::Borrow(object);
+            return objectPtr.scheduleTimer(work, delayUs, periodUs).detach();
+        },
+        py::arg("work"), py::arg("delay_us"), py::arg("period_us"),
+        "Schedules the specified work callback to run on the thread-pool at a deadline, and optionally periodically after it. The call does not block.");
 }
@@ -0,0 +1,90 @@
+//------------------------------------------------------------------------------
+// <auto-generated>
+//     This code was generated by a tool.
+//
+//     Changes to this file may cause incorrect behavior and will be lost if
+//     the code is regenerated.
+//
+//     RTGen (PythonGenerator).
+// </auto-generated>
+//------------------------------------------------------------------------------
+
+/*
+ * Copyright 2022-2024 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "py_opendaq/py_opendaq.h"
+#include "py_core_types/py_converter.h"
+
+
+PyDaqIntf<daq::ITimerTask, daq::IBaseObject> declareITimerTask(pybind11::module_ m)
+{
+    return wrapInterface<daq::ITimerTask, daq::IBaseObject>(m, "ITimerTask");
+}
+
+void defineITimerTask(pybind11::module_ m, PyDaqIntf<daq::ITimerTask, daq::IBaseObject> cls)
+{
+    cls.doc() = "A work callback scheduled to run on the thread-pool of the Scheduler at a deadline, and optionally periodically after it.";
+
+    cls.def("cancel",
+        [](daq::ITimerTask *object)
+        {
+            const auto objectPtr = daq::TimerTaskPtr::Borrow(object);
+            objectPtr.cancel();
+        },
+        "Stops the task. Pending executions are discarded.");
+    cls.def_property_readonly("active",
+        [](daq::ITimerTask *object)
+        {
+            const auto objectPtr = daq::TimerTaskPtr::Borrow(object);
+            return objectPtr.isActive();
+        },
+        "Returns whether the task is still scheduled.");
+    cls.def_property_readonly("execution_count",
+        [](daq::ITimerTask *object)
+        {
+            const auto objectPtr = daq::TimerTaskPtr::Borrow(object);
+            return objectPtr.getExecutionCount();
+        },
+        "Gets the number of finished executions.");
+    cls.def_property_readonly("overrun_count",
+        [](daq::ITimerTask *object)
+        {
+            const auto objectPtr = daq::TimerTaskPtr::Borrow(object);
+            return objectPtr.getOverrunCount();
+        },
+        "Gets the number of skipped deadlines.");
+    cls.def_property_readonly("max_jitter",
+        [](daq::ITimerTask *object)
+        {
+            const auto objectPtr = daq::TimerTaskPtr::Borrow(object);
+            return objectPtr.getMaxJitter();
+        },
+        "Gets the largest jitter of the executions since the statistics were reset.");
+    cls.def_property_readonly("mean_jitter",
+        [](daq::ITimerTask *object)
+        {
+            const auto objectPtr = daq::TimerTaskPtr::Borrow(object);
+            return objectPtr.getMeanJitter();
+        },
+        "Gets the mean jitter of the executions since the statistics were reset.");
+    cls.def("reset_statistics",
+        [](daq::ITimerTask *object)
+        {
+            const auto objectPtr = daq::TimerTaskPtr::Borrow(object);
+            objectPtr.resetStatistics();
+        },
+        "Resets the execution and overrun counts, and the jitter statistics.");
+}
@@ -142,7 +142,7 @@ void defineIConnection(pybind11::module_ m, PyDaqIntf<daq::IConnection, daq::IBa
             const auto objectPtr = daq::ConnectionPtr::Borrow(object);
             return objectPtr.getSamplesUntilNextGapPacket();
         },
-        "Gets the number of samples available in the queued packets until the next gap packet. The returned value is up-to the next Gap packet if any.");
+        "Gets the number of samples available in the queued packets until the next gap packet. The returned value is up-to the next Gap packet if any. Packets-dropped event packets count as gap packets.");
     cls.def("has_event_packet",
         [](daq::IConnection *object)
         {
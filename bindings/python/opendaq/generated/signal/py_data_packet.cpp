@@ -28,10 +28,11 @@
 #include "py_opendaq/py_opendaq.h"
 #include "py_core_types/py_converter.h"
 #include "py_core_objects/py_variant_extractor.h"
+#include "py_opendaq/py_data_packet_buffer.h"
 
 PyDaqIntf<daq::IDataPacket, daq::IPacket> declareIDataPacket(pybind11::module_ m)
 {
-    return wrapInterface<daq::IDataPacket, daq::IPacket>(m, "IDataPacket");
+    return wrapInterface<daq::IDataPacket, daq::IPacket>(m, "IDataPacket", py::buffer_protocol());
 }
 
 void defineIDataPacket(pybind11::module_ m, PyDaqIntf<daq::IDataPacket, daq::IPacket> cls)
@@ -75,26 +76,26 @@ void defineIDataPacket(pybind11::module_ m, PyDaqIntf<daq::IDataPacket, daq::IPa
         },
         py::return_value_policy::take_ownership,
         "Gets current packet offset. This offset is later applied to the data rule used by a signal to calculate actual data value. This value is usually a time or other domain value. Packet offset is particularly useful when one wants to transfer a gap in otherwise equidistant samples. If we have a linear data rule, defined by equation f(x) = k*x + n, then the data value will be calculated by the equation g(x) = offset + f(x).");
-    /*
+    cls.def_buffer(
+        [](daq::IDataPacket& object)
+        {
+            const auto objectPtr = daq::DataPacketPtr::Borrow(&object);
+            return getDataPacketBufferInfo(objectPtr, false);
+        });
     cls.def_property_readonly("data",
         [](daq::IDataPacket *object)
         {
             const auto objectPtr = daq::DataPacketPtr::Borrow(object);
-            return objectPtr.getData();
+            return dataPacketToPyArray(objectPtr, false);
         },
-        py::return_value_policy::take_ownership,
-        "Gets the calculated/scaled data address of the packet.");
-    */
-    /*
+        "Gets a read-only NumPy array viewing the calculated/scaled data of the packet. The array keeps the packet alive.");
     cls.def_property_readonly("raw_data",
         [](daq::IDataPacket *object)
         {
             const auto objectPtr = daq::DataPacketPtr::Borrow(object);
-            return objectPtr.getRawData();
+            return dataPacketToPyArray(objectPtr, true);
         },
-        py::return_value_policy::take_ownership,
-        "Gets a pointer to the raw packet data. `nullptr` if the signal's data rule is implicit.");
-    */
+        "Gets a read-only NumPy array viewing the raw packet data. The array keeps the packet alive. Raises an error if the signal's data rule is implicit.");
     cls.def_property_readonly("data_size",
         [](daq::IDataPacket *object)
         {
@@ -46,6 +46,7 @@ void defineIEventPacket(pybind11::module_ m, PyDaqIntf<daq::IEventPacket, daq::I
     m.def("ImplicitDomainGapDetectedEventPacket", [](std::variant<daq::INumber*, double, daq::IEvalValue*>& diff){
         return daq::ImplicitDomainGapDetectedEventPacket_Create(getVariantValue<daq::INumber*>(diff));
     }, py::arg("diff"));
+    m.def("PacketsDroppedEventPacket", &daq::PacketsDroppedEventPacket_Create);
 
 
     cls.def_property_readonly("event_id",
@@ -37,6 +37,17 @@ PyDaqIntf<daq::IInputPortConfig, daq::IInputPort> declareIInputPortConfig(pybind
         .value("Scheduler", daq::PacketReadyNotification::Scheduler)
         .value("SchedulerQueueWasEmpty", daq::PacketReadyNotification::SchedulerQueueWasEmpty);
 
+    py::enum_<daq::QueueLimitUnit>(m, "QueueLimitUnit")
+        .value("Packets", daq::QueueLimitUnit::Packets)
+        .value("Samples", daq::QueueLimitUnit::Samples)
+        .value("Bytes", daq::QueueLimitUnit::Bytes);
+
+    py::enum_<daq::QueueOverflowPolicy>(m, "QueueOverflowPolicy")
+        .value("DropOldest", daq::QueueOverflowPolicy::DropOldest)
+        .value("DropNewest", daq::QueueOverflowPolicy::DropNewest)
+        .value("Block", daq::QueueOverflowPolicy::Block)
+        .value("Coalesce", daq::QueueOverflowPolicy::Coalesce);
+
     return wrapInterface<daq::IInputPortConfig, daq::IInputPort>(m, "IInputPortConfig");
 }
 
@@ -108,4 +119,40 @@ void defineIInputPortConfig(pybind11::module_ m, PyDaqIntf<daq::IInputPortConfig
             return objectPtr.getGapCheckingEnabled();
         },
         "Returns the state of gap checking requested by the input port.");
+    cls.def("set_queue_limit",
+        [](daq::IInputPortConfig *object, const size_t limit, daq::QueueLimitUnit unit, daq::QueueOverflowPolicy policy, const size_t blockTimeoutMs)
+        {
+            const auto objectPtr = daq::InputPortConfigPtr::Borrow(object);
+            objectPtr.setQueueLimit(limit, unit, policy, blockTimeoutMs);
+        },
+        py::arg("limit"), py::arg("unit"), py::arg("policy"), py::arg("block_timeout_ms"),
+        "Limits the packet queue of the connections of the input port.");
+    cls.def_property_readonly("queue_limit",
+        [](daq::IInputPortConfig *object)
+        {
+            const auto objectPtr = daq::InputPortConfigPtr::Borrow(object);
+            return objectPtr.getQueueLimit();
+        },
+        "Gets the largest allowed size of the connection packet queue. Zero if the queue is not limited.");
+    cls.def_property_readonly("queue_limit_unit",
+        [](daq::IInputPortConfig *object)
+        {
+            const auto objectPtr = daq::InputPortConfigPtr::Borrow(object);
+            return objectPtr.getQueueLimitUnit();
+        },
+        "Gets the unit of the connection packet queue limit.");
+    cls.def_property_readonly("queue_overflow_policy",
+        [](daq::IInputPortConfig *object)
+        {
+            const auto objectPtr = daq::InputPortConfigPtr::Borrow(object);
+            return objectPtr.getQueueOverflowPolicy();
+        },
+        "Gets the policy applied to data packets that would exceed the connection packet queue limit.");
+    cls.def_property_readonly("queue_block_timeout",
+        [](daq::IInputPortConfig *object)
+        {
+            const auto objectPtr = daq::InputPortConfigPtr::Borrow(object);
+            return objectPtr.getQueueBlockTimeout();
+        },
+        "Gets how long the sending thread is blocked with the `Block` overflow policy.");
 }
@@ -27,6 +27,7 @@
 
 #include "py_opendaq/py_opendaq.h"
 #include "py_core_types/py_converter.h"
+#include "py_opendaq/py_packet_listener.h"
 
 
 PyDaqIntf<daq::ISignal, daq::IComponent> declareISignal(pybind11::module_ m)
@@ -102,4 +103,13 @@ void defineISignal(pybind11::module_ m, PyDaqIntf<daq::ISignal, daq::IComponent>
         },
         py::return_value_policy::take_ownership,
         "Gets the signal last value");
+    cls.def("on_packet",
+        [](daq::ISignal *object, const py::object& callback)
+        {
+            const auto objectPtr = daq::SignalPtr::Borrow(object);
+            return daq::createPacketListenerPort(objectPtr, callback).detach();
+        },
+        py::arg("callback"),
+        py::return_value_policy::take_ownership,
+        "Calls the callback with a list of the packets sent by the signal, from a scheduler worker thread. Data packets give NumPy views of their data without copying it. Returns the input port receiving the packets; the callback is called until the port is disconnected.");
 }
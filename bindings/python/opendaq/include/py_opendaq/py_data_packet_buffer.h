@@ -0,0 +1,119 @@
+/*
+ * Copyright 2022-2024 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <opendaq/opendaq.h>
+
+#include <pybind11/complex.h>
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+
+#include <complex>
+#include <vector>
+
+namespace py = pybind11;
+
+// gets the buffer format of the samples as understood by the Python buffer protocol and NumPy
+inline std::string sampleTypeToBufferFormat(daq::SampleType sampleType)
+{
+    switch (sampleType)
+    {
+        case daq::SampleType::Float32:
+            return py::format_descriptor<daq::SampleTypeToType<daq::SampleType::Float32>::Type>::format();
+        case daq::SampleType::Float64:
+            return py::format_descriptor<daq::SampleTypeToType<daq::SampleType::Float64>::Type>::format();
+        case daq::SampleType::UInt32:
+            return py::format_descriptor<daq::SampleTypeToType<daq::SampleType::UInt32>::Type>::format();
+        case daq::SampleType::Int32:
+            return py::format_descriptor<daq::SampleTypeToType<daq::SampleType::Int32>::Type>::format();
+        case daq::SampleType::UInt64:
+            return py::format_descriptor<daq::SampleTypeToType<daq::SampleType::UInt64>::Type>::format();
+        case daq::SampleType::Int64:
+        case daq::SampleType::RangeInt64:
+            return py::format_descriptor<daq::SampleTypeToType<daq::SampleType::Int64>::Type>::format();
+        case daq::SampleType::UInt8:
+            return py::format_descriptor<daq::SampleTypeToType<daq::SampleType::UInt8>::Type>::format();
+        case daq::SampleType::Int8:
+            return py::format_descriptor<daq::SampleTypeToType<daq::SampleType::Int8>::Type>::format();
+        case daq::SampleType::UInt16:
+            return py::format_descriptor<daq::SampleTypeToType<daq::SampleType::UInt16>::Type>::format();
+        case daq::SampleType::Int16:
+            return py::format_descriptor<daq::SampleTypeToType<daq::SampleType::Int16>::Type>::format();
+        case daq::SampleType::ComplexFloat32:
+            return py::format_descriptor<std::complex<float>>::format();
+        case daq::SampleType::ComplexFloat64:
+            return py::format_descriptor<std::complex<double>>::format();
+        case daq::SampleType::Undefined:
+        case daq::SampleType::Binary:
+        case daq::SampleType::String:
+        case daq::SampleType::Struct:
+        default:
+            throw daq::InvalidParameterException("Unsupported sample type: " + daq::convertSampleTypeToString(sampleType));
+    }
+}
+
+/// Describes the data of the packet as a read-only buffer, without copying it. Samples with dimensions add an axis
+/// for each dimension, and range samples an axis of length 2 for the range bounds.
+/// @param raw If true, the buffer holds the raw data, before post scaling. Implicit packets have no raw data.
+inline py::buffer_info getDataPacketBufferInfo(const daq::DataPacketPtr& packet, bool raw)
+{
+    const auto descriptor = packet.getDataDescriptor();
+    auto sampleType = descriptor.getSampleType();
+    const auto postScaling = descriptor.getPostScaling();
+    if (raw && postScaling.assigned())
+        sampleType = postScaling.getInputSampleType();
+
+    const auto format = sampleTypeToBufferFormat(sampleType);
+    void* data = raw ? packet.getRawData() : packet.getData();
+    if (data == nullptr)
+        throw daq::InvalidParameterException("The packet has no raw data, the data rule of the signal is implicit");
+
+    std::vector<py::ssize_t> shape{static_cast<py::ssize_t>(packet.getSampleCount())};
+    const auto dimensions = descriptor.getDimensions();
+    if (dimensions.assigned())
+    {
+        for (const auto& dimension : dimensions)
+            shape.push_back(static_cast<py::ssize_t>(dimension.getSize()));
+    }
+    if (sampleType == daq::SampleType::RangeInt64)
+        shape.push_back(2);
+
+    py::ssize_t itemSize = static_cast<py::ssize_t>(daq::getSampleSize(sampleType));
+    if (sampleType == daq::SampleType::RangeInt64)
+        itemSize /= 2;
+
+    std::vector<py::ssize_t> strides(shape.size());
+    py::ssize_t stride = itemSize;
+    for (size_t i = shape.size(); i > 0; i--)
+    {
+        strides[i - 1] = stride;
+        stride *= shape[i - 1];
+    }
+
+    return py::buffer_info(data, itemSize, format, static_cast<py::ssize_t>(shape.size()), shape, strides, true);
+}
+
+/// Creates a read-only NumPy array viewing the data of the packet. The array holds a reference to the packet.
+inline py::array dataPacketToPyArray(const daq::DataPacketPtr& packet, bool raw)
+{
+    const auto info = getDataPacketBufferInfo(packet, raw);
+    auto base = py::capsule(packet.addRefAndReturn(), [](void* p) { static_cast<daq::IDataPacket*>(p)->releaseRef(); });
+
+    py::array array(info, base);
+    array.attr("flags").attr("writeable") = false;
+    return array;
+}
@@ -68,6 +68,7 @@ PyDaqIntf<daq::IGraphVisualization, daq::IBaseObject> declareIGraphVisualization
 PyDaqIntf<daq::IScheduler, daq::IBaseObject> declareIScheduler(pybind11::module_ m);
 PyDaqIntf<daq::ITask, daq::IBaseObject> declareITask(pybind11::module_ m);
 PyDaqIntf<daq::ITaskGraph, daq::ITask> declareITaskGraph(pybind11::module_ m);
+PyDaqIntf<daq::ITimerTask, daq::IBaseObject> declareITimerTask(pybind11::module_ m);
 PyDaqIntf<daq::IDataDescriptor, daq::IBaseObject> declareIDataDescriptor(pybind11::module_ m);
 PyDaqIntf<daq::IDataDescriptorBuilder, daq::IBaseObject> declareIDataDescriptorBuilder(pybind11::module_ m);
 PyDaqIntf<daq::IConnection, daq::IBaseObject> declareIConnection(pybind11::module_ m);
@@ -164,6 +165,7 @@ void defineIGraphVisualization(pybind11::module_ m, PyDaqIntf<daq::IGraphVisuali
 void defineIScheduler(pybind11::module_ m, PyDaqIntf<daq::IScheduler, daq::IBaseObject> cls);
 void defineITask(pybind11::module_ m, PyDaqIntf<daq::ITask, daq::IBaseObject> cls);
 void defineITaskGraph(pybind11::module_ m, PyDaqIntf<daq::ITaskGraph, daq::ITask> cls);
+void defineITimerTask(pybind11::module_ m, PyDaqIntf<daq::ITimerTask, daq::IBaseObject> cls);
 void defineIDataDescriptor(pybind11::module_ m, PyDaqIntf<daq::IDataDescriptor, daq::IBaseObject> cls);
 void defineIDataDescriptorBuilder(pybind11::module_ m, PyDaqIntf<daq::IDataDescriptorBuilder, daq::IBaseObject> cls);
 void defineIConnection(pybind11::module_ m, PyDaqIntf<daq::IConnection, daq::IBaseObject> cls);
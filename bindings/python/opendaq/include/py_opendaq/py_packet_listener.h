@@ -0,0 +1,60 @@
+/*
+ * Copyright 2022-2024 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <opendaq/opendaq.h>
+
+#include <pybind11/pybind11.h>
+
+#include <mutex>
+
+namespace py = pybind11;
+
+BEGIN_NAMESPACE_OPENDAQ
+
+/// Input port listener passing the packets received from a signal to a Python callable. The listener is
+/// notified through the scheduler once packets are queued in an empty connection, and passes all the packets
+/// queued by the time it acquires the GIL as one list, so a slow callback receives larger batches.
+class PyPacketListenerImpl : public ImplementationOfWeak<IInputPortNotifications>
+{
+public:
+    explicit PyPacketListenerImpl(const py::object& callback);
+    ~PyPacketListenerImpl() override;
+
+    // IInputPortNotifications
+    ErrCode INTERFACE_FUNC acceptsSignal(IInputPort* port, ISignal* signal, Bool* accept) override;
+    ErrCode INTERFACE_FUNC connected(IInputPort* port) override;
+    ErrCode INTERFACE_FUNC disconnected(IInputPort* port) override;
+    ErrCode INTERFACE_FUNC packetReceived(IInputPort* port) override;
+
+private:
+    void dispatchPackets();
+
+    py::object callback;
+
+    std::mutex sync;
+    ConnectionPtr connection;
+
+    // serializes the callbacks, acquired before the GIL
+    std::mutex dispatchSync;
+};
+
+/// Connects the signal to a new input port passing the received packets to the callback. The port keeps the
+/// listener alive, and the connection keeps the port alive until it is disconnected.
+InputPortConfigPtr createPacketListenerPort(const SignalPtr& signal, const py::object& callback);
+
+END_NAMESPACE_OPENDAQ
@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <algorithm>
+#include <chrono>
 #include <cstddef>
 #include <type_traits>
 
@@ -55,6 +57,7 @@ struct PyTypedReader
         using StatusType = typename daq::ReaderStatusType<ReaderType>::Type;
         StatusType status;
         size_t tmpCount = 0;
+        py::gil_scoped_release release;
         if constexpr (ReaderHasReadWithTimeout<ReaderType, void>::value)
         {
             reader->read(nullptr, &tmpCount, timeoutMs, &status);
@@ -69,45 +72,16 @@ struct PyTypedReader
     template <typename ReaderType>
     static inline std::tuple<SampleTypeVariant, typename daq::ReaderStatusType<ReaderType>::IType*> readValues(const ReaderType& reader, size_t count, size_t timeoutMs)
     {
+        using ResultType = std::tuple<SampleTypeVariant, typename daq::ReaderStatusType<ReaderType>::IType*>;
         if (count == 0)
         {
             auto status = readZeroValues(reader, timeoutMs);
             return {SampleTypeVariant{}, status.detach()};
         }
 
-        daq::SampleType valueType = daq::SampleType::Undefined;
-        reader->getValueReadType(&valueType);
-        switch (valueType)
-        {
-            case daq::SampleType::Float32:
-                return read<daq::SampleTypeToType<daq::SampleType::Float32>::Type>(reader, count, timeoutMs);
-            case daq::SampleType::Float64:
-                return read<daq::SampleTypeToType<daq::SampleType::Float64>::Type>(reader, count, timeoutMs);
-            case daq::SampleType::UInt32:
-                return read<daq::SampleTypeToType<daq::SampleType::UInt32>::Type>(reader, count, timeoutMs);
-            case daq::SampleType::Int32:
-                return read<daq::SampleTypeToType<daq::SampleType::Int32>::Type>(reader, count, timeoutMs);
-            case daq::SampleType::UInt64:
-                return read<daq::SampleTypeToType<daq::SampleType::UInt64>::Type>(reader, count, timeoutMs);
-            case daq::SampleType::Int64:
-                return read<daq::SampleTypeToType<daq::SampleType::Int64>::Type>(reader, count, timeoutMs);
-            case daq::SampleType::UInt8:
-                return read<daq::SampleTypeToType<daq::SampleType::UInt8>::Type>(reader, count, timeoutMs);
-            case daq::SampleType::Int8:
-                return read<daq::SampleTypeToType<daq::SampleType::Int8>::Type>(reader, count, timeoutMs);
-            case daq::SampleType::UInt16:
-                return read<daq::SampleTypeToType<daq::SampleType::UInt16>::Type>(reader, count, timeoutMs);
-            case daq::SampleType::Int16:
-                return read<daq::SampleTypeToType<daq::SampleType::Int16>::Type>(reader, count, timeoutMs);
-            case daq::SampleType::RangeInt64:
-            case daq::SampleType::ComplexFloat64:
-            case daq::SampleType::ComplexFloat32:
-            case daq::SampleType::Undefined:
-            case daq::SampleType::Binary:
-            case daq::SampleType::String:
-            default:
-                throw std::runtime_error("Unsupported values sample type: " + convertSampleTypeToString(valueType));
-        }
+        return visitSampleType(getValueReadType(reader),
+                               "values",
+                               [&](auto valueTag) -> ResultType { return read<decltype(valueTag)>(reader, count, timeoutMs); });
     }
 
     template <typename ReaderType>
@@ -115,37 +89,161 @@ struct PyTypedReader
                                                                                                              size_t count,
                                                                                                              size_t timeoutMs)
     {
+        using ResultType = std::tuple<SampleTypeVariant, DomainTypeVariant, typename daq::ReaderStatusType<ReaderType>::IType*>;
         if (count == 0)
         {
             auto status = readZeroValues(reader, timeoutMs);
             return {SampleTypeVariant{}, DomainTypeVariant{}, status.detach()};
         }
 
+        return visitSampleType(getValueReadType(reader),
+                               "values",
+                               [&](auto valueTag) -> ResultType
+                               {
+                                   using ValueType = decltype(valueTag);
+                                   if constexpr (std::is_base_of<daq::TimeReaderBase, ReaderType>::value)
+                                   {
+                                       return read<ValueType, std::chrono::system_clock::time_point>(reader, count, timeoutMs);
+                                   }
+                                   else
+                                   {
+                                       return visitSampleType(getDomainReadType(reader),
+                                                              "domain",
+                                                              [&](auto domainTag) -> ResultType
+                                                              { return read<ValueType, decltype(domainTag)>(reader, count, timeoutMs); });
+                                   }
+                               });
+    }
+
+    /// Reads into the preallocated `values` array, laid out as the arrays returned by `readValues`. The count
+    /// of samples (blocks for block readers) to read is given by the shape of the array.
+    /// @return The number of samples actually read and the reader status.
+    template <typename ReaderType>
+    static inline std::tuple<size_t, typename daq::ReaderStatusType<ReaderType>::IType*> readValuesInto(const ReaderType& reader,
+                                                                                      py::array& values,
+                                                                                      size_t timeoutMs)
+    {
+        using ResultType = std::tuple<size_t, typename daq::ReaderStatusType<ReaderType>::IType*>;
+        const size_t blockSize = getBlockSize(reader);
+        size_t count = getArrayCount<ReaderType>(values, blockSize, "values");
+        if (count == 0)
+        {
+            auto status = readZeroValues(reader, timeoutMs);
+            return {0, status.detach()};
+        }
+
+        return visitSampleType(getValueReadType(reader),
+                               "values",
+                               [&](auto valueTag) -> ResultType
+                               {
+                                   using ValueType = decltype(valueTag);
+                                   checkArrayType<ValueType>(values, "values");
+                                   auto status = readInto<ValueType>(reader, values, count, timeoutMs);
+                                   return {count, status.detach()};
+                               });
+    }
+
+    /// Reads into the preallocated `values` and `domain` arrays, laid out as the arrays returned by `readValuesWithDomain`.
+    /// The domain array of a time reader is either a `datetime64[ns]` or an `int64` array of nanoseconds since the epoch.
+    /// @return The number of samples actually read and the reader status.
+    template <typename ReaderType>
+    static inline std::tuple<size_t, typename daq::ReaderStatusType<ReaderType>::IType*> readValuesWithDomainInto(const ReaderType& reader,
+                                                                                                py::array& values,
+                                                                                                py::array& domain,
+                                                                                                size_t timeoutMs)
+    {
+        using ResultType = std::tuple<size_t, typename daq::ReaderStatusType<ReaderType>::IType*>;
+        const size_t blockSize = getBlockSize(reader);
+        size_t count = getArrayCount<ReaderType>(values, blockSize, "values");
+        if (getArrayCount<ReaderType>(domain, blockSize, "domain") != count)
+            throw daq::InvalidParameterException("The values and domain arrays must have the same shape");
+
+        if (count == 0)
+        {
+            auto status = readZeroValues(reader, timeoutMs);
+            return {0, status.detach()};
+        }
+
+        return visitSampleType(
+            getValueReadType(reader),
+            "values",
+            [&](auto valueTag) -> ResultType
+            {
+                using ValueType = decltype(valueTag);
+                checkArrayType<ValueType>(values, "values");
+                if constexpr (std::is_base_of<daq::TimeReaderBase, ReaderType>::value)
+                {
+                    checkTimeArrayType(domain);
+                    auto status = readWithDomainInto<ValueType, std::chrono::system_clock::time_point>(reader, values, domain, count, timeoutMs);
+                    return {count, status.detach()};
+                }
+                else
+                {
+                    return visitSampleType(getDomainReadType(reader),
+                                           "domain",
+                                           [&](auto domainTag) -> ResultType
+                                           {
+                                               using DomainType = decltype(domainTag);
+                                               checkArrayType<DomainType>(domain, "domain");
+                                               auto status = readWithDomainInto<ValueType, DomainType>(reader, values, domain, count, timeoutMs);
+                                               return {count, status.detach()};
+                                           });
+                }
+            });
+    }
+
+    static inline void checkTypes(daq::SampleType valueType, daq::SampleType domainType)
+    {
+        checkSampleType(valueType);
+        checkSampleType(domainType);
+    }
+
+private:
+    template <typename ReaderType>
+    static constexpr bool IsMultiReader = std::is_base_of_v<daq::MultiReaderPtr, ReaderType>;
+
+    template <typename ReaderType>
+    static inline daq::SampleType getValueReadType(const ReaderType& reader)
+    {
         daq::SampleType valueType = daq::SampleType::Undefined;
         reader->getValueReadType(&valueType);
+        return valueType;
+    }
 
-        switch (valueType)
+    template <typename ReaderType>
+    static inline daq::SampleType getDomainReadType(const ReaderType& reader)
+    {
+        daq::SampleType domainType = daq::SampleType::Undefined;
+        reader->getDomainReadType(&domainType);
+        return domainType;
+    }
+
+    // calls the visitor with a value of the C++ type of the sample type
+    template <typename Visitor>
+    static inline decltype(auto) visitSampleType(daq::SampleType sampleType, const std::string& name, Visitor&& visitor)
+    {
+        switch (sampleType)
         {
             case daq::SampleType::Float32:
-                return readWithDomain<daq::SampleTypeToType<daq::SampleType::Float32>::Type>(reader, count, timeoutMs);
+                return visitor(daq::SampleTypeToType<daq::SampleType::Float32>::Type{});
             case daq::SampleType::Float64:
-                return readWithDomain<daq::SampleTypeToType<daq::SampleType::Float64>::Type>(reader, count, timeoutMs);
+                return visitor(daq::SampleTypeToType<daq::SampleType::Float64>::Type{});
             case daq::SampleType::UInt32:
-                return readWithDomain<daq::SampleTypeToType<daq::SampleType::UInt32>::Type>(reader, count, timeoutMs);
+                return visitor(daq::SampleTypeToType<daq::SampleType::UInt32>::Type{});
             case daq::SampleType::Int32:
-                return readWithDomain<daq::SampleTypeToType<daq::SampleType::Int32>::Type>(reader, count, timeoutMs);
+                return visitor(daq::SampleTypeToType<daq::SampleType::Int32>::Type{});
             case daq::SampleType::UInt64:
-                return readWithDomain<daq::SampleTypeToType<daq::SampleType::UInt64>::Type>(reader, count, timeoutMs);
+                return visitor(daq::SampleTypeToType<daq::SampleType::UInt64>::Type{});
             case daq::SampleType::Int64:
-                return readWithDomain<daq::SampleTypeToType<daq::SampleType::Int64>::Type>(reader, count, timeoutMs);
+                return visitor(daq::SampleTypeToType<daq::SampleType::Int64>::Type{});
             case daq::SampleType::UInt8:
-                return readWithDomain<daq::SampleTypeToType<daq::SampleType::UInt8>::Type>(reader, count, timeoutMs);
+                return visitor(daq::SampleTypeToType<daq::SampleType::UInt8>::Type{});
             case daq::SampleType::Int8:
-                return readWithDomain<daq::SampleTypeToType<daq::SampleType::Int8>::Type>(reader, count, timeoutMs);
+                return visitor(daq::SampleTypeToType<daq::SampleType::Int8>::Type{});
             case daq::SampleType::UInt16:
-                return readWithDomain<daq::SampleTypeToType<daq::SampleType::UInt16>::Type>(reader, count, timeoutMs);
+                return visitor(daq::SampleTypeToType<daq::SampleType::UInt16>::Type{});
             case daq::SampleType::Int16:
-                return readWithDomain<daq::SampleTypeToType<daq::SampleType::Int16>::Type>(reader, count, timeoutMs);
+                return visitor(daq::SampleTypeToType<daq::SampleType::Int16>::Type{});
             case daq::SampleType::RangeInt64:
             case daq::SampleType::ComplexFloat64:
             case daq::SampleType::ComplexFloat32:
@@ -153,217 +251,237 @@ struct PyTypedReader
             case daq::SampleType::Binary:
             case daq::SampleType::String:
             default:
-                throw std::runtime_error("Unsupported values sample type: " + convertSampleTypeToString(valueType));
+                throw std::runtime_error("Unsupported " + name + " sample type: " + convertSampleTypeToString(sampleType));
         }
     }
 
-    static inline void checkTypes(daq::SampleType valueType, daq::SampleType domainType)
-    {
-        checkSampleType(valueType);
-        checkSampleType(domainType);
-    }
-
-private:
-    template <typename ValueType, typename ReaderType>
-    static inline std::tuple<SampleTypeVariant, DomainTypeVariant, typename daq::ReaderStatusType<ReaderType>::IType*> readWithDomain(const ReaderType& reader,
-                                                                                                       size_t count,
-                                                                                                       size_t timeoutMs)
+    // samples of each signal for multi readers, samples of each block for block readers
+    template <typename ReaderType>
+    static inline size_t getBlockSize(const ReaderType& reader)
     {
-        if constexpr (std::is_base_of<daq::TimeReaderBase, ReaderType>::value)
+        size_t blockSize = 1;
+        if constexpr (std::is_base_of_v<daq::BlockReaderPtr, ReaderType>)
         {
-            return read<ValueType, std::chrono::system_clock::time_point>(reader, count, timeoutMs);
+            reader->getBlockSize(&blockSize);
         }
-        else
+        if constexpr (IsMultiReader<ReaderType>)
         {
-            daq::SampleType domainType = daq::SampleType::Undefined;
-            reader->getDomainReadType(&domainType);
-            switch (domainType)
-            {
-                case daq::SampleType::Float32:
-                    return read<ValueType, daq::SampleTypeToType<daq::SampleType::Float32>::Type>(reader, count, timeoutMs);
-                case daq::SampleType::Float64:
-                    return read<ValueType, daq::SampleTypeToType<daq::SampleType::Float64>::Type>(reader, count, timeoutMs);
-                case daq::SampleType::UInt32:
-                    return read<ValueType, daq::SampleTypeToType<daq::SampleType::UInt32>::Type>(reader, count, timeoutMs);
-                case daq::SampleType::Int32:
-                    return read<ValueType, daq::SampleTypeToType<daq::SampleType::Int32>::Type>(reader, count, timeoutMs);
-                case daq::SampleType::UInt64:
-                    return read<ValueType, daq::SampleTypeToType<daq::SampleType::UInt64>::Type>(reader, count, timeoutMs);
-                case daq::SampleType::Int64:
-                    return read<ValueType, daq::SampleTypeToType<daq::SampleType::Int64>::Type>(reader, count, timeoutMs);
-                case daq::SampleType::UInt8:
-                    return read<ValueType, daq::SampleTypeToType<daq::SampleType::UInt8>::Type>(reader, count, timeoutMs);
-                case daq::SampleType::Int8:
-                    return read<ValueType, daq::SampleTypeToType<daq::SampleType::Int8>::Type>(reader, count, timeoutMs);
-                case daq::SampleType::UInt16:
-                    return read<ValueType, daq::SampleTypeToType<daq::SampleType::UInt16>::Type>(reader, count, timeoutMs);
-                case daq::SampleType::Int16:
-                    return read<ValueType, daq::SampleTypeToType<daq::SampleType::Int16>::Type>(reader, count, timeoutMs);
-                case daq::SampleType::RangeInt64:
-                case daq::SampleType::ComplexFloat64:
-                case daq::SampleType::ComplexFloat32:
-                case daq::SampleType::Undefined:
-                case daq::SampleType::Binary:
-                case daq::SampleType::String:
-                default:
-                    throw std::runtime_error("Unsupported domain sample type: " + convertSampleTypeToString(domainType));
-            }
+            daq::ReaderConfigPtr readerConfig = reader.template asPtr<daq::IReaderConfig>();
+            blockSize = readerConfig.getInputPorts().getCount();
         }
+        return blockSize;
     }
 
-    template <typename ValueType, typename ReaderType>
-    static inline std::tuple<SampleTypeVariant, typename daq::ReaderStatusType<ReaderType>::IType*> read(const ReaderType& reader,
-                                                                          size_t count,
-                                                                          [[maybe_unused]] size_t timeoutMs)
+    // multi readers return a row of samples per signal, block readers a row of samples per block
+    template <typename ReaderType>
+    static inline size_t getCountAxis(size_t blockSize)
     {
-        size_t blockSize = 1, initialCount = count;
-        constexpr const bool isMultiReader = std::is_base_of_v<daq::MultiReaderPtr, ReaderType>;
+        return IsMultiReader<ReaderType> && blockSize > 1 ? 1 : 0;
+    }
 
-        if constexpr (std::is_same_v<ReaderType, daq::BlockReaderPtr>)
-        {
-            reader->getBlockSize(&blockSize);
-        }
-        if constexpr (isMultiReader)
+    template <typename ElementType, typename ReaderType>
+    static inline py::array_t<ElementType> createArray(size_t count, size_t blockSize)
+    {
+        std::vector<py::ssize_t> shape;
+        if (blockSize == 1)
+            shape = {static_cast<py::ssize_t>(count)};
+        else if constexpr (IsMultiReader<ReaderType>)
+            shape = {static_cast<py::ssize_t>(blockSize), static_cast<py::ssize_t>(count)};
+        else
+            shape = {static_cast<py::ssize_t>(count), static_cast<py::ssize_t>(blockSize)};
+
+        return py::array_t<ElementType>(shape);
+    }
+
+    // returns a view of the part of the array actually read, sharing the buffer of the array
+    template <typename ElementType>
+    static inline py::array_t<ElementType> sliceArray(const py::array_t<ElementType>& array, size_t countAxis, size_t count)
+    {
+        if (static_cast<size_t>(array.shape(countAxis)) == count)
+            return array;
+
+        std::vector<py::ssize_t> shape(array.shape(), array.shape() + array.ndim());
+        std::vector<py::ssize_t> strides(array.strides(), array.strides() + array.ndim());
+        shape[countAxis] = static_cast<py::ssize_t>(count);
+        return py::array_t<ElementType>(shape, strides, array.data(), array);
+    }
+
+    static inline std::vector<void*> getRowPointers(py::array& array)
+    {
+        auto data = static_cast<uint8_t*>(array.mutable_data());
+        std::vector<void*> rows(array.ndim() == 1 ? 1 : array.shape(0));
+        for (size_t i = 0; i < rows.size(); i++)
+            rows[i] = data + i * array.strides(0);
+        return rows;
+    }
+
+    // gets the number of samples (blocks for block readers) the array can hold
+    template <typename ReaderType>
+    static inline size_t getArrayCount(const py::array& array, size_t blockSize, const std::string& name)
+    {
+        if (!array.writeable())
+            throw daq::InvalidParameterException("The " + name + " array is not writeable");
+
+        const auto itemSize = array.itemsize();
+        if (blockSize == 1)
         {
-            daq::ReaderConfigPtr readerConfig = reader.template asPtr<daq::IReaderConfig>();
-            blockSize = readerConfig.getInputPorts().getCount();
+            if (array.ndim() != 1 || (array.shape(0) > 1 && array.strides(0) != itemSize))
+                throw daq::InvalidParameterException("The " + name + " array must be a contiguous one-dimensional array");
+            return array.shape(0);
         }
 
-        using StatusType = typename daq::ReaderStatusType<ReaderType>::Type;
-        StatusType status;
-        std::vector<ValueType> values(count * blockSize);
-        if constexpr (ReaderHasReadWithTimeout<ReaderType, ValueType>::value)
+        if (array.ndim() != 2)
+            throw daq::InvalidParameterException("The " + name + " array must be a two-dimensional array");
+
+        if constexpr (IsMultiReader<ReaderType>)
         {
-            if constexpr (isMultiReader)
-            {
-                std::vector<void*> ptrs(blockSize);
-                for (size_t i = 0; i < blockSize; i++)
-                {
-                    ptrs[i] = values.data() + i * count;
-                }
-                reader->read(ptrs.data(), &count, timeoutMs, &status);
-            }
-            else
-            {
-                reader->read(values.data(), &count, timeoutMs, &status);
-            }
+            // rows of signals may be apart, samples of a signal must be contiguous
+            if (static_cast<size_t>(array.shape(0)) != blockSize || (array.shape(1) > 1 && array.strides(1) != itemSize))
+                throw daq::InvalidParameterException("The " + name + " array must hold a contiguous row of samples for each signal");
+            return array.shape(1);
         }
         else
         {
-            reader->read(values.data(), &count, &status);
-        }
-
-        py::array::ShapeContainer shape;
-        if (blockSize > 1)
-        {
-            if (!isMultiReader)
-            {
-                shape = {count, blockSize};
-            }
-            else
-            {
-                shape = {blockSize, count};
-            }
+            if (static_cast<size_t>(array.shape(1)) != blockSize || !(array.flags() & py::array::c_style))
+                throw daq::InvalidParameterException("The " + name + " array must be a C-contiguous array of blocks");
+            return array.shape(0);
         }
-        else
-            shape = {count};
+    }
 
-        py::array::StridesContainer strides;
-        if (blockSize > 1 && isMultiReader)
-            strides = {sizeof(ValueType) * initialCount, sizeof(ValueType)};
+    template <typename ElementType>
+    static inline void checkArrayType(const py::array& array, const std::string& name)
+    {
+        if (!py::array_t<ElementType>::check_(array))
+            throw daq::InvalidParameterException("The dtype of the " + name + " array does not match the read type of the reader");
+    }
 
-        return {toPyArray(std::move(values), shape, strides), status.detach()};
+    static inline void checkTimeArrayType(const py::array& array)
+    {
+        if (!py::array_t<int64_t>::check_(array) && py::str(array.dtype()).cast<std::string>() != "datetime64[ns]")
+            throw daq::InvalidParameterException("The domain array of a time reader must be a datetime64[ns] or int64 array");
     }
 
-    template <typename ValueType, typename DomainType, typename ReaderType>
-    static inline std::tuple<SampleTypeVariant, DomainTypeVariant, typename daq::ReaderStatusType<ReaderType>::IType*> read(const ReaderType& reader,
-                                                                                             size_t count,
-                                                                                             [[maybe_unused]] size_t timeoutMs)
+    static inline void convertTimePoints(void* data, size_t count)
     {
         static_assert(sizeof(std::chrono::system_clock::time_point::rep) == sizeof(int64_t));
-        using DomainVectorType = typename std::conditional<std::is_same<DomainType, std::chrono::system_clock::time_point>::value,
-                                                           std::vector<int64_t>,
-                                                           std::vector<DomainType>>::type;
 
-        size_t blockSize = 1, initialCount = count;
-        constexpr const bool isMultiReader = std::is_base_of_v<daq::MultiReaderPtr, ReaderType>;
-        if constexpr (std::is_base_of_v<daq::BlockReaderPtr, ReaderType>)
-        {
-            reader->getBlockSize(&blockSize);
-        }
-        if constexpr (isMultiReader)
-        {
-            daq::ReaderConfigPtr readerConfig = reader.template asPtr<daq::IReaderConfig>();
-            blockSize = readerConfig.getInputPorts().getCount();
-        }
+        auto timestamps = static_cast<int64_t*>(data);
+        std::transform(timestamps,
+                       timestamps + count,
+                       timestamps,
+                       [](int64_t timestamp)
+                       {
+                           const auto t = std::chrono::system_clock::time_point(std::chrono::system_clock::duration(timestamp));
+                           return std::chrono::duration_cast<std::chrono::nanoseconds>(t.time_since_epoch()).count();
+                       });
+    }
 
+    // reads directly into the buffer of the array with the GIL released
+    template <typename ValueType, typename ReaderType>
+    static inline typename daq::ReaderStatusType<ReaderType>::Type readInto(const ReaderType& reader,
+                                                                            py::array& values,
+                                                                            size_t& count,
+                                                                            [[maybe_unused]] size_t timeoutMs)
+    {
         using StatusType = typename daq::ReaderStatusType<ReaderType>::Type;
         StatusType status;
-        std::vector<ValueType> values(count * blockSize);
-        DomainVectorType domain(count * blockSize);
         if constexpr (ReaderHasReadWithTimeout<ReaderType, ValueType>::value)
         {
-            if constexpr (isMultiReader)
+            if constexpr (IsMultiReader<ReaderType>)
             {
-                std::vector<void*> valuesPtrs(blockSize), domainPtrs(blockSize);
-                for (size_t i = 0; i < blockSize; i++)
-                {
-                    valuesPtrs[i] = values.data() + i * count;
-                    domainPtrs[i] = domain.data() + i * count;
-                }
-                reader->readWithDomain(valuesPtrs.data(), domainPtrs.data(), &count, timeoutMs, &status);
+                auto valuesPtrs = getRowPointers(values);
+                py::gil_scoped_release release;
+                reader->read(valuesPtrs.data(), &count, timeoutMs, &status);
             }
             else
             {
-                reader->readWithDomain(values.data(), domain.data(), &count, timeoutMs, &status);
+                void* valuesPtr = values.mutable_data();
+                py::gil_scoped_release release;
+                reader->read(valuesPtr, &count, timeoutMs, &status);
             }
         }
         else
         {
-            reader->readWithDomain(values.data(), domain.data(), &count, &status);
+            void* valuesPtr = values.mutable_data();
+            py::gil_scoped_release release;
+            reader->read(valuesPtr, &count, &status);
         }
+        return status;
+    }
 
-        py::array::ShapeContainer shape;
-        if (blockSize > 1)
+    // reads directly into the buffers of the arrays with the GIL released, time points are converted to nanoseconds in place
+    template <typename ValueType, typename DomainType, typename ReaderType>
+    static inline typename daq::ReaderStatusType<ReaderType>::Type readWithDomainInto(const ReaderType& reader,
+                                                                                      py::array& values,
+                                                                                      py::array& domain,
+                                                                                      size_t& count,
+                                                                                      [[maybe_unused]] size_t timeoutMs)
+    {
+        constexpr const bool isTimeDomain = std::is_same_v<DomainType, std::chrono::system_clock::time_point>;
+
+        using StatusType = typename daq::ReaderStatusType<ReaderType>::Type;
+        StatusType status;
+        if constexpr (ReaderHasReadWithTimeout<ReaderType, ValueType>::value && IsMultiReader<ReaderType>)
         {
-            if (!isMultiReader)
+            auto valuesPtrs = getRowPointers(values);
+            auto domainPtrs = getRowPointers(domain);
+            py::gil_scoped_release release;
+            reader->readWithDomain(valuesPtrs.data(), domainPtrs.data(), &count, timeoutMs, &status);
+            if constexpr (isTimeDomain)
             {
-                shape = {count, blockSize};
-            }
-            else
-            {
-                shape = {blockSize, count};
+                for (auto domainPtr : domainPtrs)
+                    convertTimePoints(domainPtr, count);
             }
         }
         else
-            shape = {count};
-
-        py::array::StridesContainer strides;
-        if (blockSize > 1 && isMultiReader)
         {
-            strides = {sizeof(ValueType) * initialCount, sizeof(ValueType)};
-        }
+            void* valuesPtr = values.mutable_data();
+            void* domainPtr = domain.mutable_data();
+            const size_t blockSize = values.ndim() == 1 ? 1 : values.shape(1);
+            py::gil_scoped_release release;
+            if constexpr (ReaderHasReadWithTimeout<ReaderType, ValueType>::value)
+                reader->readWithDomain(valuesPtr, domainPtr, &count, timeoutMs, &status);
+            else
+                reader->readWithDomain(valuesPtr, domainPtr, &count, &status);
 
-        std::string domainDtype;
-        if constexpr (std::is_same_v<DomainType, std::chrono::system_clock::time_point>)
-        {
-            domainDtype = "datetime64[ns]";
-            std::transform(domain.begin(),
-                           domain.end(),
-                           domain.begin(),
-                           [](int64_t timestamp)
-                           {
-                               const auto t = std::chrono::system_clock::time_point(std::chrono::system_clock::duration(timestamp));
-                               return std::chrono::duration_cast<std::chrono::nanoseconds>(t.time_since_epoch()).count();
-                           });
+            if constexpr (isTimeDomain)
+                convertTimePoints(domainPtr, count * blockSize);
         }
+        return status;
+    }
+
+    template <typename ValueType, typename ReaderType>
+    static inline std::tuple<SampleTypeVariant, typename daq::ReaderStatusType<ReaderType>::IType*> read(const ReaderType& reader,
+                                                                          size_t count,
+                                                                          size_t timeoutMs)
+    {
+        const size_t blockSize = getBlockSize(reader);
+        auto values = createArray<ValueType, ReaderType>(count, blockSize);
+        auto status = readInto<ValueType>(reader, values, count, timeoutMs);
+
+        return {sliceArray(values, getCountAxis<ReaderType>(blockSize), count), status.detach()};
+    }
+
+    template <typename ValueType, typename DomainType, typename ReaderType>
+    static inline std::tuple<SampleTypeVariant, DomainTypeVariant, typename daq::ReaderStatusType<ReaderType>::IType*> read(const ReaderType& reader,
+                                                                                             size_t count,
+                                                                                             size_t timeoutMs)
+    {
+        constexpr const bool isTimeDomain = std::is_same_v<DomainType, std::chrono::system_clock::time_point>;
+        using DomainElementType = std::conditional_t<isTimeDomain, int64_t, DomainType>;
+
+        const size_t blockSize = getBlockSize(reader);
+        auto values = createArray<ValueType, ReaderType>(count, blockSize);
+        auto domain = createArray<DomainElementType, ReaderType>(count, blockSize);
+        auto status = readWithDomainInto<ValueType, DomainType>(reader, values, domain, count, timeoutMs);
 
-        auto valuesArray = toPyArray(std::move(values), shape, strides);
-        auto domainArray = toPyArray(std::move(domain), shape, strides, domainDtype);
+        const size_t countAxis = getCountAxis<ReaderType>(blockSize);
+        auto valuesArray = sliceArray(values, countAxis, count);
+        auto domainArray = sliceArray(domain, countAxis, count);
 
         // WA for datetime64
-        if (!domainDtype.empty())
-            domainArray.attr("dtype") = domainDtype;
+        if constexpr (isTimeDomain)
+            domainArray.attr("dtype") = "datetime64[ns]";
 
         return {std::move(valuesArray), std::move(domainArray), status.detach()};
     }
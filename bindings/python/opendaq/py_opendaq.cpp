@@ -75,6 +75,7 @@ void wrapDaqComponentOpenDaq(pybind11::module_ m)
     auto classIScheduler = declareIScheduler(m);
     auto classITask = declareITask(m);
     auto classITaskGraph = declareITaskGraph(m);
+    auto classITimerTask = declareITimerTask(m);
     auto classIDataDescriptor = declareIDataDescriptor(m);
     auto classIDataDescriptorBuilder = declareIDataDescriptorBuilder(m);
     auto classIConnection = declareIConnection(m);
@@ -166,6 +167,7 @@ void wrapDaqComponentOpenDaq(pybind11::module_ m)
     defineIScheduler(m, classIScheduler);
     defineITask(m, classITask);
     defineITaskGraph(m, classITaskGraph);
+    defineITimerTask(m, classITimerTask);
     defineIDataDescriptor(m, classIDataDescriptor);
     defineIDataDescriptorBuilder(m, classIDataDescriptorBuilder);
     defineIConnection(m, classIConnection);
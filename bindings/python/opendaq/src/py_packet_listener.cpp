@@ -0,0 +1,103 @@
+#include "py_opendaq/py_packet_listener.h"
+#include "py_core_types/py_converter.h"
+
+BEGIN_NAMESPACE_OPENDAQ
+
+PyPacketListenerImpl::PyPacketListenerImpl(const py::object& callback)
+    : callback(callback)
+{
+}
+
+PyPacketListenerImpl::~PyPacketListenerImpl()
+{
+    // the last reference can be released by a scheduler worker, which does not hold the GIL
+    if (Py_IsInitialized())
+    {
+        py::gil_scoped_acquire acquire;
+        callback = py::object();
+    }
+    else
+    {
+        callback.release();
+    }
+}
+
+ErrCode PyPacketListenerImpl::acceptsSignal(IInputPort* /*port*/, ISignal* /*signal*/, Bool* accept)
+{
+    OPENDAQ_PARAM_NOT_NULL(accept);
+
+    *accept = true;
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode PyPacketListenerImpl::connected(IInputPort* port)
+{
+    OPENDAQ_PARAM_NOT_NULL(port);
+
+    std::scoped_lock lock(sync);
+    return port->getConnection(&connection);
+}
+
+ErrCode PyPacketListenerImpl::disconnected(IInputPort* port)
+{
+    OPENDAQ_PARAM_NOT_NULL(port);
+
+    std::scoped_lock lock(sync);
+    connection = nullptr;
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode PyPacketListenerImpl::packetReceived(IInputPort* /*port*/)
+{
+    return daqTry([this] { dispatchPackets(); });
+}
+
+void PyPacketListenerImpl::dispatchPackets()
+{
+    ConnectionPtr conn;
+    {
+        std::scoped_lock lock(sync);
+        conn = connection;
+    }
+
+    if (!conn.assigned())
+        return;
+
+    std::scoped_lock dispatchLock(dispatchSync);
+    py::gil_scoped_acquire acquire;
+
+    const auto packets = conn.dequeueAll();
+    if (packets.getCount() == 0)
+        return;
+
+    py::list pyPackets(packets.getCount());
+    for (size_t i = 0; i < packets.getCount(); i++)
+        pyPackets[i] = baseObjectToPyObject(packets.getItemAt(i));
+
+    try
+    {
+        callback(pyPackets);
+    }
+    catch (py::error_already_set& e)
+    {
+        // reported like exceptions raised in other callbacks without a caller, the packet stream continues
+        e.discard_as_unraisable("on_packet callback");
+    }
+}
+
+InputPortConfigPtr createPacketListenerPort(const SignalPtr& signal, const py::object& callback)
+{
+    if (!signal.assigned())
+        throw ArgumentNullException("Signal must not be null.");
+
+    const InputPortNotificationsPtr listener = createWithImplementation<IInputPortNotifications, PyPacketListenerImpl>(callback);
+
+    auto port = InputPort(signal.getContext(), nullptr, "on_packet");
+    port.setCustomData(listener);
+    port.setListener(listener);
+    port.setNotificationMethod(PacketReadyNotification::SchedulerQueueWasEmpty);
+    port.connect(signal);
+    return port;
+}
+
+END_NAMESPACE_OPENDAQ
@@ -0,0 +1,68 @@
+#!/usr/bin/env python
+
+import time
+import unittest
+import opendaq_test
+import opendaq
+import numpy
+
+
+class TestDataPacket(opendaq_test.TestCase):
+
+    def receive_data_packets(self, mock, data):
+        received = []
+        port = mock.signal.on_packet(lambda packets: received.extend(packets))
+        mock.add_data(data)
+
+        # packets are delivered from a scheduler worker once the GIL is released
+        timeout = time.time() + 5
+        while not any(isinstance(p, opendaq.IDataPacket) for p in received) and time.time() < timeout:
+            time.sleep(0.01)
+
+        port.disconnect()
+        return [p for p in received if isinstance(p, opendaq.IDataPacket)]
+
+    def test_on_packet(self):
+        mock = opendaq.MockSignal()
+        packets = self.receive_data_packets(mock, numpy.arange(10))
+
+        self.assertEqual(len(packets), 1)
+        self.assertEqual(packets[0].sample_count, 10)
+        self.assertTrue(numpy.array_equal(packets[0].data, numpy.arange(10)))
+
+    def test_buffer_protocol(self):
+        mock = opendaq.MockSignal()
+        packet = self.receive_data_packets(mock, numpy.arange(10))[0]
+
+        view = memoryview(packet)
+        self.assertTrue(view.readonly)
+        self.assertEqual(view.shape, (10,))
+
+        values = numpy.asarray(packet)
+        self.assertEqual(values.dtype, numpy.float64)
+        self.assertTrue(numpy.array_equal(values, numpy.arange(10)))
+
+    def test_data_keeps_packet_alive(self):
+        mock = opendaq.MockSignal()
+        packets = self.receive_data_packets(mock, numpy.arange(10))
+
+        values = packets[0].raw_data
+        del packets
+
+        self.assertFalse(values.flags.writeable)
+        self.assertTrue(numpy.array_equal(values, numpy.arange(10)))
+
+    def test_implicit_domain_data(self):
+        mock = opendaq.MockSignal()
+        packet = self.receive_data_packets(mock, numpy.arange(10))[0]
+
+        domain = packet.domain_packet.data
+        self.assertEqual(domain.dtype, numpy.int64)
+        self.assertTrue(numpy.array_equal(domain, numpy.arange(10)))
+
+        with self.assertRaises(RuntimeError):
+            packet.domain_packet.raw_data
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -392,5 +392,127 @@ class TestReaderDateTime(opendaq_test.TestCase):
             self.assertIsInstance(v, numpy.int64)
 
 
+    def test_read_into(self):
+        mock = opendaq.MockSignal()
+        reader = opendaq.StreamReader(mock.signal)
+        reader.read(0)
+
+        mock.add_data(numpy.arange(10))
+
+        values = numpy.zeros(16)
+        count, status = reader.read_into(values)
+        self.assertTrue(status.read_status == opendaq.ReadStatus.Ok)
+        self.assertEqual(count, 10)
+        self.assertTrue(numpy.array_equal(values[:count], numpy.arange(10)))
+
+    def test_read_into_wrong_dtype(self):
+        mock = opendaq.MockSignal()
+        reader = opendaq.StreamReader(mock.signal)
+        reader.read(0)
+
+        mock.add_data(numpy.arange(10))
+
+        with self.assertRaises(RuntimeError):
+            reader.read_into(numpy.zeros(10, dtype=numpy.int32))
+        with self.assertRaises(RuntimeError):
+            reader.read_into(numpy.zeros(20)[::2])
+        self.assertEqual(reader.available_count, 10)
+
+    def test_read_with_domain_into(self):
+        mock = opendaq.MockSignal()
+        reader = opendaq.StreamReader(mock.signal)
+        reader.read(0)
+
+        mock.add_data(numpy.arange(10))
+
+        values = numpy.zeros(10)
+        domain = numpy.zeros(10, dtype=numpy.int64)
+        count, status = reader.read_with_domain_into(values, domain)
+        self.assertTrue(status.read_status == opendaq.ReadStatus.Ok)
+        self.assertEqual(count, 10)
+        self.assertTrue(numpy.array_equal(values, numpy.arange(10)))
+
+        self.assertTrue(numpy.all(numpy.diff(domain) > 0))
+
+    def test_read_with_timestamps_into(self):
+        mock = opendaq.MockSignal()
+        stream = opendaq.StreamReader(mock.signal)
+        stream.read(0)
+        reader = opendaq.TimeStreamReader(stream)
+
+        mock.add_data(numpy.arange(10))
+
+        values = numpy.zeros(10)
+        timestamps = numpy.zeros(10, dtype='datetime64[ns]')
+        count, status = reader.read_with_timestamps_into(values, timestamps)
+        self.assertTrue(status.read_status == opendaq.ReadStatus.Ok)
+        self.assertEqual(count, 10)
+        self.assertTrue(numpy.array_equal(values, numpy.arange(10)))
+        self.assertTrue(numpy.all(timestamps > numpy.datetime64('2000-01-01')))
+
+    def test_block_read_into(self):
+        mock = opendaq.MockSignal()
+        reader = opendaq.BlockReader(mock.signal, 2)
+        reader.read(0)
+
+        mock.add_data(numpy.arange(10))
+
+        values = numpy.zeros((5, 2))
+        count, status = reader.read_into(values)
+        self.assertTrue(status.read_status == opendaq.ReadStatus.Ok)
+        self.assertEqual(count, 5)
+        self.assertTrue(numpy.array_equal(
+            values, numpy.arange(10).reshape(5, 2)))
+
+    def test_multireader_read_into_strided(self):
+        epoch = opendaq.MockSignal.current_epoch()
+
+        sig1 = opendaq.MockSignal('sig1', epoch)
+        sig2 = opendaq.MockSignal('sig2', epoch)
+
+        sigs = opendaq.List()
+        sigs.append(sig1.signal)
+        sigs.append(sig2.signal)
+
+        reader = opendaq.MultiReader(sigs)
+        reader.read(0)
+
+        nparray = numpy.arange(10)
+        sig1.add_data(nparray)
+        sig2.add_data(nparray)
+
+        # rows of a larger buffer, each signal is written to every other row
+        buffer = numpy.zeros((4, 10))
+        values = buffer[::2]
+        count, status = reader.read_into(values)
+        self.assertTrue(status.read_status == opendaq.ReadStatus.Ok)
+        self.assertEqual(count, 10)
+        self.assertTrue(numpy.array_equal(buffer[0], numpy.arange(10)))
+        self.assertTrue(numpy.array_equal(buffer[2], numpy.arange(10)))
+        self.assertTrue(numpy.array_equal(buffer[1], numpy.zeros(10)))
+
+    def test_multireader_read_partial(self):
+        epoch = opendaq.MockSignal.current_epoch()
+
+        sig1 = opendaq.MockSignal('sig1', epoch)
+        sig2 = opendaq.MockSignal('sig2', epoch)
+
+        sigs = opendaq.List()
+        sigs.append(sig1.signal)
+        sigs.append(sig2.signal)
+
+        reader = opendaq.MultiReader(sigs)
+        reader.read(0)
+
+        nparray = numpy.arange(10)
+        sig1.add_data(nparray)
+        sig2.add_data(nparray)
+
+        values, status = reader.read(20)
+        self.assertTrue(status.valid)
+        self.assertEqual(values.shape, (2, 10))
+        self.assertTrue(numpy.array_equal(values[1], numpy.arange(10)))
+
+
 if __name__ == '__main__':
     unittest.main()
@@ -109,3 +109,35 @@ function(opendaq_prepare_test_runner TEST_TARGET)
 
     set(${TEST_TARGET} ${TEST_RUNNER} PARENT_SCOPE)
 endfunction()
+
+function(opendaq_prepare_benchmark_runner BENCH_TARGET)
+    set(options "")
+    set(oneValueArgs FROM)
+    set(multiValueArgs SOURCES)
+    cmake_parse_arguments(RUNNER "${options}" "${oneValueArgs}" "${multiValueArgs}" ${ARGN})
+
+    if (NOT DEFINED RUNNER_FROM)
+        message(FATAL_ERROR "opendaq_prepare_benchmark_runner() requires the test runner to build like to be specified with FROM.")
+    endif()
+
+    if (NOT DEFINED RUNNER_SOURCES)
+        message(FATAL_ERROR "No SOURCES given to opendaq_prepare_benchmark_runner().")
+    endif()
+
+    string(REGEX REPLACE "^test_" "bench_" BENCH_RUNNER ${RUNNER_FROM})
+    add_executable(${BENCH_RUNNER} ${RUNNER_SOURCES})
+
+    set_target_properties(${BENCH_RUNNER} PROPERTIES DEBUG_POSTFIX _debug)
+
+    # Built with the same settings as the test runner, but not registered with CTest
+    foreach(PROPERTY LINK_LIBRARIES INCLUDE_DIRECTORIES COMPILE_DEFINITIONS COMPILE_OPTIONS)
+        get_target_property(PROPERTY_VALUE ${RUNNER_FROM} ${PROPERTY})
+        if (PROPERTY_VALUE)
+            set_property(TARGET ${BENCH_RUNNER} PROPERTY ${PROPERTY} ${PROPERTY_VALUE})
+        endif()
+    endforeach()
+
+    add_dependencies(${BENCH_RUNNER} ${RUNNER_FROM})
+
+    set(${BENCH_TARGET} ${BENCH_RUNNER} PARENT_SCOPE)
+endfunction()
@@ -3,6 +3,7 @@
 #include <coreobjects/property_object_class_builder_impl.h>
 #include <coreobjects/property_object_class_factory.h>
 #include <coreobjects/property_ptr.h>
+#include <coretypes/stringobject_factory.h>
 #include <coretypes/type_manager_factory.h>
 
 #include <utility>
@@ -83,7 +84,9 @@ ErrCode PropertyObjectClassBuilderImpl::addProperty(IProperty* property)
 
         if (props.hasKey(p.getName()))
             return makeErrorInfo(OPENDAQ_ERR_ALREADYEXISTS, fmt::format(R"(Property with name {} already exists)", p.getName()));
-        props.set(p.getName(), p);
+
+        // the property names of classes come from type definitions, so they are interned
+        props.set(InternedString(p.getName()), p);
 
         return OPENDAQ_SUCCESS;
     });
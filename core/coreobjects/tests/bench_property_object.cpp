@@ -0,0 +1,28 @@
+#include <gtest/gtest.h>
+#include <coreobjects/property_object_factory.h>
+#include <coreobjects/property_factory.h>
+#include <chrono>
+
+using namespace daq;
+
+using PropertyObjectBenchmark = testing::Test;
+
+TEST_F(PropertyObjectBenchmark, GetSetValueRate)
+{
+    const auto propObj = PropertyObject();
+    for (int i = 0; i < 32; ++i)
+        propObj.addProperty(IntProperty("IntProperty" + std::to_string(i), 0));
+
+    const auto name = String("IntProperty16");
+    constexpr Int iterations = 100000;
+
+    const auto start = std::chrono::steady_clock::now();
+    for (Int i = 0; i < iterations; ++i)
+    {
+        propObj.setPropertyValue(name, i);
+        ASSERT_EQ(propObj.getPropertyValue(name), i);
+    }
+    const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    RecordProperty("GetSetPerSecond", std::to_string(static_cast<int64_t>(iterations / elapsed)));
+}
@@ -53,6 +53,17 @@ TEST_F(PropertyObjectClassTest, Get)
     ASSERT_THROW(propObjClass.getProperty("Name1"), NotFoundException);
 }
 
+TEST_F(PropertyObjectClassTest, InternedPropertyNames)
+{
+    const auto props = propObjClassBuilder.getProperties();
+    for (const auto& name : props.getKeyList())
+        ASSERT_EQ(name.getObject(), InternedString(name).getObject());
+
+    // properties created outside of a class keep their own name
+    const auto name = String("NotInterned");
+    ASSERT_EQ(IntProperty(name, 0).getName().getObject(), name.getObject());
+}
+
 TEST_F(PropertyObjectClassTest, EnumProps)
 {
     auto props = propObjClass.getProperties(false);
@@ -44,7 +44,15 @@ BEGIN_NAMESPACE_OPENDAQ
  *
  * // Creates a new String object. Returns error code if not successful.
  * ErrCode createStringN(IString** obj, ConstCharPtr data, SizeT length)
+ *
+ * // Gets the interned String object with the value. Returns error code if not successful.
+ * ErrCode createInternedString(IString** obj, ConstCharPtr data, SizeT length)
  * @endcode
+ *
+ * Strings store their length, and short strings are stored within the object. Interned strings
+ * are shared by all users of the same value and are never released; they are meant for identifiers
+ * from a bounded set, such as the property names of classes. Comparing two interned strings of
+ * the same value is a pointer comparison.
  */
 DECLARE_OPENDAQ_INTERFACE(IString, IBaseObject)
 {
@@ -80,5 +88,13 @@ OPENDAQ_DECLARE_CLASS_FACTORY_WITH_INTERFACE_AND_CREATEFUNC(
     ConstCharPtr, str,
     SizeT, length
 )
+OPENDAQ_DECLARE_CLASS_FACTORY_WITH_INTERFACE_AND_CREATEFUNC(
+    LIBRARY_FACTORY,
+    InternedString,
+    IString,
+    createInternedString,
+    ConstCharPtr, str,
+    SizeT, length
+)
 
 END_NAMESPACE_OPENDAQ
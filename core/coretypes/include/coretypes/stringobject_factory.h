@@ -16,6 +16,7 @@
 
 #pragma once
 #include <coretypes/string_ptr.h>
+#include <cstring>
 
 BEGIN_NAMESPACE_OPENDAQ
 
@@ -33,7 +34,42 @@ inline StringPtr String(ConstCharPtr str, SizeT length)
 
 inline StringPtr String(const std::string& str)
 {
-    StringPtr obj(String_Create(str.c_str()));
+    StringPtr obj(StringN_Create(str.data(), str.size()));
+    return obj;
+}
+
+/*!
+ * @brief Gets the interned String object with the value, shared by all users of the same value.
+ * @param str The value of the string.
+ *
+ * Interned strings are never released; use them only for identifiers from a bounded set.
+ */
+inline StringPtr InternedString(ConstCharPtr str)
+{
+    StringPtr obj(InternedString_Create(str, str == nullptr ? 0 : std::strlen(str)));
+    return obj;
+}
+
+/*!
+ * @brief Gets the interned String object with the value, shared by all users of the same value.
+ * @param str The value of the string.
+ */
+inline StringPtr InternedString(const std::string& str)
+{
+    StringPtr obj(InternedString_Create(str.data(), str.size()));
+    return obj;
+}
+
+/*!
+ * @brief Gets the interned String object with the value of the string object.
+ * @param str The string object. Returns nullptr if not assigned.
+ */
+inline StringPtr InternedString(const StringPtr& str)
+{
+    if (!str.assigned())
+        return str;
+
+    StringPtr obj(InternedString_Create(str.getCharPtr(), str.getLength()));
     return obj;
 }
 
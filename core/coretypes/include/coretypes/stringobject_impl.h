@@ -27,11 +27,18 @@ BEGIN_NAMESPACE_OPENDAQ
 class StringImpl : public ImplementationOf<IString, IConvertible, ICoreType, IComparable, ISerializable>
 {
 public:
+    // Strings up to this length are stored in the object itself instead of in a separate allocation.
+    static constexpr SizeT SmallStringCapacity = 23;
+
     StringImpl(ConstCharPtr str);
     StringImpl(ConstCharPtr data, SizeT length);
 
     ~StringImpl() override;
 
+    // Gets the interned String object with the value, creating it on first use. Interned strings are
+    // never released, and their hash code is calculated up front.
+    static IString* Intern(ConstCharPtr data, SizeT length);
+
     // IBaseObject
     ErrCode INTERFACE_FUNC getHashCode(SizeT* hashCode) override;
     ErrCode INTERFACE_FUNC equals(IBaseObject* other, Bool* equals) const override;
@@ -57,9 +64,13 @@ public:
     ErrCode INTERFACE_FUNC getSerializeId(ConstCharPtr* id) const override;
 
 private:
+    void calculateHashCode();
+
     char* str;
+    SizeT length;
     SizeT hashCode;
     bool hashCalculated;
+    char smallStr[SmallStringCapacity + 1];
 };
 
 END_NAMESPACE_OPENDAQ
@@ -1,12 +1,35 @@
 #include <coretypes/stringobject_impl.h>
 #include <coretypes/errors.h>
 #include <coretypes/impl.h>
+#include <coretypes/validation.h>
 #include <cstring>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
 
 BEGIN_NAMESPACE_OPENDAQ
 
+namespace
+{
+
+struct InternTable
+{
+    std::mutex sync;
+    std::unordered_map<std::string_view, IString*> strings;
+};
+
+InternTable& getInternTable()
+{
+    // never destroyed, as interned strings can be referenced until the process exits
+    static InternTable* table = new InternTable();
+    return *table;
+}
+
+}
+
 StringImpl::StringImpl(ConstCharPtr data, SizeT length)
-    : hashCode(0)
+    : length(data == nullptr ? 0 : length)
+    , hashCode(0)
     , hashCalculated(false)
 {
     if (data == nullptr)
@@ -15,7 +38,7 @@ StringImpl::StringImpl(ConstCharPtr data, SizeT length)
     }
     else
     {
-        this->str = new char[length + 1];
+        this->str = length <= SmallStringCapacity ? smallStr : new char[length + 1];
 
         memcpy(this->str, data, length);
         this->str[length] = '\0';
@@ -29,11 +52,54 @@ StringImpl::StringImpl(ConstCharPtr str)
 
 StringImpl::~StringImpl()
 {
-    if (str != nullptr)
-    {
+    if (str != nullptr && str != smallStr)
         delete[] str;
-        str = nullptr;
+    str = nullptr;
+}
+
+IString* StringImpl::Intern(ConstCharPtr data, SizeT length)
+{
+    auto& table = getInternTable();
+    std::scoped_lock lock(table.sync);
+
+    const auto it = table.strings.find(std::string_view(data, length));
+    if (it != table.strings.end())
+    {
+        it->second->addRef();
+        return it->second;
     }
+
+    auto interned = new StringImpl(data, length);
+    interned->calculateHashCode();
+
+    // the reference of the table is never released
+    IString* internedStr = interned;
+    internedStr->addRef();
+#ifndef NDEBUG
+    daqUntrackObject(internedStr);
+#endif
+
+    table.strings.emplace(std::string_view(interned->str, interned->length), internedStr);
+    internedStr->addRef();
+    return internedStr;
+}
+
+void StringImpl::calculateHashCode()
+{
+    uint32_t h = 0, high;
+    const char* s = str;
+    const char* end = str + length;
+
+    while (s != end && *s)
+    {
+        h = (h << 4) + *s++;
+        if ((high = h & 0xF0000000))
+            h ^= high >> 24;
+        h &= ~high;
+    }
+
+    this->hashCode = h;
+    hashCalculated = true;
 }
 
 ErrCode StringImpl::getHashCode(SizeT* hashCode)
@@ -45,20 +111,7 @@ ErrCode StringImpl::getHashCode(SizeT* hashCode)
     }
 
     if (!hashCalculated)
-    {
-        uint32_t h = 0, high;
-        char* s = str;
-
-        while (*s)
-        {
-            h = (h << 4) + *s++;
-            if ((high = h & 0xF0000000))
-                h ^= high >> 24;
-            h &= ~high;
-        }
-        this->hashCode = h;
-        hashCalculated = true;
-    }
+        calculateHashCode();
 
     *hashCode = this->hashCode;
     return OPENDAQ_SUCCESS;
@@ -82,21 +135,27 @@ ErrCode StringImpl::equals(IBaseObject* other, Bool* equal) const
 
     if (OPENDAQ_SUCCEEDED(other->borrowInterface(IString::Id, reinterpret_cast<void**>(&otherString))))
     {
-        ConstCharPtr otherValue;
-        auto err = otherString->getCharPtr(&otherValue);
+        // interned strings with the same value are the same object
+        if (otherString == static_cast<const IString*>(this))
+        {
+            *equal = true;
+            return OPENDAQ_SUCCESS;
+        }
 
-        if (OPENDAQ_FAILED(err))
+        ConstCharPtr otherValue;
+        SizeT otherLength;
+        if (OPENDAQ_FAILED(otherString->getCharPtr(&otherValue)) || OPENDAQ_FAILED(otherString->getLength(&otherLength)))
         {
             return OPENDAQ_SUCCESS;
         }
 
-        if (otherValue == nullptr)
+        if (otherValue == nullptr || str == nullptr)
         {
-            *equal = str == nullptr;
+            *equal = str == otherValue;
         }
         else
         {
-            *equal = strcmp(str, otherValue) == 0;
+            *equal = length == otherLength && memcmp(str, otherValue, length) == 0;
         }
     }
 
@@ -111,11 +170,7 @@ ErrCode StringImpl::getCharPtr(ConstCharPtr* value)
 
 ErrCode StringImpl::getLength(SizeT* size)
 {
-    if (str != nullptr)
-        *size = strlen(str);
-    else
-        *size = 0;
-
+    *size = length;
     return OPENDAQ_SUCCESS;
 }
 
@@ -155,7 +210,7 @@ ErrCode StringImpl::toInt(Int* val)
 
 ErrCode StringImpl::toBool(Bool* val)
 {
-    if (str == nullptr || strlen(str) == 0)
+    if (str == nullptr || length == 0)
         *val = False;
 #if defined(_WIN32)
     else if (_stricmp("True", str) == 0)
@@ -226,14 +281,6 @@ ErrCode StringImpl::getSerializeId(ConstCharPtr* /*id*/) const
 
 ErrCode StringImpl::serialize(ISerializer* serializer)
 {
-    SizeT length;
-    ErrCode errCode = getLength(&length);
-
-    if (OPENDAQ_FAILED(errCode))
-    {
-        return errCode;
-    }
-
     serializer->writeString(str, length);
 
     return OPENDAQ_SUCCESS;
@@ -246,4 +293,23 @@ OPENDAQ_DEFINE_CLASS_FACTORY_WITH_INTERFACE_AND_CREATEFUNC_OBJ(
     SizeT, length
 )
 
+#if !defined(BUILDING_STATIC_LIBRARY)
+
+extern "C"
+ErrCode PUBLIC_EXPORT createInternedString(IString** obj, ConstCharPtr str, SizeT length)
+{
+    OPENDAQ_PARAM_NOT_NULL(obj);
+
+    if (str == nullptr)
+        return createStringN(obj, str, length);
+
+    return daqTry([&]()
+    {
+        *obj = StringImpl::Intern(str, length);
+        return OPENDAQ_SUCCESS;
+    });
+}
+
+#endif
+
 END_NAMESPACE_OPENDAQ
@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 #include <coretypes/coretypes.h>
+#include <cstring>
 
 using namespace daq;
 
@@ -80,6 +81,50 @@ DECLARE_OPENDAQ_INTERFACE(ITestObject, IBaseObject)
 
 END_NAMESPACE_OPENDAQ
 
+TEST_F(StringObjectTest, LongAndEmbeddedNull)
+{
+    const std::string longValue(100, 'x');
+    const auto longString = String(longValue);
+    ASSERT_EQ(longString.getLength(), 100u);
+    ASSERT_EQ(longString.toStdString(), longValue);
+
+    const char data[] = {'a', '\0', 'b'};
+    const auto string1 = String(data, 3);
+    ASSERT_EQ(string1.getLength(), 3u);
+
+    Bool eq{true};
+    string1->equals(String("a"), &eq);
+    ASSERT_FALSE(eq);
+}
+
+TEST_F(StringObjectTest, StdStringKeepsEmbeddedNull)
+{
+    // the whole std::string is stored, earlier versions stopped at the first null character
+    const std::string value("a\0b", 3);
+    const auto string1 = String(value);
+    ASSERT_EQ(string1.getLength(), 3u);
+    ASSERT_EQ(std::memcmp(string1.getCharPtr(), value.data(), value.size()), 0);
+    ASSERT_NE(string1, String("a"));
+    ASSERT_EQ(string1, String(value.data(), value.size()));
+}
+
+TEST_F(StringObjectTest, Interned)
+{
+    const auto string1 = InternedString("InternedTest");
+    const auto string2 = InternedString(std::string("InternedTest"));
+    const auto string3 = InternedString(String("InternedTest2"));
+    const auto string4 = String("InternedTest");
+
+    ASSERT_EQ(string1.getObject(), string2.getObject());
+    ASSERT_NE(string1.getObject(), string3.getObject());
+    ASSERT_EQ(string1, string4);
+    ASSERT_EQ(string1.getHashCode(), string4.getHashCode());
+    ASSERT_FALSE(InternedString(StringPtr()).assigned());
+
+    const std::string longValue(100, 'y');
+    ASSERT_EQ(InternedString(longValue).getObject(), InternedString(longValue).getObject());
+}
+
 TEST_F(StringObjectTest, CastToPtr)
 {
     auto string1 = String("Test2");
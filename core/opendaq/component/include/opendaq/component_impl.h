@@ -36,6 +36,7 @@
 #include <coreobjects/core_event_args_impl.h>
 #include <opendaq/recursive_search_ptr.h>
 #include <opendaq/component_private_ptr.h>
+#include <opendaq/component_visitor_factory.h>
 #include <opendaq/tags_impl.h>
 #include <cctype>
 #include <opendaq/ids_parser.h>
@@ -59,10 +60,10 @@ static constexpr int ComponentSerializeFlag_SerializeActiveProp = 1;
 #define COMPONENT_AVAILABLE_ATTRIBUTES {"Name", "Description", "Visible", "Active"}
 
 template <class Intf = IComponent, class ... Intfs>
-class ComponentImpl : public GenericPropertyObjectImpl<Intf, IRemovable, IComponentPrivate, IDeserializeComponent, Intfs ...>
+class ComponentImpl : public GenericPropertyObjectImpl<Intf, IRemovable, IComponentPrivate, IComponentVisitable, IDeserializeComponent, Intfs ...>
 {
 public:
-    using Super = GenericPropertyObjectImpl<Intf, IRemovable, IComponentPrivate, IDeserializeComponent, Intfs ...>;
+    using Super = GenericPropertyObjectImpl<Intf, IRemovable, IComponentPrivate, IComponentVisitable, IDeserializeComponent, Intfs ...>;
 
     ComponentImpl(const ContextPtr& context,
                   const ComponentPtr& parent,
@@ -96,6 +97,9 @@ public:
     ErrCode INTERFACE_FUNC unlockAllAttributes() override;
     ErrCode INTERFACE_FUNC triggerComponentCoreEvent(ICoreEventArgs* args) override;
 
+    // IComponentVisitable
+    ErrCode INTERFACE_FUNC visitItems(IComponentVisitor* visitor, Bool* stopped) override;
+
     // IRemovable
     ErrCode INTERFACE_FUNC remove() override;
     ErrCode INTERFACE_FUNC isRemoved(Bool* removed) override;
@@ -119,6 +123,7 @@ protected:
     virtual void visibleChanged();
     virtual void removed();
     virtual ErrCode lockAllAttributesInternal();
+    virtual void collectItems(std::vector<ComponentPtr>& items);
     ListPtr<IComponent> searchItems(const SearchFilterPtr& searchFilter, const std::vector<ComponentPtr>& items);
     void setActiveRecursive(const std::vector<ComponentPtr>& items, Bool active);
 
@@ -632,6 +637,22 @@ ErrCode ComponentImpl<Intf, Intfs...>::triggerComponentCoreEvent(ICoreEventArgs*
     return OPENDAQ_SUCCESS;
 }
 
+template <class Intf, class ... Intfs>
+ErrCode ComponentImpl<Intf, Intfs...>::visitItems(IComponentVisitor* visitor, Bool* stopped)
+{
+    OPENDAQ_PARAM_NOT_NULL(visitor);
+    OPENDAQ_PARAM_NOT_NULL(stopped);
+
+    return daqTry([&]
+    {
+        std::vector<ComponentPtr> items;
+        collectItems(items);
+
+        *stopped = !visitComponents(items, visitor);
+        return OPENDAQ_SUCCESS;
+    });
+}
+
 template <class Intf, class ... Intfs>
 ErrCode ComponentImpl<Intf, Intfs...>::getOnComponentCoreEvent(IEvent** event)
 {
@@ -860,31 +881,29 @@ ErrCode ComponentImpl<Intf, Intfs...>::lockAllAttributesInternal()
     return OPENDAQ_SUCCESS;
 }
 
+template <class Intf, class ... Intfs>
+void ComponentImpl<Intf, Intfs...>::collectItems(std::vector<ComponentPtr>& /*items*/)
+{
+}
+
 template <class Intf, class ... Intfs>
 ListPtr<IComponent> ComponentImpl<Intf, Intfs...>::searchItems(const SearchFilterPtr& searchFilter, const std::vector<ComponentPtr>& items)
 {
-    tsl::ordered_set<ComponentPtr, ComponentHash, ComponentEqualTo> allItems;
-    for (const auto& item : items)
-        if (searchFilter.acceptsComponent(item))
-            allItems.insert(item);
+    ListPtr<IComponent> childList = List<IComponent>();
+    const bool recursive = searchFilter.asPtrOrNull<IRecursiveSearch>().assigned();
 
-    if (searchFilter.asPtrOrNull<IRecursiveSearch>().assigned())
-    {
-        for (const auto& item : items)
+    // the descendants are searched with a single visitor, which appends to one result list
+    const auto visitor = ComponentVisitor(
+        [&searchFilter, &childList, recursive](const ComponentPtr& component, bool& visitChildren)
         {
-            if (!searchFilter.visitChildren(item))
-                continue;
+            if (searchFilter.acceptsComponent(component))
+                childList.pushBack(component);
 
-            if (const auto folder = item.asPtrOrNull<IFolder>(); folder.assigned())
-                for (const auto& child : folder.getItems(searchFilter))
-                    allItems.insert(child);
-        }
-    }
-    
-    ListPtr<IComponent> childList = List<IComponent>();
-    for (const auto& signal : allItems)
-        childList.pushBack(signal);
+            visitChildren = recursive && searchFilter.visitChildren(component);
+            return true;
+        });
 
+    visitComponents(items, visitor);
     return childList.detach();
 }
 
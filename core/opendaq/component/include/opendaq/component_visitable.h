@@ -0,0 +1,51 @@
+/*
+ * Copyright 2022-2024 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+#include <opendaq/component_visitor.h>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+/*!
+ * @ingroup opendaq_component_visitor
+ * @addtogroup opendaq_component_visitable Component visitable
+ * @{
+ */
+
+/*!
+ * @brief Traverses the components below a component with a Component visitor.
+ *
+ * Unlike a recursive search through `getItems` of a folder, the traversal does not build a list of the found
+ * components, and the visitor can stop it early. Each folder still copies the references to its items before
+ * they are visited, so that the visitor can access the folder.
+ */
+DECLARE_OPENDAQ_INTERFACE(IComponentVisitable, IBaseObject)
+{
+    /*!
+     * @brief Visits the child components, and recursively their descendants.
+     * @param visitor The visitor called for each visited component.
+     * @param[out] stopped True if the visitor stopped the traversal.
+     *
+     * All children of a component are visited before the descendants of any of them, which matches the order
+     * of components returned by a recursive search. Invisible components are visited as well. The children of
+     * a component are visited only if the visitor requests so for the component.
+     */
+    virtual ErrCode INTERFACE_FUNC visitItems(IComponentVisitor* visitor, Bool* stopped) = 0;
+};
+/*!@}*/
+
+END_NAMESPACE_OPENDAQ
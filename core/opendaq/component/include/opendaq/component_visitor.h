@@ -0,0 +1,47 @@
+/*
+ * Copyright 2022-2024 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <opendaq/component.h>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+/*!
+ * @ingroup opendaq_components
+ * @addtogroup opendaq_component_visitor Component visitor
+ * @{
+ */
+
+/*!
+ * @brief Called for each component visited when traversing a component tree with `visitItems`
+ * of `IComponentVisitable`.
+ *
+ * The visitor decides for each component whether its children are visited, and can stop the traversal
+ * at any component.
+ */
+DECLARE_OPENDAQ_INTERFACE(IComponentVisitor, IBaseObject)
+{
+    /*!
+     * @brief Visits the component.
+     * @param component The visited component.
+     * @param[out] visitChildren Set to false to skip the children of the component. True by default.
+     * @param[out] stop Set to true to stop the traversal. False by default.
+     */
+    virtual ErrCode INTERFACE_FUNC visit(IComponent* component, Bool* visitChildren, Bool* stop) = 0;
+};
+/*!@}*/
+
+END_NAMESPACE_OPENDAQ
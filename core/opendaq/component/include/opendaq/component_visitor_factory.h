@@ -0,0 +1,64 @@
+/*
+ * Copyright 2022-2024 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <opendaq/component_visitor_impl.h>
+#include <opendaq/recursive_search_ptr.h>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+/*!
+ * @ingroup opendaq_component_visitor
+ * @addtogroup opendaq_component_visitor_factories Factories
+ * @{
+ */
+
+/*!
+ * @brief Creates a component visitor calling the functor for each visited component.
+ * @param functor A callable with the signature `bool(const ComponentPtr& component, bool& visitChildren)`. Setting
+ * `visitChildren` to false skips the children of the component; returning false stops the traversal.
+ */
+template <typename TFunctor>
+ComponentVisitorPtr ComponentVisitor(TFunctor functor)
+{
+    return createWithImplementation<IComponentVisitor, ComponentVisitorImpl<TFunctor>>(std::move(functor));
+}
+
+/*!
+ * @brief Calls the callback for each component below the component that is accepted by the search filter. Unlike
+ * `getItems` of a folder, no list of the found components is built, and the search can be stopped early.
+ * @param component The component whose descendants are searched. The component itself is not passed to the callback.
+ * @param searchFilter The search filter. Children of components are searched only if the filter is recursive.
+ * @param callback A callable with the signature `bool(const ComponentPtr& component)`. Returning false stops the search.
+ * @returns False if the callback stopped the search.
+ */
+template <typename TFunctor>
+bool forEachComponent(const ComponentPtr& component, const SearchFilterPtr& searchFilter, TFunctor callback)
+{
+    const bool recursive = searchFilter.asPtrOrNull<IRecursiveSearch>().assigned();
+    const auto visitor = ComponentVisitor(
+        [&searchFilter, &callback, recursive](const ComponentPtr& item, bool& visitChildren)
+        {
+            visitChildren = recursive && searchFilter.visitChildren(item);
+            return !searchFilter.acceptsComponent(item) || callback(item);
+        });
+
+    return visitComponentItems(component, visitor);
+}
+
+/*!@}*/
+
+END_NAMESPACE_OPENDAQ
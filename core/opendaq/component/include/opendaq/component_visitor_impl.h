@@ -0,0 +1,115 @@
+/*
+ * Copyright 2022-2024 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <coretypes/intfs.h>
+#include <coretypes/validation.h>
+#include <opendaq/component_ptr.h>
+#include <opendaq/component_visitable_ptr.h>
+#include <opendaq/component_visitor_ptr.h>
+#include <opendaq/folder_ptr.h>
+#include <opendaq/search_filter_factory.h>
+#include <vector>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+/*!
+ * @brief Visitor calling a functor with the signature `bool(const ComponentPtr& component, bool& visitChildren)`.
+ * The functor returns false to stop the traversal.
+ */
+template <typename TFunctor>
+class ComponentVisitorImpl final : public ImplementationOf<IComponentVisitor>
+{
+public:
+    explicit ComponentVisitorImpl(TFunctor functor)
+        : functor(std::move(functor))
+    {
+    }
+
+    ErrCode INTERFACE_FUNC visit(IComponent* component, Bool* visitChildren, Bool* stop) override
+    {
+        OPENDAQ_PARAM_NOT_NULL(component);
+        OPENDAQ_PARAM_NOT_NULL(visitChildren);
+        OPENDAQ_PARAM_NOT_NULL(stop);
+
+        return daqTry([&]
+        {
+            bool visit = true;
+            *stop = !functor(ComponentPtr::Borrow(component), visit);
+            *visitChildren = visit;
+            return OPENDAQ_SUCCESS;
+        });
+    }
+
+private:
+    TFunctor functor;
+};
+
+inline bool visitComponentItems(const ComponentPtr& component, IComponentVisitor* visitor);
+
+/*!
+ * @brief Visits the components and the descendants of those, for which the visitor requests so. All components
+ * are visited before the descendants of any of them.
+ * @returns False if the visitor stopped the traversal.
+ */
+inline bool visitComponents(const std::vector<ComponentPtr>& components, IComponentVisitor* visitor)
+{
+    std::vector<bool> visitChildren(components.size());
+    for (size_t i = 0; i < components.size(); ++i)
+    {
+        Bool visit = True;
+        Bool stop = False;
+        checkErrorInfo(visitor->visit(components[i], &visit, &stop));
+        if (stop)
+            return false;
+
+        visitChildren[i] = visit;
+    }
+
+    for (size_t i = 0; i < components.size(); ++i)
+        if (visitChildren[i] && !visitComponentItems(components[i], visitor))
+            return false;
+
+    return true;
+}
+
+/*!
+ * @brief Visits the descendants of the component.
+ * @returns False if the visitor stopped the traversal.
+ */
+inline bool visitComponentItems(const ComponentPtr& component, IComponentVisitor* visitor)
+{
+    if (const auto visitable = component.asPtrOrNull<IComponentVisitable>(true); visitable.assigned())
+    {
+        Bool stopped = False;
+        checkErrorInfo(visitable->visitItems(visitor, &stopped));
+        return !stopped;
+    }
+
+    // folders not based on ComponentImpl are traversed through their item lists
+    if (const auto folder = component.asPtrOrNull<IFolder>(true); folder.assigned())
+    {
+        std::vector<ComponentPtr> items;
+        for (const auto& item : folder.getItems(search::Any()))
+            items.push_back(item);
+
+        return visitComponents(items, visitor);
+    }
+
+    return true;
+}
+
+END_NAMESPACE_OPENDAQ
@@ -70,6 +70,7 @@ protected:
     tsl::ordered_map<std::string, ComponentPtr> items;
 
     void removed() override;
+    void collectItems(std::vector<ComponentPtr>& items) override;
 
     virtual bool addItemInternal(const ComponentPtr& component);
     void serializeCustomObjectValues(const SerializerPtr& serializer, bool forUpdate) override;
@@ -136,21 +137,21 @@ ErrCode FolderImpl<Intf, Intfs...>::getItems(IList** items, ISearchFilter* searc
 {
     OPENDAQ_PARAM_NOT_NULL(items);
 
-    std::scoped_lock lock(this->sync);
-
     if (searchFilter)
     {
         return daqTry([&]
         {
+            // the search runs unlocked, as the filter can access the folder
             std::vector<ComponentPtr> itemsVec;
-            for (const auto& item : this->items)
-                itemsVec.emplace_back(item.second);
+            collectItems(itemsVec);
 
             *items = this->searchItems(searchFilter, itemsVec).detach();
             return OPENDAQ_SUCCESS;
         });
     }
 
+    std::scoped_lock lock(this->sync);
+
     IList* list;
     auto err = createListWithElementType(&list, itemId);
     if (OPENDAQ_FAILED(err))
@@ -166,6 +167,16 @@ ErrCode FolderImpl<Intf, Intfs...>::getItems(IList** items, ISearchFilter* searc
     return OPENDAQ_SUCCESS;
 }
 
+template <class Intf, class... Intfs>
+void FolderImpl<Intf, Intfs...>::collectItems(std::vector<ComponentPtr>& items)
+{
+    std::scoped_lock lock(this->sync);
+
+    items.reserve(items.size() + this->items.size());
+    for (const auto& item : this->items)
+        items.emplace_back(item.second);
+}
+
 template <class Intf, class... Intfs>
 ErrCode FolderImpl<Intf, Intfs...>::getItem(IString* localId, IComponent** item)
 {
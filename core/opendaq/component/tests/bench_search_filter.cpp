@@ -0,0 +1,53 @@
+#include <opendaq/component_factory.h>
+#include <opendaq/component_visitor_factory.h>
+#include <opendaq/context_factory.h>
+#include <opendaq/folder_factory.h>
+#include <opendaq/search_filter_factory.h>
+#include <gtest/gtest.h>
+#include <chrono>
+
+using namespace daq;
+
+using SearchFilterBenchmark = testing::Test;
+
+static FolderConfigPtr createTree(const ContextPtr& context, size_t folderCount, size_t componentCount)
+{
+    const auto root = Folder(context, nullptr, "root");
+    for (size_t i = 0; i < folderCount; ++i)
+    {
+        const auto folder = Folder(context, root, "folder" + std::to_string(i));
+        root.addItem(folder);
+
+        for (size_t j = 0; j < componentCount; ++j)
+        {
+            const auto component = Component(context, folder, "component" + std::to_string(j));
+            component.setVisible(j % 2 == 0);
+            folder.addItem(component);
+        }
+    }
+
+    return root;
+}
+
+TEST_F(SearchFilterBenchmark, RecursiveSearchRate)
+{
+    const auto root = createTree(NullContext(), 100, 100);
+    const auto filter = search::Recursive(search::Visible());
+    constexpr size_t iterations = 20;
+
+    size_t listCount = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < iterations; ++i)
+        listCount += root.getItems(filter).getCount();
+    const auto listElapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    size_t visitCount = 0;
+    start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < iterations; ++i)
+        forEachComponent(root, filter, [&visitCount](const ComponentPtr&) { return ++visitCount != 0; });
+    const auto visitElapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    ASSERT_EQ(listCount, visitCount);
+    RecordProperty("GetItemsPerSecond", std::to_string(static_cast<int64_t>(iterations / listElapsed)));
+    RecordProperty("ForEachComponentPerSecond", std::to_string(static_cast<int64_t>(iterations / visitElapsed)));
+}
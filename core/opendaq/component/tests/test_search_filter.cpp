@@ -1,5 +1,7 @@
 #include <opendaq/component_factory.h>
+#include <opendaq/component_visitor_factory.h>
 #include <opendaq/context_factory.h>
+#include <opendaq/folder_factory.h>
 #include <opendaq/search_filter_factory.h>
 #include <opendaq/tags_private_ptr.h>
 #include <gtest/gtest.h>
@@ -8,6 +10,25 @@ using namespace daq;
 
 using SearchFilterTest = testing::Test;
 
+static FolderConfigPtr createTree(const ContextPtr& context, size_t folderCount, size_t componentCount)
+{
+    const auto root = Folder(context, nullptr, "root");
+    for (size_t i = 0; i < folderCount; ++i)
+    {
+        const auto folder = Folder(context, root, "folder" + std::to_string(i));
+        root.addItem(folder);
+
+        for (size_t j = 0; j < componentCount; ++j)
+        {
+            const auto component = Component(context, folder, "component" + std::to_string(j));
+            component.setVisible(j % 2 == 0);
+            folder.addItem(component);
+        }
+    }
+
+    return root;
+}
+
 TEST_F(SearchFilterTest, RequireTagsComponentWithoutTags)
 {
     const auto component = Component(NullContext(), nullptr, "Temp");
@@ -61,3 +82,54 @@ TEST_F(SearchFilterTest, RequireTagsComponentWithTwoTags)
     filter = search::RequireTags(List<IString>("tag1", "foo"));
     ASSERT_FALSE(filter.acceptsComponent(component));
 }
+
+TEST_F(SearchFilterTest, ForEachComponentMatchesGetItems)
+{
+    const auto root = createTree(NullContext(), 5, 4);
+
+    for (const auto& filter : {search::Recursive(search::Visible()), search::Recursive(search::Any()), search::Any()})
+    {
+        std::vector<std::string> visited;
+        ASSERT_TRUE(forEachComponent(root, filter, [&visited](const ComponentPtr& component)
+        {
+            visited.push_back(component.getGlobalId());
+            return true;
+        }));
+
+        std::vector<std::string> found;
+        for (const auto& component : root.getItems(filter))
+            found.push_back(component.getGlobalId());
+
+        ASSERT_EQ(visited, found);
+    }
+}
+
+TEST_F(SearchFilterTest, ForEachComponentStop)
+{
+    const auto root = createTree(NullContext(), 5, 4);
+
+    size_t count = 0;
+    ASSERT_FALSE(forEachComponent(root, search::Recursive(search::Any()), [&count](const ComponentPtr&)
+    {
+        return ++count < 3;
+    }));
+    ASSERT_EQ(count, 3u);
+}
+
+TEST_F(SearchFilterTest, VisitItemsSkipChildren)
+{
+    const auto root = createTree(NullContext(), 5, 4);
+
+    size_t count = 0;
+    const auto visitor = ComponentVisitor([&count](const ComponentPtr& component, bool& visitChildren)
+    {
+        visitChildren = component.getLocalId() == "folder1";
+        count++;
+        return true;
+    });
+
+    Bool stopped = True;
+    ASSERT_EQ(root.asPtr<IComponentVisitable>()->visitItems(visitor, &stopped), OPENDAQ_SUCCESS);
+    ASSERT_FALSE(stopped);
+    ASSERT_EQ(count, 9u);
+}
@@ -25,6 +25,7 @@ BEGIN_NAMESPACE_OPENDAQ
 
 struct IScheduler;
 struct IModuleManager;
+struct ICoreEventBus;
 
 /*!
  * @ingroup opendaq_utility
@@ -113,6 +114,15 @@ DECLARE_OPENDAQ_INTERFACE(IContext, IBaseObject)
      * @param[out] services The dictionary of available discovery services.
      */
     virtual ErrCode INTERFACE_FUNC getDiscoveryServers(IDict** services) = 0;
+
+    /*!
+     * @brief Gets the Core Event Bus that delivers the Core Events to filtered subscriptions on a dispatcher thread.
+     * @param[out] bus The Core Event Bus.
+     *
+     * The bus receives the same events as the Core Event. It is meant for listeners that do not have to react to
+     * changes on the thread that made them, and that are only interested in some of the events.
+     */
+    virtual ErrCode INTERFACE_FUNC getCoreEventBus(ICoreEventBus** bus) = 0;
 };
 /*!@}*/
 
@@ -0,0 +1,90 @@
+/*
+ * Copyright 2022-2024 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <coretypes/listobject.h>
+#include <coretypes/procedure.h>
+#include <coretypes/stringobject.h>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+/*!
+ * @ingroup opendaq_context
+ * @addtogroup opendaq_core_event_bus Core event bus
+ * @{
+ */
+
+/*!
+ * @brief Delivers the Core Events of a Context to subscribers asynchronously, filtered by event ID,
+ * component subtree and property name.
+ *
+ * Unlike the Core Event available through `getOnCoreEvent` of the Context, whose handlers run on the
+ * thread that made the change, the handlers of the Core Event Bus run on a dedicated dispatcher thread.
+ * Events are matched against the filters of the subscriptions when published, and events matching no
+ * subscription are dropped at once. Events pending for a subscription are delivered in batches, in the
+ * order they were published; a `PropertyValueChanged` event replaces the pending event of the same property
+ * of the same component, so that a handler that falls behind only receives the latest value. The queue of each
+ * subscription is bounded; see `getDroppedEventCount`.
+ */
+DECLARE_OPENDAQ_INTERFACE(ICoreEventBus, IBaseObject)
+{
+    // [templateType(eventIds, IInteger)]
+    // [templateType(propertyNames, IString)]
+    /*!
+     * @brief Subscribes a handler to the Core Events matching the filter.
+     * @param handler The procedure called on the dispatcher thread with a list of events. Each event is a list
+     * of two elements: the Component that triggered the event (nullptr for Type Manager events), and the Core Event Args.
+     * @param eventIds The IDs of the accepted events. If nullptr or empty, events of all IDs are accepted.
+     * @param componentGlobalId The global ID of the root of the accepted Component subtree. If nullptr or empty, events
+     * of all Components are accepted; otherwise, events without a Component are not accepted. If the ID ends with '/', only
+     * events of the children are accepted, not of the root itself.
+     * @param propertyNames The names of the accepted properties. Events with a property name (the "Name" parameter, or
+     * the keys of "UpdatedProperties") are accepted only if one of the names is in the list. If nullptr or empty,
+     * events of all properties are accepted.
+     * @param maxBatchSize The maximum number of events passed to a single handler call. 0 for no limit.
+     * @param[out] id The ID of the subscription, used to unsubscribe.
+     */
+    virtual ErrCode INTERFACE_FUNC subscribe(IProcedure* handler, IList* eventIds, IString* componentGlobalId, IList* propertyNames, SizeT maxBatchSize, SizeT* id) = 0;
+
+    /*!
+     * @brief Removes the subscription. Pending events of the subscription are discarded.
+     * @param id The ID of the subscription.
+     *
+     * When called from outside the handlers, the call waits for a running call of the subscription's handler to finish,
+     * so that the handler is not called once unsubscribe returns.
+     */
+    virtual ErrCode INTERFACE_FUNC unsubscribe(SizeT id) = 0;
+
+    /*!
+     * @brief Waits until the events published before the call are delivered to the handlers.
+     *
+     * Returns at once when called from a handler.
+     */
+    virtual ErrCode INTERFACE_FUNC flush() = 0;
+
+    /*!
+     * @brief Gets the number of events dropped from the queue of the subscription because its handler fell behind.
+     * @param id The ID of the subscription.
+     * @param[out] count The number of dropped events.
+     *
+     * At most 10000 events are queued for a subscription. When the queue is full, the oldest event is dropped to
+     * make room for the new one. `PropertyValueChanged` events replaced by a newer change are not counted.
+     */
+    virtual ErrCode INTERFACE_FUNC getDroppedEventCount(SizeT id, SizeT* count) = 0;
+};
+/*!@}*/
+
+END_NAMESPACE_OPENDAQ
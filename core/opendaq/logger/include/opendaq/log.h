@@ -73,10 +73,15 @@
 
 /// Format
 
+// Formatting is skipped for messages below the component's level
 #define DAQLOG_FORMATTED(loggerComponent, message, logLevel, ...)                                    \
-    loggerComponent.logMessage(daq::SourceLocation{nullptr, 0, nullptr},    \
-                               fmt::format(FMT_STRING(message), ##__VA_ARGS__).data(),               \
-                               logLevel);
+    do                                                                                               \
+    {                                                                                                \
+        if (loggerComponent.shouldLog(logLevel))                                                     \
+            loggerComponent.logMessage(daq::SourceLocation{nullptr, 0, nullptr},                     \
+                                       fmt::format(FMT_STRING(message), ##__VA_ARGS__).data(),       \
+                                       logLevel);                                                    \
+    } while (0)
 
 #if (OPENDAQ_LOG_LEVEL <= OPENDAQ_LOG_LEVEL_TRACE)
     #define DAQLOGF_T(loggerComponent, message, ...) \
@@ -100,6 +100,15 @@ DECLARE_OPENDAQ_INTERFACE(ILoggerComponent, IBaseObject)
      * @param level The severity level of messages.
      */
     virtual ErrCode INTERFACE_FUNC flushOnLevel(LogLevel level) = 0;
+
+    /*!
+     * @brief Gets the number of messages dropped because the asynchronous message queue was full.
+     * @param[out] count The number of dropped messages.
+     *
+     * Messages are only dropped when the component's thread pool uses a non-blocking overflow policy.
+     * The queue is shared by all components using the same thread pool, so the count covers all of them.
+     */
+    virtual ErrCode INTERFACE_FUNC getDroppedMessageCount(SizeT* count) = 0;
 };
 
 /*!@}*/
@@ -52,6 +52,7 @@ public:
 
     ErrCode INTERFACE_FUNC flush() override;
     ErrCode INTERFACE_FUNC flushOnLevel(LogLevel level) override;
+    ErrCode INTERFACE_FUNC getDroppedMessageCount(SizeT* count) override;
 
     ErrCode INTERFACE_FUNC toString(CharPtr* str) override;
 
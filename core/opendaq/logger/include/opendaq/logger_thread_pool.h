@@ -27,15 +27,45 @@ BEGIN_NAMESPACE_OPENDAQ
  * @{
  */
 
+/*!
+ * @brief Enumeration of strategies used when the asynchronous logging queue is full.
+ */
+enum class LogOverflowPolicy
+{
+    Block = 0,      ///< the logging thread waits until there is space in the queue
+    OverrunOldest,  ///< the oldest queued message is replaced by the new one
+    DiscardNew      ///< the new message is dropped
+};
+
 /*!
  * @brief Container for messages queue and backing threads used for asynchronous logging.
+ *
+ * With the `Block` overflow policy, a slow sink can stall every thread that logs. The non-blocking
+ * policies keep the logging threads running and count the messages lost instead.
  */
 DECLARE_OPENDAQ_INTERFACE(ILoggerThreadPool, IBaseObject)
 {
+    /*!
+     * @brief Gets the policy applied when the message queue is full.
+     * @param[out] policy The overflow policy.
+     */
+    virtual ErrCode INTERFACE_FUNC getOverflowPolicy(LogOverflowPolicy* policy) = 0;
+
+    /*!
+     * @brief Gets the number of messages dropped because the message queue was full.
+     * @param[out] count The number of dropped messages.
+     */
+    virtual ErrCode INTERFACE_FUNC getDroppedMessageCount(SizeT* count) = 0;
 };
 
 /*!@}*/
 
 OPENDAQ_DECLARE_CLASS_FACTORY(LIBRARY_FACTORY, LoggerThreadPool)
 
+OPENDAQ_DECLARE_CLASS_FACTORY_WITH_INTERFACE(
+    LIBRARY_FACTORY, LoggerThreadPoolWithPolicy, ILoggerThreadPool,
+    LogOverflowPolicy, overflowPolicy,
+    SizeT, queueSize
+)
+
 END_NAMESPACE_OPENDAQ
@@ -34,6 +34,16 @@ inline LoggerThreadPoolPtr LoggerThreadPool()
     return LoggerThreadPoolPtr(LoggerThreadPool_Create());
 }
 
+/*!
+ * @brief Creates a Logger Thread Pool object with the given queue overflow policy.
+ * @param overflowPolicy The policy applied when the message queue is full.
+ * @param queueSize The number of messages the queue can hold.
+ */
+inline LoggerThreadPoolPtr LoggerThreadPoolWithPolicy(LogOverflowPolicy overflowPolicy, SizeT queueSize = 8192)
+{
+    return LoggerThreadPoolPtr(LoggerThreadPoolWithPolicy_Create(overflowPolicy, queueSize));
+}
+
 /*!@}*/
 
 END_NAMESPACE_OPENDAQ
@@ -27,12 +27,20 @@ class LoggerThreadPoolImpl final : public ImplementationOf<ILoggerThreadPool, IL
 {
 public:
     LoggerThreadPoolImpl();
+    LoggerThreadPoolImpl(LogOverflowPolicy overflowPolicy, SizeT queueSize);
+
+    // ILoggerThreadPool
+    ErrCode INTERFACE_FUNC getOverflowPolicy(LogOverflowPolicy* policy) override;
+    ErrCode INTERFACE_FUNC getDroppedMessageCount(SizeT* count) override;
 
     // ILoggerThreadPoolPrivate
     ErrCode INTERFACE_FUNC getThreadPoolImpl(ThreadPoolPtr *impl) override;
 
 private:
+    static LogOverflowPolicy getDefaultOverflowPolicy();
+
     ThreadPoolPtr spdlogThreadPool;
+    LogOverflowPolicy overflowPolicy;
 };
 
 END_NAMESPACE_OPENDAQ
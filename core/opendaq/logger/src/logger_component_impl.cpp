@@ -22,6 +22,23 @@ static ILoggerThreadPoolPrivate::ThreadPoolPtr getThreadPool(const LoggerThreadP
     return threadPoolImpl;
 }
 
+#ifndef OPENDAQ_LOGGER_SYNC
+static spdlog::async_overflow_policy getOverflowPolicy(const LoggerThreadPoolPtr& threadPool)
+{
+    switch (threadPool.getOverflowPolicy())
+    {
+        case LogOverflowPolicy::OverrunOldest:
+            return spdlog::async_overflow_policy::overrun_oldest;
+        case LogOverflowPolicy::DiscardNew:
+            return spdlog::async_overflow_policy::discard_new;
+        case LogOverflowPolicy::Block:
+            break;
+    }
+
+    return spdlog::async_overflow_policy::block;
+}
+#endif
+
 LoggerComponentImpl::LoggerComponentImpl(const StringPtr& name, const ListPtr<ILoggerSink>& sinks,
                                          const LoggerThreadPoolPtr& threadPool, LogLevel level)
 #ifdef OPENDAQ_LOGGER_SYNC
@@ -34,7 +51,7 @@ LoggerComponentImpl::LoggerComponentImpl(const StringPtr& name, const ListPtr<IL
         name,
         std::initializer_list<spdlog::sink_ptr>(),
         getThreadPool(threadPool),
-        spdlog::async_overflow_policy::block)
+        getOverflowPolicy(threadPool))
     )
 #endif
     , threadPool(std::move(threadPool))
@@ -131,6 +148,21 @@ ErrCode LoggerComponentImpl::flushOnLevel(LogLevel level)
     return OPENDAQ_SUCCESS;
 }
 
+ErrCode LoggerComponentImpl::getDroppedMessageCount(SizeT* count)
+{
+    if (count == nullptr)
+    {
+        return makeErrorInfo(OPENDAQ_ERR_ARGUMENT_NULL, "Can not return by a null pointer.");
+    }
+
+#ifdef OPENDAQ_LOGGER_SYNC
+    *count = 0;
+    return OPENDAQ_SUCCESS;
+#else
+    return threadPool->getDroppedMessageCount(count);
+#endif
+}
+
 ErrCode LoggerComponentImpl::toString(CharPtr* str)
 {
     return daqDuplicateCharPtr(spdlogLogger->name().data(), str);
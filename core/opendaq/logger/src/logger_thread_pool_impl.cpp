@@ -1,12 +1,44 @@
 #include <opendaq/logger_thread_pool_impl.h>
 
 #include <coretypes/impl.h>
+#include <spdlog/spdlog.h>
+
+#include <cstdlib>
+#include <string>
 
 BEGIN_NAMESPACE_OPENDAQ
 
-LoggerThreadPoolImpl::LoggerThreadPoolImpl() :
-    spdlogThreadPool(std::make_shared<ThreadPool>(8192, 1, []{}))
+LoggerThreadPoolImpl::LoggerThreadPoolImpl()
+    : LoggerThreadPoolImpl(getDefaultOverflowPolicy(), 8192)
+{
+}
+
+LoggerThreadPoolImpl::LoggerThreadPoolImpl(LogOverflowPolicy overflowPolicy, SizeT queueSize)
+    : spdlogThreadPool(std::make_shared<ThreadPool>(queueSize, 1, []{}))
+    , overflowPolicy(overflowPolicy)
+{
+    if (queueSize == 0)
+        throw InvalidParameterException("Queue size must be greater than 0.");
+}
+
+ErrCode LoggerThreadPoolImpl::getOverflowPolicy(LogOverflowPolicy* policy)
+{
+    if (policy == nullptr)
+    {
+        return makeErrorInfo(OPENDAQ_ERR_ARGUMENT_NULL, "Can not return by a null pointer.");
+    }
+    *policy = overflowPolicy;
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode LoggerThreadPoolImpl::getDroppedMessageCount(SizeT* count)
 {
+    if (count == nullptr)
+    {
+        return makeErrorInfo(OPENDAQ_ERR_ARGUMENT_NULL, "Can not return by a null pointer.");
+    }
+    *count = spdlogThreadPool->overrun_counter() + spdlogThreadPool->discard_counter();
+    return OPENDAQ_SUCCESS;
 }
 
 ErrCode LoggerThreadPoolImpl::getThreadPoolImpl(ThreadPoolPtr *impl)
@@ -19,6 +51,34 @@ ErrCode LoggerThreadPoolImpl::getThreadPoolImpl(ThreadPoolPtr *impl)
     return OPENDAQ_SUCCESS;
 }
 
+LogOverflowPolicy LoggerThreadPoolImpl::getDefaultOverflowPolicy()
+{
+    const char* env = std::getenv("OPENDAQ_LOG_OVERFLOW_POLICY");
+    if (env == nullptr)
+        return LogOverflowPolicy::Block;
+
+    const std::string policy(env);
+    if (policy == "overrun_oldest")
+        return LogOverflowPolicy::OverrunOldest;
+    if (policy == "discard_new")
+        return LogOverflowPolicy::DiscardNew;
+    if (policy != "block")
+    {
+        // no openDAQ logger exists yet, so the warning goes to the default spdlog logger
+        spdlog::warn(R"(Unknown OPENDAQ_LOG_OVERFLOW_POLICY "{}"; accepted values are "block", "overrun_oldest" and "discard_new". Using "block".)",
+                     policy);
+    }
+
+    return LogOverflowPolicy::Block;
+}
+
 OPENDAQ_DEFINE_CLASS_FACTORY(LIBRARY_FACTORY, LoggerThreadPool)
 
+OPENDAQ_DEFINE_CLASS_FACTORY_WITH_INTERFACE_AND_CREATEFUNC(
+    LIBRARY_FACTORY, LoggerThreadPool,
+    ILoggerThreadPool, createLoggerThreadPoolWithPolicy,
+    LogOverflowPolicy, overflowPolicy,
+    SizeT, queueSize
+)
+
 END_NAMESPACE_OPENDAQ
@@ -0,0 +1,54 @@
+#ifdef OPENDAQ_LOG_LEVEL
+#undef OPENDAQ_LOG_LEVEL
+#endif
+
+#define OPENDAQ_LOG_LEVEL OPENDAQ_LOG_LEVEL_TRACE
+
+#include <gtest/gtest.h>
+#include <opendaq/logger_component_factory.h>
+#include <opendaq/logger_thread_pool_factory.h>
+#include <opendaq/custom_log.h>
+#include "slow_logger_sink.h"
+#include <coretypes/impl.h>
+#include <opendaq/logger_sink_ptr.h>
+
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+using namespace daq;
+
+using LoggerComponentBenchmark = testing::Test;
+
+TEST_F(LoggerComponentBenchmark, CallerLatencyUnderBackPressure)
+{
+    using namespace std::chrono;
+
+    const auto measure = [](LogOverflowPolicy policy)
+    {
+        auto sink = createWithImplementation<ILoggerSink, SlowLoggerSink>(microseconds(200));
+        auto loggerComponent = LoggerComponent("testLatency", {sink}, LoggerThreadPoolWithPolicy(policy, 64), LogLevel::Trace);
+
+        std::vector<int64_t> latencies;
+        for (int i = 0; i < 2000; ++i)
+        {
+            const auto start = steady_clock::now();
+            LOG_I("message {}", i)
+            latencies.push_back(duration_cast<nanoseconds>(steady_clock::now() - start).count());
+        }
+
+        std::sort(latencies.begin(), latencies.end());
+        return std::make_pair(latencies[latencies.size() / 2], latencies[latencies.size() * 99 / 100]);
+    };
+
+    const auto [blockP50, blockP99] = measure(LogOverflowPolicy::Block);
+    const auto [discardP50, discardP99] = measure(LogOverflowPolicy::DiscardNew);
+
+    RecordProperty("BlockP50Ns", std::to_string(blockP50));
+    RecordProperty("BlockP99Ns", std::to_string(blockP99));
+    RecordProperty("DiscardNewP50Ns", std::to_string(discardP50));
+    RecordProperty("DiscardNewP99Ns", std::to_string(discardP99));
+
+    // A blocked caller waits for the sink at least once per message
+    ASSERT_LT(discardP99, blockP99);
+}
@@ -0,0 +1,101 @@
+/*
+ * Copyright 2022-2024 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <coretypes/common.h>
+#include <coretypes/intfs.h>
+#include <opendaq/logger_sink.h>
+#include <opendaq/logger_sink_base_private.h>
+
+#include <spdlog/sinks/base_sink.h>
+
+#include <chrono>
+#include <mutex>
+#include <thread>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+// Simulates a sink with back-pressure, e.g. a file on slow storage
+class SlowSpdlogSink : public spdlog::sinks::base_sink<std::mutex>
+{
+public:
+    explicit SlowSpdlogSink(std::chrono::microseconds delay)
+        : delay(delay)
+    {
+    }
+
+protected:
+    void sink_it_(const spdlog::details::log_msg& /*msg*/) override
+    {
+        std::this_thread::sleep_for(delay);
+    }
+
+    void flush_() override
+    {
+    }
+
+private:
+    std::chrono::microseconds delay;
+};
+
+class SlowLoggerSink : public ImplementationOf<ILoggerSink, ILoggerSinkBasePrivate>
+{
+public:
+    explicit SlowLoggerSink(std::chrono::microseconds delay)
+        : sink(std::make_shared<SlowSpdlogSink>(delay))
+    {
+    }
+
+    ErrCode INTERFACE_FUNC setLevel(LogLevel level) override
+    {
+        sink->set_level(static_cast<spdlog::level::level_enum>(level));
+        return OPENDAQ_SUCCESS;
+    }
+
+    ErrCode INTERFACE_FUNC getLevel(LogLevel* level) override
+    {
+        *level = static_cast<LogLevel>(sink->level());
+        return OPENDAQ_SUCCESS;
+    }
+
+    ErrCode INTERFACE_FUNC shouldLog(LogLevel level, Bool* willLog) override
+    {
+        *willLog = sink->should_log(static_cast<spdlog::level::level_enum>(level));
+        return OPENDAQ_SUCCESS;
+    }
+
+    ErrCode INTERFACE_FUNC setPattern(IString* /*pattern*/) override
+    {
+        return OPENDAQ_SUCCESS;
+    }
+
+    ErrCode INTERFACE_FUNC flush() override
+    {
+        sink->flush();
+        return OPENDAQ_SUCCESS;
+    }
+
+    ErrCode INTERFACE_FUNC getSinkImpl(SinkPtr* sinkImp) override
+    {
+        *sinkImp = sink;
+        return OPENDAQ_SUCCESS;
+    }
+
+private:
+    SinkPtr sink;
+};
+
+END_NAMESPACE_OPENDAQ
@@ -13,10 +13,12 @@
 #include <opendaq/custom_log.h>
 #include "should_log.h"
 #include "invalid_logger_sink.h"
+#include "slow_logger_sink.h"
 #include <coretypes/listobject_factory.h>
 #include <coretypes/impl.h>
 #include <opendaq/logger_sink_ptr.h>
 
+#include <chrono>
 #include <thread>
 
 using namespace daq;
@@ -380,3 +382,72 @@ TEST_P(ShouldLogOff, Component)
 }
 
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(ShouldNotLogTrace);
+
+TEST_F(LoggerComponentTest, ThreadPoolDefaultPolicy)
+{
+    auto threadPool = LoggerThreadPool();
+    ASSERT_EQ(threadPool.getOverflowPolicy(), LogOverflowPolicy::Block);
+    ASSERT_EQ(threadPool.getDroppedMessageCount(), 0u);
+}
+
+TEST_F(LoggerComponentTest, ThreadPoolInvalidQueueSize)
+{
+    ASSERT_THROW(LoggerThreadPoolWithPolicy(LogOverflowPolicy::DiscardNew, 0), InvalidParameterException);
+}
+
+TEST_F(LoggerComponentTest, DroppedMessageCountNull)
+{
+    auto loggerComponent = LoggerComponent("test");
+    ASSERT_EQ(loggerComponent->getDroppedMessageCount(nullptr), OPENDAQ_ERR_ARGUMENT_NULL);
+}
+
+TEST_F(LoggerComponentTest, NonBlockingPolicyDropsUnderBackPressure)
+{
+    using namespace std::chrono_literals;
+
+    auto sink = createWithImplementation<ILoggerSink, SlowLoggerSink>(1ms);
+    auto threadPool = LoggerThreadPoolWithPolicy(LogOverflowPolicy::DiscardNew, 4);
+    auto loggerComponent = LoggerComponent("testDrop", {sink}, threadPool, LogLevel::Trace);
+
+    constexpr size_t messageCount = 1000;
+    for (size_t i = 0; i < messageCount; ++i)
+        LOG_I("message {}", i)
+
+    // The sink can process at most a few messages while the loop above runs
+    ASSERT_GT(loggerComponent.getDroppedMessageCount(), 0u);
+    ASSERT_EQ(loggerComponent.getDroppedMessageCount(), threadPool.getDroppedMessageCount());
+}
+
+TEST_F(LoggerComponentTest, FilteredMessagesAreNotFormatted)
+{
+    int formatCount = 0;
+    auto loggerComponent = LoggerComponent("testFilter", {StdErrLoggerSink()}, LoggerThreadPool(), LogLevel::Off);
+
+    const auto format = [&formatCount](int value)
+    {
+        ++formatCount;
+        return value;
+    };
+
+    LOG_E("value {}", format(1))
+    ASSERT_EQ(formatCount, 0);
+
+    loggerComponent.setLevel(LogLevel::Error);
+    LOG_E("value {}", format(1))
+    ASSERT_EQ(formatCount, 1);
+
+    loggerComponent.flush();
+}
+
+TEST_F(LoggerComponentTest, FormattedMacroIsSingleStatement)
+{
+    auto loggerComponent = LoggerComponent("testStatement", {StdErrLoggerSink()}, LoggerThreadPool(), LogLevel::Off);
+
+    bool elseTaken = false;
+    if (loggerComponent.getLevel() != LogLevel::Off)
+        LOG_I("value {}", 1)
+    else
+        elseTaken = true;
+
+    ASSERT_TRUE(elseTaken);
+}
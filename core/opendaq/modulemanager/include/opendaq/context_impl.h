@@ -23,9 +23,12 @@
 #include <coretypes/type_manager_ptr.h>
 #include <coreobjects/authentication_provider_ptr.h>
 #include <opendaq/discovery_server_ptr.h>
+#include <opendaq/core_event_bus_ptr.h>
 
 BEGIN_NAMESPACE_OPENDAQ
 
+class CoreEventBusImpl;
+
 class ContextImpl : public ImplementationOf<IContext, IContextInternal>
 {
 public:
@@ -48,6 +51,7 @@ public:
     ErrCode INTERFACE_FUNC getOptions(IDict** options) override;
     ErrCode INTERFACE_FUNC getModuleOptions(IString* moduleId, IDict** options) override;
     ErrCode INTERFACE_FUNC getDiscoveryServers(IDict** services) override;
+    ErrCode INTERFACE_FUNC getCoreEventBus(ICoreEventBus** bus) override;
 
 private:
     void componentCoreEventCallback(ComponentPtr& component, CoreEventArgsPtr& eventArgs);
@@ -59,6 +63,8 @@ private:
     TypeManagerPtr typeManager;
     AuthenticationProviderPtr authenticationProvider;
     EventEmitter<ComponentPtr, CoreEventArgsPtr> coreEvent;
+    CoreEventBusPtr coreEventBus;
+    CoreEventBusImpl* coreEventBusImpl;
     DictPtr<IString, IBaseObject> options;
     DictPtr<IString, IDiscoveryServer> discoveryServices;
 };
@@ -0,0 +1,104 @@
+/*
+ * Copyright 2022-2024 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <opendaq/core_event_bus.h>
+#include <opendaq/component_ptr.h>
+#include <opendaq/logger_ptr.h>
+#include <opendaq/logger_component_ptr.h>
+#include <coreobjects/core_event_args_ptr.h>
+#include <coretypes/procedure_ptr.h>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+class CoreEventBusImpl : public ImplementationOf<ICoreEventBus>
+{
+public:
+    explicit CoreEventBusImpl(const LoggerPtr& logger);
+    ~CoreEventBusImpl() override;
+
+    ErrCode INTERFACE_FUNC subscribe(IProcedure* handler, IList* eventIds, IString* componentGlobalId, IList* propertyNames, SizeT maxBatchSize, SizeT* id) override;
+    ErrCode INTERFACE_FUNC unsubscribe(SizeT id) override;
+    ErrCode INTERFACE_FUNC flush() override;
+    ErrCode INTERFACE_FUNC getDroppedEventCount(SizeT id, SizeT* count) override;
+
+    // Queues the event for the matching subscriptions; called by the Context on the thread that triggered the event.
+    void publish(const ComponentPtr& component, const CoreEventArgsPtr& args);
+
+    // Stops the dispatcher thread and removes all subscriptions.
+    void stop();
+
+    static constexpr SizeT MaxQueuedEvents = 10000;
+
+private:
+    struct QueuedEvent
+    {
+        ComponentPtr component;
+        CoreEventArgsPtr args;
+        std::string coalesceKey;
+        bool dropped{false};
+    };
+
+    struct Subscription
+    {
+        ProcedurePtr handler;
+        std::unordered_set<Int> eventIds;
+        std::string componentGlobalId;
+        std::unordered_set<std::string> propertyNames;
+        SizeT maxBatchSize{0};
+
+        std::deque<QueuedEvent> queue;
+        SizeT firstSequence{0};
+        std::unordered_map<std::string, SizeT> pendingValueChanges;
+        SizeT droppedEventCount{0};
+    };
+
+    bool matches(const Subscription& subscription, const std::string& globalId, bool hasComponent, const CoreEventArgsPtr& args) const;
+    void enqueue(Subscription& subscription,
+                 const ComponentPtr& component,
+                 const CoreEventArgsPtr& args,
+                 const std::string& coalesceKey,
+                 std::vector<QueuedEvent>& droppedEvents);
+    bool popEvent(Subscription& subscription, QueuedEvent& event);
+    ListPtr<IBaseObject> takeBatch(Subscription& subscription);
+    bool hasPendingEvents() const;
+    void dispatcherLoop();
+
+    LoggerComponentPtr loggerComponent;
+
+    std::mutex sync;
+    std::condition_variable eventsCv;
+    std::condition_variable idleCv;
+    std::map<SizeT, Subscription> subscriptions;
+    std::atomic<SizeT> subscriptionCount;
+    SizeT nextId;
+    SizeT dispatchingId;
+    bool dispatching;
+    bool stopped;
+    std::thread dispatcher;
+};
+
+END_NAMESPACE_OPENDAQ
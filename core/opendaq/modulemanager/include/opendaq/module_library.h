@@ -32,6 +32,16 @@ struct ModuleLibrary
     ModulePtr module;
 };
 
-ModuleLibrary loadModule(const LoggerComponentPtr& loggerComponent, const fs::path& path, IContext* context);
+boost::dll::shared_library openModuleLibrary(const LoggerComponentPtr& loggerComponent,
+                                             const fs::path& path,
+                                             boost::dll::load_mode::type mode = boost::dll::load_mode::default_mode);
+ModulePtr createModuleFromLibrary(const LoggerComponentPtr& loggerComponent,
+                                  const boost::dll::shared_library& moduleLibrary,
+                                  const fs::path& path,
+                                  IContext* context);
+ModuleLibrary loadModule(const LoggerComponentPtr& loggerComponent,
+                         const fs::path& path,
+                         IContext* context,
+                         boost::dll::load_mode::type mode = boost::dll::load_mode::default_mode);
 
 END_NAMESPACE_OPENDAQ
@@ -17,6 +17,7 @@
 #pragma once
 #include <opendaq/module_manager.h>
 #include <opendaq/module_manager_utils.h>
+#include <opendaq/module_manager_server_utils.h>
 #include <opendaq/context_ptr.h>
 #include <opendaq/logger_ptr.h>
 #include <opendaq/logger_component_ptr.h>
@@ -25,8 +26,14 @@
 #include <vector>
 #include <opendaq/mirrored_device_config_ptr.h>
 #include <opendaq/streaming_ptr.h>
+#include <opendaq/module_ptr.h>
 
+#include <opendaq/module_manifest_cache.h>
+
+#include <condition_variable>
+#include <functional>
 #include <map>
+#include <mutex>
 #include <thread>
 #include <boost/asio/executor_work_guard.hpp>
 #include <boost/asio/io_context.hpp>
@@ -35,7 +42,15 @@ BEGIN_NAMESPACE_OPENDAQ
 
 struct ModuleLibrary;
 
-class ModuleManagerImpl : public ImplementationOfWeak<IModuleManager, IModuleManagerUtils>
+struct LazyModuleLibrary
+{
+    fs::path path;
+    ModuleManifest manifest;
+    // Set while a call loads the library, so that it is loaded only once
+    bool loading = false;
+};
+
+class ModuleManagerImpl : public ImplementationOfWeak<IModuleManager, IModuleManagerUtils, IModuleManagerServerUtils>
 {
 public:
     explicit ModuleManagerImpl(const BaseObjectPtr& path);
@@ -53,6 +68,10 @@ public:
     ErrCode INTERFACE_FUNC createStreaming(IStreaming** streaming, IString* connectionString, IPropertyObject* config = nullptr) override;
     ErrCode INTERFACE_FUNC getAvailableStreamingTypes(IDict** streamingTypes) override;
     ErrCode INTERFACE_FUNC createDefaultAddDeviceConfig(IPropertyObject** defaultConfig) override;
+    ErrCode INTERFACE_FUNC createServer(IServer** server, IString* serverTypeId, IDevice* rootDevice, IPropertyObject* config = nullptr) override;
+
+    // Number of modules created so far, not counting the ones deferred by lazy loading
+    SizeT getLoadedModuleCount();
 
 private:
     static uint16_t getServerCapabilityPriority(const ServerCapabilityPtr& cap);
@@ -81,9 +100,26 @@ private:
     static StringPtr convertIfOldIdFB(const StringPtr& id);
     static StringPtr convertIfOldIdProtocol(const StringPtr& id);
 
+    static bool isLazyLoadingEnabled(const ContextPtr& context);
+    static std::string getManifestCachePath(const ContextPtr& context);
+    std::vector<ModulePtr> loadLazyModules(const std::function<bool(const ModuleManifest&)>& predicate);
+    std::vector<ModulePtr> loadAllLazyModules();
+
     bool modulesLoaded;
     std::vector<std::string> paths;
     std::vector<ModuleLibrary> libraries;
+
+    // Modules known from the manifest cache whose libraries have not been opened yet.
+    // The context is only held while such modules remain, as it is needed to create them.
+    std::vector<LazyModuleLibrary> lazyLibraries;
+    ContextPtr lazyContext;
+
+    // Guards libraries and lazyLibraries. Modules are called on a snapshot taken under the lock,
+    // as lazy loading can add libraries while other calls iterate them. Lazy libraries are loaded
+    // without the lock, and calls needing a library that is being loaded wait on lazyLibrariesLoaded.
+    std::mutex librariesSync;
+    std::condition_variable lazyLibrariesLoaded;
+
     LoggerPtr logger;
     LoggerComponentPtr loggerComponent;
 
@@ -0,0 +1,50 @@
+/*
+ * Copyright 2022-2024 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <opendaq/server.h>
+#include <opendaq/device.h>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+/*#
+ * [interfaceLibrary(IPropertyObject, "coreobjects")]
+ */
+
+/*!
+ * @ingroup opendaq_modules
+ * @addtogroup opendaq_module_manager Module manager server utils
+ * @{
+ */
+
+/*!
+ * @brief Creates servers through the module manager, so that a module that was not loaded yet
+ * can be loaded when one of its server types is requested.
+ */
+DECLARE_OPENDAQ_INTERFACE(IModuleManagerServerUtils, IBaseObject)
+{
+    /*!
+     * @brief Creates a server of the specified type using the first loaded module that provides it.
+     * @param[out] server The created server.
+     * @param serverTypeId The id of the server type to create.
+     * @param rootDevice The root device the server publishes.
+     * @param config The server configuration. In case of a null value, the module's default configuration is used.
+     */
+    virtual ErrCode INTERFACE_FUNC createServer(IServer** server, IString* serverTypeId, IDevice* rootDevice, IPropertyObject* config = nullptr) = 0;
+};
+/*!@}*/
+
+END_NAMESPACE_OPENDAQ
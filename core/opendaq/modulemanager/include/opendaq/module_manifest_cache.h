@@ -0,0 +1,93 @@
+/*
+ * Copyright 2022-2024 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+
+#include <coretypes/common.h>
+#include <coretypes/filesystem.h>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+enum class ModuleManifestStatus
+{
+    Module = 0,
+    NoEntryPoint
+};
+
+/*!
+ * @brief Cached outcome of probing a module library.
+ *
+ * Entries are keyed by the library path and are only valid while its modification time and
+ * size match the ones recorded when the library was probed. For modules, the manifest also
+ * lists the component types the module provides, which allows the module manager to defer
+ * loading the library until one of those types is requested.
+ */
+struct ModuleManifest
+{
+    std::string path;
+    int64_t modificationTime{};
+    uint64_t fileSize{};
+    ModuleManifestStatus status{ModuleManifestStatus::Module};
+    std::string moduleId;
+    std::string moduleName;
+    std::string version;
+    bool typesKnown{false};
+    std::vector<std::string> deviceConnectionPrefixes;
+    std::vector<std::string> functionBlockTypeIds;
+    std::vector<std::string> serverTypeIds;
+    std::vector<std::string> streamingConnectionPrefixes;
+};
+
+/*!
+ * @brief Persistent cache of module manifests used to skip re-probing unchanged libraries.
+ *
+ * The cache is stored as a line-based text file tagged with the version of the SDK that wrote it;
+ * a cache written by a different SDK version is discarded on load. Libraries that were found not
+ * to be modules are skipped on the next start-up without being opened. Dependency check failures
+ * are not cached, as they depend on the libraries the module is loaded next to rather than on the
+ * module library itself. All members are thread-safe.
+ */
+class ModuleManifestCache
+{
+public:
+    ModuleManifestCache(fs::path cacheFile, std::string sdkVersion);
+
+    void load();
+    bool save();
+
+    std::optional<ModuleManifest> find(const fs::path& libraryPath) const;
+    void update(const fs::path& libraryPath, ModuleManifest manifest);
+
+    const fs::path& getCacheFile() const;
+    static bool readFileKey(const fs::path& libraryPath, int64_t& modificationTime, uint64_t& fileSize);
+
+private:
+    static std::string getKey(const fs::path& libraryPath);
+
+    fs::path cacheFile;
+    std::string sdkVersion;
+    std::unordered_map<std::string, ModuleManifest> manifests;
+    bool dirty;
+    mutable std::mutex sync;
+};
+
+END_NAMESPACE_OPENDAQ
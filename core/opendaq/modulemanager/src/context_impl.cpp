@@ -4,6 +4,7 @@
 #include <opendaq/module_manager_ptr.h>
 #include <opendaq/component_private_ptr.h>
 #include <opendaq/custom_log.h>
+#include <opendaq/core_event_bus_impl.h>
 #include <coretypes/type_manager_private.h>
 #include <coreobjects/core_event_args_factory.h>
 #include <coreobjects/authentication_provider_factory.h>
@@ -24,6 +25,7 @@ ContextImpl::ContextImpl(SchedulerPtr scheduler,
     , authenticationProvider(std::move(authenticationProvider))
     , options(std::move(options))
     , discoveryServices(std::move(discoveryServices))
+    , coreEventBusImpl(nullptr)
 {
     if (!this->logger.assigned())
         throw ArgumentNullException("Logger must not be null");
@@ -31,6 +33,9 @@ ContextImpl::ContextImpl(SchedulerPtr scheduler,
     if (!this->authenticationProvider.assigned())
         this->authenticationProvider = AuthenticationProvider();
 
+    coreEventBus = createWithImplementation<ICoreEventBus, CoreEventBusImpl>(this->logger);
+    coreEventBusImpl = static_cast<CoreEventBusImpl*>(coreEventBus.getObject());
+
     if (this->moduleManager.assigned())
     {
         this->moduleManagerWeakRef = this->moduleManager;
@@ -66,6 +71,7 @@ ContextImpl::ContextImpl(SchedulerPtr scheduler,
 ContextImpl::~ContextImpl()
 {
     Event(this->coreEvent) -= event(&ContextImpl::componentCoreEventCallback);
+    coreEventBusImpl->stop();
 }
 
 ErrCode ContextImpl::getScheduler(IScheduler** scheduler)
@@ -185,6 +191,16 @@ ErrCode ContextImpl::getModuleOptions(IString* moduleId, IDict** options)
 
 void ContextImpl::componentCoreEventCallback(ComponentPtr& component, CoreEventArgsPtr& eventArgs)
 {
+    try
+    {
+        coreEventBusImpl->publish(component, eventArgs);
+    }
+    catch (const std::exception& e)
+    {
+        const auto loggerComponent = this->logger.getOrAddComponent("CoreEventBus");
+        LOG_W("Failed to publish core event {} to the core event bus: {}", eventArgs.getEventName(), e.what())
+    }
+
     if (!component.assigned())
         return;
 
@@ -217,6 +233,14 @@ ErrCode ContextImpl::getDiscoveryServers(IDict** services)
     return OPENDAQ_SUCCESS;
 }
 
+ErrCode ContextImpl::getCoreEventBus(ICoreEventBus** bus)
+{
+    OPENDAQ_PARAM_NOT_NULL(bus);
+
+    *bus = coreEventBus.addRefAndReturn();
+    return OPENDAQ_SUCCESS;
+}
+
 OPENDAQ_DEFINE_CLASS_FACTORY(
     LIBRARY_FACTORY,
     Context,
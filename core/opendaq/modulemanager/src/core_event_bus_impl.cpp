@@ -0,0 +1,357 @@
+#include <opendaq/core_event_bus_impl.h>
+#include <opendaq/custom_log.h>
+#include <coreobjects/core_event_args_ids.h>
+#include <coretypes/validation.h>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+namespace
+{
+
+std::string getStringParameter(const DictPtr<IString, IBaseObject>& parameters, const std::string& name)
+{
+    if (!parameters.hasKey(name))
+        return "";
+
+    const auto value = parameters.get(name).asPtrOrNull<IString>();
+    return value.assigned() ? value.toStdString() : "";
+}
+
+}
+
+CoreEventBusImpl::CoreEventBusImpl(const LoggerPtr& logger)
+    : loggerComponent(logger.assigned() ? logger.getOrAddComponent("CoreEventBus") : nullptr)
+    , subscriptionCount(0)
+    , nextId(1)
+    , dispatchingId(0)
+    , dispatching(false)
+    , stopped(false)
+{
+}
+
+CoreEventBusImpl::~CoreEventBusImpl()
+{
+    stop();
+}
+
+ErrCode CoreEventBusImpl::subscribe(
+    IProcedure* handler, IList* eventIds, IString* componentGlobalId, IList* propertyNames, SizeT maxBatchSize, SizeT* id)
+{
+    OPENDAQ_PARAM_NOT_NULL(handler);
+    OPENDAQ_PARAM_NOT_NULL(id);
+
+    return daqTry(
+        [&]()
+        {
+            Subscription subscription;
+            subscription.handler = handler;
+            subscription.maxBatchSize = maxBatchSize;
+
+            if (eventIds != nullptr)
+                for (const auto& eventId : ListPtr<IBaseObject>::Borrow(eventIds))
+                    subscription.eventIds.insert(static_cast<Int>(eventId));
+
+            if (componentGlobalId != nullptr)
+                subscription.componentGlobalId = StringPtr::Borrow(componentGlobalId).toStdString();
+
+            if (propertyNames != nullptr)
+                for (const auto& name : ListPtr<IBaseObject>::Borrow(propertyNames))
+                    subscription.propertyNames.insert(static_cast<std::string>(name));
+
+            std::scoped_lock lock(sync);
+            if (stopped)
+                return makeErrorInfo(OPENDAQ_ERR_INVALIDSTATE, "Core event bus is stopped");
+
+            *id = nextId++;
+            subscriptions.emplace(*id, std::move(subscription));
+            subscriptionCount++;
+
+            // the dispatcher is started by the first subscription, so that contexts without subscribers do not run a thread
+            if (!dispatcher.joinable())
+            {
+                this->addRef();
+                dispatcher = std::thread(&CoreEventBusImpl::dispatcherLoop, this);
+            }
+
+            return OPENDAQ_SUCCESS;
+        });
+}
+
+ErrCode CoreEventBusImpl::unsubscribe(SizeT id)
+{
+    // the handler and the pending events are released after unlocking
+    decltype(subscriptions)::node_type removed;
+    std::unique_lock lock(sync);
+
+    const auto it = subscriptions.find(id);
+    if (it == subscriptions.end())
+        return makeErrorInfo(OPENDAQ_ERR_NOTFOUND, "Core event bus subscription not found");
+
+    removed = subscriptions.extract(it);
+    subscriptionCount--;
+
+    if (std::this_thread::get_id() != dispatcher.get_id())
+        idleCv.wait(lock, [this, id] { return !dispatching || dispatchingId != id; });
+
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode CoreEventBusImpl::flush()
+{
+    std::unique_lock lock(sync);
+
+    if (std::this_thread::get_id() == dispatcher.get_id())
+        return OPENDAQ_SUCCESS;
+
+    idleCv.wait(lock, [this] { return stopped || (!dispatching && !hasPendingEvents()); });
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode CoreEventBusImpl::getDroppedEventCount(SizeT id, SizeT* count)
+{
+    OPENDAQ_PARAM_NOT_NULL(count);
+
+    std::scoped_lock lock(sync);
+
+    const auto it = subscriptions.find(id);
+    if (it == subscriptions.end())
+        return makeErrorInfo(OPENDAQ_ERR_NOTFOUND, "Core event bus subscription not found");
+
+    *count = it->second.droppedEventCount;
+    return OPENDAQ_SUCCESS;
+}
+
+void CoreEventBusImpl::publish(const ComponentPtr& component, const CoreEventArgsPtr& args)
+{
+    if (subscriptionCount == 0)
+        return;
+
+    const bool hasComponent = component.assigned();
+    const std::string globalId = hasComponent ? component.getGlobalId().toStdString() : "";
+
+    std::string coalesceKey;
+    if (args.getEventId() == static_cast<Int>(CoreEventId::PropertyValueChanged))
+    {
+        const auto parameters = args.getParameters();
+        coalesceKey = globalId + '\n' + getStringParameter(parameters, "Path") + '\n' + getStringParameter(parameters, "Name");
+    }
+
+    // dropped events are released after unlocking, as releasing them can trigger further events
+    std::vector<QueuedEvent> droppedEvents;
+    bool queued = false;
+    {
+        std::scoped_lock lock(sync);
+        if (stopped)
+            return;
+
+        for (auto& [id, subscription] : subscriptions)
+        {
+            if (!matches(subscription, globalId, hasComponent, args))
+                continue;
+
+            enqueue(subscription, component, args, coalesceKey, droppedEvents);
+            queued = true;
+        }
+    }
+
+    if (queued)
+        eventsCv.notify_one();
+}
+
+void CoreEventBusImpl::stop()
+{
+    decltype(subscriptions) removed;
+    {
+        std::scoped_lock lock(sync);
+        stopped = true;
+        removed.swap(subscriptions);
+        subscriptionCount = 0;
+    }
+
+    eventsCv.notify_all();
+    idleCv.notify_all();
+
+    if (!dispatcher.joinable())
+        return;
+
+    if (std::this_thread::get_id() == dispatcher.get_id())
+        dispatcher.detach();
+    else
+        dispatcher.join();
+}
+
+bool CoreEventBusImpl::matches(const Subscription& subscription,
+                               const std::string& globalId,
+                               bool hasComponent,
+                               const CoreEventArgsPtr& args) const
+{
+    if (!subscription.eventIds.empty() && subscription.eventIds.count(args.getEventId()) == 0)
+        return false;
+
+    if (!subscription.componentGlobalId.empty())
+    {
+        // a root ending with '/' accepts only its children
+        const auto& root = subscription.componentGlobalId;
+        if (!hasComponent || globalId.compare(0, root.size(), root) != 0)
+            return false;
+        if (globalId.size() > root.size() && root.back() != '/' && globalId[root.size()] != '/')
+            return false;
+    }
+
+    if (!subscription.propertyNames.empty())
+    {
+        const auto parameters = args.getParameters();
+        if (parameters.hasKey("Name"))
+            return subscription.propertyNames.count(getStringParameter(parameters, "Name")) != 0;
+
+        if (parameters.hasKey("UpdatedProperties"))
+        {
+            const DictPtr<IString, IBaseObject> updatedProperties = parameters.get("UpdatedProperties");
+            for (const auto& name : updatedProperties.getKeyList())
+                if (subscription.propertyNames.count(name.toStdString()) != 0)
+                    return true;
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void CoreEventBusImpl::enqueue(Subscription& subscription,
+                               const ComponentPtr& component,
+                               const CoreEventArgsPtr& args,
+                               const std::string& coalesceKey,
+                               std::vector<QueuedEvent>& droppedEvents)
+{
+    // the oldest events are dropped when the handler falls too far behind
+    while (subscription.queue.size() >= MaxQueuedEvents)
+    {
+        if (!popEvent(subscription, droppedEvents.emplace_back()))
+            continue;
+
+        if (subscription.droppedEventCount++ == 0 && loggerComponent.assigned())
+            LOG_W("Core event bus handler falls behind, the oldest queued events are dropped")
+    }
+
+    const SizeT sequence = subscription.firstSequence + subscription.queue.size();
+
+    if (!coalesceKey.empty())
+    {
+        // the pending change of the same property is dropped, so that only the latest value is delivered
+        const auto [it, inserted] = subscription.pendingValueChanges.try_emplace(coalesceKey, sequence);
+        if (!inserted)
+        {
+            subscription.queue[it->second - subscription.firstSequence].dropped = true;
+            it->second = sequence;
+        }
+    }
+
+    subscription.queue.push_back({component, args, coalesceKey});
+}
+
+bool CoreEventBusImpl::popEvent(Subscription& subscription, QueuedEvent& event)
+{
+    event = std::move(subscription.queue.front());
+    subscription.queue.pop_front();
+    const SizeT sequence = subscription.firstSequence++;
+
+    if (event.dropped)
+        return false;
+
+    if (!event.coalesceKey.empty())
+    {
+        const auto it = subscription.pendingValueChanges.find(event.coalesceKey);
+        if (it != subscription.pendingValueChanges.end() && it->second == sequence)
+            subscription.pendingValueChanges.erase(it);
+    }
+
+    return true;
+}
+
+ListPtr<IBaseObject> CoreEventBusImpl::takeBatch(Subscription& subscription)
+{
+    auto batch = List<IBaseObject>();
+    SizeT count = 0;
+
+    QueuedEvent event;
+    while (!subscription.queue.empty() && (subscription.maxBatchSize == 0 || count < subscription.maxBatchSize))
+    {
+        if (!popEvent(subscription, event))
+            continue;
+
+        batch.pushBack(List<IBaseObject>(event.component, event.args));
+        count++;
+    }
+
+    return batch;
+}
+
+bool CoreEventBusImpl::hasPendingEvents() const
+{
+    for (const auto& [id, subscription] : subscriptions)
+        if (!subscription.queue.empty())
+            return true;
+
+    return false;
+}
+
+void CoreEventBusImpl::dispatcherLoop()
+{
+    {
+        std::unique_lock lock(sync);
+
+        while (!stopped)
+        {
+            eventsCv.wait(lock, [this] { return stopped || hasPendingEvents(); });
+
+            std::vector<SizeT> pendingIds;
+            for (const auto& [id, subscription] : subscriptions)
+                if (!subscription.queue.empty())
+                    pendingIds.push_back(id);
+
+            // each subscription gets one batch per pass, so that a busy subscription does not hold back the others
+            for (const SizeT id : pendingIds)
+            {
+                if (stopped)
+                    break;
+
+                const auto it = subscriptions.find(id);
+                if (it == subscriptions.end())
+                    continue;
+
+                auto batch = takeBatch(it->second);
+                if (batch.getCount() == 0)
+                    continue;
+
+                auto handler = it->second.handler;
+                dispatchingId = id;
+                dispatching = true;
+                lock.unlock();
+
+                const ErrCode errCode = handler->dispatch(batch);
+                if (OPENDAQ_FAILED(errCode))
+                {
+                    daqClearErrorInfo();
+                    if (loggerComponent.assigned())
+                        LOG_W("Core event bus handler failed with error code {:#x}", errCode)
+                }
+
+                // the events and the handler are released before locking, as releasing them can trigger further events
+                batch.release();
+                handler.release();
+
+                lock.lock();
+                dispatching = false;
+                idleCv.notify_all();
+            }
+
+            if (!hasPendingEvents())
+                idleCv.notify_all();
+        }
+    }
+
+    // releases the reference taken when the dispatcher was started; the bus can be destroyed here
+    this->releaseRef();
+}
+
+END_NAMESPACE_OPENDAQ
@@ -28,14 +28,25 @@
 #include <coreobjects/property_object_protected_ptr.h>
 #include <coreobjects/property_internal_ptr.h>
 #include <coreobjects/property_object_internal.h>
+#include <opendaq/module_manifest_cache.h>
+#include <opendaq/scheduler_ptr.h>
+#include <opendaq/awaitable_ptr.h>
+#include <opendaq/version.h>
 
 BEGIN_NAMESPACE_OPENDAQ
 static OrphanedModules orphanedModules;
 
 static constexpr char createModuleFactory[] = "createModule";
 static constexpr char checkDependenciesFunc[] = "checkDependencies";
+static constexpr char manifestCacheFileName[] = ".opendaq_module_manifest";
 
-static std::vector<ModuleLibrary> enumerateModules(const LoggerComponentPtr& loggerComponent, std::string searchFolder, IContext* context);
+static std::vector<ModuleLibrary> enumerateModules(const LoggerComponentPtr& loggerComponent,
+                                                   std::string searchFolder,
+                                                   IContext* context,
+                                                   const SchedulerPtr& scheduler,
+                                                   bool lazyLoading,
+                                                   const std::string& manifestCachePath,
+                                                   std::vector<LazyModuleLibrary>& lazyLibraries);
 
 ModuleManagerImpl::ModuleManagerImpl(const BaseObjectPtr& path)
     : modulesLoaded(false)
@@ -90,11 +101,11 @@ ErrCode ModuleManagerImpl::getModules(IList** availableModules)
 {
     if (availableModules == nullptr)
         return OPENDAQ_ERR_ARGUMENT_NULL;
-    
+
     auto list = List<IModule>();
-    for (auto& library : libraries)
+    for (const auto& module : loadAllLazyModules())
     {
-        list.pushBack(library.module);
+        list.pushBack(module);
     }
 
     *availableModules = list.detach();
@@ -108,6 +119,7 @@ ErrCode ModuleManagerImpl::addModule(IModule* module)
     
     orphanedModules.tryUnload();
 
+    std::scoped_lock lock(librariesSync);
     const auto found = std::find_if(
         libraries.cbegin(),
         libraries.cend(),
@@ -136,6 +148,9 @@ ErrCode ModuleManagerImpl::loadModules(IContext* context)
         return makeErrorInfo(OPENDAQ_ERR_ARGUMENT_NULL, "Logger must not be null");
 
     loggerComponent = this->logger.getOrAddComponent("ModuleManager");
+    const auto scheduler = contextPtr.getScheduler();
+    const bool lazyLoading = isLazyLoadingEnabled(contextPtr);
+    const auto manifestCachePath = getManifestCachePath(contextPtr);
 
     return daqTry([&]()
     {
@@ -143,8 +158,12 @@ ErrCode ModuleManagerImpl::loadModules(IContext* context)
         {
             try
             {
-                auto localLibraries = enumerateModules(loggerComponent, path, context);
-                libraries.insert(libraries.end(), localLibraries.begin(), localLibraries.end());                
+                std::vector<LazyModuleLibrary> localLazyLibraries;
+                auto localLibraries = enumerateModules(loggerComponent, path, context, scheduler, lazyLoading, manifestCachePath, localLazyLibraries);
+
+                std::scoped_lock lock(librariesSync);
+                libraries.insert(libraries.end(), localLibraries.begin(), localLibraries.end());
+                lazyLibraries.insert(lazyLibraries.end(), localLazyLibraries.begin(), localLazyLibraries.end());
             }
             catch (const daq::DaqException& e)
             {
@@ -159,11 +178,148 @@ ErrCode ModuleManagerImpl::loadModules(IContext* context)
                 LOG_W(R"(Unknown error occured scanning directory "{}")", path)
             }
         }
+
+        std::scoped_lock lock(librariesSync);
+        if (!lazyLibraries.empty())
+        {
+            LOG_I("{} modules deferred until first use.", lazyLibraries.size())
+            lazyContext = contextPtr;
+        }
+
         modulesLoaded = true;
         return OPENDAQ_SUCCESS;
     });
 }
 
+bool ModuleManagerImpl::isLazyLoadingEnabled(const ContextPtr& context)
+{
+    const auto options = context.getOptions();
+    if (!options.assigned() || !options.hasKey("ModuleManager"))
+        return false;
+
+    const DictPtr<IString, IBaseObject> managerOptions = options.get("ModuleManager");
+    if (!managerOptions.assigned() || !managerOptions.hasKey("LazyLoading"))
+        return false;
+
+    return static_cast<bool>(managerOptions.get("LazyLoading"));
+}
+
+std::string ModuleManagerImpl::getManifestCachePath(const ContextPtr& context)
+{
+    const auto options = context.getOptions();
+    if (!options.assigned() || !options.hasKey("ModuleManager"))
+        return {};
+
+    const DictPtr<IString, IBaseObject> managerOptions = options.get("ModuleManager");
+    if (!managerOptions.assigned() || !managerOptions.hasKey("ManifestCachePath"))
+        return {};
+
+    const StringPtr path = managerOptions.get("ManifestCachePath").asPtrOrNull<IString>();
+    return path.assigned() ? path.toStdString() : std::string{};
+}
+
+// Set while the thread loads lazy libraries, as module factories may call back into the module manager
+static thread_local bool loadingLazyLibraries = false;
+
+std::vector<ModulePtr> ModuleManagerImpl::loadLazyModules(const std::function<bool(const ModuleManifest&)>& predicate)
+{
+    std::unique_lock lock(librariesSync);
+
+    std::vector<fs::path> claimed;
+    for (auto& lazyLibrary : lazyLibraries)
+    {
+        if (!lazyLibrary.loading && predicate(lazyLibrary.manifest))
+        {
+            lazyLibrary.loading = true;
+            claimed.push_back(lazyLibrary.path);
+        }
+    }
+
+    if (!claimed.empty())
+    {
+        const auto context = lazyContext;
+        lock.unlock();
+
+        const bool wasLoading = loadingLazyLibraries;
+        loadingLazyLibraries = true;
+
+        [[maybe_unused]]
+        Finally onExit([wasLoading]()
+        {
+            loadingLazyLibraries = wasLoading;
+        });
+
+        std::vector<ModuleLibrary> loaded;
+        for (const auto& path : claimed)
+        {
+            try
+            {
+                // Dependencies are resolved relative to the library, as the working directory is shared by all threads
+                loaded.push_back(loadModule(loggerComponent, path, context, boost::dll::load_mode::load_with_altered_search_path));
+            }
+            catch (const std::exception& e)
+            {
+                LOGP_W(e.what())
+            }
+            catch (...)
+            {
+                LOG_E("Unknown error occurred while loading a module", ".")
+            }
+        }
+
+        lock.lock();
+        libraries.insert(libraries.end(), loaded.begin(), loaded.end());
+        lazyLibraries.erase(std::remove_if(lazyLibraries.begin(),
+                                           lazyLibraries.end(),
+                                           [&claimed](const LazyModuleLibrary& lazyLibrary)
+                                           {
+                                               return std::find(claimed.begin(), claimed.end(), lazyLibrary.path) != claimed.end();
+                                           }),
+                            lazyLibraries.end());
+
+        if (lazyLibraries.empty())
+            lazyContext.release();
+
+        lazyLibrariesLoaded.notify_all();
+    }
+
+    // Libraries claimed by other calls are waited for, unless called back from a module factory on this thread
+    if (!loadingLazyLibraries)
+    {
+        lazyLibrariesLoaded.wait(lock,
+                                 [this, &predicate]()
+                                 {
+                                     return std::none_of(lazyLibraries.begin(),
+                                                         lazyLibraries.end(),
+                                                         [&predicate](const LazyModuleLibrary& lazyLibrary)
+                                                         { return lazyLibrary.loading && predicate(lazyLibrary.manifest); });
+                                 });
+    }
+
+    std::vector<ModulePtr> modules;
+    modules.reserve(libraries.size());
+    for (const auto& library : libraries)
+        modules.push_back(library.module);
+
+    return modules;
+}
+
+SizeT ModuleManagerImpl::getLoadedModuleCount()
+{
+    std::scoped_lock lock(librariesSync);
+    return libraries.size();
+}
+
+std::vector<ModulePtr> ModuleManagerImpl::loadAllLazyModules()
+{
+    return loadLazyModules([](const ModuleManifest&) { return true; });
+}
+
+static bool manifestContains(const std::vector<std::string>& list, const std::string& value)
+{
+    return std::find(list.begin(), list.end(), value) != list.end();
+}
+
 struct DevicePing
 {
     std::string address;
@@ -260,15 +416,15 @@ void ModuleManagerImpl::setAddressesReachable(const std::map<std::string, bool>&
 ErrCode ModuleManagerImpl::getAvailableDevices(IList** availableDevices)
 {
     OPENDAQ_PARAM_NOT_NULL(availableDevices);
+    const auto modules = loadAllLazyModules();
+
     auto availableDevicesPtr = List<IDeviceInfo>();
 
     using AsyncEnumerationResult = std::future<ListPtr<IDeviceInfo>>;
     std::vector<std::pair<AsyncEnumerationResult, ModulePtr>> enumerationResults;
 
-    for (const auto& library : libraries)
+    for (const auto& module : modules)
     {
-        const auto module = library.module;
-
         try
         {
             // Parallelize the process of each module enumerating/discovering available devices,
@@ -372,13 +528,12 @@ ErrCode ModuleManagerImpl::getAvailableDevices(IList** availableDevices)
 ErrCode ModuleManagerImpl::getAvailableDeviceTypes(IDict** deviceTypes)
 {
     OPENDAQ_PARAM_NOT_NULL(deviceTypes);
-    
+    const auto modules = loadAllLazyModules();
+
     auto availableTypes = Dict<IString, IDeviceType>();
 
-    for (const auto& library : libraries)
+    for (const auto& module : modules)
     {
-        const auto module = library.module;
-
         DictPtr<IString, IDeviceType> moduleDeviceTypes;
 
         try
@@ -499,9 +654,14 @@ ErrCode ModuleManagerImpl::createDevice(IDevice** device, IString* connectionStr
     PropertyObjectPtr generalConfig = isDefaultAddDeviceConfigRes ? configPtr.getPropertyValue("General").asPtr<IPropertyObject>() : PropertyObject();
     PropertyObjectPtr devConfig = isDefaultAddDeviceConfigRes ? configPtr.getPropertyValue("Device").asPtr<IPropertyObject>() : configPtr;
 
-    for (const auto& library : libraries)
+    const std::string devicePrefix = getPrefixFromConnectionString(connectionStringPtr);
+    const auto modules = loadLazyModules([&devicePrefix](const ModuleManifest& manifest)
+    {
+        return manifestContains(manifest.deviceConnectionPrefixes, devicePrefix);
+    });
+
+    for (const auto& module : modules)
     {
-        const auto module = library.module;
         const std::string prefix = getPrefixFromConnectionString(connectionStringPtr);
 
         DictPtr<IString, IDeviceType> types;
@@ -621,13 +781,12 @@ ErrCode ModuleManagerImpl::createDevice(IDevice** device, IString* connectionStr
 ErrCode ModuleManagerImpl::getAvailableFunctionBlockTypes(IDict** functionBlockTypes)
 {
     OPENDAQ_PARAM_NOT_NULL(functionBlockTypes);
+    const auto modules = loadAllLazyModules();
 
     auto availableTypes = Dict<IString, IFunctionBlockType>();
 
-    for (const auto& library : libraries)
+    for (const auto& module : modules)
     {
-        const auto module = library.module;
-        
         DictPtr<IString, IFunctionBlockType> types;
         try
         {
@@ -693,11 +852,13 @@ ErrCode ModuleManagerImpl::createFunctionBlock(IFunctionBlock** functionBlock, I
     OPENDAQ_PARAM_NOT_NULL(id);
 
     const StringPtr typeId = convertIfOldIdFB(StringPtr::Borrow(id));
+    const auto modules = loadLazyModules([typeIdStr = typeId.toStdString()](const ModuleManifest& manifest)
+    {
+        return manifestContains(manifest.functionBlockTypeIds, typeIdStr);
+    });
 
-    for (const auto& library : libraries)
+    for (const auto& module : modules)
     {
-        const auto module = library.module;
-        
         DictPtr<IString, IFunctionBlockType> types;
         try
         {
@@ -784,13 +945,12 @@ ErrCode ModuleManagerImpl::createStreaming(IStreaming** streaming, IString* conn
 ErrCode ModuleManagerImpl::getAvailableStreamingTypes(IDict** streamingTypes)
 {
     OPENDAQ_PARAM_NOT_NULL(streamingTypes);
+    const auto modules = loadAllLazyModules();
 
     auto availableTypes = Dict<IString, IStreamingType>();
 
-    for (const auto& library : libraries)
+    for (const auto& module : modules)
     {
-        const auto module = library.module;
-        
         DictPtr<IString, IStreamingType> types;
         try
         {
@@ -816,6 +976,38 @@ ErrCode ModuleManagerImpl::getAvailableStreamingTypes(IDict** streamingTypes)
     return OPENDAQ_SUCCESS;
 }
 
+ErrCode ModuleManagerImpl::createServer(IServer** server, IString* serverTypeId, IDevice* rootDevice, IPropertyObject* config)
+{
+    OPENDAQ_PARAM_NOT_NULL(server);
+    OPENDAQ_PARAM_NOT_NULL(serverTypeId);
+
+    const auto typeId = StringPtr::Borrow(serverTypeId);
+    const auto modules = loadLazyModules([typeIdStr = typeId.toStdString()](const ModuleManifest& manifest)
+    {
+        return manifestContains(manifest.serverTypeIds, typeIdStr);
+    });
+
+    for (const auto& module : modules)
+    {
+        DictPtr<IString, IServerType> serverTypes;
+        try
+        {
+            serverTypes = module.getAvailableServerTypes();
+        }
+        catch (const NotImplementedException&)
+        {
+            serverTypes = nullptr;
+        }
+
+        if (!serverTypes.assigned() || !serverTypes.hasKey(typeId))
+            continue;
+
+        return module->createServer(server, typeId, rootDevice, config);
+    }
+
+    return OPENDAQ_ERR_NOTFOUND;
+}
+
 ErrCode ModuleManagerImpl::createDefaultAddDeviceConfig(IPropertyObject** defaultConfig)
 {
     OPENDAQ_PARAM_NOT_NULL(defaultConfig);
@@ -1035,10 +1227,14 @@ StreamingPtr ModuleManagerImpl::onCreateStreaming(const StringPtr& connectionStr
     PropertyObjectPtr generalConfig = isDefaultDeviceConfig ? config.getPropertyValue("General").asPtr<IPropertyObject>() : PropertyObject();
     PropertyObjectPtr streamingConfig = isDefaultAddDeviceConfig(config) ? config.getPropertyValue("Streaming").asPtr<IPropertyObject>() : config;
 
-    for (const auto& library : libraries)
+    const std::string streamingPrefix = getPrefixFromConnectionString(connectionString);
+    const auto modules = loadLazyModules([&streamingPrefix](const ModuleManifest& manifest)
+    {
+        return manifestContains(manifest.streamingConnectionPrefixes, streamingPrefix);
+    });
+
+    for (const auto& module : modules)
     {
-        const auto module = library.module;
-    
         const std::string prefix = getPrefixFromConnectionString(connectionString);
         DictPtr<IString, IStreamingType> types;
         module->getAvailableStreamingTypes(&types);
@@ -1087,11 +1283,12 @@ StreamingPtr ModuleManagerImpl::onCreateStreaming(const StringPtr& connectionStr
 
 void ModuleManagerImpl::completeServerCapabilities(const ServerCapabilityPtr& source, const ListPtr<IServerCapability>& targetCaps)
 {
+    const auto modules = loadAllLazyModules();
+
     for (const auto& target : targetCaps)
     {
-        for (const auto& library : libraries)
+        for (const auto& module : modules)
         {
-            const auto module = library.module;
             try
             {
                 if (module.completeServerCapability(source, target))
@@ -1255,7 +1452,143 @@ bool ModuleManagerImpl::isDefaultAddDeviceConfig(const PropertyObjectPtr& config
     return config.hasProperty("General") && config.hasProperty("Streaming") && config.hasProperty("Device");
 }
 
-std::vector<ModuleLibrary> enumerateModules(const LoggerComponentPtr& loggerComponent, std::string searchFolder, IContext* context)
+static fs::path getManifestCacheFile(const std::string& searchFolder, const std::string& manifestCachePath)
+{
+    std::string cachePath = manifestCachePath;
+    if (const auto envPath = std::getenv("OPENDAQ_MODULES_MANIFEST"); envPath != nullptr)
+        cachePath = envPath;
+
+    if (cachePath == "[[none]]")
+        return {};
+
+    if (cachePath.empty())
+        return fs::absolute(searchFolder) / manifestCacheFileName;
+
+    // Each module folder gets its own cache file in the configured folder
+    const auto folderKey = fs::absolute(searchFolder).lexically_normal().generic_string();
+    return fs::absolute(cachePath) / fmt::format("{}_{:016x}", manifestCacheFileName, std::hash<std::string>{}(folderKey));
+}
+
+static std::string getSdkVersion()
+{
+    unsigned int major{};
+    unsigned int minor{};
+    unsigned int patch{};
+    daqOpenDaqGetVersion(&major, &minor, &patch);
+    return fmt::format("{}.{}.{}", major, minor, patch);
+}
+
+struct ModuleCandidate
+{
+    fs::path path;
+    boost::dll::shared_library handle;
+    std::string error;
+    std::optional<ModuleManifestStatus> rejectedStatus;
+};
+
+static void openModuleCandidate(const LoggerComponentPtr& loggerComponent, ModuleCandidate& candidate)
+{
+    try
+    {
+        candidate.handle = openModuleLibrary(loggerComponent, candidate.path);
+    }
+    catch (const ModuleNoEntryPointException& e)
+    {
+        candidate.error = e.what();
+        candidate.rejectedStatus = ModuleManifestStatus::NoEntryPoint;
+    }
+    catch (const std::exception& e)
+    {
+        candidate.error = e.what();
+    }
+    catch (...)
+    {
+        candidate.error = "Unknown error occurred while loading a module";
+    }
+}
+
+static void openModuleCandidates(const LoggerComponentPtr& loggerComponent,
+                                 std::vector<ModuleCandidate>& candidates,
+                                 const SchedulerPtr& scheduler)
+{
+    if (!scheduler.assigned() || !scheduler.isMultiThreaded() || candidates.size() < 2)
+    {
+        for (auto& candidate : candidates)
+            openModuleCandidate(loggerComponent, candidate);
+        return;
+    }
+
+    // Opening a library and checking its dependencies does not touch the context,
+    // so it can be spread across the scheduler workers.
+    std::vector<AwaitablePtr> pending;
+    pending.reserve(candidates.size());
+
+    for (auto& candidate : candidates)
+    {
+        pending.push_back(scheduler.scheduleFunction([&loggerComponent, &candidate]()
+        {
+            openModuleCandidate(loggerComponent, candidate);
+            return true;
+        }));
+    }
+
+    for (const auto& awaitable : pending)
+        awaitable.wait();
+}
+
+template <typename GetTypes, typename GetKey>
+static void collectManifestTypes(GetTypes getTypes, std::vector<std::string>& target, GetKey getKey)
+{
+    decltype(getTypes()) types;
+    try
+    {
+        types = getTypes();
+    }
+    catch (const NotImplementedException&)
+    {
+        return;
+    }
+
+    if (!types.assigned())
+        return;
+
+    for (const auto& [id, type] : types)
+        target.push_back(getKey(id, type));
+}
+
+static bool fillManifestTypes(const ModulePtr& module, ModuleManifest& manifest)
+{
+    try
+    {
+        collectManifestTypes([&module] { return module.getAvailableDeviceTypes(); },
+                             manifest.deviceConnectionPrefixes,
+                             [](const StringPtr&, const DeviceTypePtr& type) { return type.getConnectionStringPrefix().toStdString(); });
+        collectManifestTypes([&module] { return module.getAvailableFunctionBlockTypes(); },
+                             manifest.functionBlockTypeIds,
+                             [](const StringPtr& id, const FunctionBlockTypePtr&) { return id.toStdString(); });
+        collectManifestTypes([&module] { return module.getAvailableServerTypes(); },
+                             manifest.serverTypeIds,
+                             [](const StringPtr& id, const ServerTypePtr&) { return id.toStdString(); });
+        collectManifestTypes([&module] { return module.getAvailableStreamingTypes(); },
+                             manifest.streamingConnectionPrefixes,
+                             [](const StringPtr&, const StreamingTypePtr& type) { return type.getConnectionStringPrefix().toStdString(); });
+    }
+    catch (...)
+    {
+        // A module that cannot list its types is always loaded eagerly
+        return false;
+    }
+
+    return true;
+}
+
+std::vector<ModuleLibrary> enumerateModules(const LoggerComponentPtr& loggerComponent,
+                                            std::string searchFolder,
+                                            IContext* context,
+                                            const SchedulerPtr& scheduler,
+                                            bool lazyLoading,
+                                            const std::string& manifestCachePath,
+                                            std::vector<LazyModuleLibrary>& lazyLibraries)
 {
     orphanedModules.tryUnload();
 
@@ -1292,11 +1625,19 @@ std::vector<ModuleLibrary> enumerateModules(const LoggerComponentPtr& loggerComp
     auto loadPath = fs::absolute(searchFolder).string();
     LOG_I("Loading modules from '{}'", fs::absolute(searchFolder).string())
 
+    std::optional<ModuleManifestCache> manifestCache;
+    if (const auto cacheFile = getManifestCacheFile(searchFolder, manifestCachePath); !cacheFile.empty())
+    {
+        manifestCache.emplace(cacheFile, getSdkVersion());
+        manifestCache->load();
+    }
+
     std::vector<ModuleLibrary> moduleDrivers;
     fs::recursive_directory_iterator dirIterator(searchFolder);
+    const auto initialWorkingDir = fs::current_path();
 
     [[maybe_unused]]
-    Finally onExit([workingDir = fs::current_path()]()
+    Finally onExit([workingDir = initialWorkingDir]()
     {
         fs::current_path(workingDir);
     });
@@ -1304,6 +1645,8 @@ std::vector<ModuleLibrary> enumerateModules(const LoggerComponentPtr& loggerComp
     fs::current_path(searchFolder);
     auto currPath = fs::current_path().string();
 
+    std::vector<ModuleCandidate> candidates;
+
     const auto endIter = fs::recursive_directory_iterator();
     while (dirIterator != endIter)
     {
@@ -1317,23 +1660,78 @@ std::vector<ModuleLibrary> enumerateModules(const LoggerComponentPtr& loggerComp
         const fs::path& entryPath = entry.path();
         const auto filename = entryPath.filename().u8string();
 
-        if (boost::algorithm::ends_with(filename, OPENDAQ_MODULE_SUFFIX))
+        if (!boost::algorithm::ends_with(filename, OPENDAQ_MODULE_SUFFIX))
+            continue;
+
+        if (manifestCache)
         {
-            try
+            const auto manifest = manifestCache->find(entryPath);
+            if (manifest && manifest->status != ModuleManifestStatus::Module)
             {
-                moduleDrivers.push_back(loadModule(loggerComponent, entryPath, context));
+                LOG_D("Skipping \"{}\": cached manifest marks it as not loadable.", entryPath.string());
+                continue;
             }
-            catch (const std::exception& e)
+
+            if (manifest && lazyLoading && manifest->typesKnown)
             {
-                LOGP_W(e.what())
+                LOG_D("Deferring loading of module {} from \"{}\".", manifest->moduleName, entryPath.string());
+                lazyLibraries.push_back({initialWorkingDir / entryPath, manifest.value()});
+                continue;
             }
-            catch (...)
+        }
+
+        candidates.push_back({entryPath});
+    }
+
+    openModuleCandidates(loggerComponent, candidates, scheduler);
+
+    // Modules are created in enumeration order on the calling thread, as module factories
+    // are free to use the context without synchronization.
+    for (auto& candidate : candidates)
+    {
+        if (!candidate.error.empty())
+        {
+            LOGP_W(candidate.error)
+            if (manifestCache && candidate.rejectedStatus.has_value())
+            {
+                ModuleManifest manifest;
+                manifest.status = candidate.rejectedStatus.value();
+                manifestCache->update(candidate.path, std::move(manifest));
+            }
+            continue;
+        }
+
+        try
+        {
+            auto module = createModuleFromLibrary(loggerComponent, candidate.handle, candidate.path, context);
+            if (manifestCache)
             {
-                LOG_E("Unknown error occurred wile loading a module", ".")
+                ModuleManifest manifest;
+                manifest.status = ModuleManifestStatus::Module;
+                manifest.moduleId = module.getId().toStdString();
+                manifest.moduleName = module.getName().toStdString();
+                if (auto version = module.getVersionInfo(); version.assigned())
+                    manifest.version = fmt::format("{}.{}.{}", version.getMajor(), version.getMinor(), version.getPatch());
+                manifest.typesKnown = fillManifestTypes(module, manifest);
+
+                manifestCache->update(candidate.path, std::move(manifest));
             }
+
+            moduleDrivers.push_back({std::move(candidate.handle), module});
+        }
+        catch (const std::exception& e)
+        {
+            LOGP_W(e.what())
+        }
+        catch (...)
+        {
+            LOG_E("Unknown error occurred while loading a module", ".")
         }
     }
 
+    if (manifestCache && !manifestCache->save())
+        LOG_W("Module manifest cache \"{}\" could not be written.", manifestCache->getCacheFile().string())
+
     return moduleDrivers;
 }
 
@@ -1373,14 +1771,15 @@ static void printAvailableTypes(const ModulePtr& module, const LoggerComponentPt
     printComponentTypes([&module](){return module.getAvailableServerTypes(); }, "SRV", loggerComponent);
 }
 
-ModuleLibrary loadModule(const LoggerComponentPtr& loggerComponent, const fs::path& path, IContext* context)
+boost::dll::shared_library openModuleLibrary(const LoggerComponentPtr& loggerComponent,
+                                             const fs::path& path,
+                                             boost::dll::load_mode::type mode)
 {
-    auto currDir = fs::current_path();
     auto relativePath = fs::proximate(path).string();
     LOG_T("Loading module \"{}\".", relativePath);
 
     std::error_code libraryErrCode;
-    boost::dll::shared_library moduleLibrary(path, libraryErrCode);
+    boost::dll::shared_library moduleLibrary(path, mode, libraryErrCode);
 
     if (libraryErrCode)
     {
@@ -1426,6 +1825,16 @@ ModuleLibrary loadModule(const LoggerComponentPtr& loggerComponent, const fs::pa
         throw ModuleNoEntryPointException("Module \"{}\" has no exported module factory.", relativePath);
     }
 
+    return moduleLibrary;
+}
+
+ModulePtr createModuleFromLibrary(const LoggerComponentPtr& loggerComponent,
+                                  const boost::dll::shared_library& moduleLibrary,
+                                  const fs::path& path,
+                                  IContext* context)
+{
+    auto relativePath = fs::proximate(path).string();
+
     using ModuleFactory = ErrCode(IModule**, IContext*);
     ModuleFactory* factory = moduleLibrary.get<ModuleFactory>(createModuleFactory);
 
@@ -1457,6 +1866,17 @@ ModuleLibrary loadModule(const LoggerComponentPtr& loggerComponent, const fs::pa
 
     printAvailableTypes(module, loggerComponent);
 
+    return module;
+}
+
+ModuleLibrary loadModule(const LoggerComponentPtr& loggerComponent,
+                         const fs::path& path,
+                         IContext* context,
+                         boost::dll::load_mode::type mode)
+{
+    auto moduleLibrary = openModuleLibrary(loggerComponent, path, mode);
+    auto module = createModuleFromLibrary(loggerComponent, moduleLibrary, path, context);
+
     return { std::move(moduleLibrary), module };
 }
 
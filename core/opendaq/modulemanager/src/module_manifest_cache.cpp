@@ -0,0 +1,223 @@
+#include <opendaq/module_manifest_cache.h>
+#include <fstream>
+#include <sstream>
+#include <vector>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+static constexpr char manifestHeader[] = "openDAQ module manifest v3";
+static constexpr char fieldSeparator = '\t';
+static constexpr char listSeparator = ';';
+static constexpr size_t fieldCount = 12;
+
+static std::vector<std::string> splitFields(const std::string& line, char separator)
+{
+    std::vector<std::string> fields;
+    std::string field;
+    std::istringstream stream(line);
+    while (std::getline(stream, field, separator))
+        fields.push_back(field);
+
+    // Trailing empty field is dropped by getline
+    if (!line.empty() && line.back() == separator)
+        fields.emplace_back();
+
+    return fields;
+}
+
+static std::vector<std::string> splitList(const std::string& field)
+{
+    if (field.empty())
+        return {};
+    return splitFields(field, listSeparator);
+}
+
+static std::string joinList(const std::vector<std::string>& list)
+{
+    std::string joined;
+    for (const auto& item : list)
+    {
+        if (!joined.empty())
+            joined += listSeparator;
+        joined += item;
+    }
+    return joined;
+}
+
+ModuleManifestCache::ModuleManifestCache(fs::path cacheFile, std::string sdkVersion)
+    : cacheFile(std::move(cacheFile))
+    , sdkVersion(std::move(sdkVersion))
+    , dirty(false)
+{
+}
+
+void ModuleManifestCache::load()
+{
+    std::scoped_lock lock(sync);
+
+    manifests.clear();
+    dirty = false;
+
+    std::ifstream file(cacheFile);
+    if (!file.is_open())
+        return;
+
+    std::string line;
+    if (!std::getline(file, line) || line != manifestHeader)
+        return;
+
+    // Entries written by a different SDK version are re-probed
+    if (!std::getline(file, line) || line != sdkVersion)
+        return;
+
+    while (std::getline(file, line))
+    {
+        auto fields = splitFields(line, fieldSeparator);
+        if (fields.size() != fieldCount)
+            continue;
+
+        try
+        {
+            ModuleManifest manifest;
+            manifest.path = fields[0];
+            manifest.modificationTime = std::stoll(fields[1]);
+            manifest.fileSize = std::stoull(fields[2]);
+            const auto status = std::stoi(fields[3]);
+            if (status != static_cast<int>(ModuleManifestStatus::Module) && status != static_cast<int>(ModuleManifestStatus::NoEntryPoint))
+                continue;
+
+            manifest.status = static_cast<ModuleManifestStatus>(status);
+            manifest.moduleId = fields[4];
+            manifest.moduleName = fields[5];
+            manifest.version = fields[6];
+            manifest.typesKnown = fields[7] == "1";
+            manifest.deviceConnectionPrefixes = splitList(fields[8]);
+            manifest.functionBlockTypeIds = splitList(fields[9]);
+            manifest.serverTypeIds = splitList(fields[10]);
+            manifest.streamingConnectionPrefixes = splitList(fields[11]);
+
+            manifests.insert_or_assign(manifest.path, std::move(manifest));
+        }
+        catch (const std::exception&)
+        {
+            // Corrupted entries are ignored and re-probed
+        }
+    }
+}
+
+bool ModuleManifestCache::save()
+{
+    std::scoped_lock lock(sync);
+
+    if (!dirty)
+        return true;
+
+    std::error_code errCode;
+    if (cacheFile.has_parent_path())
+        fs::create_directories(cacheFile.parent_path(), errCode);
+
+    // Written next to the cache and renamed over it, so that concurrently starting processes
+    // never read a partially written cache
+    auto tempFile = cacheFile;
+    tempFile += ".tmp";
+
+    {
+        std::ofstream file(tempFile, std::ios::trunc);
+        if (!file.is_open())
+            return false;
+
+        file << manifestHeader << '\n' << sdkVersion << '\n';
+        for (const auto& [_, manifest] : manifests)
+        {
+            file << manifest.path << fieldSeparator
+                 << manifest.modificationTime << fieldSeparator
+                 << manifest.fileSize << fieldSeparator
+                 << static_cast<int>(manifest.status) << fieldSeparator
+                 << manifest.moduleId << fieldSeparator
+                 << manifest.moduleName << fieldSeparator
+                 << manifest.version << fieldSeparator
+                 << (manifest.typesKnown ? "1" : "0") << fieldSeparator
+                 << joinList(manifest.deviceConnectionPrefixes) << fieldSeparator
+                 << joinList(manifest.functionBlockTypeIds) << fieldSeparator
+                 << joinList(manifest.serverTypeIds) << fieldSeparator
+                 << joinList(manifest.streamingConnectionPrefixes) << '\n';
+        }
+
+        file.flush();
+        if (!file.good())
+        {
+            file.close();
+            fs::remove(tempFile, errCode);
+            return false;
+        }
+    }
+
+    fs::rename(tempFile, cacheFile, errCode);
+    if (errCode)
+    {
+        fs::remove(tempFile, errCode);
+        return false;
+    }
+
+    dirty = false;
+    return true;
+}
+
+std::optional<ModuleManifest> ModuleManifestCache::find(const fs::path& libraryPath) const
+{
+    int64_t modificationTime;
+    uint64_t fileSize;
+    if (!readFileKey(libraryPath, modificationTime, fileSize))
+        return std::nullopt;
+
+    std::scoped_lock lock(sync);
+
+    const auto it = manifests.find(getKey(libraryPath));
+    if (it == manifests.end())
+        return std::nullopt;
+
+    if (it->second.modificationTime != modificationTime || it->second.fileSize != fileSize)
+        return std::nullopt;
+
+    return it->second;
+}
+
+void ModuleManifestCache::update(const fs::path& libraryPath, ModuleManifest manifest)
+{
+    if (!readFileKey(libraryPath, manifest.modificationTime, manifest.fileSize))
+        return;
+
+    manifest.path = getKey(libraryPath);
+
+    std::scoped_lock lock(sync);
+    manifests.insert_or_assign(manifest.path, std::move(manifest));
+    dirty = true;
+}
+
+const fs::path& ModuleManifestCache::getCacheFile() const
+{
+    return cacheFile;
+}
+
+bool ModuleManifestCache::readFileKey(const fs::path& libraryPath, int64_t& modificationTime, uint64_t& fileSize)
+{
+    std::error_code errCode;
+    const auto writeTime = fs::last_write_time(libraryPath, errCode);
+    if (errCode)
+        return false;
+
+    const auto size = fs::file_size(libraryPath, errCode);
+    if (errCode)
+        return false;
+
+    modificationTime = static_cast<int64_t>(writeTime.time_since_epoch().count());
+    fileSize = static_cast<uint64_t>(size);
+    return true;
+}
+
+std::string ModuleManifestCache::getKey(const fs::path& libraryPath)
+{
+    return libraryPath.lexically_normal().generic_string();
+}
+
+END_NAMESPACE_OPENDAQ
@@ -0,0 +1,69 @@
+#include <opendaq/module_manager_factory.h>
+#include <opendaq/context_factory.h>
+#include <opendaq/scheduler_factory.h>
+#include <opendaq/logger_factory.h>
+#include <testutils/testutils.h>
+#include <coretypes/filesystem.h>
+#include <boost/dll/runtime_symbol_info.hpp>
+
+#include <chrono>
+
+using namespace daq;
+
+class ModuleManagerBenchmark : public testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        logger = Logger();
+        workingDir = fs::current_path();
+        fs::current_path(boost::dll::program_location().remove_filename());
+    }
+
+    void TearDown() override
+    {
+        fs::current_path(workingDir);
+    }
+
+    static fs::path GetMockModulePath(const std::string& moduleFileName)
+    {
+        return fs::path(MODULE_TEST_DIR) / moduleFileName;
+    }
+
+    fs::path workingDir;
+    LoggerPtr logger;
+};
+
+TEST_F(ModuleManagerBenchmark, ColdAndWarmStartupWithManyLibraries)
+{
+    using namespace std::chrono;
+    constexpr int libraryCount = 64;
+
+    const fs::path dir = fs::absolute(fs::temp_directory_path() / "opendaq_bench_manifest_startup");
+    fs::remove_all(dir);
+    fs::create_directories(dir);
+
+    for (int i = 0; i < libraryCount; ++i)
+    {
+        const auto libraryPath = dir / fmt::format("library_{}{}", i, OPENDAQ_MODULE_SUFFIX);
+        fs::copy_file(GetMockModulePath(EMPTY_MODULE_FILE_NAME), libraryPath);
+    }
+
+    const auto loadAll = [&]()
+    {
+        const auto start = steady_clock::now();
+        auto manager = ModuleManager(dir.string());
+        auto ctx = Context(Scheduler(logger), logger, nullptr, manager, nullptr);
+        EXPECT_EQ(manager.getModules().getCount(), 0u);
+        return duration_cast<microseconds>(steady_clock::now() - start).count();
+    };
+
+    const auto cold = loadAll();
+    ASSERT_TRUE(fs::exists(dir / ".opendaq_module_manifest"));
+    const auto warm = loadAll();
+
+    RecordProperty("ColdStartupUs", std::to_string(cold));
+    RecordProperty("WarmStartupUs", std::to_string(warm));
+
+    fs::remove_all(dir);
+}
@@ -5,6 +5,7 @@
 #include <coretypes/listobject_factory.h>
 #include <coretypes/validation.h>
 #include <coretypes/dictobject_factory.h>
+#include <opendaq/device_type_factory.h>
 
 using namespace daq;
 
@@ -30,7 +31,10 @@ ErrCode MockModuleImpl::getAvailableDeviceTypes(IDict** deviceTypes)
 {
     OPENDAQ_PARAM_NOT_NULL(deviceTypes);
 
-    *deviceTypes = Dict<IString, IDeviceType>().detach();
+    auto types = Dict<IString, IDeviceType>();
+    types.set("MockDevice", DeviceType("MockDevice", "Mock device", "Device type without devices", "daqmock"));
+
+    *deviceTypes = types.detach();
     return OPENDAQ_SUCCESS;
 }
 
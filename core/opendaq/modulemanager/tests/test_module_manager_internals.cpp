@@ -6,7 +6,14 @@
 #include <opendaq/logger_ptr.h>
 #include <opendaq/logger_component_ptr.h>
 #include <opendaq/logger_factory.h>
+#include <opendaq/module_manifest_cache.h>
+#include <opendaq/module_manager_factory.h>
+#include <opendaq/context_factory.h>
+#include <opendaq/scheduler_factory.h>
+#include <opendaq/module_manager_utils_ptr.h>
 
+#include <chrono>
+#include <fstream>
 #include <thread>
 
 using namespace daq;
@@ -92,3 +99,215 @@ TEST_F(ModuleManagerInternalsTest, ModuleDependenciesCheckSucceed)
 
     ASSERT_EQ(lib.module.getName(), "MockModule");
 }
+
+TEST_F(ModuleManagerInternalsTest, OpenLibraryDoesNotCreateModule)
+{
+    fs::path modulePath = GetMockModulePath(CRASHING_MODULE_FILE_NAME);
+
+    boost::dll::shared_library lib;
+    ASSERT_NO_THROW(lib = openModuleLibrary(loggerComponent, modulePath));
+    ASSERT_TRUE(lib.is_loaded());
+}
+
+TEST_F(ModuleManagerInternalsTest, ManifestCacheRoundTrip)
+{
+    const fs::path cacheFile = fs::temp_directory_path() / "opendaq_test_manifest_roundtrip";
+    const fs::path modulePath = GetMockModulePath(EMPTY_MODULE_FILE_NAME);
+
+    {
+        ModuleManifestCache cache(cacheFile, "1.0.0");
+        ModuleManifest manifest;
+        manifest.status = ModuleManifestStatus::NoEntryPoint;
+        cache.update(modulePath, manifest);
+        ASSERT_TRUE(cache.save());
+    }
+
+    ModuleManifestCache cache(cacheFile, "1.0.0");
+    cache.load();
+
+    const auto manifest = cache.find(modulePath);
+    ASSERT_TRUE(manifest.has_value());
+    ASSERT_EQ(manifest->status, ModuleManifestStatus::NoEntryPoint);
+    ASSERT_FALSE(cache.find(GetMockModulePath(CRASHING_MODULE_FILE_NAME)).has_value());
+
+    fs::remove(cacheFile);
+}
+
+TEST_F(ModuleManagerInternalsTest, ManifestCacheInvalidatedOnChange)
+{
+    const fs::path dir = fs::temp_directory_path() / "opendaq_test_manifest_invalidate";
+    fs::create_directories(dir);
+    const fs::path libraryPath = dir / (std::string("library") + OPENDAQ_MODULE_SUFFIX);
+    fs::copy_file(GetMockModulePath(EMPTY_MODULE_FILE_NAME), libraryPath, fs::copy_options::overwrite_existing);
+
+    ModuleManifestCache cache(dir / "manifest", "1.0.0");
+    cache.update(libraryPath, ModuleManifest{});
+    ASSERT_TRUE(cache.find(libraryPath).has_value());
+
+    {
+        std::ofstream file(libraryPath, std::ios::app | std::ios::binary);
+        file << "changed";
+    }
+
+    ASSERT_FALSE(cache.find(libraryPath).has_value());
+
+    fs::remove_all(dir);
+}
+
+TEST_F(ModuleManagerInternalsTest, ManifestCacheDiscardedOnSdkVersionChange)
+{
+    const fs::path cacheFile = fs::temp_directory_path() / "opendaq_test_manifest_sdk_version";
+    const fs::path modulePath = GetMockModulePath(EMPTY_MODULE_FILE_NAME);
+
+    {
+        ModuleManifestCache cache(cacheFile, "1.0.0");
+        ModuleManifest manifest;
+        manifest.status = ModuleManifestStatus::NoEntryPoint;
+        cache.update(modulePath, manifest);
+        ASSERT_TRUE(cache.save());
+    }
+
+    ModuleManifestCache cache(cacheFile, "2.0.0");
+    cache.load();
+    ASSERT_FALSE(cache.find(modulePath).has_value());
+
+    fs::remove(cacheFile);
+}
+
+TEST_F(ModuleManagerInternalsTest, ManifestCacheSaveReplacesFile)
+{
+    const fs::path dir = fs::temp_directory_path() / "opendaq_test_manifest_save";
+    fs::remove_all(dir);
+    const fs::path cacheFile = dir / "nested" / "manifest";
+
+    ModuleManifestCache cache(cacheFile, "1.0.0");
+    cache.update(GetMockModulePath(EMPTY_MODULE_FILE_NAME), ModuleManifest{});
+    ASSERT_TRUE(cache.save());
+    ASSERT_TRUE(fs::exists(cacheFile));
+
+    cache.update(GetMockModulePath(CRASHING_MODULE_FILE_NAME), ModuleManifest{});
+    ASSERT_TRUE(cache.save());
+
+    auto tempFile = cacheFile;
+    tempFile += ".tmp";
+    ASSERT_FALSE(fs::exists(tempFile));
+
+    ModuleManifestCache reloaded(cacheFile, "1.0.0");
+    reloaded.load();
+    ASSERT_TRUE(reloaded.find(GetMockModulePath(EMPTY_MODULE_FILE_NAME)).has_value());
+    ASSERT_TRUE(reloaded.find(GetMockModulePath(CRASHING_MODULE_FILE_NAME)).has_value());
+
+    fs::remove_all(dir);
+}
+
+TEST_F(ModuleManagerInternalsTest, DependencyFailuresNotCached)
+{
+    const fs::path dir = fs::absolute("mock_dependencies_failed");
+    fs::remove_all(dir);
+    fs::create_directories(dir);
+    fs::copy_file(GetMockModulePath(DEPENDENCIES_FAILED_MODULE_NAME), dir / DEPENDENCIES_FAILED_MODULE_NAME);
+
+    {
+        auto manager = ModuleManager(dir.string());
+        auto ctx = Context(Scheduler(logger), logger, nullptr, manager, nullptr);
+        ASSERT_EQ(manager.getModules().getCount(), 0u);
+    }
+
+    // Nothing to record, so the cache is not written at all
+    ASSERT_FALSE(fs::exists(dir / ".opendaq_module_manifest"));
+
+    fs::remove_all(dir);
+}
+
+TEST_F(ModuleManagerInternalsTest, ManifestCachePathOption)
+{
+    const fs::path dir = fs::absolute(fs::temp_directory_path() / "opendaq_test_manifest_location");
+    const fs::path cacheDir = dir / "cache";
+    fs::remove_all(dir);
+    fs::create_directories(dir / "modules");
+    fs::copy_file(GetMockModulePath(EMPTY_MODULE_FILE_NAME), dir / "modules" / EMPTY_MODULE_FILE_NAME);
+
+    auto options = Dict<IString, IBaseObject>({{"ModuleManager", Dict<IString, IBaseObject>({{"ManifestCachePath", cacheDir.string()}})}});
+    {
+        auto manager = ModuleManager((dir / "modules").string());
+        auto ctx = Context(Scheduler(logger), logger, nullptr, manager, nullptr, options);
+        ASSERT_EQ(manager.getModules().getCount(), 0u);
+    }
+
+    ASSERT_FALSE(fs::exists(dir / "modules" / ".opendaq_module_manifest"));
+    ASSERT_TRUE(fs::is_directory(cacheDir));
+    ASSERT_FALSE(fs::is_empty(cacheDir));
+
+    fs::remove_all(dir);
+}
+
+TEST_F(ModuleManagerInternalsTest, LazyLoadingFromManifest)
+{
+    // Kept next to the mock folder so the module resolves its dependencies the same way
+    const fs::path dir = fs::absolute("mock_lazy");
+    fs::remove_all(dir);
+    fs::create_directories(dir);
+    fs::copy_file(GetMockModulePath(DEPENDENCIES_SUCCEEDED_MODULE_NAME), dir / DEPENDENCIES_SUCCEEDED_MODULE_NAME);
+
+    {
+        auto manager = ModuleManager(dir.string());
+        auto ctx = Context(Scheduler(logger), logger, nullptr, manager, nullptr);
+        ASSERT_EQ(manager.getModules().getCount(), 1u);
+    }
+
+    auto options = Dict<IString, IBaseObject>({{"ModuleManager", Dict<IString, IBaseObject>({{"LazyLoading", true}})}});
+    auto manager = ModuleManager(dir.string());
+    auto ctx = Context(Scheduler(logger), logger, nullptr, manager, nullptr, options);
+    auto managerImpl = static_cast<ModuleManagerImpl*>(manager.getObject());
+    ASSERT_EQ(managerImpl->getLoadedModuleCount(), 0u);
+
+    // Types the module does not provide do not load it
+    ASSERT_THROW(manager.asPtr<IModuleManagerUtils>().createFunctionBlock("NotProvided", nullptr), NotFoundException);
+    ASSERT_ANY_THROW(manager.asPtr<IModuleManagerUtils>().createDevice("daqother://device", nullptr));
+    ASSERT_EQ(managerImpl->getLoadedModuleCount(), 0u);
+
+    // The mock module provides the "daqmock" prefix, but does not create devices
+    ASSERT_ANY_THROW(manager.asPtr<IModuleManagerUtils>().createDevice("daqmock://device", nullptr));
+    ASSERT_EQ(managerImpl->getLoadedModuleCount(), 1u);
+
+    const auto modules = manager.getModules();
+    ASSERT_EQ(modules.getCount(), 1u);
+    ASSERT_EQ(modules[0].getName(), "MockModule");
+
+    fs::remove_all(dir);
+}
+
+TEST_F(ModuleManagerInternalsTest, LazyLoadingConcurrent)
+{
+    const fs::path dir = fs::absolute("mock_lazy_concurrent");
+    fs::remove_all(dir);
+    fs::create_directories(dir);
+    fs::copy_file(GetMockModulePath(DEPENDENCIES_SUCCEEDED_MODULE_NAME), dir / DEPENDENCIES_SUCCEEDED_MODULE_NAME);
+
+    {
+        auto manager = ModuleManager(dir.string());
+        auto ctx = Context(Scheduler(logger), logger, nullptr, manager, nullptr);
+    }
+
+    auto options = Dict<IString, IBaseObject>({{"ModuleManager", Dict<IString, IBaseObject>({{"LazyLoading", true}})}});
+    auto manager = ModuleManager(dir.string());
+    auto ctx = Context(Scheduler(logger), logger, nullptr, manager, nullptr, options);
+    auto managerImpl = static_cast<ModuleManagerImpl*>(manager.getObject());
+    ASSERT_EQ(managerImpl->getLoadedModuleCount(), 0u);
+
+    // Every call sees the module, while the library is loaded only once and the working directory is left alone
+    const auto workingDir = fs::current_path();
+    std::vector<std::thread> threads;
+    std::vector<SizeT> moduleCounts(8);
+    for (SizeT i = 0; i < moduleCounts.size(); ++i)
+        threads.emplace_back([&manager, &moduleCounts, i]() { moduleCounts[i] = manager.getModules().getCount(); });
+    for (auto& thread : threads)
+        thread.join();
+
+    for (const auto count : moduleCounts)
+        ASSERT_EQ(count, 1u);
+    ASSERT_EQ(managerImpl->getLoadedModuleCount(), 1u);
+    ASSERT_EQ(fs::current_path(), workingDir);
+
+    fs::remove_all(dir);
+}
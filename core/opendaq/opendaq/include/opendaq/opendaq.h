@@ -31,6 +31,7 @@
 #include <opendaq/task_ptr.h>
 #include <opendaq/awaitable_ptr.h>
 #include <opendaq/graph_visualization_ptr.h>
+#include <opendaq/timer_task_ptr.h>
 
 #include <opendaq/logger_factory.h>
 
@@ -36,6 +36,7 @@ struct MockContext : daq::ImplementationOf<daq::IContext, daq::IContextInternal>
     MOCK_METHOD(daq::ErrCode, getTypeManager, (daq::ITypeManager** manager), (override MOCK_CALL));
     MOCK_METHOD(daq::ErrCode, getAuthenticationProvider, (daq::IAuthenticationProvider** authenticationProvider), (override MOCK_CALL));
     MOCK_METHOD(daq::ErrCode, getOnCoreEvent, (daq::IEvent** event), (override MOCK_CALL));
+    MOCK_METHOD(daq::ErrCode, getCoreEventBus, (daq::ICoreEventBus** bus), (override MOCK_CALL));
     MOCK_METHOD(daq::ErrCode, moveModuleManager, (daq::IModuleManager** manager), (override MOCK_CALL));
     MOCK_METHOD(daq::ErrCode, getOptions, (daq::IDict** options), (override MOCK_CALL));
     MOCK_METHOD(daq::ErrCode, getModuleOptions, (daq::IString* moduleId, daq::IDict** options), (override MOCK_CALL));
@@ -83,5 +84,10 @@ struct MockContext : daq::ImplementationOf<daq::IContext, daq::IContextInternal>
             .Times(AnyNumber())
             .WillRepeatedly(DoAll(Invoke([&](daq::IEvent** event) { *event = coreEvent.addRefAndReturn(); }),
                                   Return(OPENDAQ_SUCCESS)));
+
+        EXPECT_CALL(*this, getCoreEventBus)
+            .Times(AnyNumber())
+            .WillRepeatedly(DoAll(Invoke([&](daq::ICoreEventBus** bus) { *bus = nullptr; }),
+                                  Return(OPENDAQ_SUCCESS)));
     }
 };
@@ -47,6 +47,12 @@ struct MockInputPort : daq::MockGenericComponent<MockInputPort, daq::IInputPortC
 
     MOCK_METHOD(daq::ErrCode, getGapCheckingEnabled, (daq::Bool* gapCheckingEnabled), (override MOCK_CALL));
 
+    MOCK_METHOD(daq::ErrCode, setQueueLimit, (daq::SizeT limit, daq::QueueLimitUnit unit, daq::QueueOverflowPolicy policy, daq::SizeT blockTimeoutMs), (override MOCK_CALL));
+    MOCK_METHOD(daq::ErrCode, getQueueLimit, (daq::SizeT* limit), (override MOCK_CALL));
+    MOCK_METHOD(daq::ErrCode, getQueueLimitUnit, (daq::QueueLimitUnit* unit), (override MOCK_CALL));
+    MOCK_METHOD(daq::ErrCode, getQueueOverflowPolicy, (daq::QueueOverflowPolicy* policy), (override MOCK_CALL));
+    MOCK_METHOD(daq::ErrCode, getQueueBlockTimeout, (daq::SizeT* blockTimeoutMs), (override MOCK_CALL));
+
     daq::Bool active = true;
 
     MockInputPort()
@@ -32,6 +32,7 @@ struct MockScheduler : daq::ImplementationOf<daq::IScheduler>
     MOCK_METHOD(daq::ErrCode, scheduleFunction, (daq::IFunction* work, daq::IAwaitable** awaitable), (override MOCK_CALL));
     MOCK_METHOD(daq::ErrCode, scheduleWork, (daq::IWork* work), (override MOCK_CALL));
     MOCK_METHOD(daq::ErrCode, scheduleGraph, (daq::ITaskGraph * graph, daq::IAwaitable** awaitable), (override MOCK_CALL));
+    MOCK_METHOD(daq::ErrCode, scheduleTimer, (daq::IWork* work, daq::SizeT delayUs, daq::SizeT periodUs, daq::ITimerTask** task), (override MOCK_CALL));
     MOCK_METHOD(daq::ErrCode, stop, (), (override MOCK_CALL));
     MOCK_METHOD(daq::ErrCode, waitAll, (), (override MOCK_CALL));
     MOCK_METHOD(daq::ErrCode, isMultiThreaded, (daq::Bool* multiThreaded), (override MOCK_CALL));
@@ -12,8 +12,9 @@ DictPtr<IString, IBaseObject> InstanceBuilderImpl::GetDefaultOptions()
 {
     return Dict<IString, IBaseObject>({
         {"ModuleManager", Dict<IString, IBaseObject>({
-                {"ModulesPaths", List<IString>(""),
-                }
+                {"ModulesPaths", List<IString>("")},
+                {"LazyLoading", false},
+                {"ManifestCachePath", ""}
             })},
         {"Scheduler", Dict<IString, IBaseObject>({
                 {"WorkersNum", 0}
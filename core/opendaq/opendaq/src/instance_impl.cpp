@@ -13,6 +13,7 @@
 #include <opendaq/device_private.h>
 
 #include <opendaq/module_manager_utils_ptr.h>
+#include <opendaq/module_manager_server_utils.h>
 #include <opendaq/discovery_server_factory.h>
 
 BEGIN_NAMESPACE_OPENDAQ
@@ -209,37 +210,43 @@ ErrCode InstanceImpl::addServer(IString* serverTypeId, IPropertyObject* serverCo
 
     auto typeId = convertIfOldIdProtocol(toStdString(serverTypeId));
 
-    for (const auto module : moduleManager.getModules())
+    // Use the root device instead of Instance(this) to prevent cycling reference.
+    ServerPtr createdServer;
+    if (const auto serverUtils = moduleManager.asPtrOrNull<IModuleManagerServerUtils>(); serverUtils.assigned())
     {
-        DictPtr<IString, IServerType> serverTypes;
-        try
-        {
-            serverTypes = module.getAvailableServerTypes();
-        }
-        catch (NotImplementedException&)
-        {
-            serverTypes = nullptr;
-        }
-
-        if (!serverTypes.assigned())
-            continue;
-
-        for (const auto& [id, serverType] : serverTypes)
+        const ErrCode errCode = serverUtils->createServer(&createdServer, typeId, rootDevice, serverConfig);
+        if (OPENDAQ_FAILED(errCode))
+            return errCode;
+    }
+    else
+    {
+        for (const auto module : moduleManager.getModules())
         {
-            if (id == typeId)
+            DictPtr<IString, IServerType> serverTypes;
+            try
             {
-                // Use the root device instead of Instance(this) to prevent cycling reference.
-                auto createdServer = module.createServer(typeId, rootDevice, serverConfig);
+                serverTypes = module.getAvailableServerTypes();
+            }
+            catch (NotImplementedException&)
+            {
+                serverTypes = nullptr;
+            }
 
-                std::scoped_lock lock(configSync);
-                servers.push_back(createdServer);
-                *server = createdServer.detach();
-                return OPENDAQ_SUCCESS;
+            if (serverTypes.assigned() && serverTypes.hasKey(typeId))
+            {
+                createdServer = module.createServer(typeId, rootDevice, serverConfig);
+                break;
             }
         }
+
+        if (!createdServer.assigned())
+            return OPENDAQ_ERR_NOTFOUND;
     }
 
-    return OPENDAQ_ERR_NOTFOUND;
+    std::scoped_lock lock(configSync);
+    servers.push_back(createdServer);
+    *server = createdServer.detach();
+    return OPENDAQ_SUCCESS;
 }
 
 std::string getErrorMessage()
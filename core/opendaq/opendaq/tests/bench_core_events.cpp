@@ -0,0 +1,43 @@
+#include <opendaq/component_factory.h>
+#include <opendaq/context_factory.h>
+#include <opendaq/core_event_bus_ptr.h>
+#include <coreobjects/property_factory.h>
+#include <coreobjects/property_object_internal_ptr.h>
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+
+using namespace daq;
+
+using CoreEventBenchmark = testing::Test;
+
+TEST_F(CoreEventBenchmark, BusPublishRate)
+{
+    constexpr Int changeCount = 20000;
+
+    const auto context = NullContext();
+    const auto component = Component(context, nullptr, "comp");
+    component.addProperty(IntProperty("Int", 0));
+    component.addProperty(IntProperty("Watched", 0));
+    component.asPtrOrNull<IPropertyObjectInternal>().enableCoreEventTrigger();
+
+    std::atomic<SizeT> eventCount{0};
+    const auto bus = context.getCoreEventBus();
+    bus.subscribe(Procedure([&](const ListPtr<IBaseObject>& events) { eventCount += events.getCount(); }),
+                  List<IInteger>(static_cast<Int>(CoreEventId::PropertyValueChanged)),
+                  nullptr,
+                  List<IString>("Watched"),
+                  0);
+
+    // changes of properties no subscription is interested in are dropped on the changing thread
+    const auto start = std::chrono::steady_clock::now();
+    for (Int i = 1; i <= changeCount; ++i)
+        component.setPropertyValue("Int", i);
+    const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    component.setPropertyValue("Watched", 1);
+    bus.flush();
+    ASSERT_EQ(eventCount.load(), 1u);
+
+    RecordProperty("ChangesPerSecond", std::to_string(static_cast<int64_t>(changeCount / elapsed)));
+}
@@ -18,6 +18,8 @@
 #include <opendaq/mock/mock_physical_device.h>
 #include <opendaq/device_domain_factory.h>
 #include <coreobjects/authentication_provider_factory.h>
+#include <opendaq/core_event_bus_ptr.h>
+#include <future>
 
 using namespace daq;
 
@@ -1466,3 +1468,257 @@ TEST_F(CoreEventTest, DomainChanged)
 
     ASSERT_EQ(changeCount, 3);
 }
+
+TEST_F(CoreEventTest, BusFilterByEventIdAndProperty)
+{
+    const auto context = NullContext();
+    const auto component = Component(context, nullptr, "comp");
+    component.addProperty(StringProperty("String", "foo"));
+    component.addProperty(IntProperty("Int", 0));
+    component.asPtrOrNull<IPropertyObjectInternal>().enableCoreEventTrigger();
+
+    std::vector<CoreEventArgsPtr> received;
+    const auto bus = context.getCoreEventBus();
+    bus.subscribe(
+        Procedure(
+            [&](const ListPtr<IBaseObject>& events)
+            {
+                for (const ListPtr<IBaseObject>& event : events)
+                {
+                    ASSERT_EQ(event[0], component);
+                    received.push_back(event[1]);
+                }
+            }),
+        List<IInteger>(static_cast<Int>(CoreEventId::PropertyValueChanged)),
+        nullptr,
+        List<IString>("String"),
+        0);
+
+    component.setPropertyValue("Int", 1);
+    component.setPropertyValue("String", "bar");
+    component.addProperty(StringProperty("String2", "foo"));
+    bus.flush();
+
+    ASSERT_EQ(received.size(), 1u);
+    ASSERT_EQ(received[0].getEventId(), static_cast<Int>(CoreEventId::PropertyValueChanged));
+    ASSERT_EQ(received[0].getParameters().get("Value"), "bar");
+}
+
+TEST_F(CoreEventTest, BusFilterByComponentSubtree)
+{
+    const auto context = NullContext();
+    const auto parent = Component(context, nullptr, "parent");
+    const auto child = Component(context, parent, "child");
+    const auto sibling = Component(context, nullptr, "parent2");
+
+    for (const auto& component : {parent, child, sibling})
+    {
+        component.addProperty(IntProperty("Int", 0));
+        component.asPtrOrNull<IPropertyObjectInternal>().enableCoreEventTrigger();
+    }
+
+    std::vector<StringPtr> received;
+    const auto bus = context.getCoreEventBus();
+    bus.subscribe(
+        Procedure(
+            [&](const ListPtr<IBaseObject>& events)
+            {
+                for (const ListPtr<IBaseObject>& event : events)
+                    received.push_back(event[0].asPtr<IComponent>().getGlobalId());
+            }),
+        nullptr,
+        parent.getGlobalId(),
+        nullptr,
+        0);
+
+    sibling.setPropertyValue("Int", 1);
+    child.setPropertyValue("Int", 1);
+    parent.setPropertyValue("Int", 1);
+    context.getTypeManager().addType(StructType("BusStructType", List<IString>("Field0"), List<IType>(SimpleType(ctString))));
+    bus.flush();
+
+    ASSERT_EQ(received.size(), 2u);
+    ASSERT_EQ(received[0], child.getGlobalId());
+    ASSERT_EQ(received[1], parent.getGlobalId());
+}
+
+TEST_F(CoreEventTest, BusFilterByComponentChildren)
+{
+    const auto context = NullContext();
+    const auto parent = Component(context, nullptr, "parent");
+    const auto child = Component(context, parent, "child");
+
+    for (const auto& component : {parent, child})
+    {
+        component.addProperty(IntProperty("Int", 0));
+        component.asPtrOrNull<IPropertyObjectInternal>().enableCoreEventTrigger();
+    }
+
+    std::vector<StringPtr> received;
+    const auto bus = context.getCoreEventBus();
+    bus.subscribe(
+        Procedure(
+            [&](const ListPtr<IBaseObject>& events)
+            {
+                for (const ListPtr<IBaseObject>& event : events)
+                    received.push_back(event[0].asPtr<IComponent>().getGlobalId());
+            }),
+        nullptr,
+        parent.getGlobalId() + "/",
+        nullptr,
+        0);
+
+    parent.setPropertyValue("Int", 1);
+    child.setPropertyValue("Int", 1);
+    bus.flush();
+
+    ASSERT_EQ(received.size(), 1u);
+    ASSERT_EQ(received[0], child.getGlobalId());
+}
+
+TEST_F(CoreEventTest, BusCoalescesValueChanges)
+{
+    const auto context = NullContext();
+    const auto component = Component(context, nullptr, "comp");
+    component.addProperty(IntProperty("Int", 0));
+    component.addProperty(StringProperty("String", "foo"));
+    component.asPtrOrNull<IPropertyObjectInternal>().enableCoreEventTrigger();
+
+    std::promise<void> handlerEntered;
+    std::promise<void> releaseHandler;
+    auto releaseFuture = releaseHandler.get_future().share();
+    std::vector<std::pair<std::string, Int>> received;
+
+    const auto bus = context.getCoreEventBus();
+    bus.subscribe(
+        Procedure(
+            [&](const ListPtr<IBaseObject>& events)
+            {
+                for (const ListPtr<IBaseObject>& event : events)
+                {
+                    const CoreEventArgsPtr args = event[1];
+                    const auto params = args.getParameters();
+                    const auto name = static_cast<std::string>(params.get("Name"));
+                    received.emplace_back(name, name == "Int" ? static_cast<Int>(params.get("Value")) : -1);
+                }
+
+                if (received.size() == 1)
+                {
+                    handlerEntered.set_value();
+                    releaseFuture.wait();
+                }
+            }),
+        List<IInteger>(static_cast<Int>(CoreEventId::PropertyValueChanged)),
+        nullptr,
+        nullptr,
+        0);
+
+    component.setPropertyValue("Int", 1);
+    handlerEntered.get_future().wait();
+
+    // the handler is busy, so the following changes of "Int" are replaced by the latest one
+    for (Int i = 2; i <= 100; ++i)
+        component.setPropertyValue("Int", i);
+    component.setPropertyValue("String", "bar");
+
+    releaseHandler.set_value();
+    bus.flush();
+
+    ASSERT_EQ(received.size(), 3u);
+    ASSERT_EQ(received[0], std::make_pair(std::string("Int"), Int(1)));
+    ASSERT_EQ(received[1], std::make_pair(std::string("Int"), Int(100)));
+    ASSERT_EQ(received[2], std::make_pair(std::string("String"), Int(-1)));
+}
+
+TEST_F(CoreEventTest, BusMaxBatchSizeAndUnsubscribe)
+{
+    const auto context = NullContext();
+    const auto component = Component(context, nullptr, "comp");
+    component.addProperty(IntProperty("Int", 0));
+    component.asPtrOrNull<IPropertyObjectInternal>().enableCoreEventTrigger();
+
+    std::atomic<SizeT> maxBatch{0};
+    std::atomic<SizeT> eventCount{0};
+    const auto bus = context.getCoreEventBus();
+    const auto id = bus.subscribe(
+        Procedure(
+            [&](const ListPtr<IBaseObject>& events)
+            {
+                maxBatch = std::max<SizeT>(maxBatch.load(), events.getCount());
+                eventCount += events.getCount();
+            }),
+        nullptr,
+        nullptr,
+        nullptr,
+        2);
+
+    for (Int i = 1; i <= 10; ++i)
+        component.addProperty(IntProperty("Int" + std::to_string(i), i));
+    bus.flush();
+
+    ASSERT_EQ(eventCount.load(), 10u);
+    ASSERT_LE(maxBatch.load(), 2u);
+
+    bus.unsubscribe(id);
+    component.setPropertyValue("Int", 1);
+    bus.flush();
+
+    ASSERT_EQ(eventCount.load(), 10u);
+    ASSERT_THROW(bus.unsubscribe(id), NotFoundException);
+}
+
+TEST_F(CoreEventTest, BusDropsOldestEvents)
+{
+    constexpr SizeT maxQueuedEvents = 10000;
+    constexpr SizeT overflow = 10;
+
+    const auto context = NullContext();
+    const auto component = Component(context, nullptr, "comp");
+    component.asPtrOrNull<IPropertyObjectInternal>().enableCoreEventTrigger();
+
+    std::promise<void> handlerEntered;
+    std::promise<void> releaseHandler;
+    auto releaseFuture = releaseHandler.get_future().share();
+    SizeT eventCount = 0;
+    bool firstActive = true;
+    bool lastActive = true;
+
+    const auto bus = context.getCoreEventBus();
+    const auto id = bus.subscribe(
+        Procedure(
+            [&](const ListPtr<IBaseObject>& events)
+            {
+                for (const ListPtr<IBaseObject>& event : events)
+                {
+                    const CoreEventArgsPtr args = event[1];
+                    lastActive = args.getParameters().get("Active");
+                    if (eventCount++ == 1)
+                        firstActive = lastActive;
+                }
+
+                if (eventCount == 1)
+                {
+                    handlerEntered.set_value();
+                    releaseFuture.wait();
+                }
+            }),
+        List<IInteger>(static_cast<Int>(CoreEventId::AttributeChanged)),
+        nullptr,
+        nullptr,
+        0);
+
+    component.setActive(false);
+    handlerEntered.get_future().wait();
+
+    // the handler is busy, so the oldest of the queued changes are dropped
+    for (SizeT i = 0; i < maxQueuedEvents + overflow; ++i)
+        component.setActive(i % 2 == 0);
+
+    releaseHandler.set_value();
+    bus.flush();
+
+    ASSERT_EQ(eventCount, maxQueuedEvents + 1);
+    ASSERT_EQ(bus.getDroppedEventCount(id), overflow);
+    ASSERT_EQ(firstActive, overflow % 2 == 0);
+    ASSERT_EQ(lastActive, (maxQueuedEvents + overflow - 1) % 2 == 0);
+}
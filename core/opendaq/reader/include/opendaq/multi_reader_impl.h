@@ -22,6 +22,9 @@
 #include <opendaq/multi_reader_builder_ptr.h>
 #include <opendaq/reader_factory.h>
 
+#include <atomic>
+#include <unordered_map>
+
 BEGIN_NAMESPACE_OPENDAQ
 
 class MultiReaderImpl : public ImplementationOfWeak<IMultiReader, IReaderConfig, IInputPortNotifications>
@@ -96,7 +99,13 @@ private:
 
     SyncStatus getSyncStatus() const;
 
+    void initSignalsReady(const ListPtr<IInputPortConfig>& ports);
+    bool markSignalReady(SizeT index);
+    bool isPacketReady(IInputPort* inputPort);
+    void updateSignalsReady();
+
     MultiReaderStatusPtr readPackets();
+    MultiReaderStatusPtr readPacketsLocked(std::unique_lock<std::mutex>& notifyLock);
 
     void prepare(void** outValues, SizeT count, std::chrono::milliseconds timeoutTime);
     void prepareWithDomain(void** outValues, void** domain, SizeT count, std::chrono::milliseconds timeoutTime);
@@ -138,6 +147,13 @@ private:
     bool startOnFullUnitOfDomain;
 
     NotifyInfo notify{};
+
+    // A port notification only checks its own signal. The signal is marked ready once it has packets
+    // queued, and the notify mutex is locked only when all signals are ready or an event packet is
+    // queued. The flags are recomputed from the connections after each read, under the notify mutex.
+    std::unordered_map<IInputPort*, SizeT> portIndices;
+    std::unique_ptr<std::atomic<bool>[]> signalsReady;
+    std::atomic<std::int64_t> signalsNotReady{0};
     bool portConnected {};
     bool portDisconnected {};
 
@@ -130,6 +130,20 @@ DECLARE_OPENDAQ_INTERFACE(ITailReaderBuilder, IBaseObject)
      * @param[out] skipEvents The skip events
      */
     virtual ErrCode INTERFACE_FUNC getSkipEvents(Bool* skipEvents) = 0;
+
+    // [returnSelf]
+    /*!
+     * @brief Sets whether the reader copies the received samples into a ring buffer
+     * @param copySamples If true, the samples are converted to the read types on arrival and stored in a buffer
+     * of history size samples allocated up front. Packets are released as soon as they are received.
+     */
+    virtual ErrCode INTERFACE_FUNC setCopySamples(Bool copySamples) = 0;
+
+    /*!
+     * @brief Gets whether the reader copies the received samples into a ring buffer
+     * @param[out] copySamples True if the samples are copied into a ring buffer
+     */
+    virtual ErrCode INTERFACE_FUNC getCopySamples(Bool* copySamples) = 0;
 };
 
 OPENDAQ_DECLARE_CLASS_FACTORY_WITH_INTERFACE(LIBRARY_FACTORY, TailReaderBuilder, ITailReaderBuilder)
@@ -22,6 +22,7 @@
 #include <opendaq/tail_reader_builder_ptr.h>
 
 #include <deque>
+#include <vector>
 
 BEGIN_NAMESPACE_OPENDAQ
 
@@ -39,14 +40,16 @@ public:
                    SampleType valueReadType,
                    SampleType domainReadType,
                    ReadMode mode,
-                   Bool skipEvents = false);
+                   Bool skipEvents = false,
+                   Bool copySamples = false);
 
     TailReaderImpl(IInputPortConfig* port,
                    SizeT historySize,
                    SampleType valueReadType,
                    SampleType domainReadType,
                    ReadMode mode,
-                   Bool skipEvents = false);
+                   Bool skipEvents = false,
+                   Bool copySamples = false);
 
     TailReaderImpl(const ReaderConfigPtr& readerConfig,
                    SampleType valueReadType,
@@ -71,14 +74,60 @@ public:
     ErrCode INTERFACE_FUNC getEmpty(Bool* empty) override;
 
 private:
+    // domain offset of the sample at the position, following the offset and linear rule delta of the domain packets
+    struct RingOffset
+    {
+        SizeT position;
+        Int offset;
+        Int delta;
+    };
+
+    // event packet received after the samples preceding the position
+    struct RingEvent
+    {
+        SizeT position;
+        EventPacketPtr packet;
+        bool valid;
+    };
+
     ErrCode readPacket(TailReaderInfo& info, const DataPacketPtr& packet);
     TailReaderStatusPtr readData(TailReaderInfo& info);
 
+    void initRing();
+    bool updateRingLayout();
+    void receiveRingEvent(const EventPacketPtr& eventPacket);
+    ErrCode writeRing(const DataPacketPtr& dataPacket);
+    void fallBackToPacketHistory(ErrCode errCode);
+    void copyRing(const std::vector<uint8_t>& ring, SizeT sampleSize, SizeT position, SizeT count, void** output) const;
+    ErrCode readRingRange(TailReaderInfo& info, SizeT position, SizeT count);
+    ErrCode readRing(TailReaderInfo& info, TailReaderStatusPtr& status);
+    NumberPtr getRingOffset(SizeT position) const;
+    SizeT getRingStart() const;
+
 private:
+    // events not yet read are limited, so a reader that is never read does not grow
+    static constexpr SizeT MaxRingEvents = 64;
+
     SizeT historySize;
 
     SizeT cachedSamples;
     std::deque<PacketPtr> packets;
+
+    // with `copySamples`, the samples are converted to the read types on arrival and kept in rings of
+    // `historySize` samples, so the packets are released at once and the history has a fixed footprint
+    Bool copySamples;
+    std::vector<uint8_t> valueRing;
+    std::vector<uint8_t> domainRing;
+    SizeT valueSampleSize;
+    SizeT domainSampleSize;
+
+    // positions count all samples written to the rings
+    SizeT ringWritten;
+    SizeT ringReadStart;
+    SizeT ringDomainStart;
+    bool ringInvalid;
+    std::deque<RingOffset> ringOffsets;
+    std::deque<RingEvent> ringEvents;
 };
 
 END_NAMESPACE_OPENDAQ
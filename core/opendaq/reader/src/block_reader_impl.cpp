@@ -359,7 +359,8 @@ BlockReaderStatusPtr BlockReaderImpl::readPackets()
                 handleDescriptorChanged(eventPacket);
             }
 
-            if (!skipEvents || invalid || eventPacket.getEventId() == event_packet_id::IMPLICIT_DOMAIN_GAP_DETECTED)
+            if (!skipEvents || invalid || eventPacket.getEventId() == event_packet_id::IMPLICIT_DOMAIN_GAP_DETECTED ||
+                eventPacket.getEventId() == event_packet_id::PACKETS_DROPPED)
             {
                 auto writtenSamplesCount = info.writtenSampleCount - initialWrittenSamplesCount;
                 info.clean();
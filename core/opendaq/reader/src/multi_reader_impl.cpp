@@ -43,6 +43,7 @@ MultiReaderImpl::MultiReaderImpl(const ListPtr<IComponent>& list,
         if (fromInputPorts)
             portBinder = PropertyObject();
 
+        initSignalsReady(ports);
         connectPorts(ports, valueReadType, domainReadType, mode);
 
         updateCommonSampleRateAndDividers();
@@ -54,6 +55,9 @@ MultiReaderImpl::MultiReaderImpl(const ListPtr<IComponent>& list,
         ErrCode errCode = synchronize(min, syncStatus);
 
         checkErrorInfo(errCode);
+
+        std::scoped_lock lock(notify.mutex);
+        updateSignalsReady();
     }
     catch (...)
     {
@@ -80,6 +84,11 @@ MultiReaderImpl::MultiReaderImpl(MultiReaderImpl* old,
     this->internalAddRef();
     auto listener = this->thisPtr<InputPortNotificationsPtr>();
 
+    auto ports = List<IInputPortConfig>();
+    for (const auto& signal : old->signals)
+        ports.pushBack(signal.port);
+    initSignalsReady(ports);
+
     for (auto& signal : old->signals)
     {
         signals.emplace_back(signal, listener, valueReadType, domainReadType);
@@ -88,6 +97,9 @@ MultiReaderImpl::MultiReaderImpl(MultiReaderImpl* old,
     updateCommonSampleRateAndDividers();
     if (invalid)
         throw InvalidParameterException("Signal sample rate does not match required common sample rate");
+
+    std::scoped_lock notifyLock(notify.mutex);
+    updateSignalsReady();
 }
 
 MultiReaderImpl::MultiReaderImpl(const ReaderConfigPtr& readerConfig,
@@ -116,6 +128,7 @@ MultiReaderImpl::MultiReaderImpl(const ReaderConfigPtr& readerConfig,
 
     bool fromInputPorts;
     CheckPreconditions(ports, false, fromInputPorts);
+    initSignalsReady(ports);
   
     for (const auto& port : ports)
     {
@@ -126,6 +139,9 @@ MultiReaderImpl::MultiReaderImpl(const ReaderConfigPtr& readerConfig,
     updateCommonSampleRateAndDividers();
     if (invalid)
         throw InvalidParameterException("Signal sample rate does not match required common sample rate");
+
+    std::scoped_lock lock(notify.mutex);
+    updateSignalsReady();
 }
 
 MultiReaderImpl::MultiReaderImpl(const MultiReaderBuilderPtr& builder)
@@ -140,6 +156,7 @@ MultiReaderImpl::MultiReaderImpl(const MultiReaderBuilderPtr& builder)
 
     if (fromInputPorts)
         portBinder = PropertyObject();
+    initSignalsReady(ports);
     connectPorts(ports, builder.getValueReadType(), builder.getDomainReadType(), builder.getReadMode());
 
     updateCommonSampleRateAndDividers();
@@ -151,6 +168,9 @@ MultiReaderImpl::MultiReaderImpl(const MultiReaderBuilderPtr& builder)
     ErrCode errCode = synchronize(min, syncStatus);
 
     checkErrorInfo(errCode);
+
+    std::scoped_lock lock(notify.mutex);
+    updateSignalsReady();
 }
 
 MultiReaderImpl::~MultiReaderImpl()
@@ -596,6 +616,58 @@ SyncStatus MultiReaderImpl::getSyncStatus() const
     return status;
 }
 
+void MultiReaderImpl::initSignalsReady(const ListPtr<IInputPortConfig>& ports)
+{
+    const SizeT count = ports.getCount();
+    signalsReady = std::make_unique<std::atomic<bool>[]>(count);
+    signalsNotReady = static_cast<std::int64_t>(count);
+
+    for (SizeT i = 0; i < count; ++i)
+        portIndices.emplace(ports[i].asPtr<IInputPort>(true).getObject(), i);
+}
+
+bool MultiReaderImpl::markSignalReady(SizeT index)
+{
+    if (!signalsReady[index].exchange(true))
+        return signalsNotReady.fetch_sub(1) <= 1;
+
+    return signalsNotReady <= 0;
+}
+
+bool MultiReaderImpl::isPacketReady(IInputPort* inputPort)
+{
+    const auto it = portIndices.find(inputPort);
+    if (it == portIndices.end())
+        return true;
+
+    const auto connection = InputPortPtr::Borrow(inputPort).getConnection();
+    if (connection.assigned() && connection.hasEventPacket())
+        return true;
+
+    return markSignalReady(it->second);
+}
+
+void MultiReaderImpl::updateSignalsReady()
+{
+    if (!signalsReady)
+        return;
+
+    // flags are cleared before the connections are checked, so that a packet enqueued meanwhile is
+    // counted either by its notification or by the check below
+    signalsNotReady = static_cast<std::int64_t>(signals.size());
+    for (SizeT i = 0; i < signals.size(); ++i)
+        signalsReady[i] = false;
+
+    for (SizeT i = 0; i < signals.size(); ++i)
+    {
+        if (signals[i].getAvailable(true) != 0)
+            markSignalReady(i);
+    }
+
+    if (signalsNotReady <= 0)
+        notify.packetReady = true;
+}
+
 DictPtr<IString, IEventPacket> MultiReaderImpl::readUntilFirstDataPacket()
 {
     auto packets = Dict<IString, EventPacketPtr>();
@@ -676,6 +748,13 @@ ErrCode MultiReaderImpl::synchronize(SizeT& min, SyncStatus& syncStatus)
 MultiReaderStatusPtr MultiReaderImpl::readPackets()
 {
     std::unique_lock notifyLock(notify.mutex);
+    auto status = readPacketsLocked(notifyLock);
+    updateSignalsReady();
+    return status;
+}
+
+MultiReaderStatusPtr MultiReaderImpl::readPacketsLocked(std::unique_lock<std::mutex>& notifyLock)
+{
     SizeT availableSamples{};
     SyncStatus syncStatus{};
 
@@ -718,6 +797,8 @@ MultiReaderStatusPtr MultiReaderImpl::readPackets()
                 }
             }
 
+            // packets were consumed, so wait for the signals to be ready again
+            updateSignalsReady();
             return false;
         };
 
@@ -916,8 +997,8 @@ ErrCode MultiReaderImpl::packetReceived(IInputPort* inputPort)
     // data are ready 
     // if any of signals has event packet 
     // or all signals have data packet
-    bool hasEventPacket = false;
-    bool hasDataPacket = true;
+    if (!isPacketReady(inputPort))
+        return OPENDAQ_SUCCESS;
 
     std::unique_lock lock(notify.mutex);
     if (portDisconnected)
@@ -926,26 +1007,13 @@ ErrCode MultiReaderImpl::packetReceived(IInputPort* inputPort)
         return OPENDAQ_SUCCESS;
     }
 
-    for (auto& signal : signals)
+    notify.packetReady = true;
+    ProcedurePtr callback = readCallback;
+    lock.unlock();
+    notify.condition.notify_one();
+    if (callback.assigned())
     {
-        if (signal.isFirstPacketEvent())
-        {
-            hasEventPacket = true;
-            break;
-        }
-        hasDataPacket &= (signal.getAvailable(true) != 0);
-    }
-
-    if (hasEventPacket || hasDataPacket)
-    {
-        notify.packetReady = true;
-        ProcedurePtr callback = readCallback;
-        lock.unlock();
-        notify.condition.notify_one();
-        if (callback.assigned())
-        {
-            return wrapHandler(callback);
-        }
+        return wrapHandler(callback);
     }
 
     return OPENDAQ_SUCCESS;
@@ -323,7 +323,7 @@ EventPacketPtr SignalReader::readUntilNextDataPacket()
                     domainDescriptor = newDomainDescriptor;
                 }
             }
-            else if (packetId == event_packet_id::IMPLICIT_DOMAIN_GAP_DETECTED)
+            else if (packetId == event_packet_id::IMPLICIT_DOMAIN_GAP_DETECTED || packetId == event_packet_id::PACKETS_DROPPED)
             {
                 if (!dataDescriptor.assigned() && !domainDescriptor.assigned())
                 {
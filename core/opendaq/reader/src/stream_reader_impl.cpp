@@ -533,7 +533,8 @@ ReaderStatusPtr StreamReaderImpl::readPackets()
                     invalid = true;
                 }
             } 
-            if (!skipEvents || invalid || eventPacket.getEventId() == event_packet_id::IMPLICIT_DOMAIN_GAP_DETECTED)
+            if (!skipEvents || invalid || eventPacket.getEventId() == event_packet_id::IMPLICIT_DOMAIN_GAP_DETECTED ||
+                eventPacket.getEventId() == event_packet_id::PACKETS_DROPPED)
             {
                 return ReaderStatus(eventPacket, !invalid, offset);
             }
@@ -16,6 +16,7 @@ TailReaderBuilderImpl::TailReaderBuilderImpl()
     , historySize(1)
     , used(false)
     , skipEvents(false)
+    , copySamples(false)
 {
 }
 
@@ -119,6 +120,18 @@ ErrCode TailReaderBuilderImpl::getSkipEvents(Bool* skipEvents)
     return OPENDAQ_SUCCESS;
 }
 
+ErrCode TailReaderBuilderImpl::setCopySamples(Bool copySamples)
+{
+    this->copySamples = copySamples;
+    return OPENDAQ_SUCCESS;
+}
+ErrCode TailReaderBuilderImpl::getCopySamples(Bool* copySamples)
+{
+    OPENDAQ_PARAM_NOT_NULL(copySamples);
+    *copySamples = this->copySamples;
+    return OPENDAQ_SUCCESS;
+}
+
 /////////////////////
 ////
 //// FACTORIES
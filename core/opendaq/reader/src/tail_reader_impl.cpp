@@ -1,5 +1,10 @@
 #include <opendaq/reader_errors.h>
 #include <opendaq/tail_reader_impl.h>
+#include <opendaq/sample_type_traits.h>
+#include <opendaq/custom_log.h>
+
+#include <algorithm>
+#include <cstring>
 
 BEGIN_NAMESPACE_OPENDAQ
 
@@ -8,11 +13,20 @@ TailReaderImpl::TailReaderImpl(ISignal* signal,
                                SampleType valueReadType,
                                SampleType domainReadType,
                                ReadMode mode,
-                               Bool skipEvents)
+                               Bool skipEvents,
+                               Bool copySamples)
     : Super(SignalPtr(signal), mode, valueReadType, domainReadType, skipEvents)
     , historySize(historySize)
     , cachedSamples(0)
+    , copySamples(copySamples)
+    , valueSampleSize(0)
+    , domainSampleSize(0)
+    , ringWritten(0)
+    , ringReadStart(0)
+    , ringDomainStart(0)
+    , ringInvalid(false)
 {
+    initRing();
     port.setNotificationMethod(PacketReadyNotification::SameThread);
     packetReceived(port.as<IInputPort>(true));
 }
@@ -22,11 +36,20 @@ TailReaderImpl::TailReaderImpl(IInputPortConfig* port,
                                SampleType valueReadType,
                                SampleType domainReadType,
                                ReadMode mode,
-                               Bool skipEvents)
+                               Bool skipEvents,
+                               Bool copySamples)
     : Super(InputPortConfigPtr(port), mode, valueReadType, domainReadType, skipEvents)
     , historySize(historySize)
     , cachedSamples(0)
+    , copySamples(copySamples)
+    , valueSampleSize(0)
+    , domainSampleSize(0)
+    , ringWritten(0)
+    , ringReadStart(0)
+    , ringDomainStart(0)
+    , ringInvalid(false)
 {
+    initRing();
     this->port.setNotificationMethod(PacketReadyNotification::Scheduler);
 }
 
@@ -38,6 +61,13 @@ TailReaderImpl::TailReaderImpl(const ReaderConfigPtr& readerConfig,
     : Super(readerConfig, mode, valueReadType, domainReadType)
     , historySize(historySize)
     , cachedSamples(0)
+    , copySamples(false)
+    , valueSampleSize(0)
+    , domainSampleSize(0)
+    , ringWritten(0)
+    , ringReadStart(0)
+    , ringDomainStart(0)
+    , ringInvalid(false)
 {
 }
 
@@ -49,9 +79,18 @@ TailReaderImpl::TailReaderImpl(TailReaderImpl* old,
     , historySize(historySize)
     , cachedSamples(old->cachedSamples)
     , packets(old->packets)
-    
+    , copySamples(old->copySamples)
+    , valueSampleSize(0)
+    , domainSampleSize(0)
+    , ringWritten(0)
+    , ringReadStart(0)
+    , ringDomainStart(0)
+    , ringInvalid(false)
 {
     handleDescriptorChanged(DataDescriptorChangedEventPacket(dataDescriptor, domainDescriptor));
+
+    // copied samples are already converted to the read types of the old reader, so the history starts empty
+    initRing();
 }
 
 ErrCode TailReaderImpl::getAvailableCount(SizeT* count)
@@ -60,7 +99,7 @@ ErrCode TailReaderImpl::getAvailableCount(SizeT* count)
 
     std::unique_lock lock(mutex);
 
-    *count = cachedSamples;
+    *count = copySamples ? ringWritten - getRingStart() : cachedSamples;
     return OPENDAQ_SUCCESS;
 }
 
@@ -163,7 +202,8 @@ TailReaderStatusPtr TailReaderImpl::readData(TailReaderInfo& info)
             it = packets.erase(packets.begin(), it + 1);
             cachedSamples -= readCachedSamples;
 
-            if (!skipEvents || invalid || eventPacket.getEventId() == event_packet_id::IMPLICIT_DOMAIN_GAP_DETECTED)
+            if (!skipEvents || invalid || eventPacket.getEventId() == event_packet_id::IMPLICIT_DOMAIN_GAP_DETECTED ||
+                eventPacket.getEventId() == event_packet_id::PACKETS_DROPPED)
             {
                 return TailReaderStatus(packet, !invalid, offset);
             }
@@ -187,6 +227,268 @@ TailReaderStatusPtr TailReaderImpl::readData(TailReaderInfo& info)
     return TailReaderStatus(nullptr, !invalid, offset);
 }
 
+void TailReaderImpl::initRing()
+{
+    if (!copySamples)
+        return;
+
+    const auto valueReadType = valueReader->getReadType();
+    if (!valueReader->isUndefined() && getSampleSize(valueReadType) == 0)
+        throw InvalidParameterException("Copying samples requires a numeric value read type");
+
+    ringInvalid = !updateRingLayout();
+}
+
+bool TailReaderImpl::updateRingLayout()
+{
+    SizeT valueSize = getSampleSize(valueReader->getReadType());
+    if (dataDescriptor.assigned())
+    {
+        const auto dimensions = dataDescriptor.getDimensions();
+        if (dimensions.assigned() && dimensions.getCount() == 1)
+            valueSize *= dimensions[0].getSize();
+    }
+
+    const SizeT domainSize = getSampleSize(domainReader->getReadType());
+    if (valueSize != valueSampleSize || domainSize != domainSampleSize)
+    {
+        valueSampleSize = valueSize;
+        domainSampleSize = domainSize;
+        std::vector<uint8_t>(historySize * valueSampleSize).swap(valueRing);
+        std::vector<uint8_t>(historySize * domainSampleSize).swap(domainRing);
+
+        // samples stored with the previous layout can no longer be read
+        ringReadStart = ringWritten;
+        ringDomainStart = ringWritten;
+        ringOffsets.clear();
+    }
+
+    return valueSampleSize != 0;
+}
+
+void TailReaderImpl::receiveRingEvent(const EventPacketPtr& eventPacket)
+{
+    // the descriptor is applied on arrival, as the following samples are converted when received;
+    // the reader becomes invalid only once the event is read
+    const bool wasInvalid = invalid;
+    invalid = false;
+    handleDescriptorChanged(eventPacket);
+    const bool valid = !invalid && updateRingLayout();
+    invalid = wasInvalid;
+
+    ringInvalid = !valid;
+    ringEvents.push_back({ringWritten, eventPacket, valid});
+
+    // the oldest event is dropped along with the samples preceding it; an invalid descriptor still invalidates the reader
+    if (ringEvents.size() > MaxRingEvents)
+    {
+        const auto dropped = ringEvents.front();
+        ringEvents.pop_front();
+        ringEvents.front().valid = ringEvents.front().valid && dropped.valid;
+        ringReadStart = std::max(ringReadStart, dropped.position);
+    }
+}
+
+void TailReaderImpl::fallBackToPacketHistory(ErrCode errCode)
+{
+    const auto logger = port.getContext().getLogger();
+    if (logger.assigned())
+    {
+        const auto loggerComponent = logger.getOrAddComponent("TailReader");
+        LOG_W("Copying samples to the history failed with error {:#x}, packets are kept instead", static_cast<uint32_t>(errCode));
+    }
+    daqClearErrorInfo();
+
+    // the copied samples are dropped, events not yet read are kept in order
+    copySamples = false;
+    for (const auto& event : ringEvents)
+        packets.push_back(event.packet);
+    cachedSamples = 0;
+
+    ringEvents.clear();
+    ringOffsets.clear();
+    std::vector<uint8_t>().swap(valueRing);
+    std::vector<uint8_t>().swap(domainRing);
+}
+
+ErrCode TailReaderImpl::writeRing(const DataPacketPtr& dataPacket)
+{
+    if (ringInvalid || historySize == 0)
+        return OPENDAQ_SUCCESS;
+
+    const SizeT sampleCount = dataPacket.getSampleCount();
+    const SizeT skipped = sampleCount > historySize ? sampleCount - historySize : 0;
+    const SizeT index = (ringWritten + skipped) % historySize;
+    const SizeT firstCount = std::min(sampleCount - skipped, historySize - index);
+    const SizeT secondCount = sampleCount - skipped - firstCount;
+
+    // only the last samples of a packet longer than the history are converted, wrapping around the end of the ring
+    const auto writeSamples = [&](Reader& reader, void* data, std::vector<uint8_t>& ring, SizeT sampleSize)
+    {
+        void* output = ring.data() + index * sampleSize;
+        ErrCode errCode = reader.readData(data, skipped, &output, firstCount);
+        if (OPENDAQ_SUCCEEDED(errCode) && secondCount > 0)
+        {
+            output = ring.data();
+            errCode = reader.readData(data, skipped + firstCount, &output, secondCount);
+        }
+        return errCode;
+    };
+
+    // the domain is written first, as resolving its sample type can change the layout of the rings
+    bool domainWritten = false;
+    const auto domainPacket = dataPacket.getDomainPacket();
+    if (domainPacket.assigned())
+    {
+        ErrCode errCode = domainSampleSize != 0 ? writeSamples(*domainReader, domainPacket.getData(), domainRing, domainSampleSize)
+                                                : OPENDAQ_ERR_INVALIDSTATE;
+        if (errCode == OPENDAQ_ERR_INVALIDSTATE && trySetDomainSampleType(domainPacket))
+        {
+            if (!updateRingLayout())
+                return OPENDAQ_SUCCESS;
+            errCode = domainSampleSize != 0 ? writeSamples(*domainReader, domainPacket.getData(), domainRing, domainSampleSize)
+                                            : OPENDAQ_ERR_INVALIDSTATE;
+        }
+
+        domainWritten = OPENDAQ_SUCCEEDED(errCode);
+        if (OPENDAQ_FAILED(errCode))
+            daqClearErrorInfo();
+    }
+
+    const ErrCode errCode = writeSamples(*valueReader, getValuePacketData(dataPacket), valueRing, valueSampleSize);
+    if (OPENDAQ_FAILED(errCode))
+        return errCode;
+
+    if (!domainWritten)
+        ringDomainStart = ringWritten + sampleCount;
+
+    Int offset = 0;
+    Int delta = 0;
+    if (domainPacket.assigned() && domainPacket.getOffset().assigned())
+    {
+        offset = domainPacket.getOffset().getIntValue();
+        const auto domainRule = domainPacket.getDataDescriptor().getRule();
+        if (domainRule.assigned() && domainRule.getType() == DataRuleType::Linear)
+            delta = domainRule.getParameters().get("delta");
+    }
+
+    // packets continuing the linear domain of the previous one share its entry
+    const bool continues = !ringOffsets.empty() && ringOffsets.back().delta == delta &&
+                           ringOffsets.back().offset + static_cast<Int>(ringWritten - ringOffsets.back().position) * delta == offset;
+    if (!continues)
+        ringOffsets.push_back({ringWritten, offset, delta});
+
+    ringWritten += sampleCount;
+
+    const SizeT start = getRingStart();
+    while (ringOffsets.size() > 1 && ringOffsets[1].position <= start)
+        ringOffsets.pop_front();
+
+    return OPENDAQ_SUCCESS;
+}
+
+SizeT TailReaderImpl::getRingStart() const
+{
+    const SizeT oldest = ringWritten > historySize ? ringWritten - historySize : 0;
+    return std::max(oldest, ringReadStart);
+}
+
+NumberPtr TailReaderImpl::getRingOffset(SizeT position) const
+{
+    auto it = std::upper_bound(ringOffsets.begin(),
+                               ringOffsets.end(),
+                               position,
+                               [](SizeT value, const RingOffset& ringOffset) { return value < ringOffset.position; });
+    if (it == ringOffsets.begin())
+        return NumberPtr(0);
+
+    --it;
+    return NumberPtr(it->offset + static_cast<Int>(position - it->position) * it->delta);
+}
+
+void TailReaderImpl::copyRing(const std::vector<uint8_t>& ring, SizeT sampleSize, SizeT position, SizeT count, void** output) const
+{
+    const SizeT index = position % historySize;
+    const SizeT firstCount = std::min(count, historySize - index);
+
+    auto* out = static_cast<uint8_t*>(*output);
+    std::memcpy(out, ring.data() + index * sampleSize, firstCount * sampleSize);
+    std::memcpy(out + firstCount * sampleSize, ring.data(), (count - firstCount) * sampleSize);
+    *output = out + count * sampleSize;
+}
+
+ErrCode TailReaderImpl::readRingRange(TailReaderInfo& info, SizeT position, SizeT count)
+{
+    if (info.domainValues != nullptr && position < ringDomainStart)
+        return makeErrorInfo(OPENDAQ_ERR_INVALIDSTATE, "Packets must have an associated domain packets to read domain data.");
+
+    copyRing(valueRing, valueSampleSize, position, count, &info.values);
+    if (info.domainValues != nullptr)
+        copyRing(domainRing, domainSampleSize, position, count, &info.domainValues);
+
+    info.remainingToRead -= count;
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode TailReaderImpl::readRing(TailReaderInfo& info, TailReaderStatusPtr& status)
+{
+    std::unique_lock lock(mutex);
+
+    const SizeT end = ringWritten;
+    SizeT position = getRingStart();
+    if (info.remainingToRead > end - position && info.remainingToRead > historySize)
+    {
+        status = TailReaderStatus(nullptr, !invalid, 0, false);
+        return OPENDAQ_SUCCESS;
+    }
+
+    if (end - position > info.remainingToRead)
+        position = end - info.remainingToRead;
+
+    NumberPtr offset;
+    while (!ringEvents.empty())
+    {
+        const auto event = ringEvents.front();
+        ringEvents.pop_front();
+
+        if (position < event.position)
+        {
+            if (!offset.assigned())
+                offset = getRingOffset(position);
+
+            const ErrCode errCode = readRingRange(info, position, event.position - position);
+            if (OPENDAQ_FAILED(errCode))
+                return errCode;
+            position = event.position;
+        }
+
+        // samples preceding the event are not read after it
+        ringReadStart = std::max(ringReadStart, event.position);
+        if (!event.valid)
+            invalid = true;
+
+        if (!skipEvents || invalid || event.packet.getEventId() == event_packet_id::IMPLICIT_DOMAIN_GAP_DETECTED ||
+            event.packet.getEventId() == event_packet_id::PACKETS_DROPPED)
+        {
+            status = TailReaderStatus(event.packet, !invalid, offset);
+            return OPENDAQ_SUCCESS;
+        }
+    }
+
+    if (position < end)
+    {
+        if (!offset.assigned())
+            offset = getRingOffset(position);
+
+        const ErrCode errCode = readRingRange(info, position, end - position);
+        if (OPENDAQ_FAILED(errCode))
+            return errCode;
+    }
+
+    status = TailReaderStatus(nullptr, !invalid, offset);
+    return OPENDAQ_SUCCESS;
+}
+
 ErrCode TailReaderImpl::read(void* values, SizeT* count, ITailReaderStatus** status)
 {
     OPENDAQ_PARAM_NOT_NULL(count);
@@ -207,7 +509,18 @@ ErrCode TailReaderImpl::read(void* values, SizeT* count, ITailReaderStatus** sta
 
     TailReaderInfo info{values, nullptr, *count};
 
-    auto statusPtr = readData(info);
+    TailReaderStatusPtr statusPtr;
+    if (copySamples)
+    {
+        const ErrCode errCode = readRing(info, statusPtr);
+        if (OPENDAQ_FAILED(errCode))
+            return errCode;
+    }
+    else
+    {
+        statusPtr = readData(info);
+    }
+
     if (status != nullptr)
     {
         *status = statusPtr.detach();
@@ -237,7 +550,18 @@ ErrCode TailReaderImpl::readWithDomain(void* values, void* domain, SizeT* count,
 
     TailReaderInfo info{values, domain, *count};
 
-    auto statusPtr = readData(info);
+    TailReaderStatusPtr statusPtr;
+    if (copySamples)
+    {
+        const ErrCode errCode = readRing(info, statusPtr);
+        if (OPENDAQ_FAILED(errCode))
+            return errCode;
+    }
+    else
+    {
+        statusPtr = readData(info);
+    }
+
     if (status != nullptr)
     {
         *status = statusPtr.detach();
@@ -251,6 +575,34 @@ ErrCode TailReaderImpl::packetReceived(IInputPort* /*port*/)
     std::unique_lock lock(mutex);
     bool hasEventPacket = false;
     PacketPtr packet = connection.dequeue();
+    while (packet.assigned() && copySamples)
+    {
+        switch (packet.getType())
+        {
+            case PacketType::Data:
+            {
+                const ErrCode errCode = writeRing(packet.asPtr<IDataPacket>(true));
+                if (OPENDAQ_FAILED(errCode))
+                {
+                    // the packet is stored by the packet based history below
+                    fallBackToPacketHistory(errCode);
+                    continue;
+                }
+                break;
+            }
+            case PacketType::Event:
+            {
+                hasEventPacket = true;
+                receiveRingEvent(packet.asPtr<IEventPacket>(true));
+                break;
+            }
+            case PacketType::None:
+                break;
+        }
+
+        packet = connection.dequeue();
+    }
+
     while (packet.assigned())
     {
         switch (packet.getType())
@@ -308,8 +660,9 @@ ErrCode TailReaderImpl::packetReceived(IInputPort* /*port*/)
         packet = connection.dequeue();
     }
 
+    const SizeT available = copySamples ? ringWritten - getRingStart() : cachedSamples;
     auto callback = readCallback;
-    if (callback.assigned() && (hasEventPacket || (cachedSamples >= historySize)))
+    if (callback.assigned() && (hasEventPacket || (available >= historySize)))
     {
         lock.unlock();
         return wrapHandler(callback);
@@ -388,7 +741,8 @@ daq::ErrCode PUBLIC_EXPORT createTailReaderFromBuilder(ITailReader** objTmp, ITa
                                                          builderPtr.getValueReadType(),
                                                          builderPtr.getDomainReadType(),
                                                          builderPtr.getReadMode(),
-                                                         builderPtr.getSkipEvents());
+                                                         builderPtr.getSkipEvents(),
+                                                         builderPtr.getCopySamples());
     }
     else if (auto signal = builderPtr.getSignal(); signal.assigned())
     {
@@ -398,7 +752,8 @@ daq::ErrCode PUBLIC_EXPORT createTailReaderFromBuilder(ITailReader** objTmp, ITa
                                                          builderPtr.getValueReadType(),
                                                          builderPtr.getDomainReadType(),
                                                          builderPtr.getReadMode(),
-                                                         builderPtr.getSkipEvents());
+                                                         builderPtr.getSkipEvents(),
+                                                         builderPtr.getCopySamples());
     }
 
     return makeErrorInfo(OPENDAQ_ERR_ARGUMENT_NULL, "Neither signal nor input port is not set in TailReader builder", nullptr);
@@ -0,0 +1,85 @@
+#include <opendaq/reader_factory.h>
+#include "reader_common.h"
+
+#include <chrono>
+
+using namespace daq;
+
+class MultiReaderBenchmark : public ReaderTest<>
+{
+public:
+    // signals with a common linear domain, each sent one packet per round
+    void addSignals(SizeT signalCount)
+    {
+        domainSignal = Signal(context, nullptr, "time");
+        domainSignal.setDescriptor(createDomainDescriptor("2022-09-27T00:02:03+00:00"));
+
+        valueSignals.clear();
+        signals = List<ISignal>();
+        for (SizeT i = 0; i < signalCount; ++i)
+        {
+            auto valueSignal = Signal(context, nullptr, fmt::format("sig{}", i));
+            valueSignal.setDescriptor(setupDescriptor(SampleType::Float64));
+            valueSignal.setDomainSignal(domainSignal);
+            valueSignals.push_back(valueSignal);
+            signals.pushBack(valueSignal);
+        }
+    }
+
+    void sendPackets(Int round, Int packetSize) const
+    {
+        for (const auto& valueSignal : valueSignals)
+        {
+            auto domainPacket = DataPacket(domainSignal.getDescriptor(), packetSize, round * packetSize);
+            auto packet = DataPacketWithDomain(domainPacket, valueSignal.getDescriptor(), packetSize);
+
+            auto data = static_cast<double*>(packet.getRawData());
+            for (Int i = 0; i < packetSize; ++i)
+                data[i] = static_cast<double>(round * packetSize + i);
+
+            valueSignal.sendPacket(packet);
+        }
+    }
+
+protected:
+    SignalConfigPtr domainSignal;
+    std::vector<SignalConfigPtr> valueSignals;
+    ListPtr<ISignal> signals;
+};
+
+TEST_F(MultiReaderBenchmark, ReadRateBySignalCount)
+{
+    constexpr Int PACKET_SIZE = 100;
+    constexpr Int ROUNDS = 200;
+
+    for (const SizeT signalCount : {1u, 8u, 32u, 128u})
+    {
+        addSignals(signalCount);
+        auto multi = MultiReader(signals);
+
+        std::vector<double> values(signalCount * PACKET_SIZE);
+        std::vector<void*> valuesPerSignal(signalCount);
+        for (SizeT i = 0; i < signalCount; ++i)
+            valuesPerSignal[i] = values.data() + i * PACKET_SIZE;
+
+        const auto start = std::chrono::steady_clock::now();
+        for (Int round = 0; round < ROUNDS; ++round)
+        {
+            sendPackets(round, PACKET_SIZE);
+
+            SizeT count{PACKET_SIZE};
+            auto status = multi.read(valuesPerSignal.data(), &count);
+            if (status.getReadStatus() == ReadStatus::Event)
+            {
+                count = PACKET_SIZE;
+                status = multi.read(valuesPerSignal.data(), &count);
+            }
+
+            ASSERT_EQ(status.getReadStatus(), ReadStatus::Ok);
+            ASSERT_EQ(count, static_cast<SizeT>(PACKET_SIZE));
+        }
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+        RecordProperty(fmt::format("ReadsPerSecond_{}", signalCount), std::to_string(ROUNDS / elapsed.count()));
+    }
+}
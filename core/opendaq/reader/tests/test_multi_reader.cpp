@@ -2140,6 +2140,61 @@ TEST_F(MultiReaderTest, DISABLED_MultiReaderGapDetection)
     ASSERT_EQ(count, 10u);
 }
 
+TEST_F(MultiReaderTest, PacketsDropped)
+{
+    constexpr const auto NUM_SIGNALS = 2;
+    readSignals.reserve(NUM_SIGNALS);
+
+    auto& sig0 = addSignal(0, 10, createDomainSignal("2022-09-27T00:02:03+00:00", nullptr, LinearDataRule(1, 0)));
+    auto& sig1 = addSignal(0, 10, createDomainSignal("2022-09-27T00:02:03+00:00", nullptr, LinearDataRule(1, 0)));
+
+    auto ports = portsList();
+    ports[0].setQueueLimit(1, QueueLimitUnit::Packets, QueueOverflowPolicy::DropOldest, 0);
+
+    auto signals = signalsToList();
+    auto multi = MultiReaderFromPort(ports);
+    for (size_t i = 0; i < NUM_SIGNALS; i++)
+        ports[i].connect(signals[i]);
+
+    SizeT count{0};
+    MultiReaderStatusPtr status = multi.read(nullptr, &count);
+    ASSERT_EQ(status.getReadStatus(), ReadStatus::Event);
+
+    // the first packet of signal 0 is dropped, so signal 0 continues 10 samples after signal 1
+    sig0.createAndSendPacket(0);
+    sig0.createAndSendPacket(1);
+    sig1.createAndSendPacket(0);
+    sig1.createAndSendPacket(1);
+    sig1.signal.getContext().getScheduler().waitAll();
+
+    ASSERT_EQ(multi.getAvailableCount(), 0u);
+
+    count = 0;
+    status = multi.read(nullptr, &count);
+    ASSERT_EQ(status.getReadStatus(), ReadStatus::Event);
+    ASSERT_EQ(status.getEventPackets().getCount(), 1u);
+    ASSERT_TRUE(status.getEventPackets().hasKey("/readsig0"));
+
+    auto event = status.getEventPackets().get("/readsig0");
+    ASSERT_EQ(event.getEventId(), event_packet_id::PACKETS_DROPPED);
+    ASSERT_EQ(event.getParameters().get(event_packet_param::DROPPED_PACKETS), 1);
+
+    // the signals are aligned again after the event
+    constexpr const SizeT SAMPLES = 10;
+
+    std::array<double[SAMPLES], NUM_SIGNALS> values{};
+    std::array<ClockTick[SAMPLES], NUM_SIGNALS> domain{};
+
+    void* valuesPerSignal[NUM_SIGNALS]{values[0], values[1]};
+    void* domainPerSignal[NUM_SIGNALS]{domain[0], domain[1]};
+
+    count = SAMPLES;
+    status = multi.readWithDomain(valuesPerSignal, domainPerSignal, &count);
+    ASSERT_EQ(status.getReadStatus(), ReadStatus::Ok);
+    ASSERT_EQ(count, SAMPLES);
+    ASSERT_THAT(domain[1], ElementsAreArray(domain[0]));
+}
+
 TEST_F(MultiReaderTest, ReadWhenOnePortIsNotConnected)
 {
     constexpr const auto NUM_SIGNALS = 3;
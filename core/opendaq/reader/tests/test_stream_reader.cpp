@@ -772,6 +772,107 @@ TYPED_TEST(StreamReaderTest, GapDetected)
     ASSERT_FALSE(status.getEventPacket().assigned());
 }
 
+TYPED_TEST(StreamReaderTest, PacketsDropped)
+{
+    this->signal.setDescriptor(setupDescriptor(SampleType::Float64));
+
+    auto port = InputPort(this->signal.getContext(), nullptr, "readsig");
+    port.setQueueLimit(2, QueueLimitUnit::Packets, QueueOverflowPolicy::DropOldest, 0);
+
+    auto reader = daq::StreamReaderBuilder()
+        .setInputPort(port)
+        .setValueReadType(SampleTypeFromType<TypeParam>::SampleType)
+        .setDomainReadType(SampleTypeFromType<ClockRange>::SampleType)
+        .setSkipEvents(true)
+        .build();
+    port.connect(this->signal);
+
+    for (int i = 1; i <= 3; ++i)
+    {
+        auto dataPacket = DataPacket(this->signal.getDescriptor(), 1);
+        static_cast<double*>(dataPacket.getData())[0] = i;
+        this->sendPacket(dataPacket);
+    }
+
+    // the first packet was dropped, so the reader stops at the event packet that replaced it
+    SizeT count{3};
+    TypeParam samples[3]{};
+    auto status = reader.read(&samples, &count);
+    ASSERT_EQ(count, 0u);
+    ASSERT_EQ(status.getReadStatus(), ReadStatus::Event);
+    ASSERT_EQ(status.getEventPacket().getEventId(), event_packet_id::PACKETS_DROPPED);
+    ASSERT_EQ(status.getEventPacket().getParameters().get(event_packet_param::DROPPED_PACKETS), 1);
+
+    count = 3;
+    status = reader.read(&samples, &count);
+    ASSERT_EQ(count, 2u);
+    ASSERT_EQ(status.getReadStatus(), ReadStatus::Ok);
+    ASSERT_EQ(samples[0], static_cast<TypeParam>(2));
+    ASSERT_EQ(samples[1], static_cast<TypeParam>(3));
+}
+
+TYPED_TEST(StreamReaderTest, PacketsDroppedAvailableCount)
+{
+    this->signal.setDescriptor(setupDescriptor(SampleType::Float64));
+
+    auto port = InputPort(this->signal.getContext(), nullptr, "readsig");
+    port.setQueueLimit(2, QueueLimitUnit::Packets, QueueOverflowPolicy::DropOldest, 0);
+
+    auto reader = daq::StreamReaderBuilder()
+        .setInputPort(port)
+        .setValueReadType(SampleTypeFromType<TypeParam>::SampleType)
+        .setDomainReadType(SampleTypeFromType<ClockRange>::SampleType)
+        .setSkipEvents(true)
+        .build();
+    port.connect(this->signal);
+
+    for (int i = 1; i <= 3; ++i)
+        this->sendPacket(DataPacket(this->signal.getDescriptor(), 1));
+
+    // the samples behind the event packet are not available until the event is read
+    ASSERT_EQ(reader.getAvailableCount(), 0u);
+    ASSERT_FALSE(reader.getEmpty());
+
+    SizeT count{0};
+    auto status = reader.read(nullptr, &count);
+    ASSERT_EQ(status.getReadStatus(), ReadStatus::Event);
+    ASSERT_EQ(status.getEventPacket().getEventId(), event_packet_id::PACKETS_DROPPED);
+
+    ASSERT_EQ(reader.getAvailableCount(), 2u);
+}
+
+TYPED_TEST(StreamReaderTest, PacketsDroppedTimedRead)
+{
+    this->signal.setDescriptor(setupDescriptor(SampleType::Float64));
+
+    auto port = InputPort(this->signal.getContext(), nullptr, "readsig");
+    port.setQueueLimit(2, QueueLimitUnit::Packets, QueueOverflowPolicy::DropOldest, 0);
+
+    auto reader = daq::StreamReaderBuilder()
+        .setInputPort(port)
+        .setValueReadType(SampleTypeFromType<TypeParam>::SampleType)
+        .setDomainReadType(SampleTypeFromType<ClockRange>::SampleType)
+        .setSkipEvents(true)
+        .build();
+    port.connect(this->signal);
+
+    for (int i = 1; i <= 3; ++i)
+        this->sendPacket(DataPacket(this->signal.getDescriptor(), 1));
+
+    // the pending event packet ends the wait, even though fewer samples than requested are queued
+    constexpr SizeT timeoutMs = 10000;
+    SizeT count{3};
+    TypeParam samples[3]{};
+    const auto start = std::chrono::steady_clock::now();
+    auto status = reader.read(&samples, &count, timeoutMs);
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    ASSERT_EQ(count, 0u);
+    ASSERT_EQ(status.getReadStatus(), ReadStatus::Event);
+    ASSERT_EQ(status.getEventPacket().getEventId(), event_packet_id::PACKETS_DROPPED);
+    ASSERT_LT(elapsed, std::chrono::milliseconds(timeoutMs));
+}
+
 TYPED_TEST(StreamReaderTest, DescriptorChangedNotConvertible)
 {
     this->signal.setDescriptor(setupDescriptor(SampleType::Int32));
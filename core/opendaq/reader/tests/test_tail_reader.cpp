@@ -1216,4 +1216,157 @@ TEST_F(TailReaderTest, DeltaCheck)
 
     ASSERT_EQ(count, 1);
     ASSERT_EQ(status.getOffset(), 1);
-}
\ No newline at end of file
+}
+
+TEST_F(TailReaderTest, CopySamplesRollingDomain)
+{
+    using ValueType = std::int64_t;
+
+    this->signal.setDescriptor(setupDescriptor(SampleTypeFromType<ValueType>::SampleType));
+
+    constexpr auto PACKET_SAMPLES = 4u;
+    constexpr auto HISTORY_SIZE = 10u;
+
+    auto reader = TailReaderBuilder()
+        .setSignal(this->signal)
+        .setHistorySize(HISTORY_SIZE)
+        .setValueReadType(SampleTypeFromType<double>::SampleType)
+        .setDomainReadType(SampleTypeFromType<ClockTick>::SampleType)
+        .setSkipEvents(true)
+        .setCopySamples(true)
+        .build();
+    ASSERT_EQ(reader.getAvailableCount(), 0u);
+
+    for (SizeT packetIndex = 0; packetIndex < 3; ++packetIndex)
+    {
+        const Int offset = static_cast<Int>(packetIndex * PACKET_SAMPLES);
+        auto domainPacket = DataPacket(setupDescriptor(SampleType::UInt64, LinearDataRule(1, 0), nullptr), PACKET_SAMPLES, offset);
+        auto dataPacket = DataPacketWithDomain(domainPacket, this->signal.getDescriptor(), PACKET_SAMPLES);
+
+        auto dataPtr = static_cast<ValueType*>(dataPacket.getData());
+        for (SizeT i = 0; i < PACKET_SAMPLES; ++i)
+            dataPtr[i] = offset + static_cast<Int>(i);
+
+        this->sendPacket(dataPacket);
+    }
+
+    ASSERT_EQ(reader.getAvailableCount(), HISTORY_SIZE);
+
+    SizeT count{HISTORY_SIZE};
+    double values[HISTORY_SIZE]{};
+    ClockTick domain[HISTORY_SIZE]{};
+    auto status = reader.readWithDomain(&values, &domain, &count);
+
+    ASSERT_EQ(count, HISTORY_SIZE);
+    ASSERT_EQ(status.getOffset(), 2);
+    for (SizeT i = 0; i < HISTORY_SIZE; ++i)
+    {
+        ASSERT_EQ(values[i], static_cast<double>(i + 2));
+        ASSERT_EQ(domain[i], static_cast<ClockTick>(i + 2));
+    }
+
+    // the history is kept after reading
+    count = 3;
+    reader.read(&values, &count);
+    ASSERT_EQ(count, 3u);
+    ASSERT_EQ(values[0], 9.0);
+    ASSERT_EQ(values[2], 11.0);
+}
+
+TEST_F(TailReaderTest, CopySamplesReleasesPackets)
+{
+    this->signal.setDescriptor(setupDescriptor(SampleType::Float64));
+
+    auto reader = TailReaderBuilder()
+        .setSignal(this->signal)
+        .setHistorySize(10)
+        .setSkipEvents(true)
+        .setCopySamples(true)
+        .build();
+
+    auto dataPacket = DataPacket(this->signal.getDescriptor(), 5);
+    this->sendPacket(dataPacket);
+    ASSERT_EQ(reader.getAvailableCount(), 5u);
+
+    // the samples are copied on arrival, so the reader does not hold the packet
+    const auto refCount = dataPacket.getRefCount();
+    reader.release();
+    ASSERT_EQ(dataPacket.getRefCount(), refCount);
+}
+
+TEST_F(TailReaderTest, CopySamplesDescriptorChanged)
+{
+    this->signal.setDescriptor(setupDescriptor(SampleType::Float64));
+
+    constexpr auto HISTORY_SIZE = 10u;
+
+    auto reader = TailReaderBuilder()
+        .setSignal(this->signal)
+        .setHistorySize(HISTORY_SIZE)
+        .setCopySamples(true)
+        .build();
+
+    SizeT count{0};
+    while (reader.read(nullptr, &count).getReadStatus() == ReadStatus::Event)
+        count = 0;
+
+    auto dataPacket = DataPacket(this->signal.getDescriptor(), 5);
+    auto dataPtr = static_cast<double*>(dataPacket.getData());
+    for (SizeT i = 0; i < 5; ++i)
+        dataPtr[i] = static_cast<double>(i);
+    this->sendPacket(dataPacket);
+
+    this->signal.setDescriptor(setupDescriptor(SampleType::Int32));
+
+    auto intPacket = DataPacket(this->signal.getDescriptor(), 5);
+    auto intPtr = static_cast<std::int32_t*>(intPacket.getData());
+    for (SizeT i = 0; i < 5; ++i)
+        intPtr[i] = static_cast<std::int32_t>(i + 5);
+    this->sendPacket(intPacket);
+
+    ASSERT_EQ(reader.getAvailableCount(), HISTORY_SIZE);
+
+    // samples preceding the event are read together with it
+    count = HISTORY_SIZE;
+    double values[HISTORY_SIZE]{};
+    auto status = reader.read(&values, &count);
+    ASSERT_EQ(status.getReadStatus(), ReadStatus::Event);
+    ASSERT_EQ(count, 5u);
+    for (SizeT i = 0; i < 5; ++i)
+        ASSERT_EQ(values[i], static_cast<double>(i));
+
+    ASSERT_EQ(reader.getAvailableCount(), 5u);
+
+    count = HISTORY_SIZE;
+    status = reader.read(&values, &count);
+    ASSERT_EQ(status.getReadStatus(), ReadStatus::Ok);
+    ASSERT_EQ(count, 5u);
+    for (SizeT i = 0; i < 5; ++i)
+        ASSERT_EQ(values[i], static_cast<double>(i + 5));
+}
+
+TEST_F(TailReaderTest, CopySamplesLimitsPendingEvents)
+{
+    this->signal.setDescriptor(setupDescriptor(SampleType::Float64));
+
+    auto reader = TailReaderBuilder()
+        .setSignal(this->signal)
+        .setHistorySize(10)
+        .setCopySamples(true)
+        .build();
+
+    // descriptor changes are received but never read, only the latest are kept
+    for (SizeT i = 0; i < 100; ++i)
+        this->signal.setDescriptor(setupDescriptor(i % 2 == 0 ? SampleType::Int32 : SampleType::Float64));
+
+    SizeT eventCount = 0;
+    SizeT count{0};
+    while (reader.read(nullptr, &count).getReadStatus() == ReadStatus::Event)
+    {
+        count = 0;
+        ++eventCount;
+    }
+
+    ASSERT_EQ(eventCount, 64u);
+    ASSERT_TRUE(reader.getIsValid());
+}
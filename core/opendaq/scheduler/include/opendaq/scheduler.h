@@ -17,6 +17,7 @@
 #pragma once
 #include <opendaq/awaitable.h>
 #include <opendaq/work.h>
+#include <opendaq/timer_task.h>
 #include <opendaq/task_graph.h>
 #include <opendaq/logger.h>
 #include <coretypes/listobject.h>
@@ -32,7 +33,7 @@ BEGIN_NAMESPACE_OPENDAQ
  */
 
 /*!
- * @brief A thread-pool scheduler that supports scheduling one-off functions as well as
+ * @brief A thread-pool scheduler that supports scheduling one-off functions, periodic work, as well as
  * dependency graphs.
  */
 DECLARE_OPENDAQ_INTERFACE(IScheduler, IBaseObject)
@@ -85,6 +86,23 @@ DECLARE_OPENDAQ_INTERFACE(IScheduler, IBaseObject)
      * @param[out] multiThreaded Returns @c true if more that one worker thread is used by the scheduler.
      */
     virtual ErrCode INTERFACE_FUNC isMultiThreaded(Bool* multiThreaded) = 0;
+
+    /*!
+     * @brief Schedules the specified work callback to run on the thread-pool at a deadline, and optionally
+     * periodically after it.
+     * The call does not block.
+     * @param work The function to schedule for execution.
+     * @param delayUs The time until the first deadline in microseconds.
+     * @param periodUs The period of the following deadlines in microseconds. If 0, the work runs only once.
+     * @param[out] task The object representing the scheduled work. It is used to cancel the work and to query
+     * its execution statistics.
+     * @retval OPENDAQ_ERR_SCHEDULER_STOPPED when the scheduler already stopped and is not accepting any more work.
+     *
+     * All timer tasks of the scheduler share a single timer thread that dispatches the work to the thread-pool
+     * at its deadlines. The work keeps running until the task is cancelled or the scheduler is stopped, even if
+     * the task object is released.
+     */
+    virtual ErrCode INTERFACE_FUNC scheduleTimer(IWork* work, SizeT delayUs, SizeT periodUs, ITimerTask** task) = 0;
 };
 /*!@}*/
 
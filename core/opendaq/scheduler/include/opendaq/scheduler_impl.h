@@ -21,9 +21,16 @@
 #include <opendaq/logger_ptr.h>
 #include <opendaq/logger_component_ptr.h>
 #include <opendaq/awaitable_ptr.h>
+#include <opendaq/timer_task_impl.h>
+#include <opendaq/timer_task_ptr.h>
 
 #include <opendaq/task_flow.h>
 
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <thread>
+
 BEGIN_NAMESPACE_OPENDAQ
 
 class SchedulerImpl final : public ImplementationOf<IScheduler>
@@ -35,6 +42,7 @@ public:
     ErrCode INTERFACE_FUNC scheduleFunction(IFunction* function, IAwaitable** awaitable) override;
     ErrCode INTERFACE_FUNC scheduleWork(IWork* work) override;
     ErrCode INTERFACE_FUNC scheduleGraph(ITaskGraph* graph, IAwaitable** awaitable) override;
+    ErrCode INTERFACE_FUNC scheduleTimer(IWork* work, SizeT delayUs, SizeT periodUs, ITimerTask** task) override;
     ErrCode INTERFACE_FUNC isMultiThreaded(Bool* multiThreaded) override;
 
     ErrCode INTERFACE_FUNC stop() override;
@@ -44,12 +52,20 @@ public:
 
 private:
     ErrCode checkAndPrepare(const IBaseObject* work, IAwaitable** awaitable);
+    void timerLoop();
+    void stopTimers();
 
     bool stopped;
     LoggerPtr logger;
     LoggerComponentPtr loggerComponent;
 
     std::unique_ptr<tf::Executor> executor;
+
+    std::mutex timerSync;
+    std::condition_variable timerCv;
+    std::multimap<TimerTaskImpl::Clock::time_point, TimerTaskPtr> timers;
+    bool timersStopped;
+    std::thread timerThread;
 };
 
 END_NAMESPACE_OPENDAQ
@@ -0,0 +1,87 @@
+/*
+ * Copyright 2022-2024 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <coretypes/baseobject.h>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+/*!
+ * @ingroup opendaq_scheduler_components
+ * @addtogroup opendaq_timer_task Timer task
+ * @{
+ */
+
+/*!
+ * @brief A work callback scheduled to run on the thread-pool of the Scheduler at a deadline, and optionally
+ * periodically after it.
+ *
+ * The deadlines of a periodic task are computed from the first deadline and the period, so that the execution
+ * time and the dispatch latency do not accumulate into a drift. A deadline is skipped and counted as an overrun
+ * if the previous execution has not finished yet, or if the deadline passed before the task could be dispatched.
+ *
+ * The jitter of an execution is the time between its deadline and the start of the execution.
+ */
+DECLARE_OPENDAQ_INTERFACE(ITimerTask, IBaseObject)
+{
+    /*!
+     * @brief Stops the task. Pending executions are discarded.
+     *
+     * When called from outside the work callback, the call waits for a running execution to finish, so that the
+     * callback is not called once cancel returns. The work callback is released by the call.
+     */
+    virtual ErrCode INTERFACE_FUNC cancel() = 0;
+
+    /*!
+     * @brief Returns whether the task is still scheduled.
+     * @param[out] active False if the task was cancelled, the scheduler was stopped, or the single execution
+     * of a non-periodic task has finished.
+     */
+    virtual ErrCode INTERFACE_FUNC isActive(Bool* active) = 0;
+
+    /*!
+     * @brief Gets the number of finished executions.
+     * @param[out] count The number of finished executions.
+     */
+    virtual ErrCode INTERFACE_FUNC getExecutionCount(SizeT* count) = 0;
+
+    /*!
+     * @brief Gets the number of skipped deadlines.
+     * @param[out] count The number of deadlines skipped because the previous execution was still running, or
+     * because they passed before the task could be dispatched.
+     */
+    virtual ErrCode INTERFACE_FUNC getOverrunCount(SizeT* count) = 0;
+
+    /*!
+     * @brief Gets the largest jitter of the executions since the statistics were reset.
+     * @param[out] jitterUs The jitter in microseconds.
+     */
+    virtual ErrCode INTERFACE_FUNC getMaxJitter(SizeT* jitterUs) = 0;
+
+    /*!
+     * @brief Gets the mean jitter of the executions since the statistics were reset.
+     * @param[out] jitterUs The jitter in microseconds.
+     */
+    virtual ErrCode INTERFACE_FUNC getMeanJitter(SizeT* jitterUs) = 0;
+
+    /*!
+     * @brief Resets the execution and overrun counts, and the jitter statistics.
+     */
+    virtual ErrCode INTERFACE_FUNC resetStatistics() = 0;
+};
+/*!@}*/
+
+END_NAMESPACE_OPENDAQ
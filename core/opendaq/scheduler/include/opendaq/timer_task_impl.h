@@ -0,0 +1,72 @@
+/*
+ * Copyright 2022-2024 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <opendaq/timer_task.h>
+#include <opendaq/work_ptr.h>
+#include <coretypes/intfs.h>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+class TimerTaskImpl final : public ImplementationOf<ITimerTask>
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    TimerTaskImpl(WorkPtr work, Clock::duration period);
+
+    ErrCode INTERFACE_FUNC cancel() override;
+    ErrCode INTERFACE_FUNC isActive(Bool* active) override;
+    ErrCode INTERFACE_FUNC getExecutionCount(SizeT* count) override;
+    ErrCode INTERFACE_FUNC getOverrunCount(SizeT* count) override;
+    ErrCode INTERFACE_FUNC getMaxJitter(SizeT* jitterUs) override;
+    ErrCode INTERFACE_FUNC getMeanJitter(SizeT* jitterUs) override;
+    ErrCode INTERFACE_FUNC resetStatistics() override;
+
+    // Called by the timer thread at the deadline. Returns false if the deadline is skipped.
+    bool tryStart();
+
+    // Runs the work on a worker thread, after a successful tryStart.
+    void execute(Clock::time_point deadline);
+
+    // Computes the deadline after the given one, skipping the deadlines that already passed.
+    // Returns false if the task does not run again.
+    bool nextDeadline(Clock::time_point& deadline, Clock::time_point now);
+
+    // Cancels the task without waiting for a running execution; called when the scheduler stops.
+    void stop();
+
+private:
+    std::mutex sync;
+    std::condition_variable idleCv;
+    WorkPtr work;
+    Clock::duration period;
+    bool cancelled;
+    bool running;
+    std::thread::id runningThreadId;
+
+    SizeT executionCount;
+    SizeT overrunCount;
+    SizeT jitterCount;
+    Clock::duration maxJitter;
+    Clock::duration totalJitter;
+};
+
+END_NAMESPACE_OPENDAQ
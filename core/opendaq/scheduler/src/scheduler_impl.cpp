@@ -23,6 +23,7 @@ SchedulerImpl::SchedulerImpl(LoggerPtr logger, SizeT numWorkers)
                           ? this->logger.getOrAddComponent("Scheduler")
                           : throw ArgumentNullException("Logger must not be null"))
     , executor(std::make_unique<tf::Executor>(numWorkers < 1 ? std::thread::hardware_concurrency() : numWorkers))
+    , timersStopped(false)
 {
     LOG_T("Starting scheduler with {} workers.", executor->num_workers())
 }
@@ -48,6 +49,7 @@ ErrCode SchedulerImpl::stop()
     stopped = true;
 
     LOGP_T("Stopping scheduler")
+    stopTimers();
     executor.reset();
 
     LOGP_T("Stopped")
@@ -118,6 +120,92 @@ ErrCode SchedulerImpl::scheduleGraph(ITaskGraph* graph, IAwaitable** awaitable)
     return OPENDAQ_SUCCESS;
 }
 
+ErrCode SchedulerImpl::scheduleTimer(IWork* work, SizeT delayUs, SizeT periodUs, ITimerTask** task)
+{
+    OPENDAQ_PARAM_NOT_NULL(work);
+    OPENDAQ_PARAM_NOT_NULL(task);
+
+    if (stopped)
+        return OPENDAQ_ERR_SCHEDULER_STOPPED;
+
+    const auto deadline = TimerTaskImpl::Clock::now() + std::chrono::microseconds(delayUs);
+    const auto timerTask = createWithImplementation<ITimerTask, TimerTaskImpl>(WorkPtr(work), std::chrono::microseconds(periodUs));
+
+    {
+        std::scoped_lock lock(timerSync);
+        if (timersStopped)
+            return OPENDAQ_ERR_SCHEDULER_STOPPED;
+
+        // a single thread dispatches the work of all timers, started with the first timer
+        if (!timerThread.joinable())
+            timerThread = std::thread(&SchedulerImpl::timerLoop, this);
+
+        timers.emplace(deadline, timerTask);
+    }
+
+    timerCv.notify_one();
+
+    *task = timerTask.addRefAndReturn();
+    return OPENDAQ_SUCCESS;
+}
+
+void SchedulerImpl::timerLoop()
+{
+    std::unique_lock lock(timerSync);
+
+    while (!timersStopped)
+    {
+        if (timers.empty())
+        {
+            timerCv.wait(lock);
+            continue;
+        }
+
+        const auto now = TimerTaskImpl::Clock::now();
+        auto first = timers.begin();
+        if (first->first > now)
+        {
+            timerCv.wait_until(lock, first->first);
+            continue;
+        }
+
+        auto deadline = first->first;
+        auto task = std::move(first->second);
+        timers.erase(first);
+
+        auto taskImpl = static_cast<TimerTaskImpl*>(task.getObject());
+        if (taskImpl->tryStart())
+            executor->silent_async([task, deadline]() { static_cast<TimerTaskImpl*>(task.getObject())->execute(deadline); });
+
+        if (taskImpl->nextDeadline(deadline, now))
+            timers.emplace(deadline, std::move(task));
+        else
+        {
+            // the task is released after unlocking, as it can hold the last reference to the work
+            lock.unlock();
+            task.release();
+            lock.lock();
+        }
+    }
+}
+
+void SchedulerImpl::stopTimers()
+{
+    decltype(timers) stoppedTimers;
+    {
+        std::scoped_lock lock(timerSync);
+        timersStopped = true;
+        stoppedTimers.swap(timers);
+    }
+
+    timerCv.notify_all();
+    if (timerThread.joinable())
+        timerThread.join();
+
+    for (const auto& [deadline, task] : stoppedTimers)
+        static_cast<TimerTaskImpl*>(task.getObject())->stop();
+}
+
 ErrCode SchedulerImpl::isMultiThreaded(Bool* multiThreaded)
 {
     if (multiThreaded == nullptr)
@@ -0,0 +1,169 @@
+#include <opendaq/timer_task_impl.h>
+#include <coretypes/validation.h>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+using namespace std::chrono;
+
+TimerTaskImpl::TimerTaskImpl(WorkPtr work, Clock::duration period)
+    : work(std::move(work))
+    , period(period)
+    , cancelled(false)
+    , running(false)
+    , executionCount(0)
+    , overrunCount(0)
+    , jitterCount(0)
+    , maxJitter(0)
+    , totalJitter(0)
+{
+}
+
+ErrCode TimerTaskImpl::cancel()
+{
+    WorkPtr cancelledWork;
+    {
+        std::unique_lock lock(sync);
+        cancelled = true;
+
+        if (runningThreadId != std::this_thread::get_id())
+            idleCv.wait(lock, [this] { return !running; });
+
+        // the work is released after unlocking, as it can hold the last reference to its owner
+        cancelledWork = std::move(work);
+    }
+
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode TimerTaskImpl::isActive(Bool* active)
+{
+    OPENDAQ_PARAM_NOT_NULL(active);
+
+    std::scoped_lock lock(sync);
+    *active = !cancelled;
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode TimerTaskImpl::getExecutionCount(SizeT* count)
+{
+    OPENDAQ_PARAM_NOT_NULL(count);
+
+    std::scoped_lock lock(sync);
+    *count = executionCount;
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode TimerTaskImpl::getOverrunCount(SizeT* count)
+{
+    OPENDAQ_PARAM_NOT_NULL(count);
+
+    std::scoped_lock lock(sync);
+    *count = overrunCount;
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode TimerTaskImpl::getMaxJitter(SizeT* jitterUs)
+{
+    OPENDAQ_PARAM_NOT_NULL(jitterUs);
+
+    std::scoped_lock lock(sync);
+    *jitterUs = static_cast<SizeT>(duration_cast<microseconds>(maxJitter).count());
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode TimerTaskImpl::getMeanJitter(SizeT* jitterUs)
+{
+    OPENDAQ_PARAM_NOT_NULL(jitterUs);
+
+    std::scoped_lock lock(sync);
+    *jitterUs = jitterCount == 0 ? 0 : static_cast<SizeT>(duration_cast<microseconds>(totalJitter).count()) / jitterCount;
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode TimerTaskImpl::resetStatistics()
+{
+    std::scoped_lock lock(sync);
+    executionCount = 0;
+    overrunCount = 0;
+    jitterCount = 0;
+    maxJitter = Clock::duration::zero();
+    totalJitter = Clock::duration::zero();
+    return OPENDAQ_SUCCESS;
+}
+
+bool TimerTaskImpl::tryStart()
+{
+    std::scoped_lock lock(sync);
+    if (cancelled)
+        return false;
+
+    if (running)
+    {
+        overrunCount++;
+        return false;
+    }
+
+    running = true;
+    return true;
+}
+
+void TimerTaskImpl::execute(Clock::time_point deadline)
+{
+    WorkPtr currentWork;
+    {
+        std::scoped_lock lock(sync);
+        if (cancelled)
+        {
+            running = false;
+            idleCv.notify_all();
+            return;
+        }
+
+        const auto jitter = Clock::now() - deadline;
+        maxJitter = std::max(maxJitter, jitter);
+        totalJitter += jitter;
+        jitterCount++;
+
+        currentWork = work;
+        runningThreadId = std::this_thread::get_id();
+    }
+
+    // errors of the work are ignored, as with work scheduled with scheduleWork
+    if (OPENDAQ_FAILED(currentWork->execute()))
+        daqClearErrorInfo();
+    currentWork.release();
+
+    std::scoped_lock lock(sync);
+    running = false;
+    runningThreadId = std::thread::id();
+    executionCount++;
+    if (period == Clock::duration::zero())
+        cancelled = true;
+    idleCv.notify_all();
+}
+
+bool TimerTaskImpl::nextDeadline(Clock::time_point& deadline, Clock::time_point now)
+{
+    std::scoped_lock lock(sync);
+    if (cancelled || period == Clock::duration::zero())
+        return false;
+
+    // deadlines are multiples of the period from the first deadline, so the period does not drift
+    deadline += period;
+    if (deadline <= now)
+    {
+        const auto missed = (now - deadline) / period + 1;
+        overrunCount += static_cast<SizeT>(missed);
+        deadline += missed * period;
+    }
+
+    return true;
+}
+
+void TimerTaskImpl::stop()
+{
+    std::scoped_lock lock(sync);
+    cancelled = true;
+}
+
+END_NAMESPACE_OPENDAQ
@@ -0,0 +1,45 @@
+#include <gtest/gtest.h>
+#include <opendaq/scheduler_factory.h>
+#include <opendaq/work_factory.h>
+#include <opendaq/logger_factory.h>
+#include <opendaq/timer_task_ptr.h>
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace daq;
+using namespace std::chrono_literals;
+
+using TimerTaskBenchmark = testing::Test;
+
+TEST_F(TimerTaskBenchmark, JitterWithManyTasks)
+{
+    const auto scheduler = Scheduler(Logger());
+
+    constexpr size_t taskCount = 100;
+    std::vector<TimerTaskPtr> tasks;
+    for (size_t i = 0; i < taskCount; ++i)
+        tasks.push_back(scheduler.scheduleTimer(Work([] {}), 0, 1000 + i * 100));
+
+    std::this_thread::sleep_for(1s);
+
+    SizeT maxJitter = 0;
+    SizeT meanJitter = 0;
+    SizeT executions = 0;
+    SizeT overruns = 0;
+    for (const auto& task : tasks)
+    {
+        task.cancel();
+        maxJitter = std::max(maxJitter, task.getMaxJitter());
+        meanJitter += task.getMeanJitter();
+        executions += task.getExecutionCount();
+        overruns += task.getOverrunCount();
+    }
+
+    ASSERT_GT(executions, 0u);
+    RecordProperty("Executions", std::to_string(executions));
+    RecordProperty("Overruns", std::to_string(overruns));
+    RecordProperty("MaxJitterUs", std::to_string(maxJitter));
+    RecordProperty("MeanJitterUs", std::to_string(meanJitter / taskCount));
+}
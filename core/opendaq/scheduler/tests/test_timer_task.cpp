@@ -0,0 +1,120 @@
+#include <gtest/gtest.h>
+#include <opendaq/scheduler_factory.h>
+#include <opendaq/scheduler_errors.h>
+#include <opendaq/work_factory.h>
+#include <opendaq/logger_factory.h>
+#include <opendaq/timer_task_ptr.h>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+
+using namespace daq;
+using namespace std::chrono_literals;
+
+using TimerTaskTest = testing::Test;
+
+TEST_F(TimerTaskTest, SingleShot)
+{
+    const auto scheduler = Scheduler(Logger(), 2);
+
+    std::atomic<int> executed{0};
+    const auto task = scheduler.scheduleTimer(Work([&executed] { executed++; }), 10000, 0);
+    ASSERT_TRUE(task.isActive());
+
+    std::this_thread::sleep_for(100ms);
+    ASSERT_EQ(executed.load(), 1);
+    ASSERT_EQ(task.getExecutionCount(), 1u);
+    ASSERT_FALSE(task.isActive());
+}
+
+TEST_F(TimerTaskTest, Periodic)
+{
+    const auto scheduler = Scheduler(Logger(), 2);
+
+    std::atomic<int> executed{0};
+    const auto task = scheduler.scheduleTimer(Work([&executed] { executed++; }), 0, 5000);
+
+    std::this_thread::sleep_for(200ms);
+    task.cancel();
+
+    const int count = executed.load();
+    ASSERT_GE(count, 10);
+    ASSERT_EQ(task.getExecutionCount(), static_cast<SizeT>(count));
+    ASSERT_FALSE(task.isActive());
+
+    std::this_thread::sleep_for(50ms);
+    ASSERT_EQ(executed.load(), count);
+}
+
+TEST_F(TimerTaskTest, Overrun)
+{
+    const auto scheduler = Scheduler(Logger(), 2);
+
+    const auto task = scheduler.scheduleTimer(Work([] { std::this_thread::sleep_for(25ms); }), 0, 10000);
+    std::this_thread::sleep_for(200ms);
+    task.cancel();
+
+    ASSERT_GT(task.getOverrunCount(), 0u);
+    ASSERT_GT(task.getExecutionCount(), 0u);
+
+    task.resetStatistics();
+    ASSERT_EQ(task.getOverrunCount(), 0u);
+    ASSERT_EQ(task.getExecutionCount(), 0u);
+    ASSERT_EQ(task.getMaxJitter(), 0u);
+}
+
+TEST_F(TimerTaskTest, CancelWaitsForExecution)
+{
+    const auto scheduler = Scheduler(Logger(), 2);
+
+    std::atomic<bool> started{false};
+    std::atomic<bool> finished{false};
+    const auto task = scheduler.scheduleTimer(Work([&started, &finished]
+    {
+        started = true;
+        std::this_thread::sleep_for(50ms);
+        finished = true;
+    }), 0, 0);
+
+    while (!started)
+        std::this_thread::yield();
+
+    task.cancel();
+    ASSERT_TRUE(finished);
+}
+
+TEST_F(TimerTaskTest, CancelFromWork)
+{
+    const auto scheduler = Scheduler(Logger(), 2);
+
+    std::atomic<int> executed{0};
+    TimerTaskPtr task;
+    std::mutex taskSync;
+    {
+        std::scoped_lock lock(taskSync);
+        task = scheduler.scheduleTimer(Work([&]
+        {
+            executed++;
+            std::scoped_lock lock(taskSync);
+            task.cancel();
+        }), 0, 1000);
+    }
+
+    std::this_thread::sleep_for(50ms);
+    ASSERT_EQ(executed.load(), 1);
+    ASSERT_FALSE(task.isActive());
+}
+
+TEST_F(TimerTaskTest, Stopped)
+{
+    const auto scheduler = Scheduler(Logger(), 2);
+
+    const auto task = scheduler.scheduleTimer(Work([] {}), 0, 1000);
+    scheduler.stop();
+
+    ASSERT_FALSE(task.isActive());
+
+    ITimerTask* stoppedTask = nullptr;
+    ASSERT_EQ(scheduler->scheduleTimer(Work([] {}), 0, 1000, &stoppedTask), OPENDAQ_ERR_SCHEDULER_STOPPED);
+}
@@ -160,7 +160,7 @@ DECLARE_OPENDAQ_INTERFACE(IConnection, IBaseObject)
 
     /*!
      * @brief Gets the number of samples available in the queued packets until the next gap packet.
-     * The returned value is up-to the next Gap packet if any.
+     * The returned value is up-to the next Gap packet if any. Packets-dropped event packets count as gap packets.
      * @param[out] samples The total amount of samples currently available in the stored packets until the next gap packet.
      */
     virtual ErrCode INTERFACE_FUNC getSamplesUntilNextGapPacket(SizeT* samples) = 0;
@@ -173,7 +173,7 @@ DECLARE_OPENDAQ_INTERFACE(IConnection, IBaseObject)
 
     /*!
      * @brief Queries if the connection has a gap packet.
-     * @param[out] hasGapPacket True if the connection has a gap packet.
+     * @param[out] hasGapPacket True if the connection has a gap packet or a packets-dropped event packet.
      */
     virtual ErrCode INTERFACE_FUNC hasGapPacket(Bool* hasGapPacket) = 0;
 };
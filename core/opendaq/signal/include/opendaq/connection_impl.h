@@ -16,6 +16,8 @@
 
 #pragma once
 #include <opendaq/connection.h>
+#include <opendaq/connection_private.h>
+#include <opendaq/packet_statistics.h>
 #include <opendaq/input_port_config_ptr.h>
 #include <opendaq/context_ptr.h>
 #include <coretypes/intfs.h>
@@ -24,16 +26,22 @@
 #include <opendaq/data_packet_ptr.h>
 
 #ifdef OPENDAQ_THREAD_SAFE
+    #include <condition_variable>
     #include <mutex>
 #endif
 
+#include <array>
+#include <chrono>
 #include <queue>
 
 BEGIN_NAMESPACE_OPENDAQ
-class ConnectionImpl : public ImplementationOfWeak<IConnection>
+class ConnectionImpl : public ImplementationOfWeak<IConnection, IPacketStatistics, IConnectionPrivate>
 {
 public:
-    using Super = ImplementationOfWeak<IConnection>;
+    using Super = ImplementationOfWeak<IConnection, IPacketStatistics, IConnectionPrivate>;
+
+    static constexpr uint64_t LatencySampleInterval = 16;
+    static constexpr size_t LatencyBucketCount = 24;
 
     explicit ConnectionImpl(
         const InputPortPtr& port,
@@ -62,6 +70,13 @@ public:
 
     ErrCode INTERFACE_FUNC isRemote(Bool* remote) override;
 
+    // IPacketStatistics
+    ErrCode INTERFACE_FUNC getStatistics(IDict** statistics) override;
+    ErrCode INTERFACE_FUNC resetStatistics() override;
+
+    // IConnectionPrivate
+    ErrCode INTERFACE_FUNC setQueueLimit(SizeT limit, QueueLimitUnit unit, QueueOverflowPolicy policy, SizeT blockTimeoutMs) override;
+
     // IBaseObject
     ErrCode INTERFACE_FUNC queryInterface(const IntfID& id, void** intf) override;
     ErrCode INTERFACE_FUNC borrowInterface(const IntfID& id, void** intf) const override;
@@ -92,6 +107,26 @@ private:
 
     enum class GapCheckState { disabled, uninitialized, not_available, initialized, running };
 
+    // written under the lock of the queue
+    struct Statistics
+    {
+        uint64_t packetsEnqueued{};
+        uint64_t packetsDequeued{};
+        uint64_t samplesEnqueued{};
+        uint64_t bytesEnqueued{};
+        uint64_t packetsDropped{};
+        uint64_t samplesDropped{};
+        uint64_t gapsDetected{};
+        uint64_t maxQueueDepth{};
+        std::array<uint64_t, LatencyBucketCount> latencyHistogram{};
+    };
+
+    struct LatencySample
+    {
+        uint64_t sequence;
+        std::chrono::steady_clock::time_point enqueueTime;
+    };
+
     InputPortConfigPtr port;
     WeakRefPtr<ISignal> signalRef;
     ContextPtr context;
@@ -102,12 +137,40 @@ private:
     SampleType domainSampleType;
     LoggerComponentPtr loggerComponent;
 
+    Statistics statistics;
+    uint64_t enqueueSequence{};
+    uint64_t dequeueSequence{};
+    std::deque<LatencySample> latencySamples;
+
+    // set by the input port, read under the lock of the queue
+    SizeT queueLimit{};
+    QueueLimitUnit queueLimitUnit{QueueLimitUnit::Packets};
+    QueueOverflowPolicy overflowPolicy{QueueOverflowPolicy::DropOldest};
+    std::chrono::milliseconds blockTimeout{};
+
 #ifdef OPENDAQ_THREAD_SAFE
     mutable std::mutex mutex;
+    std::condition_variable_any queueSpaceAvailable;
+    SizeT blockedProducers{};
 #endif
 
     void onPacketEnqueued(const PacketPtr& packet);
     void onPacketDequeued(const PacketPtr& packet);
+    void onPacketsDropped(SizeT count);
+
+    // called after a packet is placed in or taken from the queue
+    void trackEnqueued();
+    void trackDequeued();
+    void recordLatency(std::chrono::steady_clock::duration latency);
+
+    // called before a packet is placed in a limited queue; returns false if the packet is dropped
+    bool makeRoom(const PacketPtr& packet);
+    bool exceedsLimit(SizeT incoming) const;
+    SizeT indexOfOldestDataPacket() const;
+    void dropQueued(SizeT index);
+    void dropIncoming(SizeT sampleCount);
+    void eraseQueued(SizeT index);
+    void notifySpaceAvailable();
 
     void checkForGaps(const PacketPtr& packet);
     void enqueueGapPacket(const DomainValue& diff);
@@ -131,7 +194,9 @@ private:
 protected:
     SizeT samplesCnt{};
     SizeT eventPacketsCnt{};
-    SizeT gapPacketsCnt{};
+    SizeT gapPacketsCnt{}; // gap and packets-dropped event packets
+    SizeT dataPacketsCnt{};
+    SizeT bytesCnt{};
     std::deque<PacketPtr> packets;
 };
 
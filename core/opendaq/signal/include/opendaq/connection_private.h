@@ -0,0 +1,47 @@
+/*
+ * Copyright 2022-2024 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <opendaq/input_port_config.h>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+/*!
+ * @ingroup opendaq_signal_path
+ * @addtogroup opendaq_connection Connection
+ * @{
+ */
+
+/*!
+ * @brief Internal functions used by openDAQ core. This interface should never be used in
+ * client SDK or module code.
+ */
+DECLARE_OPENDAQ_INTERFACE(IConnectionPrivate, IBaseObject)
+{
+    /*!
+     * @brief Limits the packet queue of the connection.
+     * @param limit The largest allowed queue size, in the given unit. Zero disables the limit.
+     * @param unit The unit of the limit.
+     * @param policy What to do with a data packet that would exceed the limit.
+     * @param blockTimeoutMs How long the sending thread is blocked with the `Block` policy, in milliseconds.
+     *
+     * Called by the input port when the connection is made and when its queue limit is changed.
+     */
+    virtual ErrCode INTERFACE_FUNC setQueueLimit(SizeT limit, QueueLimitUnit unit, QueueOverflowPolicy policy, SizeT blockTimeoutMs) = 0;
+};
+/*!@}*/
+
+END_NAMESPACE_OPENDAQ
@@ -50,6 +50,7 @@ public:
     ErrCode INTERFACE_FUNC getRawSampleSize(SizeT* rawSampleSizes) override;
 
     ErrCode INTERFACE_FUNC equals(IBaseObject* other, Bool* equal) const override;
+    ErrCode INTERFACE_FUNC getHashCode(SizeT* hashCode) override;
 
     // IScalingCalcPrivate
     void* INTERFACE_FUNC scaleData(void* data, SizeT sampleCount) const override;
@@ -96,8 +97,13 @@ private:
     SizeT sampleSize;
     SizeT rawSampleSize;
 
+    // Content hash computed once at construction; descriptors are immutable, so equal
+    // descriptors always share the same hash and a mismatch proves inequality.
+    SizeT contentHash;
+
     static DictPtr<IString, IBaseObject> PackBuilder(IDataDescriptorBuilder* dataDescriptorBuilder);
     void calculateSampleMemSize();
+    SizeT calculateContentHash() const;
 };
 
 OPENDAQ_REGISTER_DESERIALIZE_FACTORY(DataDescriptorImpl)
@@ -19,6 +19,7 @@
 #include <opendaq/data_descriptor_ptr.h>
 #include <opendaq/data_rule_calc_private.h>
 #include <opendaq/generic_data_packet_impl.h>
+#include <opendaq/last_value_slot.h>
 #include <opendaq/range_factory.h>
 #include <opendaq/sample_type_traits.h>
 #include <opendaq/scaling_calc_private.h>
@@ -412,78 +413,7 @@ bool DataPacketImpl<TInterface>::isDataEqual(const DataPacketPtr& dataPacket) co
 template <typename TInterface>
 inline BaseObjectPtr DataPacketImpl<TInterface>::dataToObj(void* addr, const SampleType& type) const
 {
-    switch (type)
-    {
-        case SampleType::Float32:
-        {
-            const auto data = static_cast<float*>(addr);
-            return Floating(*data);
-        }
-        case SampleType::Float64:
-        {
-            const auto data = static_cast<double*>(addr);
-            return Floating(*data);
-        }
-        case SampleType::Int8:
-        {
-            const auto data = static_cast<int8_t*>(addr);
-            return Integer(*data);
-        }
-        case SampleType::UInt8:
-        {
-            const auto data = static_cast<uint8_t*>(addr);
-            return Integer(*data);
-        }
-        case SampleType::Int16:
-        {
-            const auto data = static_cast<int16_t*>(addr);
-            return Integer(*data);
-        }
-        case SampleType::UInt16:
-        {
-            const auto data = static_cast<uint16_t*>(addr);
-            return Integer(*data);
-        }
-        case SampleType::Int32:
-        {
-            const auto data = static_cast<int32_t*>(addr);
-            return Integer(*data);
-        }
-        case SampleType::UInt32:
-        {
-            const auto data = static_cast<uint32_t*>(addr);
-            return Integer(*data);
-        }
-        case SampleType::Int64:
-        {
-            const auto data = static_cast<int64_t*>(addr);
-            return Integer(*data);
-        }
-        case SampleType::UInt64:
-        {
-            const auto data = static_cast<uint64_t*>(addr);
-            return Integer(*data);
-        }
-        case SampleType::RangeInt64:
-        {
-            const auto data = static_cast<int64_t*>(addr);
-            return Range(data[0], data[1]);
-        }
-        case SampleType::ComplexFloat32:
-        {
-            const auto data = static_cast<float*>(addr);
-            return ComplexNumber(data[0], data[1]);
-        }
-        case SampleType::ComplexFloat64:
-        {
-            const auto data = static_cast<double*>(addr);
-            return ComplexNumber(data[0], data[1]);
-        }
-        default:
-        {
-            return BaseObject();
-        }
-    }
+    return sampleToObject(addr, type);
 }
 
 template <typename TInterface>
@@ -570,6 +500,18 @@ ErrCode DataPacketImpl<TInterface>::getLastValue(IBaseObject** value, ITypeManag
     if (dimensionCount > 1)
         return OPENDAQ_IGNORED;
 
+    // scalar samples are scaled or calculated only for the last sample, instead of for the whole packet
+    if (dimensionCount == 0)
+    {
+        IDataPacket* thisPacket = this;
+        LastValueSlot lastValue;
+        if (lastValue.update(DataPacketPtr::Borrow(thisPacket)))
+        {
+            *value = lastValue.getValue().detach();
+            return OPENDAQ_SUCCESS;
+        }
+    }
+
     void* addr;
     ErrCode err = this->getData(&addr);
     if (OPENDAQ_FAILED(err))
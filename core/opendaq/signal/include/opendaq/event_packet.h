@@ -89,4 +89,21 @@ OPENDAQ_DECLARE_CLASS_FACTORY_WITH_INTERFACE(LIBRARY_FACTORY,
                                              INumber*,
                                              diff)
 
+/*!
+ * @brief Creates a PacketsDropped Event packet.
+ * @param droppedPackets The number of dropped data packets.
+ * @param droppedSamples The number of samples in the dropped data packets.
+ *
+ * The ID of the packet is "PACKETS_DROPPED". Its parameters dictionary contains the keys "DroppedPackets" and
+ * "DroppedSamples". The packet is placed in a connection queue where data packets were dropped, because the
+ * queue limit was reached.
+ */
+OPENDAQ_DECLARE_CLASS_FACTORY_WITH_INTERFACE(LIBRARY_FACTORY,
+                                             PacketsDroppedEventPacket,
+                                             IEventPacket,
+                                             SizeT,
+                                             droppedPackets,
+                                             SizeT,
+                                             droppedSamples)
+
 END_NAMESPACE_OPENDAQ
@@ -31,4 +31,11 @@ namespace event_packet_id
      *  - "GapDiff" : Int64       // in ticks
      */
     const std::string IMPLICIT_DOMAIN_GAP_DETECTED = "IMPLICIT_DOMAIN_GAP_DETECTED";
+
+    /*!
+     * Parameter dictionary elements:
+     *  - "DroppedPackets" : Int  // data packets dropped by the connection queue limit
+     *  - "DroppedSamples" : Int
+     */
+    const std::string PACKETS_DROPPED = "PACKETS_DROPPED";
     }
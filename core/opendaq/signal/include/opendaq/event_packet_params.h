@@ -23,4 +23,7 @@ namespace event_packet_param
     const std::string DOMAIN_DATA_DESCRIPTOR = "DomainDataDescriptor";
 
     const std::string GAP_DIFF = "GapDiff";
+
+    const std::string DROPPED_PACKETS = "DroppedPackets";
+    const std::string DROPPED_SAMPLES = "DroppedSamples";
 }
@@ -36,6 +36,27 @@ enum class PacketReadyNotification
     SchedulerQueueWasEmpty  ///< Call the listener asynchronously or in another thread only if connection packet queue was empty
 };
 
+/*!
+ * @brief Represents the quantity in which the connection packet queue limit is expressed.
+ */
+enum class QueueLimitUnit
+{
+    Packets,    ///< The number of queued data packets.
+    Samples,    ///< The number of samples in the queued data packets.
+    Bytes       ///< The size of the raw data of the queued data packets.
+};
+
+/*!
+ * @brief Represents what the connection does with a data packet that would exceed the queue limit.
+ */
+enum class QueueOverflowPolicy
+{
+    DropOldest, ///< Drop the oldest queued data packets until the new packet fits.
+    DropNewest, ///< Drop the new packet.
+    Block,      ///< Block the sending thread until the packet fits or the timeout expires, then drop the new packet.
+    Coalesce    ///< Replace the newest queued data packets with the new packet, so that the latest value is kept.
+};
+
  /*!
  * @ingroup opendaq_signal_path
  * @addtogroup opendaq_input_port Input port
@@ -99,6 +120,47 @@ DECLARE_OPENDAQ_INTERFACE(IInputPortConfig, IInputPort)
      * @param gapCheckingEnabled true if gap checking is requested by the input port.
      */
     virtual ErrCode INTERFACE_FUNC getGapCheckingEnabled(Bool* gapCheckingEnabled) = 0;
+
+    /*!
+     * @brief Limits the packet queue of the connections of the input port.
+     * @param limit The largest allowed queue size, in the given unit. Zero disables the limit.
+     * @param unit The unit of the limit.
+     * @param policy What to do with a data packet that would exceed the limit.
+     * @param blockTimeoutMs How long the sending thread is blocked with the `Block` policy, in milliseconds.
+     *
+     * Event packets are never dropped and do not count towards the limit. A data packet is always
+     * accepted if the queue holds no other data packets, even if it exceeds the limit by itself.
+     * Dropped packets are replaced with a "PACKETS_DROPPED" event packet at their place in the queue,
+     * so that the readers know a part of the data is missing. The limit applies to the current
+     * connection and to all connections made later.
+     *
+     * The `Block` policy requires the packets to be read on a different thread than the one sending them.
+     */
+    virtual ErrCode INTERFACE_FUNC setQueueLimit(SizeT limit, QueueLimitUnit unit, QueueOverflowPolicy policy, SizeT blockTimeoutMs) = 0;
+
+    /*!
+     * @brief Gets the largest allowed size of the connection packet queue. Zero if the queue is not limited.
+     * @param[out] limit The queue limit.
+     */
+    virtual ErrCode INTERFACE_FUNC getQueueLimit(SizeT* limit) = 0;
+
+    /*!
+     * @brief Gets the unit of the connection packet queue limit.
+     * @param[out] unit The unit of the limit.
+     */
+    virtual ErrCode INTERFACE_FUNC getQueueLimitUnit(QueueLimitUnit* unit) = 0;
+
+    /*!
+     * @brief Gets the policy applied to data packets that would exceed the connection packet queue limit.
+     * @param[out] policy The overflow policy.
+     */
+    virtual ErrCode INTERFACE_FUNC getQueueOverflowPolicy(QueueOverflowPolicy* policy) = 0;
+
+    /*!
+     * @brief Gets how long the sending thread is blocked with the `Block` overflow policy.
+     * @param[out] blockTimeoutMs The timeout in milliseconds.
+     */
+    virtual ErrCode INTERFACE_FUNC getQueueBlockTimeout(SizeT* blockTimeoutMs) = 0;
 };
 /*!@}*/
 
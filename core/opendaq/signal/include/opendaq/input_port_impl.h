@@ -16,18 +16,24 @@
 
 #pragma once
 #include <opendaq/connection_factory.h>
+#include <opendaq/connection_private_ptr.h>
 #include <opendaq/context_ptr.h>
 #include <opendaq/component_impl.h>
 #include <opendaq/input_port_config.h>
 #include <opendaq/input_port_private.h>
 #include <opendaq/input_port_notifications_ptr.h>
 #include <opendaq/input_port_ptr.h>
+#include <opendaq/packet_statistics_ptr.h>
+#include <opendaq/sharded_counters.h>
 #include <opendaq/removable_ptr.h>
 #include <opendaq/signal_errors.h>
 #include <opendaq/signal_events_ptr.h>
 #include <opendaq/signal_factory.h>
 #include <opendaq/work_factory.h>
 
+#include <atomic>
+#include <memory>
+
 BEGIN_NAMESPACE_OPENDAQ
 
 template <class... Interfaces>
@@ -36,10 +42,10 @@ class GenericInputPortImpl;
 using InputPortImpl = GenericInputPortImpl<>;
 
 template <class ... Interfaces>
-class GenericInputPortImpl : public ComponentImpl<IInputPortConfig, IInputPortPrivate, Interfaces ...>
+class GenericInputPortImpl : public ComponentImpl<IInputPortConfig, IInputPortPrivate, IPacketStatistics, Interfaces ...>
 {
 public:
-    using Super = ComponentImpl<IInputPortConfig, IInputPortPrivate, Interfaces ...>;
+    using Super = ComponentImpl<IInputPortConfig, IInputPortPrivate, IPacketStatistics, Interfaces ...>;
 
     explicit GenericInputPortImpl(const ContextPtr& context,
                                   const ComponentPtr& parent,
@@ -64,9 +70,19 @@ public:
 
     ErrCode INTERFACE_FUNC getGapCheckingEnabled(Bool* gapCheckingEnabled) override;
 
+    ErrCode INTERFACE_FUNC setQueueLimit(SizeT limit, QueueLimitUnit unit, QueueOverflowPolicy policy, SizeT blockTimeoutMs) override;
+    ErrCode INTERFACE_FUNC getQueueLimit(SizeT* limit) override;
+    ErrCode INTERFACE_FUNC getQueueLimitUnit(QueueLimitUnit* unit) override;
+    ErrCode INTERFACE_FUNC getQueueOverflowPolicy(QueueOverflowPolicy* policy) override;
+    ErrCode INTERFACE_FUNC getQueueBlockTimeout(SizeT* blockTimeoutMs) override;
+
     // IInputPortPrivate
     ErrCode INTERFACE_FUNC disconnectWithoutSignalNotification() override;
 
+    // IPacketStatistics
+    ErrCode INTERFACE_FUNC getStatistics(IDict** statistics) override;
+    ErrCode INTERFACE_FUNC resetStatistics() override;
+
     // IRemovable
     ErrCode INTERFACE_FUNC remove() override;
     ErrCode INTERFACE_FUNC isRemoved(Bool* removed) override;
@@ -104,15 +120,37 @@ protected:
     StringPtr serializedSignalId;
 
 private:
+    // notifications sent through the scheduler run one at a time, in order; notifications arriving while
+    // one is pending are counted and run by the same work item instead of being scheduled separately
+    struct NotifyQueue
+    {
+        std::atomic<SizeT> pending{0};
+        WorkPtr work;
+    };
+
+    enum NotificationCounter : size_t
+    {
+        NotificationsCounter,
+        NotificationsCoalescedCounter,
+        NotificationCounterCount
+    };
+
     Bool requiresSignal;
     bool gapCheckingEnabled;
     BaseObjectPtr customData;
     PacketReadyNotification notifyMethod{};
 
+    SizeT queueLimit{};
+    QueueLimitUnit queueLimitUnit{QueueLimitUnit::Packets};
+    QueueOverflowPolicy queueOverflowPolicy{QueueOverflowPolicy::DropOldest};
+    SizeT queueBlockTimeout{};
+
     WeakRefPtr<IInputPortNotifications> listenerRef;
     WeakRefPtr<IConnection> connectionRef{};
     bool isInputPortRemoved;
-    WorkPtr notifySchedulerCallback;
+    std::shared_ptr<NotifyQueue> notifyQueue;
+    // notifications come from the threads sending to the port, which is usually one
+    ShardedCounters<NotificationCounterCount, 2> notificationCounters;
 
     LoggerComponentPtr loggerComponent;
     SchedulerPtr scheduler;
@@ -126,6 +164,7 @@ private:
     void notifyPacketEnqueuedSameThread();
     void notifyPacketEnqueuedScheduler();
     void finishUpdate();
+    void applyQueueLimit(const ConnectionPtr& connection);
 
     SignalPtr getSignalNoLock();
 };
@@ -203,6 +242,7 @@ ErrCode GenericInputPortImpl<Interfaces...>::connect(ISignal* signal)
             return OPENDAQ_ERR_SIGNAL_NOT_ACCEPTED;
 
         const auto connection = createConnection(signalPtr);
+        applyQueueLimit(connection);
 
         InputPortNotificationsPtr inputPortListener;
         {
@@ -405,12 +445,29 @@ void GenericInputPortImpl<Interfaces...>::notifyPacketEnqueuedSameThread()
 template <class... Interfaces>
 void GenericInputPortImpl<Interfaces...>::notifyPacketEnqueuedScheduler()
 {
-    scheduler.scheduleWork(notifySchedulerCallback);
+    const auto queue = notifyQueue;
+    if (!queue)
+        return;
+
+    if (queue->pending.fetch_add(1) != 0)
+    {
+        notificationCounters.add(NotificationsCoalescedCounter, 1);
+        return;
+    }
+
+    const ErrCode errCode = scheduler->scheduleWork(queue->work);
+    if (OPENDAQ_FAILED(errCode))
+    {
+        queue->pending = 0;
+        checkErrorInfo(errCode);
+    }
 }
 
 template <class... Interfaces>
 ErrCode GenericInputPortImpl<Interfaces...>::notifyPacketEnqueued(Bool queueWasEmpty)
 {
+    notificationCounters.add(NotificationsCounter, 1);
+
     return wrapHandler(
         [this, &queueWasEmpty]
         {
@@ -443,6 +500,8 @@ ErrCode GenericInputPortImpl<Interfaces...>::notifyPacketEnqueued(Bool queueWasE
 template <class... Interfaces>
 ErrCode GenericInputPortImpl<Interfaces...>::notifyPacketEnqueuedOnThisThread()
 {
+    notificationCounters.add(NotificationsCounter, 1);
+
     return wrapHandler(
         [this]
         {
@@ -469,25 +528,50 @@ ErrCode GenericInputPortImpl<Interfaces...>::setListener(IInputPortNotifications
     if (listenerRef.assigned())
     {
         auto portRef = this->template getWeakRefInternal<IInputPort>();
-        notifySchedulerCallback = Work([notifyRef = listenerRef, portRef = portRef, loggerComponent = loggerComponent]
+        auto queue = std::make_shared<NotifyQueue>();
+        queue->work = Work([queueRef = std::weak_ptr<NotifyQueue>(queue),
+                            notifyRef = listenerRef,
+                            portRef = portRef,
+                            scheduler = scheduler,
+                            loggerComponent = loggerComponent]
         {
+            const auto queue = queueRef.lock();
+            if (!queue)
+                return;
+
+            // only the notifications pending at the start are run, after that the worker is yielded to other ports
+            const SizeT count = queue->pending;
             auto notify = notifyRef.getRef();
             auto port = portRef.getRef();
             if (notify.assigned() && port.assigned())
             {
-                try
+                for (SizeT i = 0; i < count; ++i)
                 {
-                    notify.packetReceived(port);
+                    try
+                    {
+                        notify.packetReceived(port);
+                    }
+                    catch (const std::exception& e)
+                    {
+                        LOG_E("Input port notification failed: {}", e.what());
+                    }
                 }
-                catch (const std::exception& e)
+            }
+
+            if (queue->pending.fetch_sub(count) != count && scheduler.assigned())
+            {
+                const ErrCode errCode = scheduler->scheduleWork(queue->work);
+                if (OPENDAQ_FAILED(errCode))
                 {
-                    LOG_E("Input port notification failed: {}", e.what());
+                    queue->pending = 0;
+                    daqClearErrorInfo();
                 }
             }
         });
+        notifyQueue = std::move(queue);
     }
     else
-        notifySchedulerCallback.release();
+        notifyQueue.reset();
 
     return OPENDAQ_SUCCESS;
 }
@@ -594,6 +678,62 @@ ErrCode INTERFACE_FUNC GenericInputPortImpl<Interfaces...>::getSerializeId(Const
     return OPENDAQ_SUCCESS;
 }
 
+template <class... Interfaces>
+ErrCode GenericInputPortImpl<Interfaces...>::getStatistics(IDict** statistics)
+{
+    OPENDAQ_PARAM_NOT_NULL(statistics);
+
+    return daqTry(
+        [this, &statistics]
+        {
+            ConnectionPtr connection;
+            {
+                std::scoped_lock lock(this->sync);
+                connection = getConnectionNoLock();
+            }
+
+            PacketStatisticsPtr connectionStatistics;
+            if (connection.assigned())
+                connectionStatistics = connection.asPtrOrNull<IPacketStatistics>();
+
+            auto dict = Dict<IString, IBaseObject>();
+            if (connectionStatistics.assigned())
+            {
+                for (const auto& [name, value] : connectionStatistics.getStatistics())
+                    dict.set(name, value);
+            }
+
+            dict.set("Notifications", static_cast<Int>(notificationCounters.get(NotificationsCounter)));
+            dict.set("NotificationsCoalesced", static_cast<Int>(notificationCounters.get(NotificationsCoalescedCounter)));
+
+            *statistics = dict.detach();
+            return OPENDAQ_SUCCESS;
+        });
+}
+
+template <class... Interfaces>
+ErrCode GenericInputPortImpl<Interfaces...>::resetStatistics()
+{
+    return daqTry(
+        [this]
+        {
+            ConnectionPtr connection;
+            {
+                std::scoped_lock lock(this->sync);
+                connection = getConnectionNoLock();
+            }
+
+            PacketStatisticsPtr connectionStatistics;
+            if (connection.assigned())
+                connectionStatistics = connection.asPtrOrNull<IPacketStatistics>();
+            if (connectionStatistics.assigned())
+                connectionStatistics.resetStatistics();
+
+            notificationCounters.reset();
+            return OPENDAQ_SUCCESS;
+        });
+}
+
 template <class... Interfaces>
 ErrCode INTERFACE_FUNC GenericInputPortImpl<Interfaces...>::queryInterface(const IntfID& id, void** intf)
 {
@@ -794,6 +934,95 @@ ErrCode GenericInputPortImpl<Interfaces...>::getGapCheckingEnabled(Bool* gapChec
     return OPENDAQ_SUCCESS;
 }
 
+template <class... Interfaces>
+ErrCode GenericInputPortImpl<Interfaces...>::setQueueLimit(SizeT limit,
+                                                          QueueLimitUnit unit,
+                                                          QueueOverflowPolicy policy,
+                                                          SizeT blockTimeoutMs)
+{
+    return daqTry(
+        [&]
+        {
+            ConnectionPtr connection;
+            {
+                std::scoped_lock lock(this->sync);
+
+                queueLimit = limit;
+                queueLimitUnit = unit;
+                queueOverflowPolicy = policy;
+                queueBlockTimeout = blockTimeoutMs;
+
+                connection = getConnectionNoLock();
+            }
+
+            if (connection.assigned())
+                applyQueueLimit(connection);
+        });
+}
+
+template <class... Interfaces>
+ErrCode GenericInputPortImpl<Interfaces...>::getQueueLimit(SizeT* limit)
+{
+    OPENDAQ_PARAM_NOT_NULL(limit);
+
+    std::scoped_lock lock(this->sync);
+    *limit = queueLimit;
+    return OPENDAQ_SUCCESS;
+}
+
+template <class... Interfaces>
+ErrCode GenericInputPortImpl<Interfaces...>::getQueueLimitUnit(QueueLimitUnit* unit)
+{
+    OPENDAQ_PARAM_NOT_NULL(unit);
+
+    std::scoped_lock lock(this->sync);
+    *unit = queueLimitUnit;
+    return OPENDAQ_SUCCESS;
+}
+
+template <class... Interfaces>
+ErrCode GenericInputPortImpl<Interfaces...>::getQueueOverflowPolicy(QueueOverflowPolicy* policy)
+{
+    OPENDAQ_PARAM_NOT_NULL(policy);
+
+    std::scoped_lock lock(this->sync);
+    *policy = queueOverflowPolicy;
+    return OPENDAQ_SUCCESS;
+}
+
+template <class... Interfaces>
+ErrCode GenericInputPortImpl<Interfaces...>::getQueueBlockTimeout(SizeT* blockTimeoutMs)
+{
+    OPENDAQ_PARAM_NOT_NULL(blockTimeoutMs);
+
+    std::scoped_lock lock(this->sync);
+    *blockTimeoutMs = queueBlockTimeout;
+    return OPENDAQ_SUCCESS;
+}
+
+template <class... Interfaces>
+void GenericInputPortImpl<Interfaces...>::applyQueueLimit(const ConnectionPtr& connection)
+{
+    // connections of other implementations are not limited
+    const auto connectionPrivate = connection.asPtrOrNull<IConnectionPrivate>(true);
+    if (!connectionPrivate.assigned())
+        return;
+
+    SizeT limit;
+    QueueLimitUnit unit;
+    QueueOverflowPolicy policy;
+    SizeT blockTimeoutMs;
+    {
+        std::scoped_lock lock(this->sync);
+        limit = queueLimit;
+        unit = queueLimitUnit;
+        policy = queueOverflowPolicy;
+        blockTimeoutMs = queueBlockTimeout;
+    }
+
+    connectionPrivate.setQueueLimit(limit, unit, policy, blockTimeoutMs);
+}
+
 OPENDAQ_REGISTER_DESERIALIZE_FACTORY(InputPortImpl)
 
 END_NAMESPACE_OPENDAQ
@@ -0,0 +1,195 @@
+/*
+ * Copyright 2022-2024 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <coretypes/complex_number_factory.h>
+#include <coretypes/intfs.h>
+#include <opendaq/data_descriptor_ptr.h>
+#include <opendaq/data_packet_ptr.h>
+#include <opendaq/data_rule_calc_private.h>
+#include <opendaq/range_factory.h>
+#include <opendaq/sample_type_traits.h>
+#include <opendaq/scaling_calc_private.h>
+#include <cstring>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+/*!
+ * @brief Boxes a single sample of a scalar sample type into an object.
+ * @param addr Pointer to the sample.
+ * @param sampleType The sample type of the sample.
+ * @returns The boxed sample, or an empty object for sample types that are not scalar.
+ */
+inline BaseObjectPtr sampleToObject(const void* addr, SampleType sampleType)
+{
+    switch (sampleType)
+    {
+        case SampleType::Float32:
+            return Floating(*static_cast<const float*>(addr));
+        case SampleType::Float64:
+            return Floating(*static_cast<const double*>(addr));
+        case SampleType::Int8:
+            return Integer(*static_cast<const int8_t*>(addr));
+        case SampleType::UInt8:
+            return Integer(*static_cast<const uint8_t*>(addr));
+        case SampleType::Int16:
+            return Integer(*static_cast<const int16_t*>(addr));
+        case SampleType::UInt16:
+            return Integer(*static_cast<const uint16_t*>(addr));
+        case SampleType::Int32:
+            return Integer(*static_cast<const int32_t*>(addr));
+        case SampleType::UInt32:
+            return Integer(*static_cast<const uint32_t*>(addr));
+        case SampleType::Int64:
+            return Integer(*static_cast<const int64_t*>(addr));
+        case SampleType::UInt64:
+            return Integer(*static_cast<const uint64_t*>(addr));
+        case SampleType::RangeInt64:
+        {
+            const auto data = static_cast<const int64_t*>(addr);
+            return Range(data[0], data[1]);
+        }
+        case SampleType::ComplexFloat32:
+        {
+            const auto data = static_cast<const float*>(addr);
+            return ComplexNumber(data[0], data[1]);
+        }
+        case SampleType::ComplexFloat64:
+        {
+            const auto data = static_cast<const double*>(addr);
+            return ComplexNumber(data[0], data[1]);
+        }
+        default:
+            return BaseObject();
+    }
+}
+
+/*!
+ * @brief Holds the last sample of a data packet, scaled or calculated according to the data rule.
+ *
+ * Only the last sample of the packet is scaled or calculated, so that the last value of a signal is
+ * available without keeping the whole packet alive and without scaling all of its samples. Packets
+ * with dimensions, struct or non-scalar samples, and packets with a constant or other data rule are
+ * not supported; `update` returns false for those, and the packet has to be kept instead.
+ */
+class LastValueSlot
+{
+public:
+    static constexpr SizeT MaxSampleSize = 16;
+
+    /*!
+     * @brief Stores the last sample of the packet.
+     * @returns True if the sample was stored; false if the packet is not supported, in which case the slot is cleared.
+     */
+    bool update(const DataPacketPtr& packet) noexcept
+    {
+        valueAssigned = false;
+
+        try
+        {
+            const SizeT sampleCount = packet.getSampleCount();
+            if (sampleCount == 0)
+                return false;
+
+            const auto descriptor = packet.getDataDescriptor();
+            if (!descriptor.assigned())
+                return false;
+
+            const auto dimensions = descriptor.getDimensions();
+            if (dimensions.assigned() && dimensions.getCount() > 0)
+                return false;
+
+            const auto type = descriptor.getSampleType();
+            const SizeT size = getSampleSize(type);
+            if (size == 0 || size > MaxSampleSize || descriptor.getSampleSize() != size)
+                return false;
+
+            const auto rule = descriptor.getRule();
+            void* output = sample;
+            if (!rule.assigned() || rule.getType() == DataRuleType::Explicit)
+            {
+                const SizeT rawSampleSize = descriptor.getRawSampleSize();
+                if (packet.getRawDataSize() < sampleCount * rawSampleSize)
+                    return false;
+
+                auto raw = static_cast<uint8_t*>(packet.getRawData()) + (sampleCount - 1) * rawSampleSize;
+
+                const auto scalingCalc = descriptor.asPtr<IScalingCalcPrivate>(false);
+                if (scalingCalc->hasScalingCalc())
+                    scalingCalc->scaleData(raw, 1, &output);
+                else if (rawSampleSize == size)
+                    std::memcpy(sample, raw, size);
+                else
+                    return false;
+            }
+            else if (rule.getType() == DataRuleType::Linear)
+            {
+                // the last sample equals the first sample of a packet with its offset moved by delta for each preceding sample
+                const auto delta = rule.getParameters().get("delta").asPtrOrNull<INumber>();
+                const auto offset = packet.getOffset();
+                if (!delta.assigned() || delta.getCoreType() != ctInt || (offset.assigned() && offset.getCoreType() != ctInt))
+                    return false;
+
+                const auto ruleCalc = descriptor.asPtr<IDataRuleCalcPrivate>(false);
+                if (!ruleCalc->hasDataRuleCalc())
+                    return false;
+
+                const Int lastOffset = (offset.assigned() ? offset.getIntValue() : 0) + delta.getIntValue() * static_cast<Int>(sampleCount - 1);
+                ruleCalc->calculateRule(Integer(lastOffset), 1, nullptr, 0, &output);
+            }
+            else
+            {
+                return false;
+            }
+
+            sampleType = type;
+            valueAssigned = true;
+            return true;
+        }
+        catch (...)
+        {
+            return false;
+        }
+    }
+
+    void clear()
+    {
+        valueAssigned = false;
+    }
+
+    bool assigned() const
+    {
+        return valueAssigned;
+    }
+
+    /*!
+     * @brief Boxes the stored sample into an object.
+     */
+    BaseObjectPtr getValue() const
+    {
+        if (!valueAssigned)
+            return nullptr;
+
+        return sampleToObject(sample, sampleType);
+    }
+
+private:
+    alignas(8) uint8_t sample[MaxSampleSize]{};
+    SampleType sampleType{SampleType::Invalid};
+    bool valueAssigned{false};
+};
+
+END_NAMESPACE_OPENDAQ
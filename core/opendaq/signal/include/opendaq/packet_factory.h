@@ -172,6 +172,21 @@ inline EventPacketPtr ImplicitDomainGapDetectedEventPacket(const NumberPtr& diff
     return obj;
 }
 
+/*!
+ * @brief Creates a PacketsDropped Event packet.
+ * @param droppedPackets The number of dropped data packets.
+ * @param droppedSamples The number of samples in the dropped data packets.
+ *
+ * The ID of the packet is "PACKETS_DROPPED". Its parameters dictionary contains the keys "DroppedPackets" and
+ * "DroppedSamples". The packet is placed in a connection queue where data packets were dropped, because the
+ * queue limit was reached.
+ */
+inline EventPacketPtr PacketsDroppedEventPacket(SizeT droppedPackets, SizeT droppedSamples)
+{
+    EventPacketPtr obj(PacketsDroppedEventPacket_Create(droppedPackets, droppedSamples));
+    return obj;
+}
+
 /*!@}*/
 
 END_NAMESPACE_OPENDAQ
@@ -0,0 +1,72 @@
+/*
+ * Copyright 2022-2024 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <coretypes/dictobject.h>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+/*!
+ * @ingroup opendaq_signal_path
+ * @addtogroup opendaq_packet_statistics Packet statistics
+ * @{
+ */
+
+/*!
+ * @brief Counters of the packets passing through a Signal, Connection or Input port.
+ *
+ * The counters are always collected. Signals count into per-thread shards with relaxed atomic increments,
+ * and Connections count under the lock of their queue, so the packet path pays no additional synchronization.
+ * The counters are obtained by querying the Signal, Connection or Input port for this interface.
+ *
+ * Signals provide:
+ *  - `PacketsSent`, `EventPacketsSent`: the number of packets and event packets sent to the connections.
+ *  - `SamplesSent`, `BytesSent`: the number of samples and bytes of raw data in the sent data packets.
+ *  - `PacketsIgnored`: the number of packets not sent, because the signal was inactive.
+ *
+ * Connections provide:
+ *  - `PacketsEnqueued`, `PacketsDequeued`: the number of packets placed in and taken from the queue.
+ *  - `SamplesEnqueued`, `BytesEnqueued`: the number of samples and bytes of raw data in the enqueued data packets.
+ *  - `PacketsDropped`: the number of packets dropped, because the input port was inactive or the queue limit was reached.
+ *  - `SamplesDropped`: the number of samples in the data packets dropped by the queue limit.
+ *  - `GapsDetected`: the number of gaps found by the gap check of the input port.
+ *  - `QueueDepth`, `MaxQueueDepth`: the current and the largest number of queued packets.
+ *  - `LatencySampleInterval`: every n-th enqueued packet is timed from enqueue to dequeue.
+ *  - `LatencyHistogram`: a list with the number of timed packets per latency bucket; bucket 0 holds
+ *    latencies below 1 microsecond, and bucket i holds latencies from 2^(i-1) to 2^i microseconds. The last
+ *    bucket holds all longer latencies.
+ *
+ * Input ports provide the counters of their connection, and:
+ *  - `Notifications`: the number of packet notifications received from the connection.
+ *  - `NotificationsCoalesced`: the number of notifications merged into an already scheduled one.
+ */
+DECLARE_OPENDAQ_INTERFACE(IPacketStatistics, IBaseObject)
+{
+    // [templateType(statistics, IString, IBaseObject)]
+    /*!
+     * @brief Gets the current values of the counters.
+     * @param[out] statistics The dictionary of counter names and values.
+     */
+    virtual ErrCode INTERFACE_FUNC getStatistics(IDict** statistics) = 0;
+
+    /*!
+     * @brief Sets all counters to zero. The current queue depth is kept.
+     */
+    virtual ErrCode INTERFACE_FUNC resetStatistics() = 0;
+};
+/*!@}*/
+
+END_NAMESPACE_OPENDAQ
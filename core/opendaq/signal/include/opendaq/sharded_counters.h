@@ -0,0 +1,76 @@
+/*
+ * Copyright 2022-2024 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <coretypes/common.h>
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+/*!
+ * @brief A set of counters that threads can increment concurrently without sharing cache lines.
+ *
+ * Each thread is assigned one of the shards on its first increment and only updates that shard, with
+ * relaxed atomic additions. Reading a counter sums its value over all shards, so reads are slower than
+ * increments and see the increments of other threads eventually.
+ *
+ * Each shard is aligned to a cache line, so up to eight counters take ShardCount * 64 bytes (256 bytes
+ * with the default of four shards), and more counters take a multiple of that. Threads beyond the shard
+ * count share shards, which keeps the counts exact but lets those threads contend.
+ */
+template <size_t CounterCount, size_t ShardCount = 4>
+class ShardedCounters
+{
+public:
+    void add(size_t counter, uint64_t value) noexcept
+    {
+        shards[shardIndex()].values[counter].fetch_add(value, std::memory_order_relaxed);
+    }
+
+    uint64_t get(size_t counter) const noexcept
+    {
+        uint64_t sum = 0;
+        for (const auto& shard : shards)
+            sum += shard.values[counter].load(std::memory_order_relaxed);
+        return sum;
+    }
+
+    void reset() noexcept
+    {
+        for (auto& shard : shards)
+            for (auto& value : shard.values)
+                value.store(0, std::memory_order_relaxed);
+    }
+
+private:
+    struct alignas(64) Shard
+    {
+        std::array<std::atomic<uint64_t>, CounterCount> values{};
+    };
+
+    static size_t shardIndex() noexcept
+    {
+        static std::atomic<size_t> nextIndex{0};
+        thread_local const size_t index = nextIndex.fetch_add(1, std::memory_order_relaxed) % ShardCount;
+        return index;
+    }
+
+    std::array<Shard, ShardCount> shards{};
+};
+
+END_NAMESPACE_OPENDAQ
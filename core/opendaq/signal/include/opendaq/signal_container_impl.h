@@ -75,6 +75,7 @@ protected:
     void removeComponentById(const std::string& localId);
 
     void removed() override;
+    void collectItems(std::vector<ComponentPtr>& items) override;
 
     void serializeCustomObjectValues(const SerializerPtr& serializer, bool forUpdate) override;
     virtual void updateFunctionBlock(const std::string& fbId,
@@ -498,6 +499,12 @@ void GenericSignalContainerImpl<Intf, Intfs...>::removed()
         component.remove();
 }
 
+template <class Intf, class... Intfs>
+void GenericSignalContainerImpl<Intf, Intfs...>::collectItems(std::vector<ComponentPtr>& items)
+{
+    items.insert(items.end(), this->components.begin(), this->components.end());
+}
+
 template <class Intf, class... Intfs>
 void GenericSignalContainerImpl<Intf, Intfs...>::serializeFolder(const SerializerPtr& serializer,
                                                                  const FolderConfigPtr& folder,
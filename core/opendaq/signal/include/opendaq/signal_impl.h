@@ -30,6 +30,9 @@
 #include <coretypes/validation.h>
 #include <opendaq/component_impl.h>
 #include <opendaq/input_port_private_ptr.h>
+#include <opendaq/last_value_slot.h>
+#include <opendaq/packet_statistics.h>
+#include <opendaq/sharded_counters.h>
 #include <utility>
 
 BEGIN_NAMESPACE_OPENDAQ
@@ -49,10 +52,10 @@ class SignalBase;
 using SignalImpl = SignalBase<ISignalConfig>;
 
 template <typename TInterface, typename... Interfaces>
-class SignalBase : public ComponentImpl<TInterface, ISignalEvents, ISignalPrivate, Interfaces...>
+class SignalBase : public ComponentImpl<TInterface, ISignalEvents, ISignalPrivate, IPacketStatistics, Interfaces...>
 {
 public:
-    using Super = ComponentImpl<TInterface, ISignalEvents, ISignalPrivate, Interfaces...>;
+    using Super = ComponentImpl<TInterface, ISignalEvents, ISignalPrivate, IPacketStatistics, Interfaces...>;
     using Self = SignalBase<TInterface, Interfaces...>;
 
     SignalBase(const ContextPtr& context,
@@ -96,6 +99,10 @@ public:
     ErrCode INTERFACE_FUNC clearDomainSignalWithoutNotification() override;
     ErrCode INTERFACE_FUNC enableKeepLastValue(Bool enabled) override;
 
+    // IPacketStatistics
+    ErrCode INTERFACE_FUNC getStatistics(IDict** statistics) override;
+    ErrCode INTERFACE_FUNC resetStatistics() override;
+
     // ISerializable
     ErrCode INTERFACE_FUNC getSerializeId(ConstCharPtr* id) const override;
 
@@ -130,8 +137,19 @@ protected:
     DataDescriptorPtr dataDescriptor;
     StringPtr deserializedDomainSignalId;
     DataPacketPtr lastDataPacket;
+    LastValueSlot lastValue;
 
 private:
+    enum PacketCounter : size_t
+    {
+        PacketsSentCounter,
+        EventPacketsSentCounter,
+        SamplesSentCounter,
+        BytesSentCounter,
+        PacketsIgnoredCounter,
+        PacketCounterCount
+    };
+
     bool isPublic{};
     std::vector<SignalPtr> relatedSignals;
     SignalPtr domainSignal;
@@ -140,6 +158,7 @@ private:
     std::vector<WeakRefPtr<ISignalConfig>> domainSignalReferences;
     bool keepLastPacket;
     bool keepLastValue;
+    mutable ShardedCounters<PacketCounterCount> packetCounters;
 
     bool sendPacketInternal(const PacketPtr& packet, bool ignoreActive = false) const;
     bool sendPacketInternal(PacketPtr&& packet, bool ignoreActive = false) const;
@@ -151,6 +170,7 @@ private:
                                         const DataDescriptorPtr& descriptor) const;
     void buildTempConnections(std::vector<ConnectionPtr>& tempConnections);
     void checkKeepLastPacket(const PacketPtr& packet);
+    void countSentPacket(const PacketPtr& packet) const;
     void enqueuePacketToConnections(const PacketPtr& packet, const std::vector<ConnectionPtr>& tempConnections);
     void enqueuePacketToConnections(PacketPtr&& packet, const std::vector<ConnectionPtr>& tempConnections);
     void enqueuePacketsToConnections(const ListPtr<IPacket>& packets, const std::vector<ConnectionPtr>& tempConnections);
@@ -638,7 +658,32 @@ void SignalBase<TInterface, Interfaces...>::checkKeepLastPacket(const PacketPtr&
     {
         auto dataPacket = packet.asPtrOrNull<IDataPacket>();
         if (dataPacket.assigned() && dataPacket.getSampleCount() > 0)
-            lastDataPacket = std::move(dataPacket);
+        {
+            // only the last sample is stored when possible, so that the packet is released once the readers are done with it
+            if (lastValue.update(dataPacket))
+                lastDataPacket = nullptr;
+            else
+                lastDataPacket = std::move(dataPacket);
+        }
+    }
+}
+
+template <typename TInterface, typename... Interfaces>
+void SignalBase<TInterface, Interfaces...>::countSentPacket(const PacketPtr& packet) const
+{
+    packetCounters.add(PacketsSentCounter, 1);
+
+    if (packet.getType() == PacketType::Event)
+    {
+        packetCounters.add(EventPacketsSentCounter, 1);
+        return;
+    }
+
+    const auto dataPacket = packet.asPtrOrNull<IDataPacket>(true);
+    if (dataPacket.assigned())
+    {
+        packetCounters.add(SamplesSentCounter, dataPacket.getSampleCount());
+        packetCounters.add(BytesSentCounter, dataPacket.getRawDataSize());
     }
 }
 
@@ -700,12 +745,16 @@ bool SignalBase<TInterface, Interfaces...>::keepLastPacketAndEnqueue(Packet&& pa
         std::scoped_lock lock(this->sync);
 
         if (!this->active)
+        {
+            packetCounters.add(PacketsIgnoredCounter, 1);
             return false;
+        }
 
         checkKeepLastPacket(packet);
         buildTempConnections(tempConnections);
     }
 
+    countSentPacket(packet);
     enqueuePacketToConnections(std::forward<Packet>(packet), tempConnections);
 
     return true;
@@ -723,12 +772,17 @@ bool SignalBase<TInterface, Interfaces...>::keepLastPacketAndEnqueueMultiple(Lis
         std::scoped_lock lock(this->sync);
 
         if (!this->active || cnt == 0)
+        {
+            packetCounters.add(PacketsIgnoredCounter, cnt);
             return false;
+        }
 
         checkKeepLastPacket(packets[cnt - 1]);
         buildTempConnections(tempConnections);
     }
 
+    for (const auto& packet : packets)
+        countSentPacket(packet);
     enqueuePacketsToConnections(std::forward<ListOfPackets>(packets), tempConnections);
 
     return true;
@@ -805,7 +859,12 @@ template <typename TInterface, typename... Interfaces>
 bool SignalBase<TInterface, Interfaces...>::sendPacketInternal(const PacketPtr& packet, bool ignoreActive) const
 {
     if (!ignoreActive && !this->active)
+    {
+        packetCounters.add(PacketsIgnoredCounter, 1);
         return false;
+    }
+
+    countSentPacket(packet);
 
     for (auto& connection : connections)
         connection.enqueue(packet);
@@ -817,7 +876,12 @@ template <typename TInterface, typename... Interfaces>
 bool SignalBase<TInterface, Interfaces...>::sendPacketInternal(PacketPtr&& packet, bool ignoreActive) const
 {
     if (!ignoreActive && !this->active)
+    {
+        packetCounters.add(PacketsIgnoredCounter, 1);
         return false;
+    }
+
+    countSentPacket(packet);
 
     if (connections.empty())
         return true;
@@ -1168,7 +1232,10 @@ void SignalBase<TInterface, Interfaces...>::setKeepLastPacket()
     keepLastPacket = keepLastValue && isPublic && this->visible;
 
     if (!keepLastPacket)
+    {
         lastDataPacket = nullptr;
+        lastValue.clear();
+    }
 }
 
 template <typename TInterface, typename... Interfaces>
@@ -1177,6 +1244,16 @@ ErrCode SignalBase<TInterface, Interfaces...>::getLastValue(IBaseObject ** value
     OPENDAQ_PARAM_NOT_NULL(value);
     std::scoped_lock lock(this->sync);
 
+    if (lastValue.assigned())
+    {
+        return daqTry(
+            [&]()
+            {
+                *value = lastValue.getValue().detach();
+                return OPENDAQ_SUCCESS;
+            });
+    }
+
     if (!lastDataPacket.assigned() || lastDataPacket.getSampleCount() == 0)
         return OPENDAQ_IGNORED;
 
@@ -1184,6 +1261,33 @@ ErrCode SignalBase<TInterface, Interfaces...>::getLastValue(IBaseObject ** value
     return lastDataPacket->getLastValue(value, typeManager);
 }
 
+template <typename TInterface, typename... Interfaces>
+ErrCode SignalBase<TInterface, Interfaces...>::getStatistics(IDict** statistics)
+{
+    OPENDAQ_PARAM_NOT_NULL(statistics);
+
+    return daqTry(
+        [this, &statistics]
+        {
+            auto dict = Dict<IString, IBaseObject>();
+            dict.set("PacketsSent", static_cast<Int>(packetCounters.get(PacketsSentCounter)));
+            dict.set("EventPacketsSent", static_cast<Int>(packetCounters.get(EventPacketsSentCounter)));
+            dict.set("SamplesSent", static_cast<Int>(packetCounters.get(SamplesSentCounter)));
+            dict.set("BytesSent", static_cast<Int>(packetCounters.get(BytesSentCounter)));
+            dict.set("PacketsIgnored", static_cast<Int>(packetCounters.get(PacketsIgnoredCounter)));
+
+            *statistics = dict.detach();
+            return OPENDAQ_SUCCESS;
+        });
+}
+
+template <typename TInterface, typename... Interfaces>
+ErrCode SignalBase<TInterface, Interfaces...>::resetStatistics()
+{
+    packetCounters.reset();
+    return OPENDAQ_SUCCESS;
+}
+
 template <typename TInterface, typename... Interfaces>
 void SignalBase<TInterface, Interfaces...>::visibleChanged()
 {
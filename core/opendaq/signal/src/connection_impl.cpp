@@ -1,4 +1,6 @@
 #include <coretypes/validation.h>
+#include <coretypes/dictobject_factory.h>
+#include <coretypes/listobject_factory.h>
 #include <opendaq/connection_impl.h>
 #include <opendaq/data_packet_ptr.h>
 #include <opendaq/event_packet_ids.h>
@@ -10,6 +12,12 @@
 
 BEGIN_NAMESPACE_OPENDAQ
 
+// dropped packets interrupt the samples the same way as a gap, so both are counted and scanned for as gap packets
+static bool isGapEventId(const StringPtr& eventId)
+{
+    return eventId == event_packet_id::IMPLICIT_DOMAIN_GAP_DETECTED || eventId == event_packet_id::PACKETS_DROPPED;
+}
+
 ConnectionImpl::ConnectionImpl(const InputPortPtr& port, const SignalPtr& signal, ContextPtr context)
     : port(port)
     , signalRef(signal)
@@ -40,7 +48,10 @@ ErrCode ConnectionImpl::enqueueInternal(P&& packet, const F& f)
             {
                 const auto type = packet.getType();
                 if (type != PacketType::Event)
+                {
+                    onPacketsDropped(1);
                     return OPENDAQ_IGNORED;
+                }
                 LOGP_T("Port not active, data packet dropped.")
             }
 
@@ -49,13 +60,19 @@ ErrCode ConnectionImpl::enqueueInternal(P&& packet, const F& f)
             withLock(
                 [&packet, &queueWasEmpty, this]()
                 {
-                    queueWasEmpty = queueEmpty;
                     if (gapCheckState != GapCheckState::disabled)
                         checkForGaps(packet);
 
+                    // waiting for room releases the lock, so the queue state is read after it
+                    const bool accepted = queueLimit == 0 || makeRoom(packet);
+                    queueWasEmpty = queueEmpty;
+                    queueEmpty = false;
+                    if (!accepted)
+                        return;
+
                     onPacketEnqueued(packet);
                     packets.emplace_back(std::forward<P>(packet));
-                    queueEmpty = false;
+                    trackEnqueued();
                     LOGP_T("Packet enqueued.")
                 });
 
@@ -88,7 +105,10 @@ ErrCode ConnectionImpl::enqueueMultipleInternal(const ListPtr<IPacket>& packets)
 {
     return daqTry([this, &packets] {
         if (!port.getActive())
+        {
+            onPacketsDropped(packets.getCount());
             return OPENDAQ_IGNORED;
+        }
 
         bool queueWasEmpty;
 
@@ -98,8 +118,11 @@ ErrCode ConnectionImpl::enqueueMultipleInternal(const ListPtr<IPacket>& packets)
             for (size_t i = 0; i < cnt; ++i)
             {
                 auto packet = packets.getItemAt(i);
+                if (queueLimit != 0 && !makeRoom(packet))
+                    continue;
                 onPacketEnqueued(packet);
                 this->packets.push_back(packet);
+                trackEnqueued();
             }
             queueEmpty = false;
         });
@@ -113,7 +136,10 @@ ErrCode ConnectionImpl::enqueueMultipleInternal(ListPtr<IPacket>&& packets)
 {
     return daqTry([this, &packets] {
         if (!port.getActive())
+        {
+            onPacketsDropped(packets.getCount());
             return OPENDAQ_IGNORED;
+        }
 
         bool queueWasEmpty;
 
@@ -123,8 +149,11 @@ ErrCode ConnectionImpl::enqueueMultipleInternal(ListPtr<IPacket>&& packets)
             for (size_t i = 0; i < cnt; ++i)
             {
                 auto packet = packets.popBack();
+                if (queueLimit != 0 && !makeRoom(packet))
+                    continue;
                 onPacketEnqueued(packet);
                 this->packets.push_back(packet);
+                trackEnqueued();
             }
             queueEmpty = false;
         });
@@ -143,7 +172,10 @@ ErrCode ConnectionImpl::enqueueMultipleInternal(P&& packets)
         [this, &packets]
         {
             if (!port.getActive())
+            {
+                onPacketsDropped(packets.getCount());
                 return OPENDAQ_IGNORED;
+            }
 
             bool queueWasEmpty;
 
@@ -163,8 +195,11 @@ ErrCode ConnectionImpl::enqueueMultipleInternal(P&& packets)
                         {
                             packet = packets.getItemAt(i);
                         }
+                        if (queueLimit != 0 && !makeRoom(packet))
+                            continue;
                         onPacketEnqueued(packet);
                         this->packets.push_back(packet);
+                        trackEnqueued();
                     }
                     queueEmpty = false;
                 });
@@ -220,6 +255,8 @@ ErrCode ConnectionImpl::dequeue(IPacket** packet)
         *packet = packets.front().detach();
         packets.pop_front();
         onPacketDequeued(*packet);
+        trackDequeued();
+        notifySpaceAvailable();
         LOGP_T("Packet dequeued.")
 
         return OPENDAQ_SUCCESS;
@@ -241,7 +278,18 @@ ErrCode INTERFACE_FUNC ConnectionImpl::dequeueAll(IList** packets)
             }
             samplesCnt = 0;
             eventPacketsCnt = 0;
+            gapPacketsCnt = 0;
+            dataPacketsCnt = 0;
+            bytesCnt = 0;
+            statistics.packetsDequeued += this->packets.size();
             this->packets.clear();
+            notifySpaceAvailable();
+
+            const auto now = std::chrono::steady_clock::now();
+            for (const auto& sample : latencySamples)
+                recordLatency(now - sample.enqueueTime);
+            latencySamples.clear();
+            dequeueSequence = enqueueSequence;
 
             *packets = packetsPtr.detach();
             return OPENDAQ_NO_MORE_ITEMS;
@@ -405,7 +453,7 @@ ErrCode ConnectionImpl::getSamplesUntilNextGapPacket(SizeT* samples)
                 case PacketType::Event:
                 {
                     auto eventPacket = packet.template asPtrOrNull<IEventPacket>(true);
-                    if (eventPacket.getEventId() == event_packet_id::IMPLICIT_DOMAIN_GAP_DETECTED)
+                    if (isGapEventId(eventPacket.getEventId()))
                     {
                         LOG_T("Samples until next gap packet = {}.", *samples)
                         return OPENDAQ_SUCCESS;
@@ -455,6 +503,74 @@ ErrCode ConnectionImpl::isRemote(Bool* remote)
     return OPENDAQ_SUCCESS;
 }
 
+ErrCode ConnectionImpl::getStatistics(IDict** statistics)
+{
+    OPENDAQ_PARAM_NOT_NULL(statistics);
+
+    return daqTry(
+        [this, &statistics]
+        {
+            Statistics values;
+            SizeT queueDepth;
+            withLock(
+                [this, &values, &queueDepth]()
+                {
+                    values = this->statistics;
+                    queueDepth = packets.size();
+                });
+
+            auto histogram = List<IInteger>();
+            for (const auto count : values.latencyHistogram)
+                histogram.pushBack(static_cast<Int>(count));
+
+            auto dict = Dict<IString, IBaseObject>();
+            dict.set("PacketsEnqueued", static_cast<Int>(values.packetsEnqueued));
+            dict.set("PacketsDequeued", static_cast<Int>(values.packetsDequeued));
+            dict.set("SamplesEnqueued", static_cast<Int>(values.samplesEnqueued));
+            dict.set("BytesEnqueued", static_cast<Int>(values.bytesEnqueued));
+            dict.set("PacketsDropped", static_cast<Int>(values.packetsDropped));
+            dict.set("SamplesDropped", static_cast<Int>(values.samplesDropped));
+            dict.set("GapsDetected", static_cast<Int>(values.gapsDetected));
+            dict.set("QueueDepth", static_cast<Int>(queueDepth));
+            dict.set("MaxQueueDepth", static_cast<Int>(values.maxQueueDepth));
+            dict.set("LatencySampleInterval", static_cast<Int>(LatencySampleInterval));
+            dict.set("LatencyHistogram", histogram);
+
+            *statistics = dict.detach();
+            return OPENDAQ_SUCCESS;
+        });
+}
+
+ErrCode ConnectionImpl::resetStatistics()
+{
+    withLock(
+        [this]()
+        {
+            statistics = Statistics{};
+            statistics.maxQueueDepth = packets.size();
+        });
+
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode ConnectionImpl::setQueueLimit(SizeT limit, QueueLimitUnit unit, QueueOverflowPolicy policy, SizeT blockTimeoutMs)
+{
+    withLock(
+        [&]()
+        {
+            queueLimit = limit;
+            queueLimitUnit = unit;
+            overflowPolicy = policy;
+            blockTimeout = std::chrono::milliseconds(blockTimeoutMs);
+
+            // blocked producers re-check the new limit
+            notifySpaceAvailable();
+        });
+
+    LOG_D("Queue limit set to {}.", limit)
+    return OPENDAQ_SUCCESS;
+}
+
 ErrCode ConnectionImpl::queryInterface(const IntfID& id, void** intf)
 {
     OPENDAQ_PARAM_NOT_NULL(intf);
@@ -560,6 +676,8 @@ void ConnectionImpl::enqueueGapPacket(const DomainValue& diff)
     const auto gapPacket = ImplicitDomainGapDetectedEventPacket(diffNumber);
     gapPacketsCnt += 1;
     packets.emplace_back(gapPacket);
+    statistics.gapsDetected++;
+    trackEnqueued();
     LOGP_T("Gap packet enqueued.")
 }
 
@@ -672,15 +790,252 @@ void ConnectionImpl::onPacketEnqueued(const PacketPtr& packet)
         auto dataPacket = packet.asPtrOrNull<IDataPacket>(true);
         if (dataPacket.assigned())
         {
-            samplesCnt += dataPacket.getSampleCount();
+            const SizeT sampleCount = dataPacket.getSampleCount();
+            const SizeT byteCount = dataPacket.getRawDataSize();
+            samplesCnt += sampleCount;
+            dataPacketsCnt++;
+            bytesCnt += byteCount;
+            statistics.samplesEnqueued += sampleCount;
+            statistics.bytesEnqueued += byteCount;
         }
     }
     else if (packet.getType() == PacketType::Event)
     {
-        eventPacketsCnt++;
+        if (isGapEventId(packet.asPtr<IEventPacket>(true).getEventId()))
+            gapPacketsCnt++;
+        else
+            eventPacketsCnt++;
     }
 }
 
+void ConnectionImpl::onPacketsDropped(SizeT count)
+{
+    withLock([this, count]() { statistics.packetsDropped += count; });
+}
+
+void ConnectionImpl::trackEnqueued()
+{
+    statistics.packetsEnqueued++;
+    if (packets.size() > statistics.maxQueueDepth)
+        statistics.maxQueueDepth = packets.size();
+
+    // only some packets are timed, so that the clock is not read for every packet
+    if (enqueueSequence % LatencySampleInterval == 0)
+        latencySamples.push_back({enqueueSequence, std::chrono::steady_clock::now()});
+    enqueueSequence++;
+}
+
+void ConnectionImpl::trackDequeued()
+{
+    statistics.packetsDequeued++;
+    if (!latencySamples.empty() && latencySamples.front().sequence == dequeueSequence)
+    {
+        recordLatency(std::chrono::steady_clock::now() - latencySamples.front().enqueueTime);
+        latencySamples.pop_front();
+    }
+    dequeueSequence++;
+}
+
+void ConnectionImpl::recordLatency(std::chrono::steady_clock::duration latency)
+{
+    auto micros = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(latency).count());
+
+    size_t bucket = 0;
+    while (micros != 0 && bucket < LatencyBucketCount - 1)
+    {
+        micros >>= 1;
+        bucket++;
+    }
+
+    statistics.latencyHistogram[bucket]++;
+}
+
+bool ConnectionImpl::makeRoom(const PacketPtr& packet)
+{
+    // event packets are never dropped and do not count towards the limit
+    if (packet.getType() != PacketType::Data)
+        return true;
+
+    const auto dataPacket = packet.asPtrOrNull<IDataPacket>(true);
+    if (!dataPacket.assigned())
+        return true;
+
+    SizeT incoming;
+    switch (queueLimitUnit)
+    {
+        case QueueLimitUnit::Samples:
+            incoming = dataPacket.getSampleCount();
+            break;
+        case QueueLimitUnit::Bytes:
+            incoming = dataPacket.getRawDataSize();
+            break;
+        case QueueLimitUnit::Packets:
+        default:
+            incoming = 1;
+            break;
+    }
+
+    if (!exceedsLimit(incoming))
+        return true;
+
+    switch (overflowPolicy)
+    {
+        case QueueOverflowPolicy::DropNewest:
+            break;
+
+        case QueueOverflowPolicy::Block:
+        {
+#ifdef OPENDAQ_THREAD_SAFE
+            // the mutex is held by withLock; waiting releases it, so that the reader can dequeue
+            blockedProducers++;
+            const bool fits = queueSpaceAvailable.wait_for(mutex, blockTimeout, [this, incoming] { return !exceedsLimit(incoming); });
+            blockedProducers--;
+            if (fits)
+                return true;
+#endif
+            LOGP_D("Queue limit reached, timed out waiting for the reader.")
+            break;
+        }
+
+        case QueueOverflowPolicy::Coalesce:
+            while (exceedsLimit(incoming) && packets.back().getType() == PacketType::Data)
+                dropQueued(packets.size() - 1);
+            [[fallthrough]];
+
+        case QueueOverflowPolicy::DropOldest:
+            while (exceedsLimit(incoming))
+                dropQueued(indexOfOldestDataPacket());
+            return true;
+    }
+
+    dropIncoming(dataPacket.getSampleCount());
+    return false;
+}
+
+bool ConnectionImpl::exceedsLimit(SizeT incoming) const
+{
+    // a packet is always accepted into a queue without data, so that packets larger than the limit get through
+    if (queueLimit == 0 || dataPacketsCnt == 0)
+        return false;
+
+    switch (queueLimitUnit)
+    {
+        case QueueLimitUnit::Samples:
+            return samplesCnt + incoming > queueLimit;
+        case QueueLimitUnit::Bytes:
+            return bytesCnt + incoming > queueLimit;
+        case QueueLimitUnit::Packets:
+        default:
+            return dataPacketsCnt + incoming > queueLimit;
+    }
+}
+
+SizeT ConnectionImpl::indexOfOldestDataPacket() const
+{
+    for (SizeT i = 0; i < packets.size(); ++i)
+        if (packets[i].getType() == PacketType::Data)
+            return i;
+
+    throw InvalidStateException("No data packet in the queue.");
+}
+
+static bool isPacketsDroppedEvent(const PacketPtr& packet)
+{
+    return packet.getType() == PacketType::Event &&
+           packet.asPtr<IEventPacket>(true).getEventId() == event_packet_id::PACKETS_DROPPED;
+}
+
+static EventPacketPtr mergePacketsDroppedEvent(const PacketPtr& event, SizeT droppedPackets, SizeT droppedSamples)
+{
+    const auto params = event.asPtr<IEventPacket>(true).getParameters();
+    const Int packetCount = params.get(event_packet_param::DROPPED_PACKETS);
+    const Int sampleCount = params.get(event_packet_param::DROPPED_SAMPLES);
+    return PacketsDroppedEventPacket(static_cast<SizeT>(packetCount) + droppedPackets, static_cast<SizeT>(sampleCount) + droppedSamples);
+}
+
+void ConnectionImpl::dropQueued(SizeT index)
+{
+    const SizeT sampleCount = packets[index].asPtr<IDataPacket>(true).getSampleCount();
+    onPacketDequeued(packets[index]);
+    statistics.packetsDropped++;
+    statistics.samplesDropped += sampleCount;
+
+    // the dropped packet is replaced with an event packet; consecutive drops are merged into one event packet,
+    // so that the queue does not fill up with them
+    if (index > 0 && isPacketsDroppedEvent(packets[index - 1]))
+    {
+        packets[index] = mergePacketsDroppedEvent(packets[index - 1], 1, sampleCount);
+        onPacketDequeued(packets[index - 1]);
+        eraseQueued(index - 1);
+        index--;
+    }
+    else
+    {
+        packets[index] = PacketsDroppedEventPacket(1, sampleCount);
+    }
+
+    onPacketEnqueued(packets[index]);
+    LOGP_T("Queue limit reached, queued packet dropped.")
+}
+
+void ConnectionImpl::dropIncoming(SizeT sampleCount)
+{
+    statistics.packetsDropped++;
+    statistics.samplesDropped += sampleCount;
+
+    if (!packets.empty() && isPacketsDroppedEvent(packets.back()))
+    {
+        packets.back() = mergePacketsDroppedEvent(packets.back(), 1, sampleCount);
+    }
+    else
+    {
+        const auto event = PacketsDroppedEventPacket(1, sampleCount);
+        onPacketEnqueued(event);
+        packets.emplace_back(event);
+        trackEnqueued();
+    }
+
+    LOGP_T("Queue limit reached, packet dropped.")
+}
+
+void ConnectionImpl::eraseQueued(SizeT index)
+{
+    // removing the first packet is the same as dequeuing it, as far as latency sampling is concerned
+    if (index == 0)
+    {
+        packets.pop_front();
+        if (!latencySamples.empty() && latencySamples.front().sequence == dequeueSequence)
+            latencySamples.pop_front();
+        dequeueSequence++;
+        return;
+    }
+
+    packets.erase(packets.begin() + static_cast<std::ptrdiff_t>(index));
+
+    // the packets behind the erased one move one place forward
+    const uint64_t sequence = dequeueSequence + index;
+    for (auto it = latencySamples.end(); it != latencySamples.begin();)
+    {
+        --it;
+        if (it->sequence < sequence)
+            break;
+
+        if (it->sequence == sequence)
+            it = latencySamples.erase(it);
+        else
+            it->sequence--;
+    }
+    enqueueSequence--;
+}
+
+void ConnectionImpl::notifySpaceAvailable()
+{
+#ifdef OPENDAQ_THREAD_SAFE
+    if (blockedProducers != 0)
+        queueSpaceAvailable.notify_all();
+#endif
+}
+
 void ConnectionImpl::onPacketDequeued(const PacketPtr& packet)
 {
     if (packet.getType() == PacketType::Data)
@@ -689,6 +1044,8 @@ void ConnectionImpl::onPacketDequeued(const PacketPtr& packet)
         if (dataPacket.assigned())
         {
             samplesCnt -= dataPacket.getSampleCount();
+            dataPacketsCnt--;
+            bytesCnt -= dataPacket.getRawDataSize();
         }
     }
     else if (packet.getType() == PacketType::Event)
@@ -698,10 +1055,10 @@ void ConnectionImpl::onPacketDequeued(const PacketPtr& packet)
         {
             eventPacketsCnt--;
         }
-        else if (eventPacket.getEventId() == event_packet_id::IMPLICIT_DOMAIN_GAP_DETECTED)
+        else if (isGapEventId(eventPacket.getEventId()))
         {
             gapPacketsCnt--;
-        }  
+        }
     }
 }
 
@@ -1,4 +1,5 @@
 #include <coretypes/coretype_utils.h>
+#include <coretypes/ctutils.h>
 #include <coretypes/validation.h>
 #include <opendaq/data_descriptor_builder_impl.h>
 #include <opendaq/data_descriptor_builder_ptr.h>
@@ -9,12 +10,25 @@
 #include <opendaq/range_factory.h>
 #include <opendaq/scaling_factory.h>
 #include <opendaq/signal_errors.h>
+#include <string_view>
 
 BEGIN_NAMESPACE_OPENDAQ
 
 namespace detail
 {
     static const StructTypePtr dataDescriptorStructType = DataDescriptorStructType();
+
+    static void hashCombine(SizeT& seed, SizeT value)
+    {
+        seed ^= value + static_cast<SizeT>(0x9e3779b9) + (seed << 6) + (seed >> 2);
+    }
+
+    static SizeT hashString(const StringPtr& str)
+    {
+        if (!str.assigned())
+            return 0;
+        return std::hash<std::string_view>{}(std::string_view(str.getCharPtr(), str.getLength()));
+    }
 }
 
 DictPtr<IString, IBaseObject> DataDescriptorImpl::PackBuilder(IDataDescriptorBuilder* dataDescriptorBuilder)
@@ -55,6 +69,7 @@ DataDescriptorImpl::DataDescriptorImpl(IDataDescriptorBuilder* dataDescriptorBui
     this->dataRuleCalc = nullptr;
     checkErrorInfo(validate());
     calculateSampleMemSize();
+    this->contentHash = calculateContentHash();
 }
 
 ErrCode DataDescriptorImpl::getName(IString** name)
@@ -273,6 +288,44 @@ ErrCode DataDescriptorImpl::validate()
     return OPENDAQ_SUCCESS;
 }
 
+SizeT DataDescriptorImpl::calculateContentHash() const
+{
+    // Only fields whose equality is exact (or normalized, as with the tick resolution) contribute,
+    // so that descriptors considered equal by `equals` always produce the same hash.
+    SizeT hash = static_cast<SizeT>(sampleType);
+    detail::hashCombine(hash, detail::hashString(name));
+    detail::hashCombine(hash, detail::hashString(origin));
+    detail::hashCombine(hash, dimensions.assigned() ? dimensions.getCount() + 1 : 0);
+    detail::hashCombine(hash, structFields.assigned() ? structFields.getCount() + 1 : 0);
+    detail::hashCombine(hash, metadata.assigned() ? metadata.getCount() + 1 : 0);
+    detail::hashCombine(hash, unit.assigned() ? detail::hashString(unit.getSymbol()) + 1 : 0);
+    detail::hashCombine(hash, dataRule.assigned() ? static_cast<SizeT>(dataRule.getType()) + 1 : 0);
+    detail::hashCombine(hash, scaling.assigned() ? static_cast<SizeT>(scaling.getType()) + 1 : 0);
+
+    if (resolution.assigned())
+    {
+        Int num = resolution.getNumerator();
+        Int den = resolution.getDenominator();
+        daq::simplify(num, den);
+        detail::hashCombine(hash, static_cast<SizeT>(num));
+        detail::hashCombine(hash, static_cast<SizeT>(den));
+    }
+    else
+    {
+        detail::hashCombine(hash, 0);
+    }
+
+    return hash;
+}
+
+ErrCode DataDescriptorImpl::getHashCode(SizeT* hashCode)
+{
+    OPENDAQ_PARAM_NOT_NULL(hashCode);
+
+    *hashCode = contentHash;
+    return OPENDAQ_SUCCESS;
+}
+
 ErrCode INTERFACE_FUNC DataDescriptorImpl::equals(IBaseObject* other, Bool* equals) const
 {
     return daqTry([this, &other, &equals]() {
@@ -283,6 +336,18 @@ ErrCode INTERFACE_FUNC DataDescriptorImpl::equals(IBaseObject* other, Bool* equa
         if (!other)
             return OPENDAQ_SUCCESS;
 
+        if (const auto* otherImpl = dynamic_cast<const DataDescriptorImpl*>(other))
+        {
+            if (otherImpl == this)
+            {
+                *equals = true;
+                return OPENDAQ_SUCCESS;
+            }
+
+            if (otherImpl->contentHash != contentHash)
+                return OPENDAQ_SUCCESS;
+        }
+
         DataDescriptorPtr descriptor = BaseObjectPtr::Borrow(other).asPtrOrNull<IDataDescriptor>();
         if (descriptor == nullptr)
             return OPENDAQ_SUCCESS;
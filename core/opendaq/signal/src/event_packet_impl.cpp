@@ -120,6 +120,7 @@ OPENDAQ_DEFINE_CLASS_FACTORY(LIBRARY_FACTORY, EventPacket, IString*, id, IDict*,
 
 using DataDescriptorChangedEventPacketImpl = EventPacketImpl;
 using ImplicitDomainGapDetectedEventPacketImpl = EventPacketImpl;
+using PacketsDroppedEventPacketImpl = EventPacketImpl;
 
 #if !defined(BUILDING_STATIC_LIBRARY)
 
@@ -145,6 +146,18 @@ extern "C" daq::ErrCode PUBLIC_EXPORT createImplicitDomainGapDetectedEventPacket
         objTmp, event_packet_id::IMPLICIT_DOMAIN_GAP_DETECTED, parameters);
 }
 
+extern "C" daq::ErrCode PUBLIC_EXPORT createPacketsDroppedEventPacket(IEventPacket** objTmp,
+                                                                      SizeT droppedPackets,
+                                                                      SizeT droppedSamples)
+{
+    const DictPtr<IString, IInteger> parameters = Dict<IString, IInteger>(
+        {{event_packet_param::DROPPED_PACKETS, static_cast<Int>(droppedPackets)},
+         {event_packet_param::DROPPED_SAMPLES, static_cast<Int>(droppedSamples)}});
+
+    return daq::createObject<IEventPacket, PacketsDroppedEventPacketImpl>(
+        objTmp, event_packet_id::PACKETS_DROPPED, parameters);
+}
+
 #endif
 
 END_NAMESPACE_OPENDAQ
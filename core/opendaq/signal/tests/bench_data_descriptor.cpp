@@ -0,0 +1,66 @@
+#include <opendaq/data_descriptor_factory.h>
+#include <opendaq/dimension_factory.h>
+#include <opendaq/dimension_rule_factory.h>
+#include <opendaq/range_factory.h>
+#include <opendaq/scaling_factory.h>
+#include <gtest/gtest.h>
+#include <chrono>
+
+using DataDescriptorBenchmark = testing::Test;
+
+BEGIN_NAMESPACE_OPENDAQ
+
+TEST_F(DataDescriptorBenchmark, EqualsPerPacketOverhead)
+{
+    const auto dimensions = List<IDimension>(Dimension(LinearDimensionRule(1, 0, 64)));
+    const auto desc = DataDescriptorBuilder()
+                          .setSampleType(SampleType::Float64)
+                          .setDimensions(dimensions)
+                          .setUnit(Unit("V"))
+                          .setValueRange(Range(-10, 10))
+                          .setPostScaling(LinearScaling(2, 1, SampleType::Int16, ScaledSampleType::Float64))
+                          .build();
+    const auto equalCopy = DataDescriptorBuilderCopy(desc).build();
+    const auto changed = DataDescriptorBuilderCopy(desc).setUnit(Unit("A")).build();
+
+    constexpr size_t iterations = 100000;
+    size_t matches = 0;
+
+    const auto measure = [&](const DataDescriptorPtr& other)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < iterations; ++i)
+            matches += desc.equals(other) ? 1 : 0;
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count() / static_cast<double>(iterations);
+    };
+
+    RecordProperty("SameInstanceNsPerCompare", std::to_string(measure(desc)));
+    RecordProperty("ChangedNsPerCompare", std::to_string(measure(changed)));
+    RecordProperty("EqualCopyNsPerCompare", std::to_string(measure(equalCopy)));
+
+    ASSERT_EQ(matches, 2 * iterations);
+}
+
+TEST_F(DataDescriptorBenchmark, BuildRate)
+{
+    constexpr size_t iterations = 10000;
+
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < iterations; ++i)
+    {
+        const auto desc = DataDescriptorBuilder()
+                              .setName("Value")
+                              .setSampleType(SampleType::Float64)
+                              .setUnit(Unit("V"))
+                              .setValueRange(Range(-10, 10))
+                              .setPostScaling(LinearScaling(2, 1, SampleType::Int16, ScaledSampleType::Float64))
+                              .build();
+        ASSERT_EQ(desc.getSampleType(), SampleType::Float64);
+    }
+    const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    RecordProperty("BuildsPerSecond", std::to_string(static_cast<int64_t>(iterations / elapsed)));
+}
+
+END_NAMESPACE_OPENDAQ
@@ -0,0 +1,94 @@
+#include <gtest/gtest.h>
+#include <opendaq/context_factory.h>
+#include <opendaq/data_descriptor_factory.h>
+#include <opendaq/input_port_factory.h>
+#include <opendaq/packet_factory.h>
+#include <opendaq/packet_statistics_ptr.h>
+#include <opendaq/sharded_counters.h>
+#include <opendaq/signal_factory.h>
+#include <algorithm>
+#include <chrono>
+
+using namespace daq;
+
+class PacketStatisticsBenchmark : public testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        context = NullContext();
+        descriptor = DataDescriptorBuilder().setSampleType(SampleType::Int32).build();
+
+        signal = Signal(context, nullptr, "sig");
+        signal.setDescriptor(descriptor);
+
+        port = InputPort(context, nullptr, "port");
+        port.connect(signal);
+
+        // the descriptor sent on connect
+        ASSERT_TRUE(port.getConnection().dequeue().assigned());
+
+        signal.asPtr<IPacketStatistics>().resetStatistics();
+        port.asPtr<IPacketStatistics>().resetStatistics();
+    }
+
+    static Int get(const DictPtr<IString, IBaseObject>& statistics, const std::string& name)
+    {
+        return statistics.get(name);
+    }
+
+    ContextPtr context;
+    DataDescriptorPtr descriptor;
+    SignalConfigPtr signal;
+    InputPortConfigPtr port;
+};
+
+TEST_F(PacketStatisticsBenchmark, Overhead)
+{
+    constexpr size_t packetCount = 200000;
+
+    const auto connection = port.getConnection();
+    std::vector<DataPacketPtr> packets;
+    packets.reserve(packetCount);
+    for (size_t i = 0; i < packetCount; ++i)
+        packets.push_back(DataPacket(descriptor, 1));
+
+    const auto start = std::chrono::steady_clock::now();
+    for (auto& packet : packets)
+    {
+        signal.sendPacket(std::move(packet));
+        connection.dequeue();
+    }
+    const auto pathElapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    // the counter updates done per packet on the signal, connection and input port, timed on their own
+    ShardedCounters<5> signalCounters;
+    ShardedCounters<2, 2> portCounters;
+    uint64_t connectionCounters[6]{};
+    const auto countersStart = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < packetCount; ++i)
+    {
+        signalCounters.add(0, 1);
+        signalCounters.add(2, 1);
+        signalCounters.add(3, 4);
+        portCounters.add(0, 1);
+        connectionCounters[0]++;
+        connectionCounters[1]++;
+        connectionCounters[2] += 1;
+        connectionCounters[3] += 4;
+        connectionCounters[4] = std::max<uint64_t>(connectionCounters[4], i % 4);
+        if (i % 16 == 0)
+            connectionCounters[5] += static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+    }
+    const auto countersElapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - countersStart).count();
+
+    ASSERT_EQ(get(port.asPtr<IPacketStatistics>().getStatistics(), "PacketsDequeued"), static_cast<Int>(packetCount));
+    ASSERT_EQ(signalCounters.get(0) + connectionCounters[0], 2 * packetCount);
+
+    const double costPercent = countersElapsed / pathElapsed * 100.0;
+    RecordProperty("PacketsPerSecond", std::to_string(static_cast<int64_t>(packetCount / pathElapsed)));
+    RecordProperty("StatisticsCostPercent", std::to_string(costPercent));
+
+    // the statistics must not take more than 2% of the time of the packet path
+    EXPECT_LT(costPercent, 2.0);
+}
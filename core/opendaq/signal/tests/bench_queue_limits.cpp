@@ -0,0 +1,82 @@
+#include <gtest/gtest.h>
+#include <opendaq/context_factory.h>
+#include <opendaq/data_descriptor_factory.h>
+#include <opendaq/input_port_factory.h>
+#include <opendaq/packet_factory.h>
+#include <opendaq/packet_statistics_ptr.h>
+#include <opendaq/signal_factory.h>
+#include <chrono>
+
+using namespace daq;
+
+class QueueLimitsBenchmark : public testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        context = NullContext();
+        descriptor = DataDescriptorBuilder().setSampleType(SampleType::Int32).build();
+
+        signal = Signal(context, nullptr, "sig");
+        signal.setDescriptor(descriptor);
+
+        port = InputPort(context, nullptr, "port");
+    }
+
+    void connect(SizeT limit, QueueLimitUnit unit, QueueOverflowPolicy policy)
+    {
+        port.setQueueLimit(limit, unit, policy, 0);
+        port.connect(signal);
+        connection = port.getConnection();
+
+        // the descriptor sent on connect
+        ASSERT_TRUE(connection.dequeue().assigned());
+    }
+
+    ContextPtr context;
+    DataDescriptorPtr descriptor;
+    SignalConfigPtr signal;
+    InputPortConfigPtr port;
+    ConnectionPtr connection;
+};
+
+TEST_F(QueueLimitsBenchmark, EnforcementCost)
+{
+    static constexpr size_t packetCount = 200000;
+
+    // a queue that is never read, so every packet past the limit triggers the overflow policy
+    const auto measure = [this](SizeT limit, QueueOverflowPolicy policy)
+    {
+        port.setQueueLimit(limit, QueueLimitUnit::Packets, policy, 0);
+
+        std::vector<DataPacketPtr> packets;
+        packets.reserve(packetCount);
+        for (size_t i = 0; i < packetCount; ++i)
+            packets.push_back(DataPacket(descriptor, 1));
+
+        const auto start = std::chrono::steady_clock::now();
+        for (auto& packet : packets)
+            signal.sendPacket(std::move(packet));
+        const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        connection.dequeueAll();
+        return elapsed;
+    };
+
+    connect(0, QueueLimitUnit::Packets, QueueOverflowPolicy::DropOldest);
+
+    const double unlimited = measure(0, QueueOverflowPolicy::DropOldest);
+    const double underLimit = measure(packetCount, QueueOverflowPolicy::DropOldest);
+    const double dropOldest = measure(1000, QueueOverflowPolicy::DropOldest);
+    const double dropNewest = measure(1000, QueueOverflowPolicy::DropNewest);
+    const double coalesce = measure(1000, QueueOverflowPolicy::Coalesce);
+
+    RecordProperty("UnlimitedPacketsPerSecond", std::to_string(static_cast<int64_t>(packetCount / unlimited)));
+    RecordProperty("LimitCostPercent", std::to_string((underLimit - unlimited) / unlimited * 100.0));
+    RecordProperty("DropOldestPacketsPerSecond", std::to_string(static_cast<int64_t>(packetCount / dropOldest)));
+    RecordProperty("DropNewestPacketsPerSecond", std::to_string(static_cast<int64_t>(packetCount / dropNewest)));
+    RecordProperty("CoalescePacketsPerSecond", std::to_string(static_cast<int64_t>(packetCount / coalesce)));
+
+    const Int dropped = port.asPtr<IPacketStatistics>().getStatistics().get("PacketsDropped");
+    ASSERT_EQ(dropped, static_cast<Int>(3 * (packetCount - 1000)));
+}
@@ -0,0 +1,199 @@
+#include <gtest/gtest.h>
+#include <opendaq/context_factory.h>
+#include <opendaq/data_descriptor_factory.h>
+#include <opendaq/input_port_factory.h>
+#include <opendaq/input_port_notifications.h>
+#include <opendaq/packet_factory.h>
+#include <opendaq/scaling_factory.h>
+#include <opendaq/scheduler_factory.h>
+#include <opendaq/signal_factory.h>
+#include <opendaq/signal_private_ptr.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+using SignalBenchmark = testing::Test;
+
+using namespace daq;
+
+class ListenerImpl : public ImplementationOfWeak<IInputPortNotifications>
+{
+public:
+    ListenerImpl(const std::function<void(const InputPortPtr& inputPort)>& onPacketRecieved)
+        : onPacketRecieved(onPacketRecieved)
+    {
+    }
+
+    ErrCode INTERFACE_FUNC acceptsSignal(IInputPort* port, ISignal* signal, Bool* accept) override
+    {
+        *accept = True;
+        return OPENDAQ_SUCCESS;
+    }
+
+    ErrCode INTERFACE_FUNC connected(IInputPort* port) override
+    {
+        return OPENDAQ_SUCCESS;
+    }
+
+    ErrCode INTERFACE_FUNC disconnected(IInputPort* port) override
+    {
+        return OPENDAQ_SUCCESS;
+    }
+
+    ErrCode INTERFACE_FUNC packetReceived(IInputPort* port) override
+    {
+        onPacketRecieved(port);
+        return OPENDAQ_SUCCESS;
+    }
+
+private:
+    std::function<void(const InputPortPtr& inputPort)> onPacketRecieved;
+};
+
+TEST_F(SignalBenchmark, SchedulerNotificationLatency)
+{
+    constexpr SizeT PACKETS = 50;
+    constexpr SizeT LIGHT_PORTS = 4;
+
+    const auto logger = Logger();
+    const auto scheduler = Scheduler(logger, 4);
+    const auto ctx = Context(scheduler, logger, TypeManager(), nullptr, nullptr);
+
+    auto descriptor = DataDescriptorBuilder().setName("test").setSampleType(SampleType::Int64).build();
+
+    const auto now = []
+    {
+        return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    };
+
+    // each notification dequeues a single packet, so none of them may be lost when notifications are batched
+    const auto dequeueData = [](const InputPortPtr& port) -> DataPacketPtr
+    {
+        const auto conn = port.getConnection();
+        if (!conn.assigned())
+            return nullptr;
+
+        auto packet = conn.dequeue();
+        while (packet.assigned() && packet.getType() != PacketType::Data)
+            packet = conn.dequeue();
+        return packet;
+    };
+
+    // heavy listener, standing in for an FFT block
+    std::atomic<int> heavyInFlight{0};
+    std::atomic<int> heavyMaxInFlight{0};
+    std::atomic<SizeT> heavyReceived{0};
+    std::atomic<bool> heavyInOrder{true};
+    int64_t heavyLast = -1;
+    const auto heavyListener = createWithImplementation<IInputPortNotifications, ListenerImpl>(
+        [&](const InputPortPtr& port)
+        {
+            const int inFlight = ++heavyInFlight;
+            if (inFlight > heavyMaxInFlight)
+                heavyMaxInFlight = inFlight;
+
+            const auto packet = dequeueData(port);
+            if (packet.assigned())
+            {
+                const auto index = static_cast<int64_t*>(packet.getData())[1];
+                if (index != heavyLast + 1)
+                    heavyInOrder = false;
+                heavyLast = index;
+                heavyReceived++;
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+
+            --heavyInFlight;
+        });
+
+    // light listeners, standing in for trigger blocks
+    std::atomic<SizeT> lightReceived{0};
+    std::atomic<int64_t> lightMaxLatency{0};
+    std::atomic<int64_t> lightTotalLatency{0};
+    const auto lightListener = createWithImplementation<IInputPortNotifications, ListenerImpl>(
+        [&](const InputPortPtr& port)
+        {
+            const auto packet = dequeueData(port);
+            if (!packet.assigned())
+                return;
+
+            const int64_t latency = now() - static_cast<int64_t*>(packet.getData())[0];
+            lightTotalLatency += latency;
+            if (latency > lightMaxLatency)
+                lightMaxLatency = latency;
+            lightReceived++;
+        });
+
+    const auto createPort = [&](const std::string& id, const InputPortNotificationsPtr& listener)
+    {
+        auto signal = Signal(ctx, nullptr, "sig_" + id);
+        signal.asPtr<ISignalPrivate>(true).enableKeepLastValue(False);
+
+        auto port = InputPort(ctx, nullptr, "ip_" + id);
+        port.setNotificationMethod(PacketReadyNotification::Scheduler);
+        port.setListener(listener);
+        port.connect(signal);
+        return std::make_pair(signal, port);
+    };
+
+    std::vector<std::pair<SignalConfigPtr, InputPortConfigPtr>> ports;
+    ports.push_back(createPort("heavy", heavyListener));
+    for (SizeT i = 0; i < LIGHT_PORTS; ++i)
+        ports.push_back(createPort("light" + std::to_string(i), lightListener));
+
+    for (SizeT i = 0; i < PACKETS; ++i)
+    {
+        for (const auto& [signal, port] : ports)
+        {
+            auto dataPacket = DataPacket(descriptor, 2);
+            auto data = static_cast<int64_t*>(dataPacket.getData());
+            data[0] = now();
+            data[1] = static_cast<int64_t>(i);
+            signal.sendPacket(std::move(dataPacket));
+        }
+    }
+
+    scheduler.waitAll();
+
+    ASSERT_EQ(heavyReceived.load(), PACKETS);
+    ASSERT_EQ(lightReceived.load(), PACKETS * LIGHT_PORTS);
+
+    RecordProperty("LightMaxLatencyUs", std::to_string(lightMaxLatency.load()));
+    RecordProperty("LightMeanLatencyUs", std::to_string(lightTotalLatency.load() / static_cast<int64_t>(lightReceived.load())));
+
+    scheduler.stop();
+}
+
+TEST_F(SignalBenchmark, GetLastValueReadRate)
+{
+    constexpr size_t signalCount = 1000;
+    constexpr size_t sampleCount = 64 * 1024;
+    constexpr size_t rounds = 10;
+
+    const auto context = NullContext();
+    auto descriptor = DataDescriptorBuilder()
+                          .setName("test")
+                          .setSampleType(SampleType::Float64)
+                          .setPostScaling(LinearScaling(2, 1, SampleType::Int32, ScaledSampleType::Float64))
+                          .build();
+
+    auto dataPacket = DataPacket(descriptor, sampleCount);
+    auto data = static_cast<int32_t*>(dataPacket.getRawData());
+    for (size_t i = 0; i < sampleCount; ++i)
+        data[i] = static_cast<int32_t>(i);
+
+    std::vector<SignalPtr> signals;
+    for (size_t i = 0; i < signalCount; ++i)
+    {
+        signals.push_back(Signal(context, nullptr, "sig" + std::to_string(i)));
+        signals.back().sendPacket(dataPacket);
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t round = 0; round < rounds; ++round)
+        for (const auto& signal : signals)
+            ASSERT_DOUBLE_EQ(signal.getLastValue().asPtr<IFloat>(), 2.0 * (sampleCount - 1) + 1.0);
+    const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    RecordProperty("ReadsPerSecond", std::to_string(static_cast<int64_t>(signalCount * rounds / elapsed)));
+}
@@ -380,4 +380,51 @@ TEST_F(DataDescriptorTest, QueryInterface)
     ASSERT_TRUE(desc13->hasDataRuleCalc());
 }
 
+TEST_F(DataDescriptorTest, HashEqualForEqualDescriptors)
+{
+    const auto desc1 = DataDescriptorBuilder()
+                           .setName("time")
+                           .setSampleType(SampleType::Int64)
+                           .setRule(LinearDataRule(10, 0))
+                           .setTickResolution(Ratio(1, 1000))
+                           .setOrigin("1970-01-01T00:00:00Z")
+                           .build();
+
+    const auto desc2 = DataDescriptorBuilder()
+                           .setName("time")
+                           .setSampleType(SampleType::Int64)
+                           .setRule(LinearDataRule(10, 0))
+                           .setTickResolution(Ratio(2, 2000))
+                           .setOrigin("1970-01-01T00:00:00Z")
+                           .build();
+
+    ASSERT_EQ(desc1, desc2);
+    ASSERT_EQ(desc1.getHashCode(), desc2.getHashCode());
+    ASSERT_EQ(desc1.getHashCode(), DataDescriptorBuilderCopy(desc1).build().getHashCode());
+}
+
+TEST_F(DataDescriptorTest, HashDiffersOnChange)
+{
+    const auto desc = DataDescriptorBuilder().setSampleType(SampleType::Float64).setUnit(Unit("V")).build();
+
+    const auto sampleTypeChanged = DataDescriptorBuilderCopy(desc).setSampleType(SampleType::Float32).build();
+    const auto unitChanged = DataDescriptorBuilderCopy(desc).setUnit(Unit("A")).build();
+    const auto ruleChanged = DataDescriptorBuilderCopy(desc).setRule(LinearDataRule(1, 0)).build();
+
+    ASSERT_NE(desc.getHashCode(), sampleTypeChanged.getHashCode());
+    ASSERT_NE(desc.getHashCode(), unitChanged.getHashCode());
+    ASSERT_NE(desc.getHashCode(), ruleChanged.getHashCode());
+
+    ASSERT_NE(desc, sampleTypeChanged);
+    ASSERT_NE(desc, unitChanged);
+    ASSERT_NE(desc, ruleChanged);
+}
+
+TEST_F(DataDescriptorTest, EqualsSameInstance)
+{
+    const auto desc = DataDescriptorBuilder().setSampleType(SampleType::Float64).setRule(LinearDataRule(10, 10)).build();
+    ASSERT_TRUE(desc.equals(desc));
+    ASSERT_TRUE(desc.equals(desc.asPtr<IStruct>()));
+}
+
 END_NAMESPACE_OPENDAQ
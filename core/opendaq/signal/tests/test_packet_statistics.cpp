@@ -0,0 +1,209 @@
+#include <gtest/gtest.h>
+#include <opendaq/context_factory.h>
+#include <opendaq/data_descriptor_factory.h>
+#include <opendaq/input_port_factory.h>
+#include <opendaq/packet_factory.h>
+#include <opendaq/packet_statistics_ptr.h>
+#include <opendaq/sharded_counters.h>
+#include <opendaq/signal_factory.h>
+#include <thread>
+
+using namespace daq;
+
+class PacketStatisticsTest : public testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        context = NullContext();
+        descriptor = DataDescriptorBuilder().setSampleType(SampleType::Int32).build();
+
+        signal = Signal(context, nullptr, "sig");
+        signal.setDescriptor(descriptor);
+
+        port = InputPort(context, nullptr, "port");
+        port.connect(signal);
+
+        // the descriptor sent on connect
+        ASSERT_TRUE(port.getConnection().dequeue().assigned());
+
+        signal.asPtr<IPacketStatistics>().resetStatistics();
+        port.asPtr<IPacketStatistics>().resetStatistics();
+    }
+
+    static Int get(const DictPtr<IString, IBaseObject>& statistics, const std::string& name)
+    {
+        return statistics.get(name);
+    }
+
+    ContextPtr context;
+    DataDescriptorPtr descriptor;
+    SignalConfigPtr signal;
+    InputPortConfigPtr port;
+};
+
+TEST_F(PacketStatisticsTest, Counters)
+{
+    constexpr Int packetCount = 100;
+    constexpr Int sampleCount = 10;
+
+    for (Int i = 0; i < packetCount; ++i)
+        signal.sendPacket(DataPacket(descriptor, sampleCount));
+    signal.sendPacket(DataDescriptorChangedEventPacket(descriptor, nullptr));
+
+    const auto signalStatistics = signal.asPtr<IPacketStatistics>().getStatistics();
+    ASSERT_EQ(get(signalStatistics, "PacketsSent"), packetCount + 1);
+    ASSERT_EQ(get(signalStatistics, "EventPacketsSent"), 1);
+    ASSERT_EQ(get(signalStatistics, "SamplesSent"), packetCount * sampleCount);
+    ASSERT_EQ(get(signalStatistics, "BytesSent"), packetCount * sampleCount * 4);
+    ASSERT_EQ(get(signalStatistics, "PacketsIgnored"), 0);
+
+    const auto connection = port.getConnection();
+    while (connection.dequeue().assigned())
+    {
+    }
+
+    const auto portStatistics = port.asPtr<IPacketStatistics>().getStatistics();
+    ASSERT_EQ(get(portStatistics, "PacketsEnqueued"), packetCount + 1);
+    ASSERT_EQ(get(portStatistics, "PacketsDequeued"), packetCount + 1);
+    ASSERT_EQ(get(portStatistics, "SamplesEnqueued"), packetCount * sampleCount);
+    ASSERT_EQ(get(portStatistics, "BytesEnqueued"), packetCount * sampleCount * 4);
+    ASSERT_EQ(get(portStatistics, "QueueDepth"), 0);
+    ASSERT_EQ(get(portStatistics, "MaxQueueDepth"), packetCount + 1);
+    ASSERT_EQ(get(portStatistics, "Notifications"), packetCount + 1);
+
+    // the descriptor packet dequeued in SetUp was the first packet of the connection
+    const Int interval = get(portStatistics, "LatencySampleInterval");
+    const ListPtr<IInteger> histogram = portStatistics.get("LatencyHistogram");
+    Int timed = 0;
+    for (SizeT i = 0; i < histogram.getCount(); ++i)
+        timed += static_cast<Int>(histogram.getItemAt(i));
+    ASSERT_EQ(timed, (packetCount + 1) / interval);
+}
+
+TEST_F(PacketStatisticsTest, ConnectionStatistics)
+{
+    signal.sendPacket(DataPacket(descriptor, 5));
+    signal.sendPacket(DataPacket(descriptor, 5));
+
+    const auto connection = port.getConnection();
+    const auto statistics = connection.asPtr<IPacketStatistics>().getStatistics();
+    ASSERT_EQ(get(statistics, "PacketsEnqueued"), 2);
+    ASSERT_EQ(get(statistics, "QueueDepth"), 2);
+    ASSERT_FALSE(statistics.hasKey("Notifications"));
+}
+
+TEST_F(PacketStatisticsTest, DequeueAll)
+{
+    for (Int i = 0; i < 40; ++i)
+        signal.sendPacket(DataPacket(descriptor, 1));
+
+    ASSERT_EQ(port.getConnection().dequeueAll().getCount(), 40u);
+
+    const auto statistics = port.asPtr<IPacketStatistics>().getStatistics();
+    ASSERT_EQ(get(statistics, "PacketsDequeued"), 40);
+    ASSERT_EQ(get(statistics, "QueueDepth"), 0);
+    ASSERT_EQ(get(statistics, "MaxQueueDepth"), 40);
+}
+
+TEST_F(PacketStatisticsTest, Dropped)
+{
+    port.setActive(false);
+
+    signal.sendPacket(DataPacket(descriptor, 1));
+    signal.sendPackets(List<IPacket>(DataPacket(descriptor, 1), DataPacket(descriptor, 1)));
+
+    ASSERT_EQ(get(signal.asPtr<IPacketStatistics>().getStatistics(), "PacketsSent"), 3);
+
+    const auto statistics = port.asPtr<IPacketStatistics>().getStatistics();
+    ASSERT_EQ(get(statistics, "PacketsDropped"), 3);
+    ASSERT_EQ(get(statistics, "PacketsEnqueued"), 0);
+}
+
+TEST_F(PacketStatisticsTest, Ignored)
+{
+    signal.setActive(false);
+
+    signal.sendPacket(DataPacket(descriptor, 1));
+    signal.sendPackets(List<IPacket>(DataPacket(descriptor, 1), DataPacket(descriptor, 1)));
+
+    const auto statistics = signal.asPtr<IPacketStatistics>().getStatistics();
+    ASSERT_EQ(get(statistics, "PacketsIgnored"), 3);
+    ASSERT_EQ(get(statistics, "PacketsSent"), 0);
+}
+
+TEST_F(PacketStatisticsTest, Reset)
+{
+    signal.sendPacket(DataPacket(descriptor, 1));
+    signal.sendPacket(DataPacket(descriptor, 1));
+
+    signal.asPtr<IPacketStatistics>().resetStatistics();
+    port.asPtr<IPacketStatistics>().resetStatistics();
+
+    ASSERT_EQ(get(signal.asPtr<IPacketStatistics>().getStatistics(), "PacketsSent"), 0);
+
+    const auto statistics = port.asPtr<IPacketStatistics>().getStatistics();
+    ASSERT_EQ(get(statistics, "PacketsEnqueued"), 0);
+    ASSERT_EQ(get(statistics, "Notifications"), 0);
+    ASSERT_EQ(get(statistics, "QueueDepth"), 2);
+    ASSERT_EQ(get(statistics, "MaxQueueDepth"), 2);
+}
+
+TEST_F(PacketStatisticsTest, GapsDetected)
+{
+    const auto domainDescriptor = DataDescriptorBuilder()
+                                      .setSampleType(SampleType::Int64)
+                                      .setRule(LinearDataRule(1, 0))
+                                      .setTickResolution(Ratio(1, 1000))
+                                      .build();
+
+    const auto domainSignal = Signal(context, nullptr, "time");
+    domainSignal.setDescriptor(domainDescriptor);
+    const auto valueSignal = Signal(context, nullptr, "value");
+    valueSignal.setDescriptor(descriptor);
+    valueSignal.setDomainSignal(domainSignal);
+
+    const auto gapPort = InputPort(context, nullptr, "gapPort", true);
+    gapPort.connect(valueSignal);
+
+    for (const Int offset : {0, 10, 30, 40})
+    {
+        const auto domainPacket = DataPacket(domainDescriptor, 10, offset);
+        valueSignal.sendPacket(DataPacketWithDomain(domainPacket, descriptor, 10));
+    }
+
+    const auto statistics = gapPort.asPtr<IPacketStatistics>().getStatistics();
+    ASSERT_EQ(get(statistics, "GapsDetected"), 1);
+
+    // the descriptor, four data packets and the gap packet
+    ASSERT_EQ(get(statistics, "PacketsEnqueued"), 6);
+}
+
+TEST(ShardedCountersTest, Concurrent)
+{
+    constexpr size_t threadCount = 8;
+    constexpr uint64_t increments = 100000;
+
+    ShardedCounters<2> counters;
+
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < threadCount; ++i)
+        threads.emplace_back(
+            [&counters]
+            {
+                for (uint64_t j = 0; j < increments; ++j)
+                {
+                    counters.add(0, 1);
+                    counters.add(1, 2);
+                }
+            });
+
+    for (auto& thread : threads)
+        thread.join();
+
+    ASSERT_EQ(counters.get(0), threadCount * increments);
+    ASSERT_EQ(counters.get(1), 2 * threadCount * increments);
+
+    counters.reset();
+    ASSERT_EQ(counters.get(0), 0u);
+}
@@ -0,0 +1,295 @@
+#include <gtest/gtest.h>
+#include <opendaq/context_factory.h>
+#include <opendaq/data_descriptor_factory.h>
+#include <opendaq/event_packet_ids.h>
+#include <opendaq/event_packet_params.h>
+#include <opendaq/input_port_factory.h>
+#include <opendaq/packet_factory.h>
+#include <opendaq/packet_statistics_ptr.h>
+#include <opendaq/signal_factory.h>
+#include <chrono>
+#include <thread>
+
+using namespace daq;
+
+class QueueLimitsTest : public testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        context = NullContext();
+        descriptor = DataDescriptorBuilder().setSampleType(SampleType::Int32).build();
+
+        signal = Signal(context, nullptr, "sig");
+        signal.setDescriptor(descriptor);
+
+        port = InputPort(context, nullptr, "port");
+    }
+
+    void connect(SizeT limit, QueueLimitUnit unit, QueueOverflowPolicy policy, SizeT blockTimeoutMs = 0)
+    {
+        port.setQueueLimit(limit, unit, policy, blockTimeoutMs);
+        port.connect(signal);
+        connection = port.getConnection();
+
+        // the descriptor sent on connect
+        ASSERT_TRUE(connection.dequeue().assigned());
+    }
+
+    // sends data packets and returns them, so that the dequeued packets can be compared to them
+    std::vector<DataPacketPtr> send(size_t count, SizeT sampleCount = 1)
+    {
+        std::vector<DataPacketPtr> sent;
+        for (size_t i = 0; i < count; ++i)
+        {
+            sent.push_back(DataPacket(descriptor, sampleCount));
+            signal.sendPacket(sent.back());
+        }
+        return sent;
+    }
+
+    void expectDropped(const PacketPtr& packet, Int droppedPackets, Int droppedSamples)
+    {
+        ASSERT_TRUE(packet.assigned());
+        ASSERT_EQ(packet.getType(), PacketType::Event);
+
+        const auto eventPacket = packet.asPtr<IEventPacket>();
+        ASSERT_EQ(eventPacket.getEventId(), event_packet_id::PACKETS_DROPPED);
+        ASSERT_EQ(eventPacket.getParameters().get(event_packet_param::DROPPED_PACKETS), droppedPackets);
+        ASSERT_EQ(eventPacket.getParameters().get(event_packet_param::DROPPED_SAMPLES), droppedSamples);
+    }
+
+    void expectPacket(const PacketPtr& packet, const DataPacketPtr& expected)
+    {
+        ASSERT_TRUE(packet.assigned());
+        ASSERT_EQ(packet.asPtr<IDataPacket>().getObject(), expected.getObject());
+    }
+
+    ContextPtr context;
+    DataDescriptorPtr descriptor;
+    SignalConfigPtr signal;
+    InputPortConfigPtr port;
+    ConnectionPtr connection;
+};
+
+TEST_F(QueueLimitsTest, Defaults)
+{
+    ASSERT_EQ(port.getQueueLimit(), 0u);
+    ASSERT_EQ(port.getQueueLimitUnit(), QueueLimitUnit::Packets);
+    ASSERT_EQ(port.getQueueOverflowPolicy(), QueueOverflowPolicy::DropOldest);
+    ASSERT_EQ(port.getQueueBlockTimeout(), 0u);
+
+    port.setQueueLimit(100, QueueLimitUnit::Bytes, QueueOverflowPolicy::Block, 20);
+    ASSERT_EQ(port.getQueueLimit(), 100u);
+    ASSERT_EQ(port.getQueueLimitUnit(), QueueLimitUnit::Bytes);
+    ASSERT_EQ(port.getQueueOverflowPolicy(), QueueOverflowPolicy::Block);
+    ASSERT_EQ(port.getQueueBlockTimeout(), 20u);
+}
+
+TEST_F(QueueLimitsTest, Unlimited)
+{
+    connect(0, QueueLimitUnit::Packets, QueueOverflowPolicy::DropNewest);
+    send(100);
+
+    ASSERT_EQ(connection.getPacketCount(), 100u);
+}
+
+TEST_F(QueueLimitsTest, DropOldest)
+{
+    connect(3, QueueLimitUnit::Packets, QueueOverflowPolicy::DropOldest);
+    const auto sent = send(5, 10);
+
+    // the two dropped packets are merged into one event packet
+    ASSERT_EQ(connection.getPacketCount(), 4u);
+    expectDropped(connection.dequeue(), 2, 20);
+    expectPacket(connection.dequeue(), sent[2]);
+    expectPacket(connection.dequeue(), sent[3]);
+    expectPacket(connection.dequeue(), sent[4]);
+    ASSERT_FALSE(connection.dequeue().assigned());
+}
+
+TEST_F(QueueLimitsTest, DropNewest)
+{
+    connect(2, QueueLimitUnit::Packets, QueueOverflowPolicy::DropNewest);
+    const auto sent = send(4, 10);
+
+    ASSERT_EQ(connection.getPacketCount(), 3u);
+    expectPacket(connection.dequeue(), sent[0]);
+    expectPacket(connection.dequeue(), sent[1]);
+    expectDropped(connection.dequeue(), 2, 20);
+}
+
+TEST_F(QueueLimitsTest, Coalesce)
+{
+    connect(2, QueueLimitUnit::Packets, QueueOverflowPolicy::Coalesce);
+    const auto sent = send(5);
+
+    // the newest packet replaces the ones queued after the oldest
+    ASSERT_EQ(connection.getPacketCount(), 3u);
+    expectPacket(connection.dequeue(), sent[0]);
+    expectDropped(connection.dequeue(), 3, 3);
+    expectPacket(connection.dequeue(), sent[4]);
+}
+
+TEST_F(QueueLimitsTest, ConsecutiveDropsCounters)
+{
+    connect(2, QueueLimitUnit::Packets, QueueOverflowPolicy::DropOldest);
+    send(6, 10);
+
+    ASSERT_EQ(connection.getPacketCount(), 3u);
+    ASSERT_EQ(connection.getAvailableSamples(), 20u);
+    ASSERT_TRUE(connection.hasGapPacket());
+
+    expectDropped(connection.dequeue(), 4, 40);
+    ASSERT_FALSE(connection.hasGapPacket());
+    ASSERT_EQ(connection.getAvailableSamples(), 20u);
+
+    connection.dequeue();
+    connection.dequeue();
+    ASSERT_EQ(connection.getPacketCount(), 0u);
+    ASSERT_EQ(connection.getAvailableSamples(), 0u);
+}
+
+TEST_F(QueueLimitsTest, Samples)
+{
+    connect(25, QueueLimitUnit::Samples, QueueOverflowPolicy::DropOldest);
+    const auto sent = send(3, 10);
+
+    ASSERT_EQ(connection.getAvailableSamples(), 20u);
+    expectDropped(connection.dequeue(), 1, 10);
+    expectPacket(connection.dequeue(), sent[1]);
+    expectPacket(connection.dequeue(), sent[2]);
+}
+
+TEST_F(QueueLimitsTest, Bytes)
+{
+    // 40 bytes per packet
+    connect(100, QueueLimitUnit::Bytes, QueueOverflowPolicy::DropNewest);
+    send(4, 10);
+
+    ASSERT_EQ(connection.getAvailableSamples(), 20u);
+    ASSERT_EQ(connection.getPacketCount(), 3u);
+}
+
+TEST_F(QueueLimitsTest, OversizedPacketAccepted)
+{
+    connect(5, QueueLimitUnit::Samples, QueueOverflowPolicy::DropNewest);
+    const auto sent = send(2, 10);
+
+    expectPacket(connection.dequeue(), sent[0]);
+    expectDropped(connection.dequeue(), 1, 10);
+}
+
+TEST_F(QueueLimitsTest, EventPacketsKept)
+{
+    connect(1, QueueLimitUnit::Packets, QueueOverflowPolicy::DropOldest);
+
+    send(1);
+    signal.sendPacket(DataDescriptorChangedEventPacket(descriptor, nullptr));
+    const auto second = send(1);
+
+    expectDropped(connection.dequeue(), 1, 1);
+    ASSERT_EQ(connection.dequeue().asPtr<IEventPacket>().getEventId(), event_packet_id::DATA_DESCRIPTOR_CHANGED);
+    expectPacket(connection.dequeue(), second[0]);
+}
+
+TEST_F(QueueLimitsTest, Statistics)
+{
+    connect(2, QueueLimitUnit::Packets, QueueOverflowPolicy::DropOldest);
+    send(10, 5);
+
+    const auto statistics = port.asPtr<IPacketStatistics>().getStatistics();
+    ASSERT_EQ(statistics.get("PacketsDropped"), 8);
+    ASSERT_EQ(statistics.get("SamplesDropped"), 40);
+
+    // the descriptor and the data packets; the event packet of the drops took the place of the first dropped packet
+    ASSERT_EQ(statistics.get("PacketsEnqueued"), 11);
+
+    while (connection.dequeue().assigned())
+    {
+    }
+    ASSERT_EQ(connection.asPtr<IPacketStatistics>().getStatistics().get("PacketsDequeued"), 4);
+    ASSERT_FALSE(connection.hasEventPacket());
+}
+
+TEST_F(QueueLimitsTest, LimitChangedWhileConnected)
+{
+    connect(0, QueueLimitUnit::Packets, QueueOverflowPolicy::DropOldest);
+    send(5);
+
+    port.setQueueLimit(2, QueueLimitUnit::Packets, QueueOverflowPolicy::DropOldest, 0);
+    const auto sent = send(1);
+
+    // the queue is reduced to the new limit on the next packet
+    expectDropped(connection.dequeue(), 4, 4);
+    ASSERT_TRUE(connection.dequeue().assigned());
+    expectPacket(connection.dequeue(), sent[0]);
+
+    port.setQueueLimit(0, QueueLimitUnit::Packets, QueueOverflowPolicy::DropOldest, 0);
+    send(5);
+    ASSERT_EQ(connection.getPacketCount(), 5u);
+}
+
+TEST_F(QueueLimitsTest, DroppedCountedAsGap)
+{
+    connect(1, QueueLimitUnit::Packets, QueueOverflowPolicy::DropOldest);
+    send(2);
+
+    // readers skipping events stop at the drops as they do at gaps
+    ASSERT_TRUE(connection.hasGapPacket());
+    ASSERT_EQ(connection.getSamplesUntilNextGapPacket(), 0u);
+
+    expectDropped(connection.dequeue(), 1, 1);
+    ASSERT_FALSE(connection.hasGapPacket());
+    ASSERT_EQ(connection.getSamplesUntilNextGapPacket(), 1u);
+}
+
+TEST_F(QueueLimitsTest, DequeueAll)
+{
+    connect(2, QueueLimitUnit::Packets, QueueOverflowPolicy::DropNewest);
+    send(2);
+    ASSERT_EQ(connection.dequeueAll().getCount(), 2u);
+
+    send(2);
+    ASSERT_EQ(connection.getPacketCount(), 2u);
+}
+
+#ifdef OPENDAQ_THREAD_SAFE
+
+TEST_F(QueueLimitsTest, BlockUntilRead)
+{
+    connect(1, QueueLimitUnit::Packets, QueueOverflowPolicy::Block, 10000);
+    send(1);
+
+    std::thread reader(
+        [this]
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            connection.dequeue();
+        });
+
+    const auto start = std::chrono::steady_clock::now();
+    const auto sent = send(1);
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    reader.join();
+
+    ASSERT_GE(elapsed, std::chrono::milliseconds(15));
+    ASSERT_EQ(connection.getPacketCount(), 1u);
+    expectPacket(connection.dequeue(), sent[0]);
+}
+
+TEST_F(QueueLimitsTest, BlockTimeout)
+{
+    connect(1, QueueLimitUnit::Packets, QueueOverflowPolicy::Block, 20);
+    const auto sent = send(1);
+
+    const auto start = std::chrono::steady_clock::now();
+    send(1);
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    ASSERT_GE(elapsed, std::chrono::milliseconds(15));
+    expectPacket(connection.dequeue(), sent[0]);
+    expectDropped(connection.dequeue(), 1, 1);
+}
+
+#endif
@@ -17,6 +17,7 @@
 #include <opendaq/input_port_notifications.h>
 #include <opendaq/input_port_factory.h>
 #include <opendaq/scheduler_factory.h>
+#include <atomic>
 #include <thread>
 
 using SignalTest = testing::Test;
@@ -1065,6 +1066,103 @@ TEST_F(SignalTest, LastReferenceSameThreadMultiPackets)
 }
 
 
+TEST_F(SignalTest, SchedulerNotificationsPerPortSerial)
+{
+    constexpr SizeT PACKETS = 50;
+    constexpr SizeT LIGHT_PORTS = 4;
+
+    const auto logger = Logger();
+    const auto scheduler = Scheduler(logger, 4);
+    const auto ctx = Context(scheduler, logger, TypeManager(), nullptr, nullptr);
+
+    auto descriptor = DataDescriptorBuilder().setName("test").setSampleType(SampleType::Int64).build();
+
+    // each notification dequeues a single packet, so none of them may be lost when notifications are batched
+    const auto dequeueData = [](const InputPortPtr& port) -> DataPacketPtr
+    {
+        const auto conn = port.getConnection();
+        if (!conn.assigned())
+            return nullptr;
+
+        auto packet = conn.dequeue();
+        while (packet.assigned() && packet.getType() != PacketType::Data)
+            packet = conn.dequeue();
+        return packet;
+    };
+
+    // heavy listener, standing in for an FFT block
+    std::atomic<int> heavyInFlight{0};
+    std::atomic<int> heavyMaxInFlight{0};
+    std::atomic<SizeT> heavyReceived{0};
+    std::atomic<bool> heavyInOrder{true};
+    int64_t heavyLast = -1;
+    const auto heavyListener = createWithImplementation<IInputPortNotifications, ListenerImpl>(
+        [&](const InputPortPtr& port)
+        {
+            const int inFlight = ++heavyInFlight;
+            if (inFlight > heavyMaxInFlight)
+                heavyMaxInFlight = inFlight;
+
+            const auto packet = dequeueData(port);
+            if (packet.assigned())
+            {
+                const auto index = static_cast<int64_t*>(packet.getData())[0];
+                if (index != heavyLast + 1)
+                    heavyInOrder = false;
+                heavyLast = index;
+                heavyReceived++;
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+
+            --heavyInFlight;
+        });
+
+    // light listeners, standing in for trigger blocks
+    std::atomic<SizeT> lightReceived{0};
+    const auto lightListener = createWithImplementation<IInputPortNotifications, ListenerImpl>(
+        [&](const InputPortPtr& port)
+        {
+            if (dequeueData(port).assigned())
+                lightReceived++;
+        });
+
+    const auto createPort = [&](const std::string& id, const InputPortNotificationsPtr& listener)
+    {
+        auto signal = Signal(ctx, nullptr, "sig_" + id);
+        signal.asPtr<ISignalPrivate>(true).enableKeepLastValue(False);
+
+        auto port = InputPort(ctx, nullptr, "ip_" + id);
+        port.setNotificationMethod(PacketReadyNotification::Scheduler);
+        port.setListener(listener);
+        port.connect(signal);
+        return std::make_pair(signal, port);
+    };
+
+    std::vector<std::pair<SignalConfigPtr, InputPortConfigPtr>> ports;
+    ports.push_back(createPort("heavy", heavyListener));
+    for (SizeT i = 0; i < LIGHT_PORTS; ++i)
+        ports.push_back(createPort("light" + std::to_string(i), lightListener));
+
+    for (SizeT i = 0; i < PACKETS; ++i)
+    {
+        for (const auto& [signal, port] : ports)
+        {
+            auto dataPacket = DataPacket(descriptor, 1);
+            static_cast<int64_t*>(dataPacket.getData())[0] = static_cast<int64_t>(i);
+            signal.sendPacket(std::move(dataPacket));
+        }
+    }
+
+    scheduler.waitAll();
+
+    ASSERT_EQ(heavyReceived.load(), PACKETS);
+    ASSERT_EQ(lightReceived.load(), PACKETS * LIGHT_PORTS);
+    ASSERT_EQ(heavyMaxInFlight.load(), 1);
+    ASSERT_TRUE(heavyInOrder);
+
+    scheduler.stop();
+}
+
 TEST_F(SignalTest, GetLastValueRange)
 {
     const auto signal = Signal(NullContext(), nullptr, "sig");
@@ -1122,6 +1220,56 @@ TEST_F(SignalTest, GetLastValueComplexFloat64)
     ASSERT_DOUBLE_EQ(complexPtr.getImaginary(), 9.1);
 }
 
+TEST_F(SignalTest, GetLastValueScaled)
+{
+    const auto signal = Signal(NullContext(), nullptr, "sig");
+    auto descriptor = DataDescriptorBuilder()
+                          .setName("test")
+                          .setSampleType(SampleType::Float64)
+                          .setPostScaling(LinearScaling(2, 1, SampleType::Int32, ScaledSampleType::Float64))
+                          .build();
+
+    auto dataPacket = DataPacket(descriptor, 5);
+    auto data = static_cast<int32_t*>(dataPacket.getRawData());
+    for (int32_t i = 0; i < 5; ++i)
+        data[i] = i * 10;
+
+    signal.sendPacket(dataPacket);
+
+    FloatPtr floatPtr;
+    ASSERT_NO_THROW(floatPtr = signal.getLastValue().asPtr<IFloat>());
+    ASSERT_DOUBLE_EQ(floatPtr, 81.0);
+}
+
+TEST_F(SignalTest, GetLastValueLinearRule)
+{
+    const auto signal = Signal(NullContext(), nullptr, "sig");
+    auto descriptor = DataDescriptorBuilder().setName("test").setSampleType(SampleType::Int64).setRule(LinearDataRule(10, 5)).build();
+
+    signal.sendPacket(DataPacket(descriptor, 100, 1000));
+
+    IntegerPtr integerPtr;
+    ASSERT_NO_THROW(integerPtr = signal.getLastValue().asPtr<IInteger>());
+    ASSERT_EQ(integerPtr, 1000 + 5 + 10 * 99);
+}
+
+TEST_F(SignalTest, GetLastValueReleasesPacket)
+{
+    const auto signal = Signal(NullContext(), nullptr, "sig");
+    auto descriptor = DataDescriptorBuilder().setName("test").setSampleType(SampleType::Float64).build();
+
+    auto dataPacket = DataPacket(descriptor, 5);
+    static_cast<double*>(dataPacket.getData())[4] = 4.5;
+
+    const auto refCount = dataPacket.getRefCount();
+    signal.sendPacket(dataPacket);
+    ASSERT_EQ(dataPacket.getRefCount(), refCount);
+
+    FloatPtr floatPtr;
+    ASSERT_NO_THROW(floatPtr = signal.getLastValue().asPtr<IFloat>());
+    ASSERT_DOUBLE_EQ(floatPtr, 4.5);
+}
+
 TEST_F(SignalTest, TestSignalActiveSendPacket)
 {
     const auto context = NullContext();
@@ -350,10 +350,12 @@ ErrCode MirroredSignalBase<Interfaces...>::unsubscribeCompletedInternal(IString*
     {
         std::scoped_lock lock(this->sync);
         this->lastDataPacket = nullptr;
+        this->lastValue.clear();
     }
     else
     {
         this->lastDataPacket = nullptr;
+        this->lastValue.clear();
     }
 
     if (onUnsubscribeCompleteEvent.hasListeners())
@@ -29,6 +29,7 @@
 #include <opendaq/ids_parser.h>
 #include <opendaq/custom_log.h>
 #include <opendaq/packet_factory.h>
+#include <atomic>
 
 BEGIN_NAMESPACE_OPENDAQ
 
@@ -100,6 +101,28 @@ protected:
 
     void onPacket(const StringPtr& signalId, const PacketPtr& packet);
     void handleEventPacket(const MirroredSignalConfigPtr& signal, const EventPacketPtr& eventPacket);
+
+    /*!
+     * @brief Gets the signal that packets received under `signalStreamingId` should be forwarded to.
+     * @param signalStreamingId The signal Id as it appears within the streaming.
+     * @returns The signal if the Streaming is active and it is the active streaming source of the streamed
+     * signal, nullptr otherwise.
+     */
+    MirroredSignalConfigPtr getPacketRecipient(const StringPtr& signalStreamingId);
+
+    /*!
+     * @brief Forwards the packet to a signal obtained via `getPacketRecipient`.
+     * @param signal The signal receiving the packet.
+     * @param packet The received packet.
+     */
+    void deliverPacket(const MirroredSignalConfigPtr& signal, const PacketPtr& packet);
+
+    /*!
+     * @brief Gets a counter incremented whenever the outcome of `getPacketRecipient` may have changed,
+     * i.e. on activation, signal add/remove, subscribe/unsubscribe (including streaming source changes of
+     * listened signals) and signal availability changes. Allows derived classes to cache packet recipients.
+     */
+    SizeT getRecipientsVersion() const;
     void triggerSubscribeAck(const StringPtr& signalStreamingId, bool subscribed);
 
     std::mutex sync;
@@ -137,9 +160,12 @@ private:
     ErrCode doUnsubscribeSignal(const StringPtr& signalRemoteId);
     void resubscribeAvailableSignal(const StringPtr& signalStreamingId);
 
+    void invalidateRecipients();
+
     bool isActive{false};
     bool isReconnecting{false};
     const bool skipDomainSignalSubscribe;
+    std::atomic<SizeT> recipientsVersion{0};
 
     using SignalItem = std::pair<SizeT, WeakRefPtr<IMirroredSignalConfig>>;
     std::unordered_map<StringPtr, SignalItem, StringHash, StringEqualTo> streamingSignalsItems;
@@ -196,6 +222,7 @@ ErrCode StreamingImpl<Interfaces...>::setActive(Bool active)
 
     std::scoped_lock lock(sync);
     this->isActive = active;
+    invalidateRecipients();
 
     return OPENDAQ_SUCCESS;
 }
@@ -257,6 +284,7 @@ ErrCode StreamingImpl<Interfaces...>::addSignals(IList* signals)
 
             auto signalItem = std::make_pair(0, WeakRefPtr<IMirroredSignalConfig>(mirroredSignal));
             streamingSignalsItems.insert({signalIdKey, signalItem});
+            invalidateRecipients();
         }
 
         ErrCode errCode =
@@ -322,6 +350,7 @@ ErrCode StreamingImpl<Interfaces...>::removeSignals(IList* signals)
                 {
                     onRemoveSignal(mirroredSignal);
                     streamingSignalsItems.erase(it);
+                    invalidateRecipients();
                 }
             }
             else
@@ -401,6 +430,7 @@ ErrCode StreamingImpl<Interfaces...>::doSubscribeSignal(const StringPtr& signalR
         if (it->second.first > 0)
             skipSubscribeRequest = true;
         it->second.first++;
+        invalidateRecipients();
     }
     else
     {
@@ -493,6 +523,7 @@ ErrCode StreamingImpl<Interfaces...>::doUnsubscribeSignal(const StringPtr& signa
         it->second.first--;
         if (it->second.first > 0)
             skipUnsubscribeRequest = true;
+        invalidateRecipients();
     }
     else
     {
@@ -584,6 +615,7 @@ ErrCode StreamingImpl<Interfaces...>::detachRemovedSignal(const StringPtr& signa
     if (auto it = streamingSignalsItems.find(signalIdKey); it != streamingSignalsItems.end())
     {
         streamingSignalsItems.erase(it);
+        invalidateRecipients();
     }
     else
     {
@@ -634,19 +666,42 @@ template <typename... Interfaces>
 void StreamingImpl<Interfaces...>::removeAllSignalsInternal()
 {
     streamingSignalsItems.clear();
+    invalidateRecipients();
+}
+
+template <typename... Interfaces>
+void StreamingImpl<Interfaces...>::invalidateRecipients()
+{
+    recipientsVersion.fetch_add(1, std::memory_order_release);
+}
+
+template <typename... Interfaces>
+SizeT StreamingImpl<Interfaces...>::getRecipientsVersion() const
+{
+    return recipientsVersion.load(std::memory_order_acquire);
 }
 
 template <typename... Interfaces>
 void StreamingImpl<Interfaces...>::onPacket(const StringPtr& signalId, const PacketPtr& packet)
+{
+    if (!packet.assigned())
+        return;
+
+    if (const auto signal = getPacketRecipient(signalId); signal.assigned())
+        deliverPacket(signal, packet);
+}
+
+template <typename... Interfaces>
+MirroredSignalConfigPtr StreamingImpl<Interfaces...>::getPacketRecipient(const StringPtr& signalStreamingId)
 {
     MirroredSignalConfigPtr signal;
     {
         std::scoped_lock lock(sync);
 
-        if (!packet.assigned() || !this->isActive)
-            return;
+        if (!this->isActive)
+            return nullptr;
 
-        if (auto it = streamingSignalsItems.find(signalId); it != streamingSignalsItems.end())
+        if (auto it = streamingSignalsItems.find(signalStreamingId); it != streamingSignalsItems.end())
         {
             auto signalRef = it->second.second;
             signal = signalRef.getRef();
@@ -655,13 +710,19 @@ void StreamingImpl<Interfaces...>::onPacket(const StringPtr& signalId, const Pac
     if (signal.assigned() &&
         signal.getStreamed() &&
         signal.getActiveStreamingSource() == connectionString)
-    {
-        const auto eventPacket = packet.asPtrOrNull<IEventPacket>();
-        if (eventPacket.assigned())
-            handleEventPacket(signal, eventPacket);
-        else
-            signal.sendPacket(packet);
-    }
+        return signal;
+
+    return nullptr;
+}
+
+template <typename... Interfaces>
+void StreamingImpl<Interfaces...>::deliverPacket(const MirroredSignalConfigPtr& signal, const PacketPtr& packet)
+{
+    const auto eventPacket = packet.asPtrOrNull<IEventPacket>();
+    if (eventPacket.assigned())
+        handleEventPacket(signal, eventPacket);
+    else
+        signal.sendPacket(packet);
 }
 
 template <typename... Interfaces>
@@ -720,6 +781,7 @@ void StreamingImpl<Interfaces...>::addToAvailableSignals(const StringPtr& signal
     if (const auto& it = availableSignalIds.find(signalStreamingId); it == availableSignalIds.end())
     {
         this->availableSignalIds.insert(signalStreamingId);
+        invalidateRecipients();
         remapAvailableSignal(signalStreamingId);
         resubscribeAvailableSignal(signalStreamingId);
     }
@@ -746,6 +808,7 @@ void StreamingImpl<Interfaces...>::removeFromAvailableSignals(const StringPtr& s
         if (const auto& it = availableSignalIds.find(signalStreamingId); it != availableSignalIds.end())
         {
             this->availableSignalIds.erase(it);
+            invalidateRecipients();
             remapUnavailableSignal(signalStreamingId);
         }
         else
@@ -822,6 +885,7 @@ void StreamingImpl<Interfaces...>::startReconnection()
         remapUnavailableSignal(signalStreamingId);
 
     availableSignalIds.clear();
+    invalidateRecipients();
     isReconnecting = true;
 }
 
@@ -50,6 +50,7 @@ protected:
     void signalUnavailableHandler(const StringPtr& signalStringId);
 
     void connectionStatusChangedHandler(opendaq_native_streaming_protocol::ClientConnectionStatus status);
+    void packetsHandler(const opendaq_native_streaming_protocol::ReceivedPackets& packets);
 
     void prepareClientHandler();
 
@@ -74,6 +75,17 @@ protected:
     std::chrono::milliseconds streamingInitTimeout;
     std::shared_ptr<boost::asio::io_context> timerContextPtr;
     std::shared_ptr<boost::asio::steady_timer> protocolInitTimer;
+
+private:
+    struct PacketRecipient
+    {
+        bool resolved{false};
+        WeakRefPtr<IMirroredSignalConfig> signal;
+    };
+
+    // indexed by signal numeric Id, accessed only from the processing strand
+    std::vector<PacketRecipient> packetRecipients;
+    SizeT packetRecipientsVersion{0};
 };
 
 END_NAMESPACE_OPENDAQ_NATIVE_STREAMING_CLIENT_MODULE
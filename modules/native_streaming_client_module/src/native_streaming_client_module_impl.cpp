@@ -266,6 +266,27 @@ void NativeStreamingClientModule::populateTransportLayerConfigFromContext(Proper
         if (value.getCoreType() == CoreType::ctInt)
             transportLayerConfig.setPropertyValue("ReconnectionPeriod", value);
     }
+
+    if (options.hasKey("SharedMemory"))
+    {
+        auto value = options.get("SharedMemory");
+        if (value.getCoreType() == CoreType::ctBool)
+            transportLayerConfig.setPropertyValue("SharedMemory", value);
+    }
+
+    if (options.hasKey("SharedMemoryWritablePackets"))
+    {
+        auto value = options.get("SharedMemoryWritablePackets");
+        if (value.getCoreType() == CoreType::ctBool)
+            transportLayerConfig.setPropertyValue("SharedMemoryWritablePackets", value);
+    }
+
+    if (options.hasKey("PayloadCompression"))
+    {
+        auto value = options.get("PayloadCompression");
+        if (value.getCoreType() == CoreType::ctBool)
+            transportLayerConfig.setPropertyValue("PayloadCompression", value);
+    }
 }
 
 PropertyObjectPtr NativeStreamingClientModule::populateDefaultConfig(const PropertyObjectPtr& config)
@@ -399,6 +420,9 @@ PropertyObjectPtr NativeStreamingClientModule::createTransportLayerDefaultConfig
     transportLayerConfig.addProperty(daq::IntProperty("ConnectionTimeout", 1000));
     transportLayerConfig.addProperty(daq::IntProperty("StreamingInitTimeout", 1000));
     transportLayerConfig.addProperty(daq::IntProperty("ReconnectionPeriod", 1000));
+    transportLayerConfig.addProperty(daq::BoolProperty("SharedMemory", daq::False));
+    transportLayerConfig.addProperty(daq::BoolProperty("SharedMemoryWritablePackets", daq::False));
+    transportLayerConfig.addProperty(daq::BoolProperty("PayloadCompression", daq::False));
 
     populateTransportLayerConfigFromContext(transportLayerConfig);
 
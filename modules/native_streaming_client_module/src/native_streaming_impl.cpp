@@ -93,6 +93,40 @@ void NativeStreamingImpl::connectionStatusChangedHandler(opendaq_native_streamin
     }
 }
 
+void NativeStreamingImpl::packetsHandler(const ReceivedPackets& packets)
+{
+    // Recipients are resolved lazily per numeric Id and dropped whenever the subscriptions,
+    // available signals or active state of the streaming change
+    const auto recipientsVersion = getRecipientsVersion();
+    if (recipientsVersion != packetRecipientsVersion)
+    {
+        for (auto& recipient : packetRecipients)
+            recipient = PacketRecipient{};
+        packetRecipientsVersion = recipientsVersion;
+    }
+
+    for (const auto& [signalNumericId, packet] : packets)
+    {
+        if (signalNumericId >= packetRecipients.size())
+            packetRecipients.resize(static_cast<size_t>(signalNumericId) + 1);
+
+        // The string Id is looked up only when the recipient is resolved, not for every packet
+        auto& recipient = packetRecipients[signalNumericId];
+        if (!recipient.resolved)
+        {
+            if (const auto signalStringId = transportClientHandler->getSignalStringId(signalNumericId); signalStringId.assigned())
+                recipient.signal = getPacketRecipient(signalStringId);
+            recipient.resolved = true;
+        }
+
+        if (!recipient.signal.assigned())
+            continue;
+
+        if (const MirroredSignalConfigPtr signal = recipient.signal.getRef(); signal.assigned())
+            deliverPacket(signal, packet);
+    }
+}
+
 void NativeStreamingImpl::prepareClientHandler()
 {
     using namespace boost::asio;
@@ -137,6 +171,19 @@ void NativeStreamingImpl::prepareClientHandler()
             )
         );
     };
+    OnPacketsCallback onPacketsCallback =
+        [this](ReceivedPackets&& packets)
+    {
+        dispatch(
+            *processingIOContextPtr,
+            processingStrand.wrap(
+                [this, packets = std::move(packets)]()
+                {
+                    packetsHandler(packets);
+                }
+            )
+        );
+    };
     OnSignalSubscriptionAckCallback onSignalSubscriptionAckCallback =
         [this](const StringPtr& signalStringId, bool subscribed)
     {
@@ -205,6 +252,7 @@ void NativeStreamingImpl::prepareClientHandler()
                                                  onSignalSubscriptionAckCallback,
                                                  onConnectionStatusChangedCb,
                                                  onStreamingInitDoneCb);
+    transportClientHandler->setPacketsHandler(onPacketsCallback);
 }
 
 void NativeStreamingImpl::onSetActive(bool active)
@@ -21,6 +21,23 @@ using namespace daq;
 using namespace opendaq_native_streaming_protocol;
 using namespace config_protocol;
 
+static packet_streaming::PayloadCodec payloadCodecFromSelection(Int selection)
+{
+    switch (selection)
+    {
+        case 1:
+            return packet_streaming::PayloadCodec::none;
+        case 2:
+            return packet_streaming::PayloadCodec::deltaZigZag;
+        case 3:
+            return packet_streaming::PayloadCodec::xorFloat;
+        case 4:
+            return packet_streaming::PayloadCodec::shuffleLz;
+        default:
+            return packet_streaming::PayloadCodec::automatic;
+    }
+}
+
 NativeStreamingServerImpl::NativeStreamingServerImpl(DevicePtr rootDevice, PropertyObjectPtr config, const ContextPtr& context)
     : Server("OpenDAQNativeStreamingServerModule", config, rootDevice, context, nullptr)
     , readThreadActive(false)
@@ -35,6 +52,17 @@ NativeStreamingServerImpl::NativeStreamingServerImpl(DevicePtr rootDevice, Prope
     startTransportOperations();
 
     prepareServerHandler();
+    if (config.hasProperty("SharedMemoryRingSize"))
+        serverHandler->setSharedMemoryRingSize(static_cast<Int>(config.getPropertyValue("SharedMemoryRingSize")));
+    if (config.hasProperty("ClientBandwidthBudget") && config.hasProperty("ClientMaxPendingWriteSize"))
+        serverHandler->setClientBandwidthBudget(static_cast<Int>(config.getPropertyValue("ClientBandwidthBudget")),
+                                                static_cast<Int>(config.getPropertyValue("ClientMaxPendingWriteSize")));
+    if (config.hasProperty("DegradationPolicy") && config.hasProperty("DegradationFactor"))
+        serverHandler->setDegradationPolicy(
+            static_cast<native_streaming_protocol::DegradationPolicy>(static_cast<Int>(config.getPropertyValue("DegradationPolicy"))),
+            static_cast<Int>(config.getPropertyValue("DegradationFactor")));
+    if (config.hasProperty("PayloadCodec"))
+        serverHandler->setPayloadCodec(payloadCodecFromSelection(config.getPropertyValue("PayloadCodec")));
     const uint16_t port = config.getPropertyValue("NativeStreamingPort");
     serverHandler->startServer(port);
 
@@ -335,6 +363,33 @@ PropertyObjectPtr NativeStreamingServerImpl::createDefaultConfig(const ContextPt
     defaultConfig.addProperty(portProp);
     defaultConfig.addProperty(StringProperty("Path", "/"));
 
+    // size in bytes of the segment offered to clients on the same host, 0 disables it
+    const auto sharedMemoryRingSizeProp = IntPropertyBuilder("SharedMemoryRingSize", 32 * 1024 * 1024)
+        .setMinValue(0)
+        .build();
+    defaultConfig.addProperty(sharedMemoryRingSizeProp);
+
+    // data rate in bytes/s and amount of unsent data per client above which signal data is degraded, 0 disables the limit
+    const auto clientBandwidthBudgetProp = IntPropertyBuilder("ClientBandwidthBudget", 0)
+        .setMinValue(0)
+        .build();
+    defaultConfig.addProperty(clientBandwidthBudgetProp);
+    const auto clientMaxPendingWriteSizeProp = IntPropertyBuilder("ClientMaxPendingWriteSize", 0)
+        .setMinValue(0)
+        .build();
+    defaultConfig.addProperty(clientMaxPendingWriteSizeProp);
+
+    // decimation factor, or bucket size of min/max pairs; must be even for "MinMax"
+    defaultConfig.addProperty(SelectionProperty("DegradationPolicy", List<IString>("DropPackets", "Decimate", "MinMax"), 0));
+    const auto degradationFactorProp = IntPropertyBuilder("DegradationFactor", 10)
+        .setMinValue(2)
+        .build();
+    defaultConfig.addProperty(degradationFactorProp);
+
+    // payload codec used for clients that requested compression, "Automatic" picks one per packet
+    defaultConfig.addProperty(
+        SelectionProperty("PayloadCodec", List<IString>("Automatic", "None", "DeltaZigZag", "XorFloat", "ShuffleLz"), 0));
+
     populateDefaultConfigFromProvider(context, defaultConfig);
     return defaultConfig;
 }
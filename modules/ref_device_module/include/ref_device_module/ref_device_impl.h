@@ -20,6 +20,8 @@
 #include <opendaq/device_impl.h>
 #include <opendaq/logger_ptr.h>
 #include <opendaq/logger_component_ptr.h>
+#include <opendaq/scheduler_ptr.h>
+#include <opendaq/timer_task_ptr.h>
 #include <thread>
 #include <condition_variable>
 
@@ -49,6 +51,10 @@ private:
     void initSyncComponent();
     void initProperties(const PropertyObjectPtr& config);
     void acqLoop();
+    void startAcquisition();
+    TimerTaskPtr scheduleAcqTimer(const SchedulerPtr& scheduler);
+    void acqTimerTick();
+    void collectSamples();
     void updateNumberOfChannels();
     void enableCANChannel();
     void updateAcqLoopTime();
@@ -60,6 +66,7 @@ private:
     size_t id;
     StringPtr serialNumber;
 
+    TimerTaskPtr acqTimer;
     std::thread acqThread;
     std::thread acqThread2;
     std::condition_variable cv;
@@ -8,6 +8,7 @@
 #include <opendaq/custom_log.h>
 #include <opendaq/device_type_factory.h>
 #include <opendaq/device_domain_factory.h>
+#include <opendaq/work_factory.h>
 #include <utility>
 #include "mscl/mscl.h"
 
@@ -45,7 +46,7 @@ RefDeviceImpl::RefDeviceImpl(size_t id, const PropertyObjectPtr& config, const C
             serialNumber = options.get("SerialNumber");
     }
 
-    acqThread = std::thread{ &RefDeviceImpl::acqLoop, this };
+    startAcquisition();
     //acqThread2 = std::thread{ &RefDeviceImpl::hello, this };
 }
 
@@ -57,7 +58,10 @@ RefDeviceImpl::~RefDeviceImpl()
     }
     cv.notify_one();
 
-    acqThread.join();
+    if (acqTimer.assigned())
+        acqTimer.cancel();
+    if (acqThread.joinable())
+        acqThread.join();
 }
 
 DeviceInfoPtr RefDeviceImpl::CreateDeviceInfo(size_t id, const StringPtr& serialNumber)
@@ -155,23 +159,62 @@ void RefDeviceImpl::acqLoop()
 
         cv.wait_for(lock, waitTime);
         if (!stopAcq)
+            collectSamples();
+    }
+}
+
+void RefDeviceImpl::startAcquisition()
+{
+    // samples are collected by a periodic task of the scheduler; without a scheduler, the device runs its own thread
+    const auto scheduler = this->context.getScheduler();
+    if (scheduler.assigned())
+    {
+        try
+        {
+            acqTimer = scheduleAcqTimer(scheduler);
+            return;
+        }
+        catch (const DaqException& e)
         {
-            auto curTime = getMicroSecondsSinceDeviceStart();
+            LOG_W("Failed to schedule the acquisition on the scheduler, using an acquisition thread instead: {}", e.what());
+        }
+    }
 
-            //std::cout << "------------------------curTime: " <<  curTime.count() << std::endl; 
+    acqThread = std::thread{ &RefDeviceImpl::acqLoop, this };
+}
 
-            for (auto& ch : channels)
-            {
-                auto chPrivate = ch.asPtr<IRefChannel>();
-                chPrivate->collectSamples(curTime);
-            }
+TimerTaskPtr RefDeviceImpl::scheduleAcqTimer(const SchedulerPtr& scheduler)
+{
+    size_t loopTimeUs;
+    {
+        std::scoped_lock lock(sync);
+        loopTimeUs = acqLoopTime * 1000;
+    }
 
-            if (canChannel.assigned())
-            {
-                auto chPrivate = canChannel.asPtr<IRefChannel>();
-                chPrivate->collectSamples(curTime);
-            }
-        }
+    return scheduler.scheduleTimer(Work([this] { acqTimerTick(); }), loopTimeUs, loopTimeUs);
+}
+
+void RefDeviceImpl::acqTimerTick()
+{
+    std::scoped_lock lock(sync);
+    if (!stopAcq)
+        collectSamples();
+}
+
+void RefDeviceImpl::collectSamples()
+{
+    auto curTime = getMicroSecondsSinceDeviceStart();
+
+    for (auto& ch : channels)
+    {
+        auto chPrivate = ch.asPtr<IRefChannel>();
+        chPrivate->collectSamples(curTime);
+    }
+
+    if (canChannel.assigned())
+    {
+        auto chPrivate = canChannel.asPtr<IRefChannel>();
+        chPrivate->collectSamples(curTime);
     }
 }
 
@@ -292,8 +335,19 @@ void RefDeviceImpl::updateAcqLoopTime()
     Int loopTime = objPtr.getPropertyValue("AcquisitionLoopTime");
     LOG_I("Properties: AcquisitionLoopTime {}", loopTime);
 
-    std::scoped_lock lock(sync);
-    this->acqLoopTime = static_cast<size_t>(loopTime);
+    {
+        std::scoped_lock lock(sync);
+        this->acqLoopTime = static_cast<size_t>(loopTime);
+    }
+
+    // the timer is rescheduled outside the lock, as cancelling waits for a running acquisition;
+    // if the scheduler no longer accepts it, e.g. during shutdown, the device falls back to its own thread
+    if (acqTimer.assigned())
+    {
+        acqTimer.cancel();
+        acqTimer.release();
+        startAcquisition();
+    }
 }
 
 END_NAMESPACE_REF_DEVICE_MODULE
@@ -0,0 +1,598 @@
+/*
+ * Copyright 2022-2024 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <ref_fb_module/common.h>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <deque>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+BEGIN_NAMESPACE_REF_FB_MODULE
+
+namespace Decimation
+{
+
+template <typename X>
+struct Point
+{
+    X x;
+    double y;
+    bool segmentStart;
+};
+
+/*!
+ * @brief Min/max summary of a contiguous run of samples.
+ *
+ * Positions of the minimum and maximum are kept so that a bucket can be drawn as
+ * two points in the order they occurred.
+ */
+template <typename X>
+struct MinMaxBucket
+{
+    X firstX{};
+    X lastX{};
+    X minX{};
+    X maxX{};
+    double minY{};
+    double maxY{};
+    double lastY{};
+    size_t count{};
+    bool segmentStart{};
+
+    bool empty() const
+    {
+        return count == 0;
+    }
+
+    void add(X x, double y)
+    {
+        if (count == 0)
+        {
+            firstX = minX = maxX = x;
+            minY = maxY = y;
+        }
+        else if (y < minY)
+        {
+            minY = y;
+            minX = x;
+        }
+        else if (y > maxY)
+        {
+            maxY = y;
+            maxX = x;
+        }
+
+        lastX = x;
+        lastY = y;
+        count++;
+    }
+
+    void merge(const MinMaxBucket& other)
+    {
+        if (other.count == 0)
+            return;
+
+        if (count == 0)
+        {
+            *this = other;
+            return;
+        }
+
+        if (other.minY < minY)
+        {
+            minY = other.minY;
+            minX = other.minX;
+        }
+        if (other.maxY > maxY)
+        {
+            maxY = other.maxY;
+            maxX = other.maxX;
+        }
+
+        lastX = other.lastX;
+        lastY = other.lastY;
+        count += other.count;
+        segmentStart = segmentStart || other.segmentStart;
+    }
+};
+
+// Expands a bucket into one point, or into its minimum and maximum in domain order.
+template <typename X>
+void AppendBucketPoints(const MinMaxBucket<X>& bucket, std::vector<Point<X>>& points)
+{
+    if (bucket.count == 1 || bucket.minX == bucket.maxX)
+    {
+        points.push_back({bucket.minX, bucket.minY, bucket.segmentStart});
+    }
+    else if (bucket.minX < bucket.maxX)
+    {
+        points.push_back({bucket.minX, bucket.minY, bucket.segmentStart});
+        points.push_back({bucket.maxX, bucket.maxY, false});
+    }
+    else
+    {
+        points.push_back({bucket.maxX, bucket.maxY, bucket.segmentStart});
+        points.push_back({bucket.minX, bucket.minY, false});
+    }
+}
+
+/*!
+ * @brief Multi-resolution min/max pyramid that is updated incrementally as samples arrive.
+ *
+ * Level 0 holds single samples, each further level holds buckets covering twice as many
+ * samples as the level below. Every level keeps at most `bucketsPerLevel` buckets, so memory
+ * is bounded while coarse levels still cover a long history. A query picks the finest level
+ * that covers the requested range with no more than the requested number of buckets, which
+ * makes its cost proportional to the output width rather than to the number of samples.
+ *
+ * Samples must be appended in ascending domain order. The class is not thread-safe.
+ */
+template <typename X>
+class MinMaxPyramid
+{
+public:
+    using Bucket = MinMaxBucket<X>;
+
+    explicit MinMaxPyramid(size_t levelCount = 24, size_t bucketsPerLevel = 2048)
+        : levels(std::max<size_t>(levelCount, 1))
+        , bucketsPerLevel(std::max<size_t>(bucketsPerLevel, 2))
+    {
+    }
+
+    void append(X x, double y)
+    {
+        Bucket bucket;
+        bucket.add(x, y);
+        bucket.segmentStart = segmentPending;
+        segmentPending = false;
+
+        lastX = x;
+        lastY = y;
+        sampleCount++;
+
+        push(0, bucket);
+    }
+
+    template <typename V>
+    void appendLinear(const V* values, size_t count, X firstX, X deltaX)
+    {
+        X x = firstX;
+        for (size_t i = 0; i < count; ++i, x += deltaX)
+            append(x, static_cast<double>(values[i]));
+    }
+
+    template <typename V, typename D>
+    void appendExplicit(const V* values, const D* domain, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+            append(static_cast<X>(domain[i]), static_cast<double>(values[i]));
+    }
+
+    // Marks the next appended sample as the start of a new segment, e.g. after a gap in the domain.
+    void startSegment()
+    {
+        if (sampleCount > 0)
+            segmentPending = true;
+    }
+
+    void clear()
+    {
+        for (auto& level : levels)
+            level = Level{};
+
+        sampleCount = 0;
+        segmentPending = false;
+    }
+
+    bool empty() const
+    {
+        return sampleCount == 0;
+    }
+
+    size_t getSampleCount() const
+    {
+        return sampleCount;
+    }
+
+    size_t getLevelCount() const
+    {
+        return levels.size();
+    }
+
+    X getLastX() const
+    {
+        return lastX;
+    }
+
+    double getLastY() const
+    {
+        return lastY;
+    }
+
+    size_t selectLevel(X fromX, X toX, size_t maxBuckets) const
+    {
+        for (size_t i = 0; i < levels.size(); ++i)
+        {
+            const auto& level = levels[i];
+            if (level.truncated && (level.buckets.empty() || level.buckets.front().firstX > fromX))
+                continue;
+
+            const auto range = overlapping(level, fromX, toX);
+            size_t count = static_cast<size_t>(std::distance(range.first, range.second));
+            if (!tail(i).empty())
+                count++;
+
+            if (count <= maxBuckets)
+                return i;
+        }
+
+        return levels.size() - 1;
+    }
+
+    // Appends buckets overlapping [fromX, toX] at the finest level that fits into `maxBuckets`.
+    void query(X fromX, X toX, size_t maxBuckets, std::vector<Bucket>& buckets) const
+    {
+        if (sampleCount == 0)
+            return;
+
+        const size_t levelIndex = selectLevel(fromX, toX, maxBuckets);
+        const auto& level = levels[levelIndex];
+
+        const auto range = overlapping(level, fromX, toX);
+        buckets.insert(buckets.end(), range.first, range.second);
+
+        const auto tailBucket = tail(levelIndex);
+        if (!tailBucket.empty() && tailBucket.lastX >= fromX && tailBucket.firstX <= toX)
+            buckets.push_back(tailBucket);
+    }
+
+    // Same as query, but expands each bucket into one or two points in domain order.
+    void queryPoints(X fromX, X toX, size_t maxBuckets, std::vector<Point<X>>& points) const
+    {
+        std::vector<Bucket> buckets;
+        query(fromX, toX, maxBuckets, buckets);
+        ToPoints(buckets, points);
+    }
+
+    static void ToPoints(const std::vector<Bucket>& buckets, std::vector<Point<X>>& points)
+    {
+        points.reserve(points.size() + buckets.size() * 2);
+        for (const auto& bucket : buckets)
+            AppendBucketPoints(bucket, points);
+    }
+
+private:
+    struct Level
+    {
+        std::deque<Bucket> buckets;
+        Bucket pending;
+        size_t pendingChildren{};
+        bool truncated{};
+    };
+
+    using BucketIterator = typename std::deque<Bucket>::const_iterator;
+
+    std::vector<Level> levels;
+    size_t bucketsPerLevel;
+    size_t sampleCount{};
+    bool segmentPending{};
+    X lastX{};
+    double lastY{};
+
+    void push(size_t levelIndex, const Bucket& bucket)
+    {
+        // Merging two children per parent keeps the amortized cost at two merges per sample
+        while (true)
+        {
+            auto& level = levels[levelIndex];
+            level.buckets.push_back(levelIndex == 0 ? bucket : level.pending);
+            if (level.buckets.size() > bucketsPerLevel)
+            {
+                level.buckets.pop_front();
+                level.truncated = true;
+            }
+
+            if (levelIndex > 0)
+            {
+                level.pending = Bucket{};
+                level.pendingChildren = 0;
+            }
+
+            if (levelIndex + 1 >= levels.size())
+                return;
+
+            auto& parent = levels[levelIndex + 1];
+            parent.pending.merge(level.buckets.back());
+            if (++parent.pendingChildren < 2)
+                return;
+
+            levelIndex++;
+        }
+    }
+
+    // Samples not yet part of a completed bucket at `levelIndex`; pending buckets of the levels
+    // below hold disjoint, consecutive runs of samples, the coarsest one being the oldest.
+    Bucket tail(size_t levelIndex) const
+    {
+        Bucket result;
+        for (size_t i = levelIndex; i > 0; --i)
+            result.merge(levels[i].pending);
+        return result;
+    }
+
+    static std::pair<BucketIterator, BucketIterator> overlapping(const Level& level, X fromX, X toX)
+    {
+        const auto first = std::lower_bound(level.buckets.begin(),
+                                            level.buckets.end(),
+                                            fromX,
+                                            [](const Bucket& bucket, X x) { return bucket.lastX < x; });
+        const auto last = std::upper_bound(first,
+                                           level.buckets.end(),
+                                           toX,
+                                           [](X x, const Bucket& bucket) { return x < bucket.firstX; });
+        return {first, last};
+    }
+};
+
+/*!
+ * @brief Largest-Triangle-Three-Buckets downsampling of a point series.
+ *
+ * Keeps the first and the last point and selects one point per bucket in between,
+ * preserving the visual shape of the series. If `threshold` is not smaller than the
+ * input size (or smaller than 3), the input is copied unchanged.
+ */
+template <typename X>
+void LargestTriangleThreeBuckets(const std::vector<Point<X>>& input, size_t threshold, std::vector<Point<X>>& output)
+{
+    const size_t size = input.size();
+    if (threshold >= size || threshold < 3)
+    {
+        output.insert(output.end(), input.begin(), input.end());
+        return;
+    }
+
+    output.reserve(output.size() + threshold);
+
+    const double bucketSize = static_cast<double>(size - 2) / static_cast<double>(threshold - 2);
+    size_t selected = 0;
+    output.push_back(input[0]);
+
+    for (size_t i = 0; i < threshold - 2; ++i)
+    {
+        const size_t nextStart = static_cast<size_t>(std::floor((i + 1) * bucketSize)) + 1;
+        const size_t nextEnd = std::min(static_cast<size_t>(std::floor((i + 2) * bucketSize)) + 1, size);
+
+        double avgX = 0;
+        double avgY = 0;
+        for (size_t j = nextStart; j < nextEnd; ++j)
+        {
+            avgX += static_cast<double>(input[j].x);
+            avgY += input[j].y;
+        }
+        const size_t nextCount = nextEnd > nextStart ? nextEnd - nextStart : 1;
+        avgX /= static_cast<double>(nextCount);
+        avgY /= static_cast<double>(nextCount);
+
+        const size_t start = static_cast<size_t>(std::floor(i * bucketSize)) + 1;
+        const size_t end = static_cast<size_t>(std::floor((i + 1) * bucketSize)) + 1;
+
+        const double ax = static_cast<double>(input[selected].x);
+        const double ay = input[selected].y;
+
+        double maxArea = -1;
+        size_t maxIndex = start;
+        for (size_t j = start; j < end; ++j)
+        {
+            const double area = std::abs((ax - avgX) * (input[j].y - ay) - (ax - static_cast<double>(input[j].x)) * (avgY - ay));
+            if (area > maxArea)
+            {
+                maxArea = area;
+                maxIndex = j;
+            }
+        }
+
+        output.push_back(input[maxIndex]);
+        selected = maxIndex;
+    }
+
+    output.push_back(input[size - 1]);
+}
+
+enum class DecimationMode
+{
+    MinMax = 0,
+    Lttb
+};
+
+/*!
+ * @brief Decimates an unbounded sample stream in fixed-size buckets.
+ *
+ * In MinMax mode every complete bucket yields its minimum and maximum in the order they
+ * occurred. In LTTB mode every complete bucket yields the single point forming the largest
+ * triangle with the previously selected point and the average of the following bucket,
+ * so output lags the input by one bucket.
+ *
+ * Buckets never span a gap: `startSegment` flushes the pending samples and marks the next
+ * output point as the start of a new segment.
+ */
+template <typename X>
+class StreamingDecimator
+{
+public:
+    explicit StreamingDecimator(DecimationMode mode = DecimationMode::MinMax, size_t bucketSize = 100)
+        : mode(mode)
+        , bucketSize(std::max<size_t>(bucketSize, 2))
+    {
+    }
+
+    DecimationMode getMode() const
+    {
+        return mode;
+    }
+
+    size_t getBucketSize() const
+    {
+        return bucketSize;
+    }
+
+    void reset()
+    {
+        minMax = MinMaxBucket<X>{};
+        current.clear();
+        next.clear();
+        haveAnchor = false;
+        haveSamples = false;
+        segmentPending = false;
+    }
+
+    void append(X x, double y, std::vector<Point<X>>& output)
+    {
+        if (mode == DecimationMode::MinMax)
+            appendMinMax(x, y, output);
+        else
+            appendLttb(x, y, output);
+
+        haveSamples = true;
+    }
+
+    // Ends the current segment, e.g. on a gap in the domain. Samples of the incomplete bucket
+    // are written to `output`, and the next appended sample starts a new segment.
+    void startSegment(std::vector<Point<X>>& output)
+    {
+        if (!haveSamples)
+            return;
+
+        if (mode == DecimationMode::MinMax)
+            flushMinMax(output);
+        else
+            flushLttb(output);
+
+        segmentPending = true;
+    }
+
+private:
+    DecimationMode mode;
+    size_t bucketSize;
+
+    MinMaxBucket<X> minMax;
+
+    std::vector<Point<X>> current;
+    std::vector<Point<X>> next;
+    Point<X> anchor{};
+    bool haveAnchor{};
+    bool haveSamples{};
+    bool segmentPending{};
+
+    void appendMinMax(X x, double y, std::vector<Point<X>>& output)
+    {
+        if (minMax.empty())
+        {
+            minMax.segmentStart = segmentPending;
+            segmentPending = false;
+        }
+
+        minMax.add(x, y);
+        if (minMax.count < bucketSize)
+            return;
+
+        flushMinMax(output);
+    }
+
+    void flushMinMax(std::vector<Point<X>>& output)
+    {
+        if (!minMax.empty())
+            AppendBucketPoints(minMax, output);
+        minMax = MinMaxBucket<X>{};
+    }
+
+    void appendLttb(X x, double y, std::vector<Point<X>>& output)
+    {
+        if (!haveAnchor)
+        {
+            anchor = {x, y, segmentPending};
+            haveAnchor = true;
+            segmentPending = false;
+            output.push_back(anchor);
+            return;
+        }
+
+        auto& target = current.size() < bucketSize ? current : next;
+        target.push_back({x, y, false});
+        if (next.size() < bucketSize)
+            return;
+
+        double avgX = 0;
+        double avgY = 0;
+        for (const auto& point : next)
+        {
+            avgX += static_cast<double>(point.x);
+            avgY += point.y;
+        }
+        avgX /= static_cast<double>(next.size());
+        avgY /= static_cast<double>(next.size());
+
+        anchor = current[selectLargestTriangle(avgX, avgY)];
+        output.push_back(anchor);
+        current.swap(next);
+        next.clear();
+    }
+
+    // The last pending sample closes the segment, as LTTB keeps the endpoints of a series; the
+    // pending bucket contributes the point forming the largest triangle with the anchor and it.
+    void flushLttb(std::vector<Point<X>>& output)
+    {
+        if (!current.empty())
+        {
+            const Point<X> last = next.empty() ? current.back() : next.back();
+            const size_t selected = selectLargestTriangle(static_cast<double>(last.x), last.y);
+            if (!next.empty() || selected + 1 < current.size())
+                output.push_back(current[selected]);
+            output.push_back(last);
+        }
+
+        current.clear();
+        next.clear();
+        haveAnchor = false;
+    }
+
+    size_t selectLargestTriangle(double avgX, double avgY) const
+    {
+        const double ax = static_cast<double>(anchor.x);
+        const double ay = anchor.y;
+
+        double maxArea = -1;
+        size_t maxIndex = 0;
+        for (size_t i = 0; i < current.size(); ++i)
+        {
+            const double area = std::abs((ax - avgX) * (current[i].y - ay) - (ax - static_cast<double>(current[i].x)) * (avgY - ay));
+            if (area > maxArea)
+            {
+                maxArea = area;
+                maxIndex = i;
+            }
+        }
+
+        return maxIndex;
+    }
+};
+
+}
+
+END_NAMESPACE_REF_FB_MODULE
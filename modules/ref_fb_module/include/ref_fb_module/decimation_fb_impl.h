@@ -0,0 +1,90 @@
+/*
+ * Copyright 2022-2024 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <opendaq/function_block_impl.h>
+#include <ref_fb_module/common.h>
+#include <ref_fb_module/decimation.h>
+
+#include "opendaq/data_packet_ptr.h"
+#include "opendaq/event_packet_ptr.h"
+
+BEGIN_NAMESPACE_REF_FB_MODULE
+
+namespace Decimation
+{
+
+class DecimationFbImpl final : public FunctionBlock
+{
+public:
+    explicit DecimationFbImpl(const ContextPtr& ctx, const ComponentPtr& parent, const StringPtr& localId, const PropertyObjectPtr& config);
+    ~DecimationFbImpl() override = default;
+
+    static FunctionBlockTypePtr CreateType();
+
+private:
+    InputPortPtr inputPort;
+
+    DataDescriptorPtr inputDataDescriptor;
+    DataDescriptorPtr inputDomainDataDescriptor;
+
+    DataDescriptorPtr outputDataDescriptor;
+    DataDescriptorPtr outputDomainDataDescriptor;
+
+    SampleType inputSampleType;
+    SampleType inputDomainSampleType;
+
+    SignalConfigPtr outputSignal;
+    SignalConfigPtr outputDomainSignal;
+
+    DecimationMode mode;
+    size_t bucketSize;
+    StreamingDecimator<Int> decimator;
+    std::vector<Point<Int>> decimatedPoints;
+    Int nextDomainValue{};
+    bool haveNextDomainValue{};
+    bool configured;
+
+    PacketReadyNotification packetReadyNotification;
+
+    void createInputPorts();
+    void createSignals();
+
+    template <SampleType InputSampleType>
+    void processDataPacket(const DataPacketPtr& packet);
+
+    template <typename InputType>
+    void decimatePacket(const DataPacketPtr& packet, const InputType* inputData);
+
+    void sendDecimatedPoints();
+    void startSegment();
+
+    void processEventPacket(const EventPacketPtr& packet);
+    void onPacketReceived(const InputPortPtr& port) override;
+
+    void processSignalDescriptorChanged(const DataDescriptorPtr& inputDataDescriptor,
+                                        const DataDescriptorPtr& inputDomainDataDescriptor);
+
+    void configure();
+
+    void initProperties();
+    void propertyChanged(bool configure);
+    void readProperties();
+};
+
+}
+
+END_NAMESPACE_REF_FB_MODULE
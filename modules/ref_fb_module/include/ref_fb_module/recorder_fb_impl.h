@@ -0,0 +1,98 @@
+/*
+ * Copyright 2022-2024 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <columnar_recording/columnar_writer.h>
+#include <opendaq/function_block_impl.h>
+#include <ref_fb_module/common.h>
+
+#include "opendaq/data_packet_ptr.h"
+#include "opendaq/event_packet_ptr.h"
+
+BEGIN_NAMESPACE_REF_FB_MODULE
+
+namespace Recorder
+{
+
+using columnar_recording::ColumnarWriter;
+using columnar_recording::ColumnFormat;
+using columnar_recording::SampleBlock;
+namespace format = columnar_recording::format;
+
+class RecorderFbImpl final : public FunctionBlock
+{
+public:
+    explicit RecorderFbImpl(const ContextPtr& ctx, const ComponentPtr& parent, const StringPtr& localId, const PropertyObjectPtr& config);
+    ~RecorderFbImpl() override = default;
+
+    static FunctionBlockTypePtr CreateType();
+
+private:
+    struct SignalContext
+    {
+        uint32_t index;
+        InputPortConfigPtr inputPort;
+        DataDescriptorPtr dataDescriptor;
+        DataDescriptorPtr domainDataDescriptor;
+        ColumnFormat valueFormat;
+        ColumnFormat domainFormat;
+        bool linearDomain;
+        Int domainStart;
+        Int domainDelta;
+        bool explicitDomainTicks;
+        bool described;
+    };
+
+    std::vector<SignalContext> signalContexts;
+    uint32_t inputPortCount;
+    PacketReadyNotification packetReadyNotification;
+
+    ColumnarWriter writer;
+    bool recording;
+    bool failureReported;
+
+    std::string fileName;
+    size_t chunkSize;
+    size_t chunkCount;
+    bool compression;
+
+    void initProperties();
+    void readProperties();
+
+    bool startRecording();
+    void stopRecording();
+
+    void updateInputPorts();
+    SignalContext* getSignalContext(const InputPortPtr& port);
+
+    void onConnected(const InputPortPtr& port) override;
+    void onDisconnected(const InputPortPtr& port) override;
+    void onPacketReceived(const InputPortPtr& port) override;
+
+    void processEventPacket(SignalContext& signalContext, const EventPacketPtr& packet);
+    void processDataPacket(SignalContext& signalContext, const DataPacketPtr& packet);
+    void processSignalDescriptorChanged(SignalContext& signalContext,
+                                        const DataDescriptorPtr& dataDescriptor,
+                                        const DataDescriptorPtr& domainDataDescriptor);
+
+    void describeSignal(SignalContext& signalContext);
+    bool writeEventPacket(const SignalContext& signalContext, const EventPacketPtr& packet);
+    void checkWriterFailed();
+};
+
+}
+
+END_NAMESPACE_REF_FB_MODULE
@@ -22,6 +22,7 @@
 #include <opendaq/data_packet_ptr.h>
 #include <opendaq/sample_type_traits.h>
 #include <ref_fb_module/polyline.h>
+#include <ref_fb_module/decimation.h>
 
 #if defined(_MSC_VER)
     #pragma warning(push)
@@ -72,6 +73,9 @@ DOMAIN_SAMPLE_TYPE(SampleType::Float32, SampleType::Float64)
 DOMAIN_SAMPLE_TYPE(SampleType::Float64, SampleType::Float64)
 
 using DomainStamp = std::variant<int64_t, uint64_t, double>;
+using DomainPyramid = std::variant<Decimation::MinMaxPyramid<int64_t>,
+                                   Decimation::MinMaxPyramid<uint64_t>,
+                                   Decimation::MinMaxPyramid<double>>;
 
 struct SignalContext
 {
@@ -115,6 +119,10 @@ struct SignalContext
 
     bool lastValueSet;
     Float lastValue;
+
+    // Scalar signals are drawn from a min/max pyramid, so frame cost depends on the pixel width
+    bool decimate{ false };
+    DomainPyramid pyramid;
 };
 
 class RendererFbImpl final : public FunctionBlock
@@ -180,6 +188,10 @@ private:
     void renderSignalExplicit(SignalContext& signalContext, sf::RenderTarget& renderTarget) const;
     void renderSignalImplicit(SignalContext& signalContext, sf::RenderTarget& renderTarget) const;*/
 
+    template <SampleType DST>
+    void renderDecimatedSignal(SignalContext& signalContext, sf::RenderTarget& renderTarget);
+    void renderLastValue(const SignalContext& signalContext, sf::RenderTarget& renderTarget, const sf::Font& font);
+
     template <SampleType DST>
     void renderPacket(SignalContext& signalContext,
                       sf::RenderTarget& renderTarget,
@@ -239,6 +251,11 @@ private:
     template <SampleType DST>
     void setLastDomainStamp(SignalContext& signalContext, const DataPacketPtr& domainPacket);
 
+    template <SampleType DST>
+    void resetPyramid(SignalContext& signalContext);
+    template <SampleType DST>
+    void appendToPyramid(SignalContext& signalContext, const DataPacketPtr& dataPacket);
+
     void resize(sf::RenderWindow& window);
     void initProperties();
     void propertyChanged();
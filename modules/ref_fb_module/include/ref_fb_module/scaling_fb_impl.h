@@ -32,13 +32,14 @@ namespace Scaling
 class ScalingFbImpl final : public FunctionBlock
 {
 public:
-    explicit ScalingFbImpl(const ContextPtr& ctx, const ComponentPtr& parent, const StringPtr& localId);
+    explicit ScalingFbImpl(const ContextPtr& ctx, const ComponentPtr& parent, const StringPtr& localId, const PropertyObjectPtr& config);
     ~ScalingFbImpl() override = default;
 
     static FunctionBlockTypePtr CreateType();
 
 private:
     InputPortPtr inputPort;
+    PacketReadyNotification packetReadyNotification;
 
     DataDescriptorPtr inputDataDescriptor;
     DataDescriptorPtr inputDomainDataDescriptor;
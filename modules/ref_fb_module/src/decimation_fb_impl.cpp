@@ -0,0 +1,270 @@
+#include <opendaq/event_packet_params.h>
+#include <ref_fb_module/decimation_fb_impl.h>
+#include <ref_fb_module/dispatch.h>
+#include "opendaq/packet_factory.h"
+#include "opendaq/sample_type_traits.h"
+
+BEGIN_NAMESPACE_REF_FB_MODULE
+
+namespace Decimation
+{
+
+DecimationFbImpl::DecimationFbImpl(const ContextPtr& ctx, const ComponentPtr& parent, const StringPtr& localId, const PropertyObjectPtr& config)
+    : FunctionBlock(CreateType(), ctx, parent, localId)
+    , configured(false)
+{
+    if (config.assigned() && config.hasProperty("UseMultiThreadedScheduler") && !config.getPropertyValue("UseMultiThreadedScheduler"))
+        packetReadyNotification = PacketReadyNotification::SameThread;
+    else
+        packetReadyNotification = PacketReadyNotification::Scheduler;
+
+    createInputPorts();
+    createSignals();
+    initProperties();
+}
+
+FunctionBlockTypePtr DecimationFbImpl::CreateType()
+{
+    auto defaultConfig = PropertyObject();
+    defaultConfig.addProperty(BoolProperty("UseMultiThreadedScheduler", true));
+
+    return FunctionBlockType("RefFBModuleDecimation",
+                             "Decimation",
+                             "Min/max or LTTB decimation for plotting and remote viewing",
+                             defaultConfig);
+}
+
+void DecimationFbImpl::initProperties()
+{
+    objPtr.addProperty(SelectionProperty("Mode", List<IString>("MinMax", "LTTB"), 0));
+    objPtr.getOnPropertyValueWrite("Mode") +=
+        [this](PropertyObjectPtr& obj, PropertyValueEventArgsPtr& args) { propertyChanged(true); };
+
+    const auto bucketSizeProp = IntPropertyBuilder("BucketSize", 100).setMinValue(2).build();
+    objPtr.addProperty(bucketSizeProp);
+    objPtr.getOnPropertyValueWrite("BucketSize") +=
+        [this](PropertyObjectPtr& obj, PropertyValueEventArgsPtr& args) { propertyChanged(true); };
+
+    readProperties();
+}
+
+void DecimationFbImpl::propertyChanged(bool configure)
+{
+    std::scoped_lock lock(sync);
+    readProperties();
+    if (configure)
+        this->configure();
+}
+
+void DecimationFbImpl::readProperties()
+{
+    mode = static_cast<Int>(objPtr.getPropertyValue("Mode")) == 0 ? DecimationMode::MinMax : DecimationMode::Lttb;
+    bucketSize = static_cast<size_t>(static_cast<Int>(objPtr.getPropertyValue("BucketSize")));
+    decimator = StreamingDecimator<Int>(mode, bucketSize);
+}
+
+void DecimationFbImpl::processSignalDescriptorChanged(const DataDescriptorPtr& inputDataDescriptor,
+                                                      const DataDescriptorPtr& inputDomainDataDescriptor)
+{
+    if (inputDataDescriptor.assigned())
+        this->inputDataDescriptor = inputDataDescriptor;
+    if (inputDomainDataDescriptor.assigned())
+        this->inputDomainDataDescriptor = inputDomainDataDescriptor;
+
+    configure();
+}
+
+void DecimationFbImpl::configure()
+{
+    configured = false;
+    decimator.reset();
+    haveNextDomainValue = false;
+
+    if (!inputDataDescriptor.assigned() || !inputDomainDataDescriptor.assigned())
+    {
+        LOG_D("Incomplete signal descriptors")
+        return;
+    }
+
+    try
+    {
+        if (inputDataDescriptor.getDimensions().getCount() > 0)
+            throw std::runtime_error("Arrays not supported");
+
+        inputSampleType = inputDataDescriptor.getSampleType();
+        if (inputSampleType != SampleType::Float64 && inputSampleType != SampleType::Float32 && inputSampleType != SampleType::Int8 &&
+            inputSampleType != SampleType::Int16 && inputSampleType != SampleType::Int32 && inputSampleType != SampleType::Int64 &&
+            inputSampleType != SampleType::UInt8 && inputSampleType != SampleType::UInt16 && inputSampleType != SampleType::UInt32 &&
+            inputSampleType != SampleType::UInt64)
+            throw std::runtime_error("Invalid sample type");
+
+        inputDomainSampleType = inputDomainDataDescriptor.getSampleType();
+        if (inputDomainSampleType != SampleType::Int64 && inputDomainSampleType != SampleType::UInt64)
+            throw std::runtime_error("Domain sample type must be Int64 or UInt64");
+
+        const auto domainRuleType = inputDomainDataDescriptor.getRule().getType();
+        if (domainRuleType != DataRuleType::Linear && domainRuleType != DataRuleType::Explicit)
+            throw std::runtime_error("Domain rule must be linear or explicit");
+
+        const auto name = inputDataDescriptor.getName();
+        outputDataDescriptor = DataDescriptorBuilder()
+                                   .setSampleType(SampleType::Float64)
+                                   .setName(name.assigned() ? name.toStdString() + "/Decimated" : "Decimated")
+                                   .setUnit(inputDataDescriptor.getUnit())
+                                   .setValueRange(inputDataDescriptor.getValueRange())
+                                   .build();
+        outputSignal.setDescriptor(outputDataDescriptor);
+
+        outputDomainDataDescriptor = DataDescriptorBuilderCopy(inputDomainDataDescriptor)
+                                         .setRule(ExplicitDataRule())
+                                         .setSampleType(SampleType::Int64)
+                                         .build();
+        outputDomainSignal.setDescriptor(outputDomainDataDescriptor);
+
+        configured = true;
+    }
+    catch (const std::exception& e)
+    {
+        LOG_W("Failed to set descriptor for decimation signal: {}", e.what())
+        outputSignal.setDescriptor(nullptr);
+    }
+}
+
+void DecimationFbImpl::onPacketReceived(const InputPortPtr& port)
+{
+    std::scoped_lock lock(sync);
+
+    PacketPtr packet;
+    const auto connection = inputPort.getConnection();
+    if (!connection.assigned())
+        return;
+
+    packet = connection.dequeue();
+
+    while (packet.assigned())
+    {
+        switch (packet.getType())
+        {
+            case PacketType::Event:
+                processEventPacket(packet);
+                break;
+
+            case PacketType::Data:
+                if (configured)
+                    SAMPLE_TYPE_DISPATCH(inputSampleType, processDataPacket, packet);
+                break;
+
+            default:
+                break;
+        }
+
+        packet = connection.dequeue();
+    };
+}
+
+void DecimationFbImpl::processEventPacket(const EventPacketPtr& packet)
+{
+    if (packet.getEventId() == event_packet_id::DATA_DESCRIPTOR_CHANGED)
+    {
+        DataDescriptorPtr inputDataDescriptor = packet.getParameters().get(event_packet_param::DATA_DESCRIPTOR);
+        DataDescriptorPtr inputDomainDataDescriptor = packet.getParameters().get(event_packet_param::DOMAIN_DATA_DESCRIPTOR);
+        processSignalDescriptorChanged(inputDataDescriptor, inputDomainDataDescriptor);
+    }
+    else if (packet.getEventId() == event_packet_id::IMPLICIT_DOMAIN_GAP_DETECTED)
+    {
+        startSegment();
+    }
+}
+
+void DecimationFbImpl::startSegment()
+{
+    decimator.startSegment(decimatedPoints);
+    sendDecimatedPoints();
+}
+
+template <SampleType InputSampleType>
+void DecimationFbImpl::processDataPacket(const DataPacketPtr& packet)
+{
+    using InputType = typename SampleTypeToType<InputSampleType>::Type;
+    decimatePacket(packet, static_cast<const InputType*>(packet.getData()));
+}
+
+template <typename InputType>
+void DecimationFbImpl::decimatePacket(const DataPacketPtr& packet, const InputType* inputData)
+{
+    const auto domainPacket = packet.getDomainPacket();
+    if (!domainPacket.assigned())
+        return;
+
+    const size_t sampleCount = packet.getSampleCount();
+    const auto rule = domainPacket.getDataDescriptor().getRule();
+
+    // Unsigned domain values are reinterpreted as Int64, which is lossless below 2^63 ticks
+    if (rule.getType() == DataRuleType::Explicit)
+    {
+        const auto domainData = static_cast<const Int*>(domainPacket.getData());
+        for (size_t i = 0; i < sampleCount; i++)
+            decimator.append(domainData[i], static_cast<Float>(inputData[i]), decimatedPoints);
+    }
+    else
+    {
+        const auto params = rule.getParameters();
+        const Int delta = params.get("delta");
+        const Int start = params.get("start");
+        const auto offsetPtr = domainPacket.getOffset();
+        const Int offset = offsetPtr.assigned() ? offsetPtr.getIntValue() : 0;
+
+        Int domainValue = offset + start;
+
+        // Buckets must not span a gap in the domain
+        if (haveNextDomainValue && domainValue != nextDomainValue)
+            decimator.startSegment(decimatedPoints);
+
+        for (size_t i = 0; i < sampleCount; i++, domainValue += delta)
+            decimator.append(domainValue, static_cast<Float>(inputData[i]), decimatedPoints);
+
+        nextDomainValue = domainValue;
+        haveNextDomainValue = true;
+    }
+
+    sendDecimatedPoints();
+}
+
+void DecimationFbImpl::sendDecimatedPoints()
+{
+    if (decimatedPoints.empty())
+        return;
+
+    const size_t count = decimatedPoints.size();
+    const auto outputDomainPacket = DataPacket(outputDomainDataDescriptor, count);
+    const auto outputPacket = DataPacketWithDomain(outputDomainPacket, outputDataDescriptor, count);
+
+    auto domainData = static_cast<Int*>(outputDomainPacket.getData());
+    auto data = static_cast<Float*>(outputPacket.getData());
+    for (const auto& point : decimatedPoints)
+    {
+        *domainData++ = point.x;
+        *data++ = point.y;
+    }
+
+    decimatedPoints.clear();
+
+    outputDomainSignal.sendPacket(outputDomainPacket);
+    outputSignal.sendPacket(outputPacket);
+}
+
+void DecimationFbImpl::createInputPorts()
+{
+    inputPort = createAndAddInputPort("Input", packetReadyNotification);
+}
+
+void DecimationFbImpl::createSignals()
+{
+    outputSignal = createAndAddSignal(String("output"));
+    outputDomainSignal = createAndAddSignal(String("output_domain"), nullptr, false);
+    outputSignal.setDomainSignal(outputDomainSignal);
+}
+
+}
+
+END_NAMESPACE_REF_FB_MODULE
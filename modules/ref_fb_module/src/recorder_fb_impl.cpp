@@ -0,0 +1,419 @@
+#include <ref_fb_module/recorder_fb_impl.h>
+#include <coretypes/json_serializer_factory.h>
+#include <opendaq/custom_log.h>
+#include <opendaq/event_packet_ids.h>
+#include <opendaq/event_packet_params.h>
+#include <opendaq/function_block_type_factory.h>
+#include <opendaq/packet_factory.h>
+#include <opendaq/sample_type_traits.h>
+#include <algorithm>
+#include <limits>
+
+BEGIN_NAMESPACE_REF_FB_MODULE
+
+namespace Recorder
+{
+
+namespace
+{
+
+ColumnFormat getColumnFormat(const DataDescriptorPtr& descriptor)
+{
+    ColumnFormat format;
+
+    // samples larger than the field are stored with an unknown size; the runs still describe their bytes
+    const SizeT rawSampleSize = descriptor.getRawSampleSize();
+    format.sampleSize = rawSampleSize <= std::numeric_limits<uint8_t>::max() ? static_cast<uint8_t>(rawSampleSize) : 0;
+
+    SampleType rawSampleType = descriptor.getSampleType();
+    const auto postScaling = descriptor.getPostScaling();
+    if (postScaling.assigned())
+        rawSampleType = postScaling.getInputSampleType();
+
+    const auto rule = descriptor.getRule();
+    const auto dimensions = descriptor.getDimensions();
+    const bool explicitScalar = (!rule.assigned() || rule.getType() == DataRuleType::Explicit) &&
+                                (!dimensions.assigned() || dimensions.getCount() == 0);
+
+    switch (rawSampleType)
+    {
+        case SampleType::Int8:
+        case SampleType::Int16:
+        case SampleType::Int32:
+        case SampleType::Int64:
+            format.integer = explicitScalar;
+            format.isSigned = true;
+            break;
+        case SampleType::UInt8:
+        case SampleType::UInt16:
+        case SampleType::UInt32:
+        case SampleType::UInt64:
+            format.integer = explicitScalar;
+            break;
+        default:
+            break;
+    }
+
+    return format;
+}
+
+}
+
+RecorderFbImpl::RecorderFbImpl(const ContextPtr& ctx, const ComponentPtr& parent, const StringPtr& localId, const PropertyObjectPtr& config)
+    : FunctionBlock(CreateType(), ctx, parent, localId)
+    , inputPortCount(0)
+    , recording(false)
+    , failureReported(false)
+{
+    if (config.assigned() && config.hasProperty("UseMultiThreadedScheduler") && !config.getPropertyValue("UseMultiThreadedScheduler"))
+        packetReadyNotification = PacketReadyNotification::SameThread;
+    else
+        packetReadyNotification = PacketReadyNotification::Scheduler;
+
+    initProperties();
+    updateInputPorts();
+}
+
+FunctionBlockTypePtr RecorderFbImpl::CreateType()
+{
+    auto defaultConfig = PropertyObject();
+    defaultConfig.addProperty(BoolProperty("UseMultiThreadedScheduler", true));
+
+    return FunctionBlockType("RefFBModuleRecorder",
+                             "Recorder",
+                             "Records signals with their domains and events into a chunked columnar file",
+                             defaultConfig);
+}
+
+void RecorderFbImpl::initProperties()
+{
+    objPtr.addProperty(StringProperty("FileName", "recording.daqrec"));
+    objPtr.getOnPropertyValueWrite("FileName") += [this](PropertyObjectPtr& /*obj*/, PropertyValueEventArgsPtr& /*args*/) { readProperties(); };
+
+    objPtr.addProperty(IntProperty("ChunkSize", static_cast<Int>(ColumnarWriter::DefaultChunkSize)));
+    objPtr.getOnPropertyValueWrite("ChunkSize") += [this](PropertyObjectPtr& /*obj*/, PropertyValueEventArgsPtr& /*args*/) { readProperties(); };
+
+    objPtr.addProperty(IntProperty("ChunkCount", 4));
+    objPtr.getOnPropertyValueWrite("ChunkCount") += [this](PropertyObjectPtr& /*obj*/, PropertyValueEventArgsPtr& /*args*/) { readProperties(); };
+
+    objPtr.addProperty(BoolProperty("Compression", False));
+    objPtr.getOnPropertyValueWrite("Compression") += [this](PropertyObjectPtr& /*obj*/, PropertyValueEventArgsPtr& /*args*/) { readProperties(); };
+
+    objPtr.addProperty(BoolProperty("Recording", False));
+    objPtr.getOnPropertyValueWrite("Recording") += [this](PropertyObjectPtr& /*obj*/, PropertyValueEventArgsPtr& args)
+    {
+        if (args.getValue())
+        {
+            if (!startRecording())
+                args.setValue(False);
+        }
+        else
+        {
+            stopRecording();
+        }
+    };
+
+    readProperties();
+}
+
+void RecorderFbImpl::readProperties()
+{
+    std::scoped_lock lock(sync);
+
+    // the settings are applied when the next recording is started
+    fileName = static_cast<std::string>(objPtr.getPropertyValue("FileName"));
+    chunkSize = static_cast<size_t>(std::max<Int>(objPtr.getPropertyValue("ChunkSize"), 1));
+    chunkCount = static_cast<size_t>(std::max<Int>(objPtr.getPropertyValue("ChunkCount"), 2));
+    compression = objPtr.getPropertyValue("Compression");
+}
+
+bool RecorderFbImpl::startRecording()
+{
+    std::scoped_lock lock(sync);
+    if (recording)
+        return true;
+
+    ColumnarWriter::Settings settings;
+    settings.fileName = fileName;
+    settings.chunkSize = chunkSize;
+    settings.chunkCount = chunkCount;
+    settings.compress = compression;
+
+    try
+    {
+        writer.open(settings);
+    }
+    catch (const std::exception& e)
+    {
+        LOG_W("Failed to start recording: {}", e.what())
+        return false;
+    }
+
+    for (auto& signalContext : signalContexts)
+        signalContext.described = false;
+
+    recording = true;
+    failureReported = false;
+    LOG_I("Recording to {} started", fileName)
+    return true;
+}
+
+void RecorderFbImpl::stopRecording()
+{
+    {
+        std::scoped_lock lock(sync);
+        if (!recording)
+            return;
+        recording = false;
+    }
+
+    // the staged chunks are written without holding the lock, so that the input ports are not blocked meanwhile
+    writer.close();
+
+    const auto statistics = writer.getStatistics();
+    if (writer.hasFailed())
+        LOG_E("Recording to {} failed, the file has no index", fileName)
+    if (statistics.droppedBlocks > 0 || statistics.writeErrors > 0)
+        LOG_W("Recording dropped {} packets, {} writes failed", statistics.droppedBlocks, statistics.writeErrors)
+    LOG_I("Recording stopped, {} bytes written", statistics.bytesWritten)
+}
+
+void RecorderFbImpl::updateInputPorts()
+{
+    // disconnected ports are removed, and a new port is added for the next signal
+    for (auto it = signalContexts.begin(); it != signalContexts.end();)
+    {
+        if (!it->inputPort.getSignal().assigned())
+        {
+            removeInputPort(it->inputPort);
+            it = signalContexts.erase(it);
+        }
+        else
+            ++it;
+    }
+
+    // the index of the port identifies the signal in the recording
+    const uint32_t index = inputPortCount++;
+    const auto inputPort = createAndAddInputPort(fmt::format("Input{}", index), packetReadyNotification);
+
+    SignalContext signalContext{};
+    signalContext.index = index;
+    signalContext.inputPort = inputPort;
+    signalContexts.push_back(std::move(signalContext));
+}
+
+RecorderFbImpl::SignalContext* RecorderFbImpl::getSignalContext(const InputPortPtr& port)
+{
+    for (auto& signalContext : signalContexts)
+        if (signalContext.inputPort == port)
+            return &signalContext;
+
+    return nullptr;
+}
+
+void RecorderFbImpl::onConnected(const InputPortPtr& port)
+{
+    std::scoped_lock lock(sync);
+
+    updateInputPorts();
+    LOG_T("Connected to port {}", port.getLocalId())
+}
+
+void RecorderFbImpl::onDisconnected(const InputPortPtr& port)
+{
+    std::scoped_lock lock(sync);
+
+    updateInputPorts();
+    LOG_T("Disconnected from port {}", port.getLocalId())
+}
+
+void RecorderFbImpl::onPacketReceived(const InputPortPtr& port)
+{
+    std::scoped_lock lock(sync);
+
+    const auto signalContext = getSignalContext(port);
+    if (signalContext == nullptr)
+        return;
+
+    const auto connection = port.getConnection();
+    if (!connection.assigned())
+        return;
+
+    auto packet = connection.dequeue();
+    while (packet.assigned())
+    {
+        switch (packet.getType())
+        {
+            case PacketType::Event:
+                processEventPacket(*signalContext, packet);
+                break;
+
+            case PacketType::Data:
+                processDataPacket(*signalContext, packet);
+                break;
+
+            default:
+                break;
+        }
+
+        packet = connection.dequeue();
+    }
+}
+
+void RecorderFbImpl::processEventPacket(SignalContext& signalContext, const EventPacketPtr& packet)
+{
+    if (packet.getEventId() == event_packet_id::DATA_DESCRIPTOR_CHANGED)
+    {
+        const auto params = packet.getParameters();
+        const DataDescriptorPtr dataDescriptor = params.get(event_packet_param::DATA_DESCRIPTOR);
+        const DataDescriptorPtr domainDataDescriptor = params.get(event_packet_param::DOMAIN_DATA_DESCRIPTOR);
+        processSignalDescriptorChanged(signalContext, dataDescriptor, domainDataDescriptor);
+
+        // the description of the signal already contains the new descriptors
+        if (recording && !signalContext.described)
+        {
+            describeSignal(signalContext);
+            return;
+        }
+    }
+
+    if (!recording)
+        return;
+
+    if (!signalContext.described)
+        describeSignal(signalContext);
+
+    if (!writeEventPacket(signalContext, packet))
+    {
+        signalContext.described = false;
+        checkWriterFailed();
+    }
+}
+
+void RecorderFbImpl::processSignalDescriptorChanged(SignalContext& signalContext,
+                                                    const DataDescriptorPtr& dataDescriptor,
+                                                    const DataDescriptorPtr& domainDataDescriptor)
+{
+    if (dataDescriptor.assigned())
+        signalContext.dataDescriptor = dataDescriptor;
+    if (domainDataDescriptor.assigned())
+        signalContext.domainDataDescriptor = domainDataDescriptor;
+
+    signalContext.valueFormat = signalContext.dataDescriptor.assigned() ? getColumnFormat(signalContext.dataDescriptor) : ColumnFormat{};
+    signalContext.domainFormat = {};
+    signalContext.linearDomain = false;
+    signalContext.domainStart = 0;
+    signalContext.domainDelta = 0;
+    signalContext.explicitDomainTicks = false;
+
+    if (!signalContext.domainDataDescriptor.assigned())
+        return;
+
+    try
+    {
+        const auto rule = signalContext.domainDataDescriptor.getRule();
+        if (rule.assigned() && rule.getType() == DataRuleType::Linear)
+        {
+            // only the offset of the domain packets is stored for linear domains
+            const auto params = rule.getParameters();
+            signalContext.domainDelta = static_cast<Int>(params.get("delta"));
+            signalContext.domainStart = params.hasKey("start") ? static_cast<Int>(params.get("start")) : 0;
+            signalContext.linearDomain = true;
+        }
+        else
+        {
+            signalContext.domainFormat = getColumnFormat(signalContext.domainDataDescriptor);
+
+            const auto sampleType = signalContext.domainDataDescriptor.getSampleType();
+            signalContext.explicitDomainTicks = (sampleType == SampleType::Int64 || sampleType == SampleType::UInt64) &&
+                                                signalContext.domainFormat.sampleSize == sizeof(int64_t);
+        }
+    }
+    catch (const std::exception& e)
+    {
+        LOG_W("Failed to read the domain of port {}: {}", signalContext.inputPort.getLocalId(), e.what())
+    }
+}
+
+void RecorderFbImpl::processDataPacket(SignalContext& signalContext, const DataPacketPtr& packet)
+{
+    if (!recording || !signalContext.dataDescriptor.assigned())
+        return;
+
+    if (!signalContext.described)
+        describeSignal(signalContext);
+
+    SampleBlock block;
+    block.sampleCount = packet.getSampleCount();
+    block.valueFormat = signalContext.valueFormat;
+    block.values = packet.getRawData();
+    block.valueBytes = packet.getRawDataSize();
+
+    const auto domainPacket = packet.getDomainPacket();
+    if (domainPacket.assigned() && block.sampleCount > 0)
+    {
+        if (signalContext.linearDomain)
+        {
+            const auto offset = domainPacket.getOffset();
+            block.domainOffset = offset.assigned() ? offset.getIntValue() : 0;
+            block.hasTime = true;
+            block.firstTick = signalContext.domainStart + block.domainOffset;
+            block.lastTick = block.firstTick + signalContext.domainDelta * static_cast<Int>(block.sampleCount - 1);
+        }
+        else
+        {
+            block.domainFormat = signalContext.domainFormat;
+            block.domain = domainPacket.getRawData();
+            block.domainBytes = domainPacket.getRawDataSize();
+
+            if (signalContext.explicitDomainTicks && block.domainBytes >= block.sampleCount * sizeof(int64_t))
+            {
+                const auto ticks = static_cast<const int64_t*>(block.domain);
+                block.hasTime = true;
+                block.firstTick = ticks[0];
+                block.lastTick = ticks[block.sampleCount - 1];
+            }
+        }
+    }
+
+    // the writer only copies the samples; when it falls behind, the packet is dropped and counted, and the
+    // signal is described again with its next packet in case the description was dropped as well
+    if (!writer.write(signalContext.index, block))
+    {
+        signalContext.described = false;
+        checkWriterFailed();
+    }
+}
+
+void RecorderFbImpl::describeSignal(SignalContext& signalContext)
+{
+    const auto signal = signalContext.inputPort.getSignal();
+    bool described = writer.writeRecord(
+        signalContext.index, format::RecordKind::SignalInfo, signal.assigned() ? signal.getGlobalId().toStdString() : "");
+
+    if (described && (signalContext.dataDescriptor.assigned() || signalContext.domainDataDescriptor.assigned()))
+        described = writeEventPacket(signalContext, DataDescriptorChangedEventPacket(signalContext.dataDescriptor, signalContext.domainDataDescriptor));
+
+    signalContext.described = described;
+}
+
+bool RecorderFbImpl::writeEventPacket(const SignalContext& signalContext, const EventPacketPtr& packet)
+{
+    const auto serializer = JsonSerializer();
+    packet.asPtr<ISerializable>(true).serialize(serializer);
+    return writer.writeRecord(signalContext.index, format::RecordKind::Event, serializer.getOutput().toStdString());
+}
+
+void RecorderFbImpl::checkWriterFailed()
+{
+    if (failureReported || !writer.hasFailed())
+        return;
+
+    // the writer rejects the rest of the recording; it is stopped when the Recording property is cleared
+    failureReported = true;
+    LOG_E("Writing to {} failed, the rest of the recording is lost", fileName)
+}
+
+}
+
+END_NAMESPACE_REF_FB_MODULE
@@ -1,7 +1,9 @@
 #include <coretypes/version_info_factory.h>
 #include <opendaq/custom_log.h>
 #include <ref_fb_module/classifier_fb_impl.h>
+#include <ref_fb_module/decimation_fb_impl.h>
 #include <ref_fb_module/power_fb_impl.h>
+#include <ref_fb_module/recorder_fb_impl.h>
 #include <ref_fb_module/ref_fb_module_impl.h>
 #ifdef OPENDAQ_ENABLE_RENDERER
 #include <ref_fb_module/renderer_fb_impl.h>
@@ -53,6 +55,12 @@ DictPtr<IString, IFunctionBlockType> RefFBModule::onGetAvailableFunctionBlockTyp
     const auto typePowerReader = PowerReader::PowerReaderFbImpl::CreateType();
     types.set(typePowerReader.getId(), typePowerReader);
 
+    const auto typeDecimation = Decimation::DecimationFbImpl::CreateType();
+    types.set(typeDecimation.getId(), typeDecimation);
+
+    const auto typeRecorder = Recorder::RecorderFbImpl::CreateType();
+    types.set(typeRecorder.getId(), typeRecorder);
+
     return types;
 }
 
@@ -80,7 +88,7 @@ FunctionBlockPtr RefFBModule::onCreateFunctionBlock(const StringPtr& id,
     }
     if (id == Scaling::ScalingFbImpl::CreateType().getId())
     {
-        FunctionBlockPtr fb = createWithImplementation<IFunctionBlock, Scaling::ScalingFbImpl>(context, parent, localId);
+        FunctionBlockPtr fb = createWithImplementation<IFunctionBlock, Scaling::ScalingFbImpl>(context, parent, localId, config);
         return fb;
     }
     if (id == Classifier::ClassifierFbImpl::CreateType().getId())
@@ -103,6 +111,16 @@ FunctionBlockPtr RefFBModule::onCreateFunctionBlock(const StringPtr& id,
         FunctionBlockPtr fb = createWithImplementation<IFunctionBlock, PowerReader::PowerReaderFbImpl>(context, parent, localId);
         return fb;
     }
+    if (id == Decimation::DecimationFbImpl::CreateType().getId())
+    {
+        FunctionBlockPtr fb = createWithImplementation<IFunctionBlock, Decimation::DecimationFbImpl>(context, parent, localId, config);
+        return fb;
+    }
+    if (id == Recorder::RecorderFbImpl::CreateType().getId())
+    {
+        FunctionBlockPtr fb = createWithImplementation<IFunctionBlock, Recorder::RecorderFbImpl>(context, parent, localId, config);
+        return fb;
+    }
 
     LOG_W("Function block \"{}\" not found", id);
     throw NotFoundException("Function block not found");
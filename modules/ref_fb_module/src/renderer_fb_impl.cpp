@@ -21,6 +21,26 @@ BEGIN_NAMESPACE_REF_FB_MODULE
 namespace Renderer
 {
 
+static bool isDecimationSupported(SampleType sampleType)
+{
+    switch (sampleType)
+    {
+        case SampleType::Float32:
+        case SampleType::Float64:
+        case SampleType::Int8:
+        case SampleType::Int16:
+        case SampleType::Int32:
+        case SampleType::Int64:
+        case SampleType::UInt8:
+        case SampleType::UInt16:
+        case SampleType::UInt32:
+        case SampleType::UInt64:
+            return true;
+        default:
+            return false;
+    }
+}
+
 RendererFbImpl::RendererFbImpl(const ContextPtr& ctx, const ComponentPtr& parent, const StringPtr& localId)
     : FunctionBlock(CreateType(), ctx, parent, localId)
     , stopRender(false)
@@ -597,6 +617,13 @@ template <SampleType DST>
 void RendererFbImpl::renderSignal(SignalContext& signalContext, sf::RenderTarget& renderTarget, const sf::Font& font)
 {
     signalContext.lastValueSet = false;
+    if (signalContext.decimate)
+    {
+        renderDecimatedSignal<DST>(signalContext, renderTarget);
+        renderLastValue(signalContext, renderTarget, font);
+        return;
+    }
+
     if (signalContext.dataPackets.empty())
         return;
 
@@ -627,7 +654,80 @@ void RendererFbImpl::renderSignal(SignalContext& signalContext, sf::RenderTarget
     signalContext.dataPackets.erase(packetIt, signalContext.dataPackets.end());
 
     renderTarget.draw(*line);
+    renderLastValue(signalContext, renderTarget, font);
+}
+
+template <SampleType DST>
+void RendererFbImpl::renderDecimatedSignal(SignalContext& signalContext, sf::RenderTarget& renderTarget)
+{
+    using DestDomainType = typename SampleTypeToType<DomainTypeCast<DST>::DomainSampleType>::Type;
+
+    const auto& pyramid = std::get<Decimation::MinMaxPyramid<DestDomainType>>(signalContext.pyramid);
+    if (pyramid.empty())
+        return;
+
+    const float xSize = signalContext.bottomRight.x - signalContext.topLeft.x;
+    const float xOffset = signalContext.topLeft.x;
+    const float ySize = signalContext.bottomRight.y - signalContext.topLeft.y;
+    const float yOffset = signalContext.bottomRight.y;
+
+    DestDomainType firstDomainValue;
+    DestDomainType lastDomainValue;
+    if (singleXAxis)
+    {
+        firstDomainValue = std::get<DestDomainType>(signalContext.singleAxisFirstDomainStamp);
+        lastDomainValue = std::get<DestDomainType>(signalContext.singleAxisLastDomainStamp);
+    }
+    else
+    {
+        firstDomainValue = std::get<DestDomainType>(signalContext.firstDomainStamp);
+        lastDomainValue = std::get<DestDomainType>(signalContext.lastDomainStamp);
+    }
+
+    const auto domainFactor = (lastDomainValue - firstDomainValue) / static_cast<double>(xSize);
 
+    double yMax, yMin;
+    getYMinMax(signalContext, yMax, yMin);
+    const auto valueFactor = (yMax - yMin) / static_cast<double>(ySize);
+
+    // One bucket per pixel column; each bucket contributes at most its minimum and maximum
+    std::vector<Decimation::Point<DestDomainType>> points;
+    pyramid.queryPoints(firstDomainValue, lastDomainValue, static_cast<size_t>(std::max(xSize, 1.0f)), points);
+
+    auto line = std::make_unique<Polyline>(lineThickness, LineStyle::solid);
+    line->setColor(getColor(signalContext));
+
+    for (const auto& point : points)
+    {
+        if (point.x < firstDomainValue)
+            continue;
+
+        if (point.segmentStart)
+        {
+            renderTarget.draw(*line);
+            line = std::make_unique<Polyline>(lineThickness, LineStyle::solid);
+            line->setColor(getColor(signalContext));
+        }
+
+        const float xPos = xOffset + static_cast<float>(1.0 * (point.x - firstDomainValue) / domainFactor);
+        float yPos = yOffset - static_cast<float>((point.y - yMin) / valueFactor);
+
+        if (yPos < signalContext.topLeft.y)
+            yPos = signalContext.topLeft.y;
+        else if (yPos > signalContext.bottomRight.y)
+            yPos = signalContext.bottomRight.y;
+
+        line->addPoint(xPos, yPos);
+    }
+
+    renderTarget.draw(*line);
+
+    signalContext.lastValue = pyramid.getLastY();
+    signalContext.lastValueSet = true;
+}
+
+void RendererFbImpl::renderLastValue(const SignalContext& signalContext, sf::RenderTarget& renderTarget, const sf::Font& font)
+{
     if (signalContext.lastValueSet && showLastValue)
     {
         sf::Text lastValueText;
@@ -1376,6 +1476,13 @@ void RendererFbImpl::configureSignalContext(SignalContext& signalContext)
         }
         setSignalContextCaption(signalContext);
 
+        signalContext.decimate = dataDescriptor.getDimensions().getCount() == 0 && !signalContext.isRange &&
+                                 isDecimationSupported(signalContext.sampleType) &&
+                                 isDecimationSupported(signalContext.domainSampleType);
+        signalContext.dataPackets.clear();
+        if (signalContext.decimate)
+            SAMPLE_TYPE_DISPATCH(signalContext.domainSampleType, resetPyramid, signalContext)
+
         signalContext.valid = true;
         LOGP_D("Signal descriptor changed")
     }
@@ -1426,10 +1533,17 @@ void RendererFbImpl::processDataPacket(SignalContext& signalContext, const DataP
         while (!signalContext.dataPacketsInFreezeMode.empty())
         {
             auto pkt = signalContext.dataPacketsInFreezeMode.back();
-            signalContext.dataPackets.push_front(pkt);
+            if (signalContext.decimate)
+                SAMPLE_TYPE_DISPATCH(signalContext.domainSampleType, appendToPyramid, signalContext, pkt)
+            else
+                signalContext.dataPackets.push_front(pkt);
             signalContext.dataPacketsInFreezeMode.pop_back();
         }
-        signalContext.dataPackets.push_front(dataPacket);
+
+        if (signalContext.decimate)
+            SAMPLE_TYPE_DISPATCH(signalContext.domainSampleType, appendToPyramid, signalContext, dataPacket)
+        else
+            signalContext.dataPackets.push_front(dataPacket);
         SAMPLE_TYPE_DISPATCH(signalContext.domainSampleType, setLastDomainStamp, signalContext, domainPacket)
     }
 }
@@ -1469,6 +1583,87 @@ void RendererFbImpl::setLastDomainStamp(SignalContext& signalContext, const Data
     }
 }
 
+template <SampleType DST>
+void RendererFbImpl::resetPyramid(SignalContext& signalContext)
+{
+    using DestDomainType = typename SampleTypeToType<DomainTypeCast<DST>::DomainSampleType>::Type;
+    signalContext.pyramid.emplace<Decimation::MinMaxPyramid<DestDomainType>>();
+}
+
+template <SampleType DST>
+void RendererFbImpl::appendToPyramid(SignalContext& signalContext, const DataPacketPtr& dataPacket)
+{
+    using SourceDomainType = typename SampleTypeToType<DST>::Type;
+    using DestDomainType = typename SampleTypeToType<DomainTypeCast<DST>::DomainSampleType>::Type;
+
+    auto& pyramid = std::get<Decimation::MinMaxPyramid<DestDomainType>>(signalContext.pyramid);
+
+    const auto domainPacket = dataPacket.getDomainPacket();
+    const auto sampleCount = dataPacket.getSampleCount();
+    if (sampleCount == 0)
+        return;
+
+    const auto append = [&](const auto* values)
+    {
+        if (signalContext.isExplicit)
+        {
+            const auto domainData = static_cast<const SourceDomainType*>(domainPacket.getData());
+            pyramid.appendExplicit(values, domainData, sampleCount);
+            return;
+        }
+
+        NumberPtr offset = 0;
+        if (domainPacket.getOffset().assigned())
+            offset = domainPacket.getOffset();
+
+        const auto delta = static_cast<DestDomainType>(signalContext.domainDelta);
+        const auto firstDomainValue = static_cast<DestDomainType>(offset + signalContext.domainStart);
+
+        // Same jitter allowance as the packet-based renderer before a gap breaks the line
+        if (!pyramid.empty() && firstDomainValue > pyramid.getLastX() + delta + delta / 2)
+            pyramid.startSegment();
+
+        pyramid.appendLinear(values, sampleCount, firstDomainValue, delta);
+    };
+
+    const void* data = dataPacket.getData();
+    switch (signalContext.sampleType)
+    {
+        case SampleType::Float32:
+            append(static_cast<const float*>(data));
+            break;
+        case SampleType::Float64:
+            append(static_cast<const double*>(data));
+            break;
+        case SampleType::UInt8:
+            append(static_cast<const uint8_t*>(data));
+            break;
+        case SampleType::Int8:
+            append(static_cast<const int8_t*>(data));
+            break;
+        case SampleType::UInt16:
+            append(static_cast<const uint16_t*>(data));
+            break;
+        case SampleType::Int16:
+            append(static_cast<const int16_t*>(data));
+            break;
+        case SampleType::UInt32:
+            append(static_cast<const uint32_t*>(data));
+            break;
+        case SampleType::Int32:
+            append(static_cast<const int32_t*>(data));
+            break;
+        case SampleType::UInt64:
+            append(static_cast<const uint64_t*>(data));
+            break;
+        case SampleType::Int64:
+            append(static_cast<const int64_t*>(data));
+            break;
+        default:
+            break;
+    }
+}
+
 std::string RendererFbImpl::fixUpIso8601(std::string epoch)
 {
     if (epoch.find('T') == std::string::npos)
@@ -29,9 +29,15 @@ static const char* InputDisconnected = "Disconnected";
 static const char* InputConnected = "Connected";
 static const char* InputInvalid = "Invalid";
 
-ScalingFbImpl::ScalingFbImpl(const ContextPtr& ctx, const ComponentPtr& parent, const StringPtr& localId)
+ScalingFbImpl::ScalingFbImpl(const ContextPtr& ctx, const ComponentPtr& parent, const StringPtr& localId, const PropertyObjectPtr& config)
     : FunctionBlock(CreateType(), ctx, parent, localId)
 {
+    // with the single threaded scheduler, a chain of function blocks processes each packet inline on the thread of the producer
+    if (config.assigned() && config.hasProperty("UseMultiThreadedScheduler") && !config.getPropertyValue("UseMultiThreadedScheduler"))
+        packetReadyNotification = PacketReadyNotification::SameThread;
+    else
+        packetReadyNotification = PacketReadyNotification::SchedulerQueueWasEmpty;
+
     createInputPorts();
     createSignals();
     initProperties();
@@ -99,7 +105,10 @@ void ScalingFbImpl::readProperties()
 
 FunctionBlockTypePtr ScalingFbImpl::CreateType()
 {
-    return FunctionBlockType("RefFBModuleScaling", "Scaling", "Signal scaling");
+    auto defaultConfig = PropertyObject();
+    defaultConfig.addProperty(BoolProperty("UseMultiThreadedScheduler", true));
+
+    return FunctionBlockType("RefFBModuleScaling", "Scaling", "Signal scaling", defaultConfig);
 }
 
 void ScalingFbImpl::processSignalDescriptorChanged(const DataDescriptorPtr& inputDataDescriptor,
@@ -269,7 +278,7 @@ void ScalingFbImpl::processDataPacket(DataPacketPtr&& packet, ListPtr<IPacket>&
 
 void ScalingFbImpl::createInputPorts()
 {
-    inputPort = createAndAddInputPort("Input", PacketReadyNotification::SchedulerQueueWasEmpty);
+    inputPort = createAndAddInputPort("Input", packetReadyNotification);
 }
 
 void ScalingFbImpl::createSignals()
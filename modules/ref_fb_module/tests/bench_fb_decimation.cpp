@@ -0,0 +1,53 @@
+#include <ref_fb_module/decimation.h>
+#include <opendaq/opendaq.h>
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cmath>
+
+using namespace daq;
+using namespace daq::modules::ref_fb_module::Decimation;
+
+using DecimationBenchmark = testing::Test;
+
+static double testSignal(Int i)
+{
+    double value = std::sin(static_cast<double>(i) * 0.001);
+    if (i % 9973 == 0)
+        value += 5.0;
+    if (i % 7919 == 0)
+        value -= 5.0;
+    return value;
+}
+
+TEST_F(DecimationBenchmark, PyramidTiming)
+{
+    constexpr Int sampleCount = 4000000;
+    constexpr size_t pixelWidth = 1920;
+
+    MinMaxPyramid<Int> pyramid;
+
+    const auto appendStart = std::chrono::steady_clock::now();
+    for (Int i = 0; i < sampleCount; ++i)
+        pyramid.append(i, testSignal(i));
+    const auto appendTime = std::chrono::steady_clock::now() - appendStart;
+
+    std::vector<Point<Int>> points;
+    constexpr size_t queryCount = 100;
+    const auto queryStart = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < queryCount; ++i)
+    {
+        points.clear();
+        pyramid.queryPoints(0, sampleCount - 1, pixelWidth, points);
+    }
+    const auto queryTime = std::chrono::steady_clock::now() - queryStart;
+
+    const auto appendNs = std::chrono::duration_cast<std::chrono::nanoseconds>(appendTime).count();
+    const auto queryUs = std::chrono::duration_cast<std::chrono::microseconds>(queryTime).count();
+
+    RecordProperty("AppendNsPerSample", std::to_string(static_cast<double>(appendNs) / sampleCount));
+    RecordProperty("QueryUsPerFrame", std::to_string(static_cast<double>(queryUs) / queryCount));
+    RecordProperty("PointsPerFrame", std::to_string(points.size()));
+
+    // Frame cost is bounded by the output width, not by the number of samples
+    ASSERT_LE(points.size(), pixelWidth * 2);
+}
@@ -0,0 +1,176 @@
+#include <opendaq/module_ptr.h>
+#include <opendaq/opendaq.h>
+#include <ref_fb_module/module_dll.h>
+#include <chrono>
+#include <thread>
+#include "testutils/memcheck_listener.h"
+
+using namespace daq;
+
+using FbPipelineBenchmark = testing::Test;
+
+namespace
+{
+
+// Scaling -> Scaling -> Scaling -> Statistics, fed by a signal with a linear domain
+class PipelineHelper
+{
+public:
+    static constexpr SizeT PacketSize = 100;
+    static constexpr Int BlockSize = 10;
+
+    explicit PipelineHelper(bool multiThreaded)
+    {
+        const auto logger = Logger();
+        context = Context(Scheduler(logger), logger, nullptr, nullptr, nullptr);
+        createModule(&module, context);
+
+        domainDescriptor = DataDescriptorBuilder()
+                               .setSampleType(SampleType::Int64)
+                               .setRule(LinearDataRule(1, 0))
+                               .setTickResolution(Ratio(1, 1000))
+                               .setOrigin("1970")
+                               .setUnit(Unit("s", -1, "seconds", "Time"))
+                               .build();
+        domainSignal = SignalWithDescriptor(context, domainDescriptor, nullptr, "domain_signal");
+
+        descriptor = DataDescriptorBuilder()
+                         .setSampleType(SampleType::Float64)
+                         .setValueRange(Range(-10, 10))
+                         .setName("signal")
+                         .setRule(ExplicitDataRule())
+                         .build();
+        signal = SignalWithDescriptor(context, descriptor, nullptr, "signal");
+        signal.setDomainSignal(domainSignal);
+
+        SignalPtr input = signal;
+        for (int i = 0; i < 3; i++)
+        {
+            auto scaling = createFunctionBlock("RefFBModuleScaling", "scaling" + std::to_string(i), multiThreaded);
+            scaling.getInputPorts()[0].connect(input);
+            input = scaling.getSignals()[0];
+            fbs.push_back(scaling);
+        }
+
+        auto statistics = createFunctionBlock("RefFBModuleStatistics", "statistics", multiThreaded);
+        statistics.setPropertyValue("BlockSize", BlockSize);
+        statistics.getInputPorts()[0].connect(input);
+        fbs.push_back(statistics);
+
+        reader = PacketReader(statistics.getSignals()[0]);
+    }
+
+    ~PipelineHelper()
+    {
+        context.getScheduler().stop();
+    }
+
+    void send(SizeT packetCount)
+    {
+        for (SizeT i = 0; i < packetCount; i++)
+        {
+            auto domainPacket = DataPacket(domainDescriptor, PacketSize, static_cast<Int>(offset));
+            auto dataPacket = DataPacketWithDomain(domainPacket, descriptor, PacketSize);
+            auto data = static_cast<Float*>(dataPacket.getData());
+            for (SizeT j = 0; j < PacketSize; j++)
+                data[j] = static_cast<Float>((offset + j) % 10);
+            offset += PacketSize;
+
+            domainSignal.sendPacket(domainPacket);
+            signal.sendPacket(dataPacket);
+        }
+    }
+
+    // Reads until the output of the sent packets arrives; returns false on timeout.
+    bool receive(SizeT packetCount)
+    {
+        const SizeT expectedSamples = packetCount * PacketSize / BlockSize;
+        SizeT samples = 0;
+
+        const auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+        while (samples < expectedSamples)
+        {
+            const auto packet = reader.read();
+            if (!packet.assigned())
+            {
+                if (std::chrono::steady_clock::now() > timeout)
+                    return false;
+                std::this_thread::yield();
+                continue;
+            }
+
+            if (packet.getType() == PacketType::Data)
+                samples += packet.asPtr<IDataPacket>().getSampleCount();
+        }
+
+        return samples == expectedSamples;
+    }
+
+private:
+    FunctionBlockPtr createFunctionBlock(const StringPtr& typeId, const std::string& localId, bool multiThreaded)
+    {
+        auto config = module.getAvailableFunctionBlockTypes().get(typeId).createDefaultConfig();
+        config.setPropertyValue("UseMultiThreadedScheduler", multiThreaded);
+        return module.createFunctionBlock(typeId, nullptr, localId, config);
+    }
+
+    ContextPtr context;
+    ModulePtr module;
+    DataDescriptorPtr domainDescriptor;
+    DataDescriptorPtr descriptor;
+    SignalConfigPtr domainSignal;
+    SignalConfigPtr signal;
+    std::vector<FunctionBlockPtr> fbs;
+    PacketReaderPtr reader;
+    SizeT offset{0};
+};
+
+void measurePipeline(bool multiThreaded, const std::string& prefix)
+{
+    PipelineHelper helper(multiThreaded);
+
+    // the first packet configures the function blocks
+    helper.send(1);
+    ASSERT_TRUE(helper.receive(1));
+
+    constexpr SizeT LatencyRuns = 100;
+    std::chrono::steady_clock::duration maxLatency{};
+    std::chrono::steady_clock::duration totalLatency{};
+    for (SizeT i = 0; i < LatencyRuns; i++)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        helper.send(1);
+        ASSERT_TRUE(helper.receive(1));
+        const auto latency = std::chrono::steady_clock::now() - start;
+
+        totalLatency += latency;
+        maxLatency = std::max(maxLatency, latency);
+    }
+
+    constexpr SizeT ThroughputPackets = 2000;
+    const auto start = std::chrono::steady_clock::now();
+    helper.send(ThroughputPackets);
+    ASSERT_TRUE(helper.receive(ThroughputPackets));
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    using std::chrono::duration_cast;
+    using std::chrono::microseconds;
+    const auto elapsedUs = std::max<int64_t>(duration_cast<microseconds>(elapsed).count(), 1);
+
+    testing::Test::RecordProperty(prefix + "MeanLatencyUs", std::to_string(duration_cast<microseconds>(totalLatency).count() / LatencyRuns));
+    testing::Test::RecordProperty(prefix + "MaxLatencyUs", std::to_string(duration_cast<microseconds>(maxLatency).count()));
+    testing::Test::RecordProperty(prefix + "SamplesPerSecond",
+                                  std::to_string(ThroughputPackets * PipelineHelper::PacketSize * 1000000 / elapsedUs));
+}
+
+}
+
+TEST_F(FbPipelineBenchmark, SameThreadChain)
+{
+    measurePipeline(false, "SameThread");
+}
+
+TEST_F(FbPipelineBenchmark, SchedulerChain)
+{
+    measurePipeline(true, "Scheduler");
+}
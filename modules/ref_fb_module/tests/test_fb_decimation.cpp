@@ -0,0 +1,305 @@
+#include <opendaq/instance_factory.h>
+#include <opendaq/module_ptr.h>
+#include <opendaq/opendaq.h>
+#include <ref_fb_module/decimation.h>
+#include <ref_fb_module/module_dll.h>
+#include "testutils/memcheck_listener.h"
+#include <cmath>
+
+using namespace daq;
+using namespace daq::modules::ref_fb_module::Decimation;
+
+class DecimationTest : public testing::Test
+{
+};
+
+static double testSignal(Int i)
+{
+    // Slow sine with sparse single-sample spikes that must survive decimation
+    double value = std::sin(static_cast<double>(i) * 0.001);
+    if (i % 9973 == 0)
+        value += 5.0;
+    if (i % 7919 == 0)
+        value -= 5.0;
+    return value;
+}
+
+TEST_F(DecimationTest, PyramidMatchesBruteForce)
+{
+    MinMaxPyramid<Int> pyramid(20, 1024);
+
+    constexpr Int sampleCount = 100000;
+    for (Int i = 0; i < sampleCount; ++i)
+        pyramid.append(i, testSignal(i));
+
+    std::vector<MinMaxBucket<Int>> buckets;
+    pyramid.query(0, sampleCount - 1, 500, buckets);
+
+    ASSERT_FALSE(buckets.empty());
+    ASSERT_LE(buckets.size(), 500u);
+
+    size_t covered = 0;
+    for (const auto& bucket : buckets)
+    {
+        double expectedMin = testSignal(bucket.firstX);
+        double expectedMax = expectedMin;
+        for (Int i = bucket.firstX; i <= bucket.lastX; ++i)
+        {
+            expectedMin = std::min(expectedMin, testSignal(i));
+            expectedMax = std::max(expectedMax, testSignal(i));
+        }
+
+        ASSERT_DOUBLE_EQ(bucket.minY, expectedMin);
+        ASSERT_DOUBLE_EQ(bucket.maxY, expectedMax);
+        ASSERT_DOUBLE_EQ(testSignal(bucket.minX), bucket.minY);
+        ASSERT_DOUBLE_EQ(testSignal(bucket.maxX), bucket.maxY);
+        covered += bucket.count;
+    }
+
+    ASSERT_EQ(covered, static_cast<size_t>(sampleCount));
+}
+
+TEST_F(DecimationTest, PyramidFineLevelForNarrowRange)
+{
+    MinMaxPyramid<Int> pyramid;
+    for (Int i = 0; i < 10000; ++i)
+        pyramid.append(i * 10, testSignal(i));
+
+    std::vector<Point<Int>> points;
+    pyramid.queryPoints(90000, 90990, 1000, points);
+
+    ASSERT_EQ(pyramid.selectLevel(90000, 90990, 1000), 0u);
+    ASSERT_EQ(points.size(), 100u);
+    for (size_t i = 0; i < points.size(); ++i)
+    {
+        ASSERT_EQ(points[i].x, 90000 + static_cast<Int>(i) * 10);
+        ASSERT_DOUBLE_EQ(points[i].y, testSignal(9000 + static_cast<Int>(i)));
+    }
+}
+
+TEST_F(DecimationTest, PyramidIncludesPendingSamples)
+{
+    MinMaxPyramid<Int> pyramid;
+    for (Int i = 0; i < 1000; ++i)
+        pyramid.append(i, static_cast<double>(i));
+
+    // Coarse query must still reach the most recent sample
+    std::vector<MinMaxBucket<Int>> buckets;
+    pyramid.query(0, 999, 3, buckets);
+
+    ASSERT_FALSE(buckets.empty());
+    ASSERT_LE(buckets.size(), 3u);
+    ASSERT_EQ(buckets.back().lastX, 999);
+    ASSERT_DOUBLE_EQ(buckets.back().maxY, 999.0);
+    ASSERT_EQ(pyramid.getLastX(), 999);
+    ASSERT_DOUBLE_EQ(pyramid.getLastY(), 999.0);
+}
+
+TEST_F(DecimationTest, PyramidBoundedHistory)
+{
+    MinMaxPyramid<Int> pyramid(4, 16);
+    for (Int i = 0; i < 10000; ++i)
+        pyramid.append(i, static_cast<double>(i % 100));
+
+    // Only the coarsest level still reaches back to the start; the query falls back to it
+    std::vector<MinMaxBucket<Int>> buckets;
+    pyramid.query(0, 9999, 1000, buckets);
+
+    ASSERT_FALSE(buckets.empty());
+    ASSERT_LE(buckets.size(), 17u);
+    ASSERT_EQ(buckets.back().lastX, 9999);
+}
+
+TEST_F(DecimationTest, PyramidSegments)
+{
+    MinMaxPyramid<Int> pyramid;
+    for (Int i = 0; i < 10; ++i)
+        pyramid.append(i, 1.0);
+    pyramid.startSegment();
+    for (Int i = 100; i < 110; ++i)
+        pyramid.append(i, 2.0);
+
+    std::vector<Point<Int>> points;
+    pyramid.queryPoints(0, 110, 100, points);
+
+    ASSERT_EQ(points.size(), 20u);
+    ASSERT_FALSE(points[0].segmentStart);
+    ASSERT_TRUE(points[10].segmentStart);
+    ASSERT_EQ(points[10].x, 100);
+
+    // Coarser levels keep the segment start of the buckets they merge
+    std::vector<MinMaxBucket<Int>> buckets;
+    pyramid.query(0, 110, 4, buckets);
+
+    ASSERT_GE(pyramid.selectLevel(0, 110, 4), 1u);
+    ASSERT_FALSE(buckets.empty());
+    for (const auto& bucket : buckets)
+        ASSERT_EQ(bucket.segmentStart, bucket.firstX <= 100 && bucket.lastX >= 100);
+}
+
+TEST_F(DecimationTest, BucketMergeKeepsSegmentStart)
+{
+    MinMaxBucket<Int> first;
+    first.add(0, 1.0);
+
+    MinMaxBucket<Int> second;
+    second.add(10, 2.0);
+    second.segmentStart = true;
+
+    first.merge(second);
+    ASSERT_TRUE(first.segmentStart);
+    ASSERT_EQ(first.count, 2u);
+}
+
+TEST_F(DecimationTest, LttbKeepsEndpointsAndPeaks)
+{
+    std::vector<Point<Int>> input;
+    for (Int i = 0; i < 1000; ++i)
+        input.push_back({i, i == 500 ? 100.0 : 0.0, false});
+
+    std::vector<Point<Int>> output;
+    LargestTriangleThreeBuckets(input, 50, output);
+
+    ASSERT_EQ(output.size(), 50u);
+    ASSERT_EQ(output.front().x, 0);
+    ASSERT_EQ(output.back().x, 999);
+    ASSERT_TRUE(std::any_of(output.begin(), output.end(), [](const Point<Int>& p) { return p.x == 500; }));
+}
+
+TEST_F(DecimationTest, StreamingMinMax)
+{
+    StreamingDecimator<Int> decimator(DecimationMode::MinMax, 10);
+    std::vector<Point<Int>> output;
+    for (Int i = 0; i < 100; ++i)
+        decimator.append(i, i % 10 == 3 ? -1.0 : (i % 10 == 7 ? 1.0 : 0.0), output);
+
+    ASSERT_EQ(output.size(), 20u);
+    for (size_t i = 0; i < 10; ++i)
+    {
+        ASSERT_EQ(output[i * 2].x, static_cast<Int>(i * 10 + 3));
+        ASSERT_DOUBLE_EQ(output[i * 2].y, -1.0);
+        ASSERT_EQ(output[i * 2 + 1].x, static_cast<Int>(i * 10 + 7));
+        ASSERT_DOUBLE_EQ(output[i * 2 + 1].y, 1.0);
+    }
+}
+
+TEST_F(DecimationTest, StreamingMinMaxSegments)
+{
+    StreamingDecimator<Int> decimator(DecimationMode::MinMax, 10);
+    const auto value = [](Int i) { return i % 10 == 3 ? -1.0 : (i % 10 == 7 ? 1.0 : 0.0); };
+
+    std::vector<Point<Int>> output;
+    for (Int i = 0; i < 15; ++i)
+        decimator.append(i, value(i), output);
+    ASSERT_EQ(output.size(), 2u);
+
+    // The incomplete bucket is flushed instead of being merged with samples after the gap
+    decimator.startSegment(output);
+    ASSERT_EQ(output.size(), 4u);
+    ASSERT_EQ(output[2].x, 10);
+    ASSERT_EQ(output[3].x, 13);
+
+    for (Int i = 100; i < 110; ++i)
+        decimator.append(i, value(i), output);
+
+    ASSERT_EQ(output.size(), 6u);
+    for (size_t i = 0; i < 4; ++i)
+        ASSERT_FALSE(output[i].segmentStart);
+    ASSERT_TRUE(output[4].segmentStart);
+    ASSERT_EQ(output[4].x, 103);
+    ASSERT_FALSE(output[5].segmentStart);
+}
+
+TEST_F(DecimationTest, StreamingLttb)
+{
+    StreamingDecimator<Int> decimator(DecimationMode::Lttb, 10);
+    std::vector<Point<Int>> output;
+    for (Int i = 0; i < 101; ++i)
+        decimator.append(i, i == 55 ? 10.0 : 0.0, output);
+
+    // First sample plus one point per bucket, lagging by one bucket
+    ASSERT_EQ(output.size(), 10u);
+    ASSERT_EQ(output.front().x, 0);
+    ASSERT_TRUE(std::any_of(output.begin(), output.end(), [](const Point<Int>& p) { return p.x == 55; }));
+}
+
+TEST_F(DecimationTest, StreamingLttbSegments)
+{
+    StreamingDecimator<Int> decimator(DecimationMode::Lttb, 10);
+    std::vector<Point<Int>> output;
+    for (Int i = 0; i < 25; ++i)
+        decimator.append(i, i == 15 ? 10.0 : 0.0, output);
+    ASSERT_EQ(output.size(), 2u);
+
+    // The segment ends with its last sample, and the first sample after the gap is the new anchor
+    decimator.startSegment(output);
+    ASSERT_EQ(output.back().x, 24);
+    ASSERT_TRUE(std::any_of(output.begin(), output.end(), [](const Point<Int>& p) { return p.x == 15; }));
+
+    const size_t flushedCount = output.size();
+    decimator.append(100, 0.0, output);
+
+    ASSERT_EQ(output.size(), flushedCount + 1);
+    ASSERT_EQ(output.back().x, 100);
+    ASSERT_TRUE(output.back().segmentStart);
+    ASSERT_TRUE(std::none_of(output.begin(), output.end() - 1, [](const Point<Int>& p) { return p.segmentStart; }));
+}
+
+TEST_F(DecimationTest, FunctionBlockMinMax)
+{
+    const auto logger = Logger();
+    const auto context = Context(Scheduler(logger), logger, nullptr, nullptr, nullptr);
+    ModulePtr module;
+    createModule(&module, context);
+
+    const auto domainDescriptor = DataDescriptorBuilder()
+                                      .setSampleType(SampleType::Int64)
+                                      .setUnit(Unit("s", -1, "seconds", "time"))
+                                      .setRule(LinearDataRule(2, 0))
+                                      .setOrigin("1970")
+                                      .setTickResolution(Ratio(1, 1000))
+                                      .build();
+    const auto domainSignal = SignalWithDescriptor(context, domainDescriptor, nullptr, "domain_signal");
+
+    const auto valueDescriptor = DataDescriptorBuilder().setSampleType(SampleType::Float64).setValueRange(Range(-10, 10)).build();
+    const auto signal = SignalWithDescriptor(context, valueDescriptor, nullptr, "signal");
+    signal.setDomainSignal(domainSignal);
+
+    auto config = module.getAvailableFunctionBlockTypes().get("RefFBModuleDecimation").createDefaultConfig();
+    config.setPropertyValue("UseMultiThreadedScheduler", false);
+    const auto fb = module.createFunctionBlock("RefFBModuleDecimation", nullptr, "fb", config);
+    fb.setPropertyValue("BucketSize", 4);
+
+    fb.getInputPorts()[0].connect(signal);
+    const auto reader = PacketReader(fb.getSignals()[0]);
+
+    constexpr size_t sampleCount = 16;
+    const auto domainPacket = DataPacket(domainDescriptor, sampleCount, 0);
+    const auto dataPacket = DataPacketWithDomain(domainPacket, valueDescriptor, sampleCount);
+    auto data = static_cast<Float*>(dataPacket.getData());
+    for (size_t i = 0; i < sampleCount; ++i)
+        data[i] = i % 4 == 1 ? 5.0 : (i % 4 == 2 ? -5.0 : 0.0);
+
+    domainSignal.sendPacket(domainPacket);
+    signal.sendPacket(dataPacket);
+
+    DataPacketPtr received;
+    for (const auto& packet : reader.readAll())
+        if (packet.getType() == PacketType::Data)
+            received = packet;
+
+    ASSERT_TRUE(received.assigned());
+    ASSERT_EQ(received.getSampleCount(), 8u);
+
+    const auto values = static_cast<Float*>(received.getData());
+    const auto domain = static_cast<Int*>(received.getDomainPacket().getData());
+    for (size_t i = 0; i < 4; ++i)
+    {
+        ASSERT_DOUBLE_EQ(values[i * 2], 5.0);
+        ASSERT_EQ(domain[i * 2], static_cast<Int>((i * 4 + 1) * 2));
+        ASSERT_DOUBLE_EQ(values[i * 2 + 1], -5.0);
+        ASSERT_EQ(domain[i * 2 + 1], static_cast<Int>((i * 4 + 2) * 2));
+    }
+
+    context.getScheduler().stop();
+}
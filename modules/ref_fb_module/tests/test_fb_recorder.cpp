@@ -0,0 +1,162 @@
+#include <opendaq/module_ptr.h>
+#include <opendaq/opendaq.h>
+#include <columnar_recording/columnar_reader.h>
+#include <ref_fb_module/module_dll.h>
+#include "testutils/memcheck_listener.h"
+#include <filesystem>
+#include <map>
+
+using namespace daq;
+using namespace daq::columnar_recording;
+
+using RecorderFbTest = testing::Test;
+
+namespace
+{
+
+struct ReadColumn
+{
+    std::vector<uint8_t> values;
+    std::vector<format::Run> runs;
+    std::vector<std::pair<uint64_t, std::string>> records;
+    uint64_t sampleCount{0};
+};
+
+struct ReadFile
+{
+    std::vector<format::IndexEntry> index;
+    std::map<uint32_t, ReadColumn> columns;
+};
+
+// Reads the whole recording through the chunk index and concatenates the value columns of each signal.
+ReadFile readRecording(const std::string& fileName)
+{
+    ColumnarReader reader;
+    reader.open(fileName);
+
+    ReadFile file;
+    for (size_t i = 0; i < reader.getChunkCount(); i++)
+    {
+        const auto entries = reader.getIndexEntries(i);
+        file.index.insert(file.index.end(), entries.begin(), entries.end());
+
+        for (const auto& columnView : reader.getChunk(i).columns)
+        {
+            const auto& header = columnView.header;
+            auto& column = file.columns[header.signalIndex];
+
+            column.runs.insert(column.runs.end(), columnView.runs, columnView.runs + header.runCount);
+
+            std::vector<uint8_t> values(columnView.values, columnView.values + header.valuesSize);
+            if (header.valueEncoding == static_cast<uint8_t>(format::Encoding::Delta))
+            {
+                values.resize(header.sampleCount * header.valueSampleSize);
+                format::decodeDelta(columnView.values, header.valuesSize, header.sampleCount, header.valueSampleSize, values.data());
+            }
+            column.values.insert(column.values.end(), values.begin(), values.end());
+
+            for (const auto& record : columnView.getRecords())
+                column.records.emplace_back(column.sampleCount + record.sampleIndex, std::string(record.payload));
+
+            column.sampleCount += header.sampleCount;
+        }
+    }
+
+    return file;
+}
+
+std::string tempFileName(const std::string& name)
+{
+    return (std::filesystem::temp_directory_path() / name).string();
+}
+
+}
+
+TEST_F(RecorderFbTest, RecordSignal)
+{
+    const auto logger = Logger();
+    const auto context = Context(Scheduler(logger), logger, nullptr, nullptr, nullptr);
+    ModulePtr module;
+    createModule(&module, context);
+
+    const auto domainDescriptor = DataDescriptorBuilder()
+                                      .setSampleType(SampleType::Int64)
+                                      .setRule(LinearDataRule(1, 0))
+                                      .setTickResolution(Ratio(1, 1000))
+                                      .setOrigin("1970")
+                                      .setUnit(Unit("s", -1, "seconds", "Time"))
+                                      .build();
+    const auto domainSignal = SignalWithDescriptor(context, domainDescriptor, nullptr, "domain_signal");
+    const auto descriptor = DataDescriptorBuilder().setSampleType(SampleType::Int32).setRule(ExplicitDataRule()).build();
+    const auto signal = SignalWithDescriptor(context, descriptor, nullptr, "signal");
+    signal.setDomainSignal(domainSignal);
+
+    auto config = module.getAvailableFunctionBlockTypes().get("RefFBModuleRecorder").createDefaultConfig();
+    config.setPropertyValue("UseMultiThreadedScheduler", false);
+    const auto fb = module.createFunctionBlock("RefFBModuleRecorder", nullptr, "recorder", config);
+
+    ASSERT_EQ(fb.getInputPorts().getCount(), 1u);
+    fb.getInputPorts()[0].connect(signal);
+    ASSERT_EQ(fb.getInputPorts().getCount(), 2u);
+
+    const auto fileName = tempFileName("test_fb_recorder.daqrec");
+    fb.setPropertyValue("FileName", fileName);
+    fb.setPropertyValue("Compression", true);
+    fb.setPropertyValue("Recording", true);
+    ASSERT_TRUE(fb.getPropertyValue("Recording"));
+
+    constexpr size_t PacketSize = 100;
+    std::vector<int32_t> values;
+    for (size_t i = 0; i < 10; i++)
+    {
+        const auto domainPacket = DataPacket(domainDescriptor, PacketSize, static_cast<Int>(i * PacketSize));
+        const auto dataPacket = DataPacketWithDomain(domainPacket, descriptor, PacketSize);
+        const auto data = static_cast<int32_t*>(dataPacket.getData());
+        for (size_t j = 0; j < PacketSize; j++)
+        {
+            data[j] = static_cast<int32_t>(i * PacketSize + j) % 50;
+            values.push_back(data[j]);
+        }
+
+        domainSignal.sendPacket(domainPacket);
+        signal.sendPacket(dataPacket);
+    }
+
+    fb.setPropertyValue("Recording", false);
+
+    const auto file = readRecording(fileName);
+    ASSERT_FALSE(file.index.empty());
+    ASSERT_EQ(file.index.front().firstTick, 0);
+    ASSERT_EQ(file.index.back().lastTick, 999);
+
+    const auto& column = file.columns.at(0);
+    ASSERT_EQ(column.sampleCount, values.size());
+    ASSERT_EQ(std::memcmp(column.values.data(), values.data(), column.values.size()), 0);
+    ASSERT_EQ(column.runs.size(), 10u);
+    ASSERT_EQ(column.runs[3].domainOffset, 300);
+
+    ASSERT_GE(column.records.size(), 2u);
+    ASSERT_EQ(column.records[0], std::make_pair(uint64_t(0), signal.getGlobalId().toStdString()));
+    ASSERT_NE(column.records[1].second.find("DATA_DESCRIPTOR_CHANGED"), std::string::npos);
+
+    fb.getInputPorts()[0].disconnect();
+    ASSERT_EQ(fb.getInputPorts().getCount(), 1u);
+
+    std::filesystem::remove(fileName);
+    context.getScheduler().stop();
+}
+
+TEST_F(RecorderFbTest, InvalidFileName)
+{
+    const auto logger = Logger();
+    const auto context = Context(Scheduler(logger), logger, nullptr, nullptr, nullptr);
+    ModulePtr module;
+    createModule(&module, context);
+
+    const auto fb = module.createFunctionBlock("RefFBModuleRecorder", nullptr, "recorder");
+    fb.setPropertyValue("FileName", (std::filesystem::temp_directory_path() / "missing_directory" / "file.daqrec").string());
+    fb.setPropertyValue("Recording", true);
+    ASSERT_FALSE(fb.getPropertyValue("Recording"));
+
+    context.getScheduler().stop();
+}
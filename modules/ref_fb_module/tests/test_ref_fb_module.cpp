@@ -10,6 +10,7 @@
 #include <thread>
 #include "testutils/memcheck_listener.h"
 #include <opendaq/instance_factory.h>
+#include <opendaq/opendaq.h>
 
 using RefFbModuleTest = testing::Test;
 using namespace daq;
@@ -78,7 +79,7 @@ TEST_F(RefFbModuleTest, GetAvailableComponentTypes)
     DictPtr<IString, IFunctionBlockType> functionBlockTypes;
     ASSERT_NO_THROW(functionBlockTypes = module.getAvailableFunctionBlockTypes());
     ASSERT_TRUE(functionBlockTypes.assigned());
-    ASSERT_EQ(functionBlockTypes.getCount(), 8u);
+    ASSERT_EQ(functionBlockTypes.getCount(), 10u);
 
     ASSERT_TRUE(functionBlockTypes.hasKey("RefFBModuleRenderer"));
     ASSERT_EQ("RefFBModuleRenderer", functionBlockTypes.get("RefFBModuleRenderer").getId());
@@ -100,6 +101,12 @@ TEST_F(RefFbModuleTest, GetAvailableComponentTypes)
 
     ASSERT_TRUE(functionBlockTypes.hasKey("RefFBModuleTrigger"));
     ASSERT_EQ("RefFBModuleTrigger", functionBlockTypes.get("RefFBModuleTrigger").getId());
+
+    ASSERT_TRUE(functionBlockTypes.hasKey("RefFBModuleDecimation"));
+    ASSERT_EQ("RefFBModuleDecimation", functionBlockTypes.get("RefFBModuleDecimation").getId());
+
+    ASSERT_TRUE(functionBlockTypes.hasKey("RefFBModuleRecorder"));
+    ASSERT_EQ("RefFBModuleRecorder", functionBlockTypes.get("RefFBModuleRecorder").getId());
 }
 
 TEST_F(RefFbModuleTest, CreateFunctionBlockNotFound)
@@ -153,6 +160,75 @@ TEST_F(RefFbModuleTest, createFunctionBlockTrigger)
     ASSERT_TRUE(fb.assigned());
 }
 
+TEST_F(RefFbModuleTest, CreateFunctionBlockDecimation)
+{
+    const auto module = CreateModule();
+
+    auto fb = module.createFunctionBlock("RefFBModuleDecimation", nullptr, "Id");
+    ASSERT_TRUE(fb.assigned());
+    ASSERT_EQ(fb.getSignals(search::Recursive(search::Any())).getCount(), 2u);
+}
+
+TEST_F(RefFbModuleTest, ScalingSameThread)
+{
+    const auto logger = Logger();
+    const auto context = Context(Scheduler(logger), logger, nullptr, nullptr, nullptr);
+    ModulePtr module;
+    createModule(&module, context);
+
+    auto config = module.getAvailableFunctionBlockTypes().get("RefFBModuleScaling").createDefaultConfig();
+    config.setPropertyValue("UseMultiThreadedScheduler", false);
+    const auto fb = module.createFunctionBlock("RefFBModuleScaling", nullptr, "scaling", config);
+    fb.setPropertyValue("scale", 2.0);
+
+    const auto domainDescriptor = DataDescriptorBuilder()
+                                      .setSampleType(SampleType::Int64)
+                                      .setRule(LinearDataRule(1, 0))
+                                      .setTickResolution(Ratio(1, 1000))
+                                      .setOrigin("1970")
+                                      .setUnit(Unit("s", -1, "seconds", "Time"))
+                                      .build();
+    const auto descriptor = DataDescriptorBuilder().setSampleType(SampleType::Float64).setValueRange(Range(-10, 10)).build();
+    const auto domainSignal = SignalWithDescriptor(context, domainDescriptor, nullptr, "domain_signal");
+    const auto signal = SignalWithDescriptor(context, descriptor, nullptr, "signal");
+    signal.setDomainSignal(domainSignal);
+
+    fb.getInputPorts()[0].connect(signal);
+    const auto reader = PacketReader(fb.getSignals()[0]);
+
+    const auto domainPacket = DataPacket(domainDescriptor, 4, 0);
+    const auto dataPacket = DataPacketWithDomain(domainPacket, descriptor, 4);
+    auto data = static_cast<Float*>(dataPacket.getData());
+    for (size_t i = 0; i < 4; i++)
+        data[i] = static_cast<Float>(i);
+    domainSignal.sendPacket(domainPacket);
+    signal.sendPacket(dataPacket);
+
+    // the packet is scaled on this thread, so the output is available without waiting for the scheduler
+    DataPacketPtr output;
+    for (auto packet = reader.read(); packet.assigned(); packet = reader.read())
+        if (packet.getType() == PacketType::Data)
+            output = packet;
+
+    ASSERT_TRUE(output.assigned());
+    ASSERT_EQ(output.getSampleCount(), 4u);
+    const auto outputData = static_cast<Float*>(output.getData());
+    for (size_t i = 0; i < 4; i++)
+        ASSERT_DOUBLE_EQ(outputData[i], 2.0 * static_cast<Float>(i));
+
+    context.getScheduler().stop();
+}
+
+TEST_F(RefFbModuleTest, CreateFunctionBlockRecorder)
+{
+    const auto module = CreateModule();
+
+    auto fb = module.createFunctionBlock("RefFBModuleRecorder", nullptr, "Id");
+    ASSERT_TRUE(fb.assigned());
+    ASSERT_EQ(fb.getInputPorts().getCount(), 1u);
+    ASSERT_EQ(fb.getSignals(search::Recursive(search::Any())).getCount(), 0u);
+}
+
 TEST_F(RefFbModuleTest, AddFunctionBlockBackwardsCompat)
 {
     const auto instance = Instance();
@@ -0,0 +1,25 @@
+/*
+ * Copyright 2022-2024 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+#include <coretypes/common.h>
+
+#define BEGIN_NAMESPACE_REPLAY_DEVICE_MODULE BEGIN_NAMESPACE_OPENDAQ_MODULE(replay_device_module)
+
+static const std::string REPLAY_MODULE_NAME = "ReplayDevice";
+
+#define END_NAMESPACE_REPLAY_DEVICE_MODULE END_NAMESPACE_OPENDAQ_MODULE
@@ -0,0 +1,163 @@
+/*
+ * Copyright 2022-2024 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+#include <columnar_recording/columnar_reader.h>
+#include <replay_device_module/common.h>
+#include <coretypes/deserializer_ptr.h>
+#include <opendaq/device_impl.h>
+#include <opendaq/logger_ptr.h>
+#include <opendaq/logger_component_ptr.h>
+#include <opendaq/signal_config_ptr.h>
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <thread>
+
+BEGIN_NAMESPACE_REPLAY_DEVICE_MODULE
+
+enum class PlaybackMode : Int
+{
+    RealTime = 0,
+    Accelerated = 1,
+    AsFastAsPossible = 2
+};
+
+/*!
+ * @brief Plays back a recording of the reference Recorder function block.
+ *
+ * Each recorded signal is exposed with its domain signal and the descriptors it was recorded with. The
+ * recording file is mapped read-only into memory, and raw encoded samples are sent in packets that point
+ * into the mapping instead of copies; such packets must not be written to. With the "WritablePackets"
+ * configuration, raw samples are copied into new packets instead, as delta encoded samples always are.
+ * Samples are sent on a playback thread, one recorded packet at a time, paced by their domain values in
+ * the real-time and accelerated modes.
+ */
+class ReplayDeviceImpl final : public Device
+{
+public:
+    explicit ReplayDeviceImpl(const std::string& fileName,
+                              const PropertyObjectPtr& config,
+                              const ContextPtr& ctx,
+                              const ComponentPtr& parent,
+                              const StringPtr& localId,
+                              const StringPtr& name = nullptr);
+    ~ReplayDeviceImpl() override;
+
+    static DeviceInfoPtr CreateDeviceInfo(const std::string& fileName);
+    static DeviceTypePtr CreateType();
+
+    // IDevice
+    DeviceInfoPtr onGetInfo() override;
+
+    bool allowAddFunctionBlocksFromModules() override;
+
+private:
+    struct DescriptorChange
+    {
+        size_t chunkIndex;
+        DataDescriptorPtr dataDescriptor;
+        DataDescriptorPtr domainDataDescriptor;
+    };
+
+    struct ReplaySignal
+    {
+        std::string globalId;
+        SignalConfigPtr valueSignal;
+        SignalConfigPtr domainSignal;
+        DataDescriptorPtr dataDescriptor;
+        DataDescriptorPtr domainDataDescriptor;
+        bool linearDomain{false};
+        Int domainStart{0};
+        Int domainDelta{0};
+        double tickResolution{0.0};
+        std::vector<DescriptorChange> descriptorChanges;
+    };
+
+    // a recorded packet of the current chunk
+    struct RunRef
+    {
+        size_t column;
+        size_t run;
+        uint64_t sampleIndex;
+        uint64_t valueOffset;
+        uint64_t domainOffset;
+        bool hasTime;
+        int64_t firstTick;
+        int64_t lastTick;
+    };
+
+    struct ColumnState
+    {
+        std::vector<uint8_t> decodedValues;
+        std::vector<uint8_t> decodedDomain;
+        std::vector<columnar_recording::RecordView> records;
+        size_t nextRecord{0};
+        // events that precede this sample were skipped by a seek; only their descriptors are applied
+        uint64_t eventsFrom{0};
+    };
+
+    void initProperties(const PropertyObjectPtr& config);
+    void readProperties();
+    void seek();
+    void scanRecording();
+    void createSignals();
+
+    ReplaySignal* getReplaySignal(uint32_t signalIndex);
+    void applyDescriptors(ReplaySignal& signal, const DataDescriptorPtr& dataDescriptor, const DataDescriptorPtr& domainDataDescriptor);
+    void applyDescriptorsAt(size_t chunkIndex);
+
+    void playbackLoop();
+    size_t findChunk(double seconds) const;
+    void loadChunk(double fromSeconds);
+    bool waitForRun(std::unique_lock<std::mutex>& lock, const RunRef& run);
+    void playRecords(size_t columnIndex, uint64_t untilSample);
+    void playRun(const RunRef& run);
+
+    std::string fileName;
+    bool writablePackets;
+    columnar_recording::ColumnarReader reader;
+    std::map<uint32_t, ReplaySignal> replaySignals;
+    DeserializerPtr deserializer;
+
+    std::thread playbackThread;
+    std::mutex playbackSync;
+    std::condition_variable playbackCv;
+    bool stopPlayback;
+    bool playing;
+    bool loop;
+    PlaybackMode mode;
+    double speed;
+    bool seekRequested;
+    double seekSeconds;
+    bool finished;
+    bool paceValid;
+    std::chrono::steady_clock::time_point paceStartTime;
+    double paceStartSeconds;
+
+    // used by the playback thread only
+    size_t chunkIndex;
+    columnar_recording::ChunkView chunk;
+    std::vector<ColumnState> columnStates;
+    std::vector<RunRef> runs;
+    size_t nextRun;
+
+    LoggerPtr logger;
+    LoggerComponentPtr loggerComponent;
+};
+
+END_NAMESPACE_REPLAY_DEVICE_MODULE
@@ -0,0 +1,37 @@
+/*
+ * Copyright 2022-2024 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+#include <replay_device_module/common.h>
+#include <opendaq/module_impl.h>
+
+BEGIN_NAMESPACE_REPLAY_DEVICE_MODULE
+
+class ReplayDeviceModule final : public Module
+{
+public:
+    explicit ReplayDeviceModule(ContextPtr context);
+
+    ListPtr<IDeviceInfo> onGetAvailableDevices() override;
+    DictPtr<IString, IDeviceType> onGetAvailableDeviceTypes() override;
+    DevicePtr onCreateDevice(const StringPtr& connectionString, const ComponentPtr& parent, const PropertyObjectPtr& config) override;
+
+private:
+    std::string getFileNameFromConnectionString(const std::string& connectionString) const;
+};
+
+END_NAMESPACE_REPLAY_DEVICE_MODULE
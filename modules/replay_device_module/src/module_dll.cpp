@@ -0,0 +1,8 @@
+#include <replay_device_module/module_dll.h>
+#include <replay_device_module/replay_device_module_impl.h>
+
+#include <opendaq/module_factory.h>
+
+using namespace daq::modules::replay_device_module;
+
+DEFINE_MODULE_EXPORTS(ReplayDeviceModule)
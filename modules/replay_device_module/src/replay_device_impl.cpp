@@ -0,0 +1,675 @@
+#include <replay_device_module/replay_device_impl.h>
+#include <coreobjects/eval_value_factory.h>
+#include <coretypes/json_deserializer_factory.h>
+#include <opendaq/custom_log.h>
+#include <opendaq/deleter_factory.h>
+#include <opendaq/device_info_factory.h>
+#include <opendaq/device_type_factory.h>
+#include <opendaq/event_packet_ids.h>
+#include <opendaq/event_packet_params.h>
+#include <opendaq/packet_factory.h>
+#include <fmt/format.h>
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <limits>
+
+BEGIN_NAMESPACE_REPLAY_DEVICE_MODULE
+
+namespace format = columnar_recording::format;
+
+namespace
+{
+
+constexpr double RecordingStart = -std::numeric_limits<double>::infinity();
+
+// the first tick at or after `seconds` in a domain with the given tick resolution
+int64_t secondsToTick(double seconds, double tickResolution)
+{
+    const double tick = std::ceil(seconds / tickResolution);
+    if (tick <= static_cast<double>(std::numeric_limits<int64_t>::min()))
+        return std::numeric_limits<int64_t>::min();
+    if (tick >= static_cast<double>(std::numeric_limits<int64_t>::max()))
+        return std::numeric_limits<int64_t>::max();
+    return static_cast<int64_t>(tick);
+}
+
+DataPacketPtr createPacket(const DataPacketPtr& domainPacket,
+                           const DataDescriptorPtr& descriptor,
+                           uint64_t sampleCount,
+                           const uint8_t* mappedData,
+                           const uint8_t* data,
+                           size_t size,
+                           const std::shared_ptr<columnar_recording::FileMapping>& mapping)
+{
+    // raw samples are sent in place; each packet keeps the read-only mapping of the file alive
+    if (mappedData)
+        return DataPacketWithExternalMemory(domainPacket,
+                                            descriptor,
+                                            sampleCount,
+                                            const_cast<uint8_t*>(mappedData),
+                                            Deleter([mapping = mapping](void*) mutable { mapping.reset(); }),
+                                            nullptr,
+                                            size);
+
+    auto packet = domainPacket.assigned() ? DataPacketWithDomain(domainPacket, descriptor, sampleCount) : DataPacket(descriptor, sampleCount);
+    std::memcpy(packet.getRawData(), data, std::min<size_t>(size, packet.getRawDataSize()));
+    return packet;
+}
+
+}
+
+ReplayDeviceImpl::ReplayDeviceImpl(const std::string& fileName,
+                                   const PropertyObjectPtr& config,
+                                   const ContextPtr& ctx,
+                                   const ComponentPtr& parent,
+                                   const StringPtr& localId,
+                                   const StringPtr& name)
+    : GenericDevice<>(ctx, parent, localId, nullptr, name)
+    , fileName(fileName)
+    , writablePackets(false)
+    , deserializer(JsonDeserializer())
+    , stopPlayback(false)
+    , playing(false)
+    , loop(false)
+    , mode(PlaybackMode::RealTime)
+    , speed(1.0)
+    , seekRequested(true)
+    , seekSeconds(RecordingStart)
+    , finished(false)
+    , paceValid(false)
+    , paceStartSeconds(0.0)
+    , chunkIndex(0)
+    , nextRun(0)
+    , logger(ctx.getLogger())
+    , loggerComponent(this->logger.assigned() ? this->logger.getOrAddComponent(REPLAY_MODULE_NAME)
+                                              : throw ArgumentNullException("Logger must not be null"))
+{
+    try
+    {
+        reader.open(fileName);
+    }
+    catch (const std::exception& e)
+    {
+        throw NotFoundException("Failed to open recording \"{}\": {}", fileName, e.what());
+    }
+
+    // the configuration is fixed for the lifetime of the device, as sent packets cannot be changed afterwards
+    if (config.assigned() && config.hasProperty("WritablePackets"))
+        writablePackets = config.getPropertyValue("WritablePackets");
+
+    scanRecording();
+    createSignals();
+    initProperties(config);
+
+    playbackThread = std::thread{&ReplayDeviceImpl::playbackLoop, this};
+}
+
+ReplayDeviceImpl::~ReplayDeviceImpl()
+{
+    {
+        std::scoped_lock lock(playbackSync);
+        stopPlayback = true;
+    }
+    playbackCv.notify_all();
+
+    playbackThread.join();
+}
+
+DeviceInfoPtr ReplayDeviceImpl::CreateDeviceInfo(const std::string& fileName)
+{
+    auto devInfo = DeviceInfo("daqreplay://" + fileName);
+    devInfo.setName(std::filesystem::path(fileName).stem().string());
+    devInfo.setManufacturer("openDAQ");
+    devInfo.setModel("Replay device");
+    devInfo.setSerialNumber(fileName);
+    devInfo.setDeviceType(CreateType());
+
+    return devInfo;
+}
+
+DeviceTypePtr ReplayDeviceImpl::CreateType()
+{
+    auto defaultConfig = PropertyObject();
+    defaultConfig.addProperty(SelectionProperty("Mode", List<IString>("RealTime", "Accelerated", "AsFastAsPossible"), 0));
+    defaultConfig.addProperty(FloatProperty("Speed", 2.0));
+    defaultConfig.addProperty(BoolProperty("Playing", True));
+    defaultConfig.addProperty(BoolProperty("Loop", False));
+    defaultConfig.addProperty(BoolProperty("WritablePackets", False));
+
+    return DeviceType("daqreplay",
+                      "Replay device",
+                      "Plays back recordings of the Recorder function block",
+                      "daqreplay",
+                      defaultConfig);
+}
+
+DeviceInfoPtr ReplayDeviceImpl::onGetInfo()
+{
+    auto deviceInfo = ReplayDeviceImpl::CreateDeviceInfo(fileName);
+    deviceInfo.freeze();
+    return deviceInfo;
+}
+
+bool ReplayDeviceImpl::allowAddFunctionBlocksFromModules()
+{
+    return true;
+}
+
+void ReplayDeviceImpl::initProperties(const PropertyObjectPtr& config)
+{
+    Int modeValue = 0;
+    Float speedValue = 2.0;
+    bool playingValue = true;
+    bool loopValue = false;
+
+    if (config.assigned())
+    {
+        if (config.hasProperty("Mode"))
+            modeValue = config.getPropertyValue("Mode");
+        if (config.hasProperty("Speed"))
+            speedValue = config.getPropertyValue("Speed");
+        if (config.hasProperty("Playing"))
+            playingValue = config.getPropertyValue("Playing");
+        if (config.hasProperty("Loop"))
+            loopValue = config.getPropertyValue("Loop");
+    }
+
+    objPtr.addProperty(SelectionProperty("Mode", List<IString>("RealTime", "Accelerated", "AsFastAsPossible"), modeValue));
+    objPtr.getOnPropertyValueWrite("Mode") += [this](PropertyObjectPtr& /*obj*/, PropertyValueEventArgsPtr& /*args*/) { readProperties(); };
+
+    const auto speedProp = FloatPropertyBuilder("Speed", speedValue).setMinValue(0.01).setMaxValue(1000.0).setVisible(EvalValue("$Mode == 1")).build();
+    objPtr.addProperty(speedProp);
+    objPtr.getOnPropertyValueWrite("Speed") += [this](PropertyObjectPtr& /*obj*/, PropertyValueEventArgsPtr& /*args*/) { readProperties(); };
+
+    objPtr.addProperty(BoolProperty("Playing", playingValue));
+    objPtr.getOnPropertyValueWrite("Playing") += [this](PropertyObjectPtr& /*obj*/, PropertyValueEventArgsPtr& /*args*/) { readProperties(); };
+
+    objPtr.addProperty(BoolProperty("Loop", loopValue));
+    objPtr.getOnPropertyValueWrite("Loop") += [this](PropertyObjectPtr& /*obj*/, PropertyValueEventArgsPtr& /*args*/) { readProperties(); };
+
+    // position from which playback continues, in seconds of the recorded domains (domain values multiplied
+    // by their tick resolution); each signal is located in its own domain
+    objPtr.addProperty(FloatProperty("SeekPosition", 0.0));
+    objPtr.getOnPropertyValueWrite("SeekPosition") += [this](PropertyObjectPtr& /*obj*/, PropertyValueEventArgsPtr& /*args*/) { seek(); };
+
+    readProperties();
+}
+
+void ReplayDeviceImpl::readProperties()
+{
+    const Int modeValue = objPtr.getPropertyValue("Mode");
+    const Float speedValue = objPtr.getPropertyValue("Speed");
+    const bool playingValue = objPtr.getPropertyValue("Playing");
+    const bool loopValue = objPtr.getPropertyValue("Loop");
+    LOG_I("Properties: Mode {}, Speed {}, Playing {}, Loop {}", modeValue, speedValue, playingValue, loopValue);
+
+    {
+        std::scoped_lock lock(playbackSync);
+
+        // playing a recording that has finished starts it from the beginning
+        if (playingValue && !playing && finished)
+        {
+            seekRequested = true;
+            seekSeconds = RecordingStart;
+        }
+
+        mode = static_cast<PlaybackMode>(modeValue);
+        speed = std::max(speedValue, 0.01);
+        playing = playingValue;
+        loop = loopValue;
+        paceValid = false;
+    }
+
+    playbackCv.notify_all();
+}
+
+void ReplayDeviceImpl::seek()
+{
+    const Float position = objPtr.getPropertyValue("SeekPosition");
+    LOG_I("Properties: SeekPosition {}", position);
+
+    {
+        std::scoped_lock lock(playbackSync);
+        seekRequested = true;
+        seekSeconds = position;
+    }
+
+    playbackCv.notify_all();
+}
+
+void ReplayDeviceImpl::scanRecording()
+{
+    // only the records of the chunks are read; the signals are described at the start of the recording
+    for (size_t i = 0; i < reader.getChunkCount(); i++)
+    {
+        columnar_recording::ChunkView chunkView;
+        try
+        {
+            chunkView = reader.getChunk(i);
+        }
+        catch (const std::exception& e)
+        {
+            LOG_W("Failed to read chunk {} of the recording: {}", i, e.what());
+            continue;
+        }
+
+        for (const auto& column : chunkView.columns)
+        {
+            auto& signal = replaySignals[column.header.signalIndex];
+
+            for (const auto& record : column.getRecords())
+            {
+                if (record.kind == format::RecordKind::SignalInfo)
+                {
+                    if (signal.globalId.empty())
+                        signal.globalId = std::string(record.payload);
+                    continue;
+                }
+
+                try
+                {
+                    const EventPacketPtr packet = deserializer.deserialize(String(std::string(record.payload)));
+                    if (packet.getEventId() != event_packet_id::DATA_DESCRIPTOR_CHANGED)
+                        continue;
+
+                    const auto params = packet.getParameters();
+                    signal.descriptorChanges.push_back(
+                        {i, params.get(event_packet_param::DATA_DESCRIPTOR), params.get(event_packet_param::DOMAIN_DATA_DESCRIPTOR)});
+                }
+                catch (const std::exception& e)
+                {
+                    LOG_W("Failed to read an event of recorded signal {}: {}", column.header.signalIndex, e.what());
+                }
+            }
+        }
+    }
+}
+
+void ReplayDeviceImpl::createSignals()
+{
+    for (auto& [index, signal] : replaySignals)
+    {
+        const auto localId = fmt::format("Signal{}", index);
+        signal.valueSignal = createAndAddSignal(localId);
+
+        const auto hasDomain = std::any_of(signal.descriptorChanges.begin(),
+                                           signal.descriptorChanges.end(),
+                                           [](const DescriptorChange& change) { return change.domainDataDescriptor.assigned(); });
+        if (hasDomain)
+        {
+            signal.domainSignal = createAndAddSignal(localId + "Domain", nullptr, false);
+            signal.valueSignal.setDomainSignal(signal.domainSignal);
+        }
+
+        if (!signal.globalId.empty())
+        {
+            signal.valueSignal.setName(signal.globalId.substr(signal.globalId.find_last_of('/') + 1));
+            signal.valueSignal.setDescription("Replay of " + signal.globalId);
+        }
+    }
+
+    applyDescriptorsAt(0);
+}
+
+ReplayDeviceImpl::ReplaySignal* ReplayDeviceImpl::getReplaySignal(uint32_t signalIndex)
+{
+    const auto it = replaySignals.find(signalIndex);
+    return it != replaySignals.end() ? &it->second : nullptr;
+}
+
+void ReplayDeviceImpl::applyDescriptors(ReplaySignal& signal, const DataDescriptorPtr& dataDescriptor, const DataDescriptorPtr& domainDataDescriptor)
+{
+    if (domainDataDescriptor.assigned() && signal.domainSignal.assigned() &&
+        !BaseObjectPtr::Equals(domainDataDescriptor, signal.domainDataDescriptor))
+    {
+        signal.domainDataDescriptor = domainDataDescriptor;
+        signal.domainSignal.setDescriptor(domainDataDescriptor);
+
+        signal.linearDomain = false;
+        signal.tickResolution = 0.0;
+
+        const auto rule = domainDataDescriptor.getRule();
+        if (rule.assigned() && rule.getType() == DataRuleType::Linear)
+        {
+            const auto params = rule.getParameters();
+            signal.domainDelta = static_cast<Int>(params.get("delta"));
+            signal.domainStart = params.hasKey("start") ? static_cast<Int>(params.get("start")) : 0;
+            signal.linearDomain = true;
+        }
+
+        const auto resolution = domainDataDescriptor.getTickResolution();
+        if (resolution.assigned() && resolution.getDenominator() != 0)
+            signal.tickResolution = static_cast<double>(resolution.getNumerator()) / static_cast<double>(resolution.getDenominator());
+    }
+
+    if (dataDescriptor.assigned() && !BaseObjectPtr::Equals(dataDescriptor, signal.dataDescriptor))
+    {
+        signal.dataDescriptor = dataDescriptor;
+        signal.valueSignal.setDescriptor(dataDescriptor);
+    }
+}
+
+void ReplayDeviceImpl::applyDescriptorsAt(size_t chunkIndex)
+{
+    // the descriptors in effect before the chunk; a signal that starts later gets its first descriptors
+    for (auto& [index, signal] : replaySignals)
+    {
+        DataDescriptorPtr dataDescriptor;
+        DataDescriptorPtr domainDataDescriptor;
+
+        for (const auto& change : signal.descriptorChanges)
+        {
+            if (change.chunkIndex >= chunkIndex && (dataDescriptor.assigned() || domainDataDescriptor.assigned()))
+                break;
+
+            if (change.dataDescriptor.assigned())
+                dataDescriptor = change.dataDescriptor;
+            if (change.domainDataDescriptor.assigned())
+                domainDataDescriptor = change.domainDataDescriptor;
+        }
+
+        applyDescriptors(signal, dataDescriptor, domainDataDescriptor);
+    }
+}
+
+void ReplayDeviceImpl::playbackLoop()
+{
+    std::unique_lock lock(playbackSync);
+
+    while (!stopPlayback)
+    {
+        if (seekRequested)
+        {
+            const double seconds = seekSeconds;
+            seekRequested = false;
+            finished = false;
+            paceValid = false;
+            lock.unlock();
+
+            chunkIndex = seconds == RecordingStart ? 0 : findChunk(seconds);
+            applyDescriptorsAt(chunkIndex);
+            loadChunk(seconds);
+
+            lock.lock();
+            continue;
+        }
+
+        if (!playing || finished)
+        {
+            playbackCv.wait(lock);
+            continue;
+        }
+
+        if (nextRun >= runs.size())
+        {
+            const bool restart = loop && reader.getChunkCount() > 0;
+            lock.unlock();
+
+            for (size_t i = 0; i < columnStates.size(); i++)
+                playRecords(i, std::numeric_limits<uint64_t>::max());
+
+            chunkIndex++;
+            if (chunkIndex >= reader.getChunkCount() && restart)
+            {
+                chunkIndex = 0;
+                applyDescriptorsAt(0);
+            }
+
+            loadChunk(RecordingStart);
+
+            lock.lock();
+            if (chunkIndex >= reader.getChunkCount())
+                finished = true;
+            else if (chunkIndex == 0)
+                paceValid = false;
+            continue;
+        }
+
+        const auto& run = runs[nextRun];
+        if (!waitForRun(lock, run))
+            continue;
+
+        nextRun++;
+        lock.unlock();
+
+        playRecords(run.column, run.sampleIndex);
+        playRun(run);
+
+        lock.lock();
+    }
+}
+
+size_t ReplayDeviceImpl::findChunk(double seconds) const
+{
+    // playback resumes with the first chunk that has samples of any signal at or after the position; the
+    // domain ranges of the index are in ticks of each signal, so the position is converted for each of them
+    size_t result = reader.getChunkCount();
+    for (const auto& [index, signal] : replaySignals)
+        if (signal.tickResolution > 0.0)
+            result = std::min(result, reader.findChunk(index, secondsToTick(seconds, signal.tickResolution)));
+
+    return result;
+}
+
+void ReplayDeviceImpl::loadChunk(double fromSeconds)
+{
+    runs.clear();
+    nextRun = 0;
+    columnStates.clear();
+    chunk = {};
+
+    if (chunkIndex >= reader.getChunkCount())
+        return;
+
+    try
+    {
+        chunk = reader.getChunk(chunkIndex);
+    }
+    catch (const std::exception& e)
+    {
+        LOG_W("Failed to read chunk {} of the recording: {}", chunkIndex, e.what());
+        chunk = {};
+        return;
+    }
+
+    columnStates.resize(chunk.columns.size());
+    bool allRunsHaveTime = true;
+
+    for (size_t c = 0; c < chunk.columns.size(); c++)
+    {
+        const auto& column = chunk.columns[c];
+        const auto& header = column.header;
+        auto& state = columnStates[c];
+        const auto signal = getReplaySignal(header.signalIndex);
+
+        try
+        {
+            state.records = column.getRecords();
+        }
+        catch (const std::exception& e)
+        {
+            LOG_W("Failed to read the events of signal {}: {}", header.signalIndex, e.what());
+        }
+
+        // delta encoded samples are decoded once per chunk and copied into the packets
+        const auto decode = [&header](const uint8_t* data, uint64_t size, uint8_t encoding, uint8_t sampleSize, std::vector<uint8_t>& decoded)
+        {
+            if (encoding != static_cast<uint8_t>(format::Encoding::Delta))
+                return true;
+
+            decoded.resize(header.sampleCount * sampleSize);
+            return format::decodeDelta(data, size, header.sampleCount, sampleSize, decoded.data()) == size;
+        };
+
+        if (!decode(column.values, header.valuesSize, header.valueEncoding, header.valueSampleSize, state.decodedValues) ||
+            !decode(column.domain, header.domainSize, header.domainEncoding, header.domainSampleSize, state.decodedDomain))
+        {
+            LOG_W("Failed to decode the samples of signal {} in chunk {}", header.signalIndex, chunkIndex);
+            continue;
+        }
+
+        const uint64_t valuesSize = header.valueEncoding == static_cast<uint8_t>(format::Encoding::Delta) ? state.decodedValues.size() : header.valuesSize;
+        const uint64_t domainSize = header.domainEncoding == static_cast<uint8_t>(format::Encoding::Delta) ? state.decodedDomain.size() : header.domainSize;
+
+        RunRef ref{c, 0, 0, 0, 0, false, 0, 0};
+        state.eventsFrom = 0;
+        const bool skipRuns = fromSeconds != RecordingStart && signal && signal->tickResolution > 0.0;
+        const int64_t fromTick = skipRuns ? secondsToTick(fromSeconds, signal->tickResolution) : 0;
+        for (; ref.run < header.runCount; ref.run++)
+        {
+            const format::Run& run = column.runs[ref.run];
+            if (run.valueBytes > valuesSize - ref.valueOffset || run.domainBytes > domainSize - ref.domainOffset)
+            {
+                LOG_W("The samples of signal {} in chunk {} are truncated", header.signalIndex, chunkIndex);
+                break;
+            }
+
+            ref.hasTime = false;
+            if (signal && signal->linearDomain && run.sampleCount > 0)
+            {
+                ref.hasTime = true;
+                ref.firstTick = signal->domainStart + run.domainOffset;
+                ref.lastTick = ref.firstTick + signal->domainDelta * static_cast<Int>(run.sampleCount - 1);
+            }
+            else if (header.domainSampleSize == sizeof(int64_t) && run.sampleCount > 0 && run.domainBytes >= run.sampleCount * sizeof(int64_t))
+            {
+                const uint8_t* domain = state.decodedDomain.empty() ? column.domain : state.decodedDomain.data();
+                ref.hasTime = true;
+                std::memcpy(&ref.firstTick, domain + ref.domainOffset, sizeof(int64_t));
+                std::memcpy(&ref.lastTick, domain + ref.domainOffset + (run.sampleCount - 1) * sizeof(int64_t), sizeof(int64_t));
+            }
+
+            // packets that end before the seek position are skipped
+            if (skipRuns && ref.hasTime && ref.lastTick < fromTick)
+                state.eventsFrom = ref.sampleIndex + run.sampleCount;
+            else
+                runs.push_back(ref);
+
+            allRunsHaveTime = allRunsHaveTime && ref.hasTime;
+            ref.sampleIndex += run.sampleCount;
+            ref.valueOffset += run.valueBytes;
+            ref.domainOffset += run.domainBytes;
+        }
+    }
+
+    // the packets of all signals are played in the order of their domain values, when all of them have one
+    if (allRunsHaveTime)
+        std::stable_sort(runs.begin(), runs.end(), [](const RunRef& a, const RunRef& b) { return a.firstTick < b.firstTick; });
+}
+
+bool ReplayDeviceImpl::waitForRun(std::unique_lock<std::mutex>& lock, const RunRef& run)
+{
+    if (mode == PlaybackMode::AsFastAsPossible || !run.hasTime)
+        return true;
+
+    const auto signal = getReplaySignal(chunk.columns[run.column].header.signalIndex);
+    if (!signal || signal->tickResolution <= 0.0)
+        return true;
+
+    const double seconds = static_cast<double>(run.firstTick) * signal->tickResolution;
+    if (!paceValid)
+    {
+        paceValid = true;
+        paceStartTime = std::chrono::steady_clock::now();
+        paceStartSeconds = seconds;
+        return true;
+    }
+
+    const double rate = mode == PlaybackMode::Accelerated ? speed : 1.0;
+    const auto delay = std::chrono::duration<double>((seconds - paceStartSeconds) / rate);
+    const auto target = paceStartTime + std::chrono::duration_cast<std::chrono::steady_clock::duration>(delay);
+
+    // returns false if playback was stopped, paused, sought or its pace was changed while waiting
+    return !playbackCv.wait_until(lock, target, [this] { return stopPlayback || seekRequested || !playing || !paceValid; });
+}
+
+void ReplayDeviceImpl::playRecords(size_t columnIndex, uint64_t untilSample)
+{
+    auto& state = columnStates[columnIndex];
+    const auto signalIndex = chunk.columns[columnIndex].header.signalIndex;
+    const auto signal = getReplaySignal(signalIndex);
+
+    while (state.nextRecord < state.records.size() && state.records[state.nextRecord].sampleIndex <= untilSample)
+    {
+        const auto& record = state.records[state.nextRecord++];
+        if (record.kind != format::RecordKind::Event || !signal)
+            continue;
+
+        try
+        {
+            const EventPacketPtr packet = deserializer.deserialize(String(std::string(record.payload)));
+            if (packet.getEventId() == event_packet_id::DATA_DESCRIPTOR_CHANGED)
+            {
+                const auto params = packet.getParameters();
+                applyDescriptors(*signal, params.get(event_packet_param::DATA_DESCRIPTOR), params.get(event_packet_param::DOMAIN_DATA_DESCRIPTOR));
+            }
+            else if (record.sampleIndex >= state.eventsFrom)
+            {
+                signal->valueSignal.sendPacket(packet);
+            }
+        }
+        catch (const std::exception& e)
+        {
+            LOG_W("Failed to replay an event of signal {}: {}", signalIndex, e.what());
+        }
+    }
+}
+
+void ReplayDeviceImpl::playRun(const RunRef& run)
+{
+    const auto& column = chunk.columns[run.column];
+    const auto& header = column.header;
+    const format::Run& recorded = column.runs[run.run];
+    const auto& state = columnStates[run.column];
+    const auto signal = getReplaySignal(header.signalIndex);
+
+    if (!signal || !signal->dataDescriptor.assigned() || recorded.sampleCount == 0)
+        return;
+
+    const auto& mapping = reader.getMapping();
+    const bool rawValues = header.valueEncoding == static_cast<uint8_t>(format::Encoding::Raw);
+    const bool rawDomain = header.domainEncoding == static_cast<uint8_t>(format::Encoding::Raw);
+
+    // raw samples are sent in place unless the packets must be writable; other samples are copied from
+    // the mapping or from the decoded column
+    const auto inPlace = [this](bool raw, const uint8_t* mapped) { return raw && !writablePackets ? mapped : nullptr; };
+    const auto samples = [](bool raw, const uint8_t* mapped, const std::vector<uint8_t>& decoded, uint64_t offset)
+    { return raw ? mapped : decoded.data() + offset; };
+
+    DataPacketPtr domainPacket;
+    if (signal->domainSignal.assigned() && signal->domainDataDescriptor.assigned())
+    {
+        if (signal->linearDomain)
+            domainPacket = DataPacket(signal->domainDataDescriptor, recorded.sampleCount, recorded.domainOffset);
+        else if (recorded.domainBytes > 0)
+            domainPacket = createPacket(nullptr,
+                                        signal->domainDataDescriptor,
+                                        recorded.sampleCount,
+                                        inPlace(rawDomain, column.domain + run.domainOffset),
+                                        samples(rawDomain, column.domain + run.domainOffset, state.decodedDomain, run.domainOffset),
+                                        recorded.domainBytes,
+                                        mapping);
+    }
+
+    // packets of signals with implicit values carry no samples
+    DataPacketPtr valuePacket;
+    if (recorded.valueBytes > 0)
+        valuePacket = createPacket(domainPacket,
+                                   signal->dataDescriptor,
+                                   recorded.sampleCount,
+                                   inPlace(rawValues, column.values + run.valueOffset),
+                                   samples(rawValues, column.values + run.valueOffset, state.decodedValues, run.valueOffset),
+                                   recorded.valueBytes,
+                                   mapping);
+    else if (domainPacket.assigned())
+        valuePacket = DataPacketWithDomain(domainPacket, signal->dataDescriptor, recorded.sampleCount);
+    else
+        valuePacket = DataPacket(signal->dataDescriptor, recorded.sampleCount);
+
+    signal->valueSignal.sendPacket(valuePacket);
+    if (domainPacket.assigned())
+        signal->domainSignal.sendPacket(domainPacket);
+}
+
+END_NAMESPACE_REPLAY_DEVICE_MODULE
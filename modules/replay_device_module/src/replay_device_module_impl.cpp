@@ -0,0 +1,86 @@
+#include <coretypes/version_info_factory.h>
+#include <opendaq/custom_log.h>
+#include <replay_device_module/replay_device_impl.h>
+#include <replay_device_module/replay_device_module_impl.h>
+#include <replay_device_module/version.h>
+#include <filesystem>
+
+BEGIN_NAMESPACE_REPLAY_DEVICE_MODULE
+
+ReplayDeviceModule::ReplayDeviceModule(ContextPtr context)
+    : Module("ReplayDeviceModule",
+             daq::VersionInfo(REPLAY_DEVICE_MODULE_MAJOR_VERSION, REPLAY_DEVICE_MODULE_MINOR_VERSION, REPLAY_DEVICE_MODULE_PATCH_VERSION),
+             std::move(context),
+             REPLAY_MODULE_NAME)
+{
+}
+
+ListPtr<IDeviceInfo> ReplayDeviceModule::onGetAvailableDevices()
+{
+    auto availableDevices = List<IDeviceInfo>();
+
+    // recordings are not discovered, unless they are listed in the module options
+    const auto options = this->context.getModuleOptions(REPLAY_MODULE_NAME);
+    if (options.assigned() && options.hasKey("FileNames"))
+    {
+        const ListPtr<IString> fileNames = options.get("FileNames");
+        for (const auto& fileName : fileNames)
+            availableDevices.pushBack(ReplayDeviceImpl::CreateDeviceInfo(fileName.toStdString()));
+    }
+
+    return availableDevices;
+}
+
+DictPtr<IString, IDeviceType> ReplayDeviceModule::onGetAvailableDeviceTypes()
+{
+    auto result = Dict<IString, IDeviceType>();
+
+    auto deviceType = ReplayDeviceImpl::CreateType();
+    result.set(deviceType.getId(), deviceType);
+
+    return result;
+}
+
+DevicePtr ReplayDeviceModule::onCreateDevice(const StringPtr& connectionString,
+                                             const ComponentPtr& parent,
+                                             const PropertyObjectPtr& config)
+{
+    const auto fileName = getFileNameFromConnectionString(connectionString);
+
+    StringPtr localId;
+    StringPtr name = std::filesystem::path(fileName).stem().string();
+
+    if (config.assigned())
+    {
+        if (config.hasProperty("LocalId"))
+            localId = config.getPropertyValue("LocalId");
+        if (config.hasProperty("Name"))
+            name = config.getPropertyValue("Name");
+    }
+
+    if (!localId.assigned() || localId.getLength() == 0)
+        localId = "ReplayDev";
+
+    return createWithImplementation<IDevice, ReplayDeviceImpl>(fileName, config, context, parent, localId, name);
+}
+
+std::string ReplayDeviceModule::getFileNameFromConnectionString(const std::string& connectionString) const
+{
+    const std::string prefix = "daqreplay://";
+    if (connectionString.find(prefix) != 0)
+    {
+        LOG_W("Invalid connection string \"{}\", no prefix", connectionString);
+        throw InvalidParameterException();
+    }
+
+    auto fileName = connectionString.substr(prefix.size());
+    if (fileName.empty())
+    {
+        LOG_W("Invalid connection string \"{}\", no file name", connectionString);
+        throw InvalidParameterException();
+    }
+
+    return fileName;
+}
+
+END_NAMESPACE_REPLAY_DEVICE_MODULE
@@ -0,0 +1,106 @@
+#include <coretypes/common.h>
+#include <gmock/gmock.h>
+#include <columnar_recording/columnar_writer.h>
+#include <coretypes/json_serializer_factory.h>
+#include <opendaq/context_factory.h>
+#include <opendaq/data_descriptor_factory.h>
+#include <opendaq/data_rule_factory.h>
+#include <opendaq/device_ptr.h>
+#include <opendaq/module_ptr.h>
+#include <opendaq/packet_factory.h>
+#include <opendaq/reader_factory.h>
+#include <replay_device_module/module_dll.h>
+#include <testutils/testutils.h>
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <thread>
+
+using namespace daq;
+using namespace daq::columnar_recording;
+
+using ReplayDeviceBenchmark = testing::Test;
+
+namespace
+{
+
+// Writes a recording of one Int32 signal with a linear domain of 1 ms ticks.
+void writeRecording(const std::string& fileName, size_t packetCount, size_t packetSize)
+{
+    ColumnarWriter writer;
+    ColumnarWriter::Settings settings;
+    settings.fileName = fileName;
+    settings.chunkSize = 64 * 1024;
+    settings.chunkCount = packetCount * packetSize * sizeof(int32_t) / settings.chunkSize + 2;
+    writer.open(settings);
+
+    const auto domainDescriptor =
+        DataDescriptorBuilder().setSampleType(SampleType::Int64).setRule(LinearDataRule(1, 0)).setTickResolution(Ratio(1, 1000)).build();
+    const auto descriptor = DataDescriptorBuilder().setSampleType(SampleType::Int32).build();
+
+    const auto serializer = JsonSerializer();
+    DataDescriptorChangedEventPacket(descriptor, domainDescriptor).asPtr<ISerializable>(true).serialize(serializer);
+    writer.writeRecord(0, format::RecordKind::Event, serializer.getOutput().toStdString());
+
+    std::vector<int32_t> values(packetSize);
+    for (size_t i = 0; i < packetCount; i++)
+    {
+        SampleBlock block;
+        block.sampleCount = packetSize;
+        block.valueFormat = {sizeof(int32_t), true, true};
+        block.values = values.data();
+        block.valueBytes = packetSize * sizeof(int32_t);
+        block.domainOffset = static_cast<int64_t>(i * packetSize);
+        block.hasTime = true;
+        block.firstTick = block.domainOffset;
+        block.lastTick = block.domainOffset + static_cast<int64_t>(packetSize) - 1;
+        writer.write(0, block);
+    }
+
+    writer.close();
+}
+
+}
+
+TEST_F(ReplayDeviceBenchmark, ReplayRate)
+{
+    const auto fileName = (std::filesystem::temp_directory_path() / "bench_replay_rate.daqrec").string();
+    constexpr size_t PacketCount = 2000;
+    constexpr size_t PacketSize = 1000;
+    writeRecording(fileName, PacketCount, PacketSize);
+
+    ModulePtr module;
+    createModule(&module, NullContext());
+
+    auto config = module.getAvailableDeviceTypes().get("daqreplay").createDefaultConfig();
+    config.setPropertyValue("Playing", false);
+    config.setPropertyValue("Mode", 2);
+    const auto device = module.createDevice("daqreplay://" + fileName, nullptr, config);
+    const auto reader = PacketReader(device.getSignals()[0]);
+
+    const auto start = std::chrono::steady_clock::now();
+    device.setPropertyValue("Playing", true);
+
+    size_t sampleCount = 0;
+    const auto timeout = start + std::chrono::seconds(60);
+    while (sampleCount < PacketCount * PacketSize && std::chrono::steady_clock::now() < timeout)
+    {
+        const auto packet = reader.read();
+        if (!packet.assigned())
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        if (packet.getType() == PacketType::Data)
+            sampleCount += packet.asPtr<IDataPacket>().getSampleCount();
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    ASSERT_EQ(sampleCount, PacketCount * PacketSize);
+
+    const auto elapsedUs = std::max<int64_t>(std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count(), 1);
+    RecordProperty("MegaSamplesPerSecond", std::to_string(PacketCount * PacketSize / elapsedUs));
+    RecordProperty("PacketsPerSecond", std::to_string(PacketCount * 1000000 / elapsedUs));
+
+    std::filesystem::remove(fileName);
+}
@@ -0,0 +1,379 @@
+#include <coretypes/common.h>
+#include <gmock/gmock.h>
+#include <columnar_recording/columnar_writer.h>
+#include <coretypes/json_serializer_factory.h>
+#include <opendaq/context_factory.h>
+#include <opendaq/data_descriptor_factory.h>
+#include <opendaq/data_rule_factory.h>
+#include <opendaq/device_ptr.h>
+#include <opendaq/module_ptr.h>
+#include <opendaq/packet_factory.h>
+#include <opendaq/reader_factory.h>
+#include <replay_device_module/module_dll.h>
+#include <replay_device_module/version.h>
+#include <testutils/testutils.h>
+#include <fmt/format.h>
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <thread>
+
+using namespace daq;
+using namespace daq::columnar_recording;
+
+using ReplayDeviceModuleTest = testing::Test;
+
+namespace
+{
+
+ModulePtr CreateModule()
+{
+    ModulePtr module;
+    createModule(&module, NullContext());
+    return module;
+}
+
+std::string tempFileName(const std::string& name)
+{
+    return (std::filesystem::temp_directory_path() / name).string();
+}
+
+// a domain of 1 ms per sample, counted in ticks of 1 / ticksPerSecond seconds
+DataDescriptorPtr createDomainDescriptor(Int ticksPerSecond = 1000)
+{
+    return DataDescriptorBuilder()
+        .setSampleType(SampleType::Int64)
+        .setRule(LinearDataRule(ticksPerSecond / 1000, 0))
+        .setTickResolution(Ratio(1, ticksPerSecond))
+        .setOrigin("1970")
+        .setUnit(Unit("s", -1, "seconds", "time"))
+        .build();
+}
+
+DataDescriptorPtr createDescriptor()
+{
+    return DataDescriptorBuilder().setSampleType(SampleType::Int32).setName("Recorded").build();
+}
+
+// Writes a recording of Int32 signals with a linear domain of 1 ms per sample, one signal for each tick
+// resolution; sample i has value i.
+void writeRecording(const std::string& fileName,
+                    size_t packetCount,
+                    size_t packetSize,
+                    bool compress = false,
+                    const std::vector<Int>& ticksPerSecond = {1000})
+{
+    ColumnarWriter writer;
+    ColumnarWriter::Settings settings;
+    settings.fileName = fileName;
+    settings.chunkSize = 4 * 1024;
+    settings.chunkCount = ticksPerSecond.size() * packetCount * packetSize * sizeof(int32_t) / settings.chunkSize + 2;
+    settings.compress = compress;
+    writer.open(settings);
+
+    for (uint32_t signal = 0; signal < ticksPerSecond.size(); signal++)
+    {
+        const auto serializer = JsonSerializer();
+        DataDescriptorChangedEventPacket(createDescriptor(), createDomainDescriptor(ticksPerSecond[signal])).asPtr<ISerializable>(true).serialize(serializer);
+        writer.writeRecord(signal, format::RecordKind::SignalInfo, fmt::format("/recorder/Dev/RefDev0/IO/AI/RefCh{0}/Sig/AI{0}", signal));
+        writer.writeRecord(signal, format::RecordKind::Event, serializer.getOutput().toStdString());
+    }
+
+    std::vector<int32_t> values(packetSize);
+    for (size_t i = 0; i < packetCount; i++)
+    {
+        for (size_t j = 0; j < packetSize; j++)
+            values[j] = static_cast<int32_t>(i * packetSize + j);
+
+        for (uint32_t signal = 0; signal < ticksPerSecond.size(); signal++)
+        {
+            const int64_t delta = ticksPerSecond[signal] / 1000;
+
+            SampleBlock block;
+            block.sampleCount = packetSize;
+            block.valueFormat = {sizeof(int32_t), true, true};
+            block.values = values.data();
+            block.valueBytes = packetSize * sizeof(int32_t);
+            block.domainOffset = static_cast<int64_t>(i * packetSize) * delta;
+            block.hasTime = true;
+            block.firstTick = block.domainOffset;
+            block.lastTick = block.domainOffset + (static_cast<int64_t>(packetSize) - 1) * delta;
+            writer.write(signal, block);
+        }
+    }
+
+    writer.close();
+    ASSERT_EQ(writer.getStatistics().droppedBlocks, 0u);
+}
+
+DevicePtr createDevice(const ModulePtr& module, const std::string& fileName, const std::string& mode)
+{
+    auto config = module.getAvailableDeviceTypes().get("daqreplay").createDefaultConfig();
+    config.setPropertyValue("Playing", false);
+    config.setPropertyValue("Mode", mode == "RealTime" ? 0 : mode == "Accelerated" ? 1 : 2);
+    return module.createDevice("daqreplay://" + fileName, nullptr, config);
+}
+
+struct Received
+{
+    std::vector<int32_t> values;
+    std::vector<Int> domainOffsets;
+    DataDescriptorPtr descriptor;
+};
+
+// Reads data packets until `sampleCount` samples arrive; returns false on timeout.
+bool receive(const PacketReaderPtr& reader, size_t sampleCount, Received& received)
+{
+    const auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+    while (received.values.size() < sampleCount)
+    {
+        const auto packet = reader.read();
+        if (!packet.assigned())
+        {
+            if (std::chrono::steady_clock::now() > timeout)
+                return false;
+            std::this_thread::yield();
+            continue;
+        }
+
+        if (packet.getType() == PacketType::Event)
+        {
+            const auto params = packet.asPtr<IEventPacket>().getParameters();
+            if (params.hasKey("DataDescriptor") && params.get("DataDescriptor").assigned())
+                received.descriptor = params.get("DataDescriptor");
+            continue;
+        }
+
+        const auto dataPacket = packet.asPtr<IDataPacket>();
+        const auto data = static_cast<const int32_t*>(dataPacket.getRawData());
+        received.values.insert(received.values.end(), data, data + dataPacket.getSampleCount());
+        received.domainOffsets.push_back(dataPacket.getDomainPacket().getOffset().getIntValue());
+    }
+
+    return received.values.size() == sampleCount;
+}
+
+}
+
+TEST_F(ReplayDeviceModuleTest, CreateModule)
+{
+    IModule* module = nullptr;
+    ErrCode errCode = createModule(&module, NullContext());
+    ASSERT_TRUE(OPENDAQ_SUCCEEDED(errCode));
+
+    ASSERT_NE(module, nullptr);
+    module->releaseRef();
+}
+
+TEST_F(ReplayDeviceModuleTest, ModuleName)
+{
+    auto module = CreateModule();
+    ASSERT_EQ(module.getName(), "ReplayDeviceModule");
+}
+
+TEST_F(ReplayDeviceModuleTest, VersionCorrect)
+{
+    auto module = CreateModule();
+    auto version = module.getVersionInfo();
+
+    ASSERT_EQ(version.getMajor(), REPLAY_DEVICE_MODULE_MAJOR_VERSION);
+    ASSERT_EQ(version.getMinor(), REPLAY_DEVICE_MODULE_MINOR_VERSION);
+    ASSERT_EQ(version.getPatch(), REPLAY_DEVICE_MODULE_PATCH_VERSION);
+}
+
+TEST_F(ReplayDeviceModuleTest, EnumerateDevices)
+{
+    auto module = CreateModule();
+
+    ListPtr<IDeviceInfo> deviceInfo;
+    ASSERT_NO_THROW(deviceInfo = module.getAvailableDevices());
+    ASSERT_EQ(deviceInfo.getCount(), 0u);
+}
+
+TEST_F(ReplayDeviceModuleTest, DeviceType)
+{
+    auto module = CreateModule();
+
+    const auto deviceTypes = module.getAvailableDeviceTypes();
+    ASSERT_EQ(deviceTypes.getCount(), 1u);
+    ASSERT_TRUE(deviceTypes.hasKey("daqreplay"));
+    ASSERT_EQ(deviceTypes.get("daqreplay").getConnectionStringPrefix(), "daqreplay");
+}
+
+TEST_F(ReplayDeviceModuleTest, CreateDeviceConnectionStringInvalid)
+{
+    auto module = CreateModule();
+
+    ASSERT_THROW(module.createDevice("daqref://device0", nullptr), InvalidParameterException);
+    ASSERT_THROW(module.createDevice("daqreplay://", nullptr), InvalidParameterException);
+    ASSERT_THROW(module.createDevice("daqreplay://" + tempFileName("missing_recording.daqrec"), nullptr), NotFoundException);
+}
+
+TEST_F(ReplayDeviceModuleTest, RecordedSignals)
+{
+    const auto fileName = tempFileName("test_replay_signals.daqrec");
+    writeRecording(fileName, 10, 100);
+
+    auto module = CreateModule();
+    const auto device = createDevice(module, fileName, "AsFastAsPossible");
+
+    const auto signals = device.getSignals();
+    ASSERT_EQ(signals.getCount(), 1u);
+    ASSERT_EQ(signals[0].getName(), "AI0");
+    ASSERT_EQ(signals[0].getDescriptor(), createDescriptor());
+    ASSERT_EQ(signals[0].getDomainSignal().getDescriptor(), createDomainDescriptor());
+
+    ASSERT_EQ(device.getInfo().getConnectionString(), "daqreplay://" + fileName);
+    ASSERT_TRUE(device.hasProperty("SeekPosition"));
+
+    std::filesystem::remove(fileName);
+}
+
+TEST_F(ReplayDeviceModuleTest, Replay)
+{
+    for (const bool compress : {false, true})
+    {
+        const auto fileName = tempFileName("test_replay.daqrec");
+        constexpr size_t PacketCount = 50;
+        constexpr size_t PacketSize = 100;
+        writeRecording(fileName, PacketCount, PacketSize, compress);
+
+        auto module = CreateModule();
+        const auto device = createDevice(module, fileName, "AsFastAsPossible");
+        const auto reader = PacketReader(device.getSignals()[0]);
+        device.setPropertyValue("Playing", true);
+
+        Received received;
+        ASSERT_TRUE(receive(reader, PacketCount * PacketSize, received));
+        ASSERT_EQ(received.descriptor, createDescriptor());
+        for (size_t i = 0; i < received.values.size(); i++)
+            ASSERT_EQ(received.values[i], static_cast<int32_t>(i));
+        for (size_t i = 0; i < received.domainOffsets.size(); i++)
+            ASSERT_EQ(received.domainOffsets[i], static_cast<Int>(i * PacketSize));
+
+        std::filesystem::remove(fileName);
+    }
+}
+
+TEST_F(ReplayDeviceModuleTest, Seek)
+{
+    const auto fileName = tempFileName("test_replay_seek.daqrec");
+    constexpr size_t PacketSize = 100;
+    writeRecording(fileName, 100, PacketSize);
+
+    auto module = CreateModule();
+    const auto device = createDevice(module, fileName, "AsFastAsPossible");
+    const auto reader = PacketReader(device.getSignals()[0]);
+
+    // the packet that contains the position is the first one played
+    device.setPropertyValue("SeekPosition", 5.05);
+    device.setPropertyValue("Playing", true);
+
+    Received received;
+    ASSERT_TRUE(receive(reader, 50 * PacketSize, received));
+    ASSERT_EQ(received.domainOffsets.front(), 5000);
+    ASSERT_EQ(received.values.front(), 5000);
+    ASSERT_EQ(received.values.back(), 9999);
+
+    std::filesystem::remove(fileName);
+}
+
+TEST_F(ReplayDeviceModuleTest, Accelerated)
+{
+    // 500 ms of data, played 5 times faster
+    const auto fileName = tempFileName("test_replay_accelerated.daqrec");
+    constexpr size_t PacketSize = 50;
+    writeRecording(fileName, 10, PacketSize);
+
+    auto module = CreateModule();
+    const auto device = createDevice(module, fileName, "Accelerated");
+    device.setPropertyValue("Speed", 5.0);
+    const auto reader = PacketReader(device.getSignals()[0]);
+
+    const auto start = std::chrono::steady_clock::now();
+    device.setPropertyValue("Playing", true);
+
+    Received received;
+    ASSERT_TRUE(receive(reader, 10 * PacketSize, received));
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    // the last packet starts 450 ms after the first one
+    ASSERT_GE(elapsed, std::chrono::milliseconds(80));
+
+    std::filesystem::remove(fileName);
+}
+
+TEST_F(ReplayDeviceModuleTest, SeekSignalsWithDifferentResolutions)
+{
+    // the signals have the same samples, with domains counted in milliseconds and microseconds
+    const auto fileName = tempFileName("test_replay_seek_resolutions.daqrec");
+    constexpr size_t PacketSize = 100;
+    writeRecording(fileName, 100, PacketSize, false, {1000, 1000000});
+
+    auto module = CreateModule();
+    const auto device = createDevice(module, fileName, "AsFastAsPossible");
+    const auto signals = device.getSignals();
+    ASSERT_EQ(signals.getCount(), 2u);
+    const auto millisecondReader = PacketReader(signals[0]);
+    const auto microsecondReader = PacketReader(signals[1]);
+
+    device.setPropertyValue("SeekPosition", 5.05);
+    device.setPropertyValue("Playing", true);
+
+    Received milliseconds;
+    ASSERT_TRUE(receive(millisecondReader, 50 * PacketSize, milliseconds));
+    ASSERT_EQ(milliseconds.domainOffsets.front(), 5000);
+    ASSERT_EQ(milliseconds.values.front(), 5000);
+
+    Received microseconds;
+    ASSERT_TRUE(receive(microsecondReader, 50 * PacketSize, microseconds));
+    ASSERT_EQ(microseconds.domainOffsets.front(), 5000000);
+    ASSERT_EQ(microseconds.values.front(), 5000);
+
+    std::filesystem::remove(fileName);
+}
+
+TEST_F(ReplayDeviceModuleTest, WritablePackets)
+{
+    const auto fileName = tempFileName("test_replay_writable.daqrec");
+    constexpr size_t PacketSize = 100;
+    writeRecording(fileName, 10, PacketSize);
+
+    auto module = CreateModule();
+    auto config = module.getAvailableDeviceTypes().get("daqreplay").createDefaultConfig();
+    config.setPropertyValue("Playing", false);
+    config.setPropertyValue("Mode", 2);
+    config.setPropertyValue("WritablePackets", true);
+    const auto device = module.createDevice("daqreplay://" + fileName, nullptr, config);
+    const auto reader = PacketReader(device.getSignals()[0]);
+    device.setPropertyValue("Playing", true);
+
+    // a consumer that modifies its packets does not change what is played later
+    size_t sampleCount = 0;
+    const auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+    while (sampleCount < 10 * PacketSize && std::chrono::steady_clock::now() < timeout)
+    {
+        const auto packet = reader.read();
+        if (!packet.assigned() || packet.getType() != PacketType::Data)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        const auto dataPacket = packet.asPtr<IDataPacket>();
+        const auto data = static_cast<int32_t*>(dataPacket.getRawData());
+        std::fill(data, data + dataPacket.getSampleCount(), -1);
+        sampleCount += dataPacket.getSampleCount();
+    }
+    ASSERT_EQ(sampleCount, 10 * PacketSize);
+
+    device.setPropertyValue("SeekPosition", 0.0);
+    device.setPropertyValue("Playing", true);
+
+    Received received;
+    ASSERT_TRUE(receive(reader, 10 * PacketSize, received));
+    for (size_t i = 0; i < received.values.size(); i++)
+        ASSERT_EQ(received.values[i], static_cast<int32_t>(i));
+
+    std::filesystem::remove(fileName);
+}
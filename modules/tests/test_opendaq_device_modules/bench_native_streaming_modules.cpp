@@ -0,0 +1,56 @@
+#include "test_helpers/test_helpers.h"
+#include <coreobjects/authentication_provider_factory.h>
+#include <chrono>
+
+using NativeStreamingModulesBenchmark = testing::Test;
+
+using namespace daq;
+
+static InstancePtr CreateClientInstance()
+{
+    auto instance = Instance();
+    auto refDevice = instance.addDevice("daq.ns://127.0.0.1/");
+    return instance;
+}
+
+TEST_F(NativeStreamingModulesBenchmark, ReceivedPacketsRateManySignals)
+{
+    SKIP_TEST_MAC_CI;
+    constexpr Int channelCount = 1000;
+
+    auto server = InstanceCustom(Context(Scheduler(Logger()), Logger(), TypeManager(), ModuleManager(""), AuthenticationProvider()),
+                                 "local");
+    const auto serverRefDevice = server.addDevice("daqref://device1");
+    serverRefDevice.setPropertyValue("GlobalSampleRate", 10.0);
+    serverRefDevice.setPropertyValue("NumberOfChannels", channelCount);
+    server.addServer("OpenDAQNativeStreaming", nullptr);
+
+    auto client = CreateClientInstance();
+
+    std::vector<PacketReaderPtr> readers;
+    for (const auto& signal : client.getSignals(search::Recursive(search::Visible())))
+    {
+        if (signal.getDomainSignal().assigned())
+            readers.push_back(PacketReader(signal));
+    }
+    ASSERT_EQ(readers.size(), static_cast<size_t>(channelCount));
+
+    // let subscriptions settle and drain the initial event packets
+    std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+    for (const auto& reader : readers)
+        reader.readAll();
+
+    size_t packetCount = 0;
+    const auto start = std::chrono::steady_clock::now();
+    while (std::chrono::steady_clock::now() - start < std::chrono::seconds(3))
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        for (const auto& reader : readers)
+            packetCount += reader.readAll().getCount();
+    }
+    const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    RecordProperty("SignalCount", std::to_string(readers.size()));
+    RecordProperty("PacketsPerSecond", std::to_string(static_cast<double>(packetCount) / elapsed));
+    ASSERT_GT(packetCount, 0u);
+}
@@ -0,0 +1,229 @@
+/*
+ * Copyright 2022-2024 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace daq::columnar_recording
+{
+
+/*
+ * Layout of a recording file. All values are stored in the byte order of the writing machine.
+ *
+ *   FileHeader
+ *   chunk 0 .. chunk N-1
+ *   IndexHeader, IndexEntry[chunkCount]
+ *   Footer
+ *
+ * A chunk holds the samples of all recorded signals that arrived while it was staged:
+ *
+ *   ChunkHeader
+ *   ColumnHeader[signalCount]
+ *   for each column: Run[runCount], values, domain values, records
+ *
+ * Each section of a column (runs, values, domain values and records) starts at an offset of the file that is
+ * a multiple of SectionAlignment; the sizes in the column header exclude the padding. Raw encoded samples can
+ * thus be used in place when the file is mapped into memory.
+ *
+ * Each signal has a value column and a domain column. A run describes the samples of one packet; for
+ * signals with a linear domain, the domain column is empty and the domain offset of the packet is stored
+ * in the run instead. Records (signal information and event packets) are stored with the index of the
+ * sample of the column they precede. The index at the end of the file has an entry for each column of each
+ * chunk, in file order, with the file offset of the chunk and the domain range of the column, so that a
+ * reader can locate a time range of a signal without scanning the chunks. Domain ranges are in ticks of the
+ * domain of their signal; signals with different tick resolutions or origins cannot be compared by them.
+ */
+namespace format
+{
+
+constexpr char FileMagic[8] = {'D', 'A', 'Q', 'R', 'E', 'C', '0', '1'};
+constexpr char FooterMagic[8] = {'D', 'A', 'Q', 'R', 'E', 'C', 'I', 'X'};
+constexpr uint32_t Version = 3;
+constexpr size_t SectionAlignment = 8;
+constexpr uint32_t ChunkMagic = 0x4B4E4843;  // "CHNK"
+constexpr uint32_t IndexMagic = 0x58444E49;  // "INDX"
+
+enum class Encoding : uint8_t
+{
+    Raw = 0,
+    Delta = 1  // differences of consecutive integer samples, zigzag and LEB128 encoded
+};
+
+enum class RecordKind : uint32_t
+{
+    SignalInfo = 0,  // global ID of the recorded signal
+    Event = 1        // JSON serialized event packet
+};
+
+#pragma pack(push, 1)
+struct FileHeader
+{
+    char magic[8];
+    uint32_t version;
+    uint32_t reserved;
+};
+
+struct ChunkHeader
+{
+    uint32_t magic;
+    uint32_t signalCount;
+    uint64_t size;  // size of the chunk without the chunk header
+};
+
+struct ColumnHeader
+{
+    uint32_t signalIndex;
+    uint8_t valueEncoding;
+    uint8_t domainEncoding;
+    uint8_t valueSampleSize;
+    uint8_t domainSampleSize;
+    uint64_t sampleCount;
+    uint32_t runCount;
+    uint32_t recordCount;
+    int64_t firstTick;
+    int64_t lastTick;
+    uint8_t hasTime;
+    uint8_t reserved[7];
+    uint64_t valuesSize;
+    uint64_t domainSize;
+    uint64_t recordsSize;
+};
+
+struct Run
+{
+    uint64_t sampleCount;
+    uint64_t valueBytes;   // raw size of the values of the run, before encoding
+    uint64_t domainBytes;  // raw size of the domain values of the run, before encoding
+    int64_t domainOffset;
+};
+
+struct RecordHeader
+{
+    uint64_t sampleIndex;
+    uint32_t kind;
+    uint32_t size;
+};
+
+struct IndexHeader
+{
+    uint32_t magic;
+    uint32_t reserved;
+    uint64_t entryCount;
+};
+
+struct IndexEntry
+{
+    uint64_t fileOffset;  // offset of the chunk header
+    uint32_t signalIndex;
+    uint8_t hasTime;
+    uint8_t reserved[3];
+    int64_t firstTick;
+    int64_t lastTick;
+};
+
+struct Footer
+{
+    uint64_t indexOffset;
+    char magic[8];
+};
+#pragma pack(pop)
+
+static_assert(sizeof(FileHeader) == 16);
+static_assert(sizeof(ChunkHeader) == 16);
+static_assert(sizeof(ColumnHeader) == 72);
+static_assert(sizeof(Run) == 32);
+static_assert(sizeof(RecordHeader) == 16);
+static_assert(sizeof(IndexEntry) == 32);
+static_assert(sizeof(Footer) == 16);
+static_assert(sizeof(FileHeader) % SectionAlignment == 0 && sizeof(ChunkHeader) % SectionAlignment == 0 &&
+              sizeof(ColumnHeader) % SectionAlignment == 0 && sizeof(Run) % SectionAlignment == 0);
+
+constexpr uint64_t alignSection(uint64_t size)
+{
+    return (size + SectionAlignment - 1) & ~static_cast<uint64_t>(SectionAlignment - 1);
+}
+
+inline uint64_t readSample(const uint8_t* sample, size_t sampleSize, bool isSigned)
+{
+    uint64_t value = 0;
+    std::memcpy(&value, sample, sampleSize);
+    if (isSigned && sampleSize < sizeof(uint64_t) && (value >> (sampleSize * 8 - 1)) != 0)
+        value |= ~uint64_t(0) << (sampleSize * 8);
+    return value;
+}
+
+/*!
+ * @brief Appends the delta encoding of integer samples to `out`.
+ *
+ * The differences are calculated with wrap-around on sign-extended (signed types) or zero-extended
+ * values, so any sequence of samples is encoded losslessly; sign extension only keeps the differences
+ * of negative values small.
+ */
+inline void encodeDelta(const uint8_t* samples, size_t count, size_t sampleSize, bool isSigned, std::vector<uint8_t>& out)
+{
+    uint64_t previous = 0;
+    for (size_t i = 0; i < count; i++)
+    {
+        const uint64_t value = readSample(samples + i * sampleSize, sampleSize, isSigned);
+        const auto delta = static_cast<int64_t>(value - previous);
+        previous = value;
+
+        uint64_t zigzag = (static_cast<uint64_t>(delta) << 1) ^ static_cast<uint64_t>(delta >> 63);
+        while (zigzag >= 0x80)
+        {
+            out.push_back(static_cast<uint8_t>(zigzag | 0x80));
+            zigzag >>= 7;
+        }
+        out.push_back(static_cast<uint8_t>(zigzag));
+    }
+}
+
+/*!
+ * @brief Decodes `count` delta encoded samples into `out`.
+ * @returns The number of bytes consumed, or 0 if the encoded data is truncated.
+ */
+inline size_t decodeDelta(const uint8_t* data, size_t size, size_t count, size_t sampleSize, uint8_t* out)
+{
+    size_t position = 0;
+    uint64_t previous = 0;
+    for (size_t i = 0; i < count; i++)
+    {
+        uint64_t zigzag = 0;
+        for (unsigned shift = 0;; shift += 7)
+        {
+            if (position >= size || shift >= 64)
+                return 0;
+
+            const uint8_t byte = data[position++];
+            zigzag |= static_cast<uint64_t>(byte & 0x7F) << shift;
+            if ((byte & 0x80) == 0)
+                break;
+        }
+
+        const uint64_t delta = (zigzag >> 1) ^ (~(zigzag & 1) + 1);
+        previous += delta;
+        std::memcpy(out + i * sampleSize, &previous, sampleSize);
+    }
+
+    return position;
+}
+
+}
+
+}
@@ -0,0 +1,120 @@
+/*
+ * Copyright 2022-2024 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <columnar_recording/columnar_format.h>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace daq::columnar_recording
+{
+
+/*!
+ * @brief The contents of a recording file.
+ *
+ * On POSIX systems, the file is mapped read-only into memory: pages are loaded on first access and are
+ * shared with the page cache, and writing to them faults instead of changing what later reads of the file
+ * return. On other systems, the file is read into memory when opened; it must not be written to either.
+ */
+class FileMapping
+{
+public:
+    // Throws std::runtime_error if the file cannot be opened or mapped.
+    explicit FileMapping(const std::string& fileName);
+    ~FileMapping();
+
+    FileMapping(const FileMapping&) = delete;
+    FileMapping& operator=(const FileMapping&) = delete;
+
+    const uint8_t* data() const;
+    size_t size() const;
+    bool isMemoryMapped() const;
+
+private:
+    const uint8_t* memory;
+    size_t length;
+    bool mapped;
+    std::vector<uint8_t> contents;
+};
+
+struct RecordView
+{
+    uint64_t sampleIndex;
+    format::RecordKind kind;
+    std::string_view payload;
+};
+
+// Points into the read-only mapping of the file; raw encoded values and domain values start at a multiple
+// of format::SectionAlignment.
+struct ColumnView
+{
+    format::ColumnHeader header;
+    const format::Run* runs;
+    const uint8_t* values;
+    const uint8_t* domain;
+    const uint8_t* records;
+
+    // Throws std::runtime_error if the records are truncated.
+    std::vector<RecordView> getRecords() const;
+};
+
+struct ChunkView
+{
+    format::ChunkHeader header;
+    std::vector<ColumnView> columns;
+};
+
+/*!
+ * @brief Reads recording files written by ColumnarWriter (see columnar_format.h).
+ *
+ * Opening a file only reads its footer and chunk index; chunks are located through the index and their
+ * samples are accessed in place. The mapping is shared, so that views of the samples (for example, packets
+ * that point into the file) can keep it alive after the reader is closed.
+ */
+class ColumnarReader
+{
+public:
+    ColumnarReader() = default;
+
+    // Throws std::runtime_error if the file cannot be opened or is not a valid recording.
+    void open(const std::string& fileName);
+    void close();
+
+    bool isOpen() const;
+    const std::shared_ptr<FileMapping>& getMapping() const;
+
+    size_t getChunkCount() const;
+
+    // Returns the index entries of the chunk, one for each signal in the chunk.
+    std::vector<format::IndexEntry> getIndexEntries(size_t chunkIndex) const;
+
+    // Throws std::runtime_error if the chunk is corrupted.
+    ChunkView getChunk(size_t chunkIndex) const;
+
+    // Returns the index of the first chunk in which the domain range of the signal ends at or after `tick`,
+    // or the chunk count if there is none. `tick` is in ticks of the domain of the signal.
+    size_t findChunk(uint32_t signalIndex, int64_t tick) const;
+
+private:
+    std::shared_ptr<FileMapping> mapping;
+    std::vector<format::IndexEntry> index;
+    // position in the index of the first entry of each chunk
+    std::vector<size_t> chunkEntries;
+};
+
+}
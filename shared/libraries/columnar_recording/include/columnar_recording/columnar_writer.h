@@ -0,0 +1,190 @@
+/*
+ * Copyright 2022-2024 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <columnar_recording/columnar_format.h>
+#include <atomic>
+#include <condition_variable>
+#include <cstdio>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace daq::columnar_recording
+{
+
+struct ColumnFormat
+{
+    uint8_t sampleSize{0};
+    bool integer{false};
+    bool isSigned{false};
+
+    bool operator==(const ColumnFormat& other) const
+    {
+        return sampleSize == other.sampleSize && integer == other.integer && isSigned == other.isSigned;
+    }
+
+    bool operator!=(const ColumnFormat& other) const
+    {
+        return !(*this == other);
+    }
+};
+
+// The samples of a single packet of a signal, with the values of its domain packet.
+struct SampleBlock
+{
+    size_t sampleCount{0};
+    ColumnFormat valueFormat;
+    const void* values{nullptr};
+    size_t valueBytes{0};
+    ColumnFormat domainFormat;
+    const void* domain{nullptr};
+    size_t domainBytes{0};
+    int64_t domainOffset{0};
+    bool hasTime{false};
+    int64_t firstTick{0};
+    int64_t lastTick{0};
+};
+
+/*!
+ * @brief Writes the samples of multiple signals into a chunked columnar file (see columnar_format.h).
+ *
+ * Samples are copied into a staging chunk by the calling threads; once the chunk reaches the chunk size,
+ * it is handed over to the I/O thread, which encodes it and writes it with a single unbuffered write, while
+ * the callers continue with the next chunk. The number of chunks is fixed when the file is opened, so the
+ * memory used is bounded: when all chunks wait to be written, the samples are dropped instead of blocking
+ * the callers, and are counted in the statistics.
+ *
+ * A failed write fails the recording: the file is left without an index, as if it was not closed, and
+ * all further samples and records are rejected until the file is opened again.
+ */
+class ColumnarWriter
+{
+public:
+    static constexpr size_t DefaultChunkSize = 4 * 1024 * 1024;
+
+    struct Settings
+    {
+        std::string fileName;
+        size_t chunkSize{DefaultChunkSize};
+        size_t chunkCount{2};
+        bool compress{false};
+    };
+
+    struct Statistics
+    {
+        uint64_t bytesWritten{0};
+        uint64_t chunksWritten{0};
+        uint64_t droppedBlocks{0};
+        uint64_t writeErrors{0};
+    };
+
+    ColumnarWriter();
+    ~ColumnarWriter();
+
+    ColumnarWriter(const ColumnarWriter&) = delete;
+    ColumnarWriter& operator=(const ColumnarWriter&) = delete;
+
+    // Creates the file and starts the I/O thread; throws std::runtime_error if the file cannot be created.
+    // Waits for a concurrent close to finish.
+    void open(const Settings& settings);
+
+    // Writes the staged samples, the chunk index and the footer, and closes the file.
+    void close();
+
+    bool isOpen() const;
+
+    // Returns true if writing to the file failed; the recording is then incomplete.
+    bool hasFailed() const;
+
+    // Returns false if the samples were dropped, because the file is not open or has failed, or no chunk
+    // is available.
+    bool write(uint32_t signalIndex, const SampleBlock& block);
+
+    // Returns false if the record was dropped, because the file is not open or has failed, or no chunk is
+    // available.
+    bool writeRecord(uint32_t signalIndex, format::RecordKind kind, const std::string& payload);
+
+    Statistics getStatistics() const;
+
+private:
+    struct Column
+    {
+        uint32_t signalIndex{0};
+        ColumnFormat valueFormat;
+        ColumnFormat domainFormat;
+        uint64_t sampleCount{0};
+        std::vector<format::Run> runs;
+        std::vector<uint8_t> values;
+        std::vector<uint8_t> domain;
+        std::vector<uint8_t> records;
+        uint32_t recordCount{0};
+        bool hasTime{false};
+        int64_t firstTick{0};
+        int64_t lastTick{0};
+
+        void clear();
+    };
+
+    struct Chunk
+    {
+        // columns are reused between chunks, so that their buffers keep their capacity
+        std::vector<Column> columns;
+        size_t columnCount{0};
+        size_t size{0};
+
+        Column& getColumn(uint32_t signalIndex);
+        void clear();
+    };
+
+    Column* stageColumn(uint32_t signalIndex);
+    void submitChunk();
+    void ioLoop();
+    void writeChunk(Chunk& chunk);
+    void encodeColumn(const Column& column, format::ColumnHeader& header);
+    void writeIndex();
+    bool writeBuffer(const void* data, size_t size);
+
+    Settings settings;
+    std::FILE* file;
+    uint64_t fileOffset;
+
+    // serializes open and close, which run without holding sync while the I/O thread finishes
+    std::mutex openSync;
+    mutable std::mutex sync;
+    std::condition_variable chunkCv;
+    std::unique_ptr<Chunk> stagingChunk;
+    std::vector<std::unique_ptr<Chunk>> freeChunks;
+    std::deque<std::unique_ptr<Chunk>> writeQueue;
+    bool opened;
+    bool stopping;
+    std::thread ioThread;
+
+    // used by the I/O thread only
+    std::vector<uint8_t> buffer;
+    std::vector<format::IndexEntry> index;
+
+    std::atomic<uint64_t> bytesWritten;
+    std::atomic<uint64_t> chunksWritten;
+    std::atomic<uint64_t> droppedBlocks;
+    std::atomic<uint64_t> writeErrors;
+    std::atomic<bool> failed;
+};
+
+}
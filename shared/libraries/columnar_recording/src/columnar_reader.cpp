@@ -0,0 +1,278 @@
+#include <columnar_recording/columnar_reader.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+
+#if !defined(_WIN32)
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace daq::columnar_recording
+{
+
+namespace
+{
+
+template <typename T>
+T readStruct(const uint8_t* data, size_t size, uint64_t offset, const char* what)
+{
+    if (offset > size || size - offset < sizeof(T))
+        throw std::runtime_error(std::string("Recording file is truncated: ") + what);
+
+    T value;
+    std::memcpy(&value, data + offset, sizeof(T));
+    return value;
+}
+
+}
+
+#if !defined(_WIN32)
+
+FileMapping::FileMapping(const std::string& fileName)
+    : memory(nullptr)
+    , length(0)
+    , mapped(false)
+{
+    const int fd = ::open(fileName.c_str(), O_RDONLY);
+    if (fd < 0)
+        throw std::runtime_error("Failed to open recording file " + fileName);
+
+    struct stat info{};
+    if (::fstat(fd, &info) != 0)
+    {
+        ::close(fd);
+        throw std::runtime_error("Failed to read the size of recording file " + fileName);
+    }
+
+    length = static_cast<size_t>(info.st_size);
+    if (length > 0)
+    {
+        // read-only, so that the samples handed out in place cannot be changed by their consumers
+        void* address = ::mmap(nullptr, length, PROT_READ, MAP_SHARED, fd, 0);
+        if (address == MAP_FAILED)
+        {
+            ::close(fd);
+            throw std::runtime_error("Failed to map recording file " + fileName);
+        }
+
+        memory = static_cast<const uint8_t*>(address);
+        mapped = true;
+    }
+
+    // the mapping stays valid after the descriptor is closed
+    ::close(fd);
+}
+
+FileMapping::~FileMapping()
+{
+    if (mapped)
+        ::munmap(const_cast<uint8_t*>(memory), length);
+}
+
+#else
+
+FileMapping::FileMapping(const std::string& fileName)
+    : memory(nullptr)
+    , length(0)
+    , mapped(false)
+{
+    std::FILE* file = std::fopen(fileName.c_str(), "rb");
+    if (file == nullptr)
+        throw std::runtime_error("Failed to open recording file " + fileName);
+
+    std::fseek(file, 0, SEEK_END);
+    const long fileSize = std::ftell(file);
+    std::fseek(file, 0, SEEK_SET);
+
+    contents.resize(fileSize > 0 ? static_cast<size_t>(fileSize) : 0);
+    const size_t read = std::fread(contents.data(), 1, contents.size(), file);
+    std::fclose(file);
+
+    if (read != contents.size())
+        throw std::runtime_error("Failed to read recording file " + fileName);
+
+    memory = contents.data();
+    length = contents.size();
+}
+
+FileMapping::~FileMapping() = default;
+
+#endif
+
+const uint8_t* FileMapping::data() const
+{
+    return memory;
+}
+
+size_t FileMapping::size() const
+{
+    return length;
+}
+
+bool FileMapping::isMemoryMapped() const
+{
+    return mapped;
+}
+
+std::vector<RecordView> ColumnView::getRecords() const
+{
+    std::vector<RecordView> result;
+    result.reserve(header.recordCount);
+
+    uint64_t position = 0;
+    for (uint32_t i = 0; i < header.recordCount; i++)
+    {
+        const auto recordHeader = readStruct<format::RecordHeader>(records, header.recordsSize, position, "record header");
+        position += sizeof(format::RecordHeader);
+
+        if (header.recordsSize - position < recordHeader.size)
+            throw std::runtime_error("Recording file is truncated: record");
+
+        const auto payload = reinterpret_cast<const char*>(records + position);
+        result.push_back({recordHeader.sampleIndex, static_cast<format::RecordKind>(recordHeader.kind), {payload, recordHeader.size}});
+        position += recordHeader.size;
+    }
+
+    return result;
+}
+
+void ColumnarReader::open(const std::string& fileName)
+{
+    auto newMapping = std::make_shared<FileMapping>(fileName);
+    const uint8_t* data = newMapping->data();
+    const size_t size = newMapping->size();
+
+    const auto fileHeader = readStruct<format::FileHeader>(data, size, 0, "file header");
+    if (std::memcmp(fileHeader.magic, format::FileMagic, sizeof(fileHeader.magic)) != 0)
+        throw std::runtime_error("Not a recording file: " + fileName);
+    if (fileHeader.version != format::Version)
+        throw std::runtime_error("Unsupported recording file version " + std::to_string(fileHeader.version));
+
+    if (size < sizeof(format::Footer))
+        throw std::runtime_error("Recording file is truncated: footer");
+
+    const auto footer = readStruct<format::Footer>(data, size, size - sizeof(format::Footer), "footer");
+    if (std::memcmp(footer.magic, format::FooterMagic, sizeof(footer.magic)) != 0)
+        throw std::runtime_error("Recording file has no index, it was not closed: " + fileName);
+
+    const auto indexHeader = readStruct<format::IndexHeader>(data, size, footer.indexOffset, "index header");
+    if (indexHeader.magic != format::IndexMagic)
+        throw std::runtime_error("Recording file index is corrupted");
+
+    const uint64_t entriesOffset = footer.indexOffset + sizeof(format::IndexHeader);
+    if (indexHeader.entryCount > (size - entriesOffset) / sizeof(format::IndexEntry))
+        throw std::runtime_error("Recording file is truncated: index");
+
+    std::vector<format::IndexEntry> newIndex(indexHeader.entryCount);
+    std::memcpy(newIndex.data(), data + entriesOffset, newIndex.size() * sizeof(format::IndexEntry));
+
+    // the entries of a chunk are consecutive
+    std::vector<size_t> newChunkEntries;
+    for (size_t i = 0; i < newIndex.size(); i++)
+        if (i == 0 || newIndex[i].fileOffset != newIndex[i - 1].fileOffset)
+            newChunkEntries.push_back(i);
+
+    mapping = std::move(newMapping);
+    index = std::move(newIndex);
+    chunkEntries = std::move(newChunkEntries);
+}
+
+void ColumnarReader::close()
+{
+    mapping.reset();
+    index.clear();
+    chunkEntries.clear();
+}
+
+bool ColumnarReader::isOpen() const
+{
+    return mapping != nullptr;
+}
+
+const std::shared_ptr<FileMapping>& ColumnarReader::getMapping() const
+{
+    return mapping;
+}
+
+size_t ColumnarReader::getChunkCount() const
+{
+    return chunkEntries.size();
+}
+
+std::vector<format::IndexEntry> ColumnarReader::getIndexEntries(size_t chunkIndex) const
+{
+    const size_t first = chunkEntries.at(chunkIndex);
+    const size_t last = chunkIndex + 1 < chunkEntries.size() ? chunkEntries[chunkIndex + 1] : index.size();
+    return {index.begin() + first, index.begin() + last};
+}
+
+ChunkView ColumnarReader::getChunk(size_t chunkIndex) const
+{
+    if (!mapping)
+        throw std::runtime_error("Recording file is not open");
+
+    const uint8_t* data = mapping->data();
+    const size_t size = mapping->size();
+    const uint64_t chunkOffset = index[chunkEntries.at(chunkIndex)].fileOffset;
+
+    ChunkView chunk;
+    chunk.header = readStruct<format::ChunkHeader>(data, size, chunkOffset, "chunk header");
+    if (chunk.header.magic != format::ChunkMagic)
+        throw std::runtime_error("Recording file chunk " + std::to_string(chunkIndex) + " is corrupted");
+
+    const uint64_t chunkStart = chunkOffset + sizeof(format::ChunkHeader);
+    if (chunk.header.size > size - chunkStart)
+        throw std::runtime_error("Recording file is truncated: chunk");
+
+    const uint64_t chunkEnd = chunkStart + chunk.header.size;
+    uint64_t position = chunkStart + chunk.header.signalCount * sizeof(format::ColumnHeader);
+    if (position > chunkEnd)
+        throw std::runtime_error("Recording file is truncated: column headers");
+
+    // moves to the next section, checking that the section lies within the chunk
+    const auto section = [&position, chunkEnd, data](uint64_t sectionSize)
+    {
+        if (sectionSize > chunkEnd - position)
+            throw std::runtime_error("Recording file is truncated: column");
+
+        const uint8_t* start = data + position;
+        position = std::min(chunkEnd, position + format::alignSection(sectionSize));
+        return start;
+    };
+
+    chunk.columns.resize(chunk.header.signalCount);
+    for (uint32_t i = 0; i < chunk.header.signalCount; i++)
+    {
+        auto& column = chunk.columns[i];
+        column.header = readStruct<format::ColumnHeader>(data, size, chunkStart + i * sizeof(format::ColumnHeader), "column header");
+
+        column.runs = reinterpret_cast<const format::Run*>(section(uint64_t(column.header.runCount) * sizeof(format::Run)));
+        column.values = section(column.header.valuesSize);
+        column.domain = section(column.header.domainSize);
+        column.records = section(column.header.recordsSize);
+    }
+
+    return chunk;
+}
+
+size_t ColumnarReader::findChunk(uint32_t signalIndex, int64_t tick) const
+{
+    size_t chunkIndex = 0;
+    for (size_t i = 0; i < index.size(); i++)
+    {
+        if (chunkIndex + 1 < chunkEntries.size() && chunkEntries[chunkIndex + 1] == i)
+            chunkIndex++;
+
+        const auto& entry = index[i];
+        if (entry.signalIndex == signalIndex && entry.hasTime && entry.lastTick >= tick)
+            return chunkIndex;
+    }
+
+    return chunkEntries.size();
+}
+
+}
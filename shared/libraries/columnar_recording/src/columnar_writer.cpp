@@ -0,0 +1,421 @@
+#include <columnar_recording/columnar_writer.h>
+#include <algorithm>
+#include <stdexcept>
+
+namespace daq::columnar_recording
+{
+
+namespace
+{
+
+void append(std::vector<uint8_t>& buffer, const void* data, size_t size)
+{
+    const auto bytes = static_cast<const uint8_t*>(data);
+    buffer.insert(buffer.end(), bytes, bytes + size);
+}
+
+void alignSection(std::vector<uint8_t>& buffer)
+{
+    buffer.resize(format::alignSection(buffer.size()), 0);
+}
+
+}
+
+void ColumnarWriter::Column::clear()
+{
+    signalIndex = 0;
+    valueFormat = {};
+    domainFormat = {};
+    sampleCount = 0;
+    runs.clear();
+    values.clear();
+    domain.clear();
+    records.clear();
+    recordCount = 0;
+    hasTime = false;
+    firstTick = 0;
+    lastTick = 0;
+}
+
+ColumnarWriter::Column& ColumnarWriter::Chunk::getColumn(uint32_t signalIndex)
+{
+    for (size_t i = 0; i < columnCount; i++)
+        if (columns[i].signalIndex == signalIndex)
+            return columns[i];
+
+    if (columnCount == columns.size())
+        columns.emplace_back();
+
+    auto& column = columns[columnCount++];
+    column.clear();
+    column.signalIndex = signalIndex;
+    return column;
+}
+
+void ColumnarWriter::Chunk::clear()
+{
+    for (size_t i = 0; i < columnCount; i++)
+        columns[i].clear();
+
+    columnCount = 0;
+    size = 0;
+}
+
+ColumnarWriter::ColumnarWriter()
+    : file(nullptr)
+    , fileOffset(0)
+    , opened(false)
+    , stopping(false)
+    , bytesWritten(0)
+    , chunksWritten(0)
+    , droppedBlocks(0)
+    , writeErrors(0)
+    , failed(false)
+{
+}
+
+ColumnarWriter::~ColumnarWriter()
+{
+    close();
+}
+
+void ColumnarWriter::open(const Settings& settings)
+{
+    std::scoped_lock openLock(openSync);
+    std::scoped_lock lock(sync);
+    if (opened)
+        throw std::runtime_error("Recording file is already open");
+
+    file = std::fopen(settings.fileName.c_str(), "wb");
+    if (file == nullptr)
+        throw std::runtime_error("Failed to create recording file " + settings.fileName);
+
+    // each chunk is written with a single large write, so the buffering of the C library would only add a copy
+    std::setvbuf(file, nullptr, _IONBF, 0);
+
+    this->settings = settings;
+    this->settings.chunkSize = std::max<size_t>(settings.chunkSize, 1);
+    this->settings.chunkCount = std::max<size_t>(settings.chunkCount, 2);
+
+    fileOffset = 0;
+    bytesWritten = 0;
+    chunksWritten = 0;
+    droppedBlocks = 0;
+    writeErrors = 0;
+    failed = false;
+    index.clear();
+
+    format::FileHeader header{};
+    std::memcpy(header.magic, format::FileMagic, sizeof(header.magic));
+    header.version = format::Version;
+    if (!writeBuffer(&header, sizeof(header)))
+    {
+        std::fclose(file);
+        file = nullptr;
+        throw std::runtime_error("Failed to write recording file " + settings.fileName);
+    }
+
+    stagingChunk = std::make_unique<Chunk>();
+    for (size_t i = 1; i < this->settings.chunkCount; i++)
+        freeChunks.push_back(std::make_unique<Chunk>());
+
+    opened = true;
+    stopping = false;
+    ioThread = std::thread(&ColumnarWriter::ioLoop, this);
+}
+
+void ColumnarWriter::close()
+{
+    std::scoped_lock openLock(openSync);
+    {
+        std::scoped_lock lock(sync);
+        if (!opened)
+            return;
+
+        if (stagingChunk && stagingChunk->size > 0)
+            submitChunk();
+
+        opened = false;
+        stopping = true;
+    }
+
+    chunkCv.notify_all();
+    ioThread.join();
+
+    // a failed recording is left without an index, so that readers do not trust the data after the failure
+    if (!failed)
+        writeIndex();
+    std::fclose(file);
+    file = nullptr;
+
+    stagingChunk.reset();
+    freeChunks.clear();
+    writeQueue.clear();
+}
+
+bool ColumnarWriter::isOpen() const
+{
+    std::scoped_lock lock(sync);
+    return opened;
+}
+
+bool ColumnarWriter::hasFailed() const
+{
+    return failed;
+}
+
+bool ColumnarWriter::write(uint32_t signalIndex, const SampleBlock& block)
+{
+    std::scoped_lock lock(sync);
+    if (!opened || failed)
+        return false;
+
+    const size_t size = sizeof(format::Run) + block.valueBytes + block.domainBytes;
+    Column* column = stageColumn(signalIndex);
+
+    // the sample size of a column is fixed within a chunk, so a format change starts a new chunk
+    if (column && !column->runs.empty() && (column->valueFormat != block.valueFormat || column->domainFormat != block.domainFormat))
+    {
+        submitChunk();
+        column = stageColumn(signalIndex);
+    }
+
+    if (!column)
+    {
+        droppedBlocks++;
+        return false;
+    }
+
+    column->valueFormat = block.valueFormat;
+    column->domainFormat = block.domainFormat;
+    column->runs.push_back({block.sampleCount, block.valueBytes, block.domainBytes, block.domainOffset});
+    if (block.valueBytes > 0)
+        append(column->values, block.values, block.valueBytes);
+    if (block.domainBytes > 0)
+        append(column->domain, block.domain, block.domainBytes);
+    column->sampleCount += block.sampleCount;
+
+    if (block.hasTime)
+    {
+        column->firstTick = column->hasTime ? std::min(column->firstTick, block.firstTick) : block.firstTick;
+        column->lastTick = column->hasTime ? std::max(column->lastTick, block.lastTick) : block.lastTick;
+        column->hasTime = true;
+    }
+
+    stagingChunk->size += size;
+    if (stagingChunk->size >= settings.chunkSize)
+        submitChunk();
+
+    return true;
+}
+
+bool ColumnarWriter::writeRecord(uint32_t signalIndex, format::RecordKind kind, const std::string& payload)
+{
+    std::scoped_lock lock(sync);
+    if (!opened || failed)
+        return false;
+
+    const size_t size = sizeof(format::RecordHeader) + payload.size();
+    Column* column = stageColumn(signalIndex);
+    if (!column)
+    {
+        droppedBlocks++;
+        return false;
+    }
+
+    const format::RecordHeader header{column->sampleCount, static_cast<uint32_t>(kind), static_cast<uint32_t>(payload.size())};
+    append(column->records, &header, sizeof(header));
+    append(column->records, payload.data(), payload.size());
+    column->recordCount++;
+
+    stagingChunk->size += size;
+    if (stagingChunk->size >= settings.chunkSize)
+        submitChunk();
+
+    return true;
+}
+
+ColumnarWriter::Statistics ColumnarWriter::getStatistics() const
+{
+    Statistics statistics;
+    statistics.bytesWritten = bytesWritten;
+    statistics.chunksWritten = chunksWritten;
+    statistics.droppedBlocks = droppedBlocks;
+    statistics.writeErrors = writeErrors;
+    return statistics;
+}
+
+ColumnarWriter::Column* ColumnarWriter::stageColumn(uint32_t signalIndex)
+{
+    if (!stagingChunk)
+    {
+        if (freeChunks.empty())
+            return nullptr;
+
+        stagingChunk = std::move(freeChunks.back());
+        freeChunks.pop_back();
+    }
+
+    return &stagingChunk->getColumn(signalIndex);
+}
+
+void ColumnarWriter::submitChunk()
+{
+    writeQueue.push_back(std::move(stagingChunk));
+    if (!freeChunks.empty())
+    {
+        stagingChunk = std::move(freeChunks.back());
+        freeChunks.pop_back();
+    }
+
+    chunkCv.notify_one();
+}
+
+void ColumnarWriter::ioLoop()
+{
+    std::unique_lock lock(sync);
+
+    while (true)
+    {
+        chunkCv.wait(lock, [this] { return stopping || !writeQueue.empty(); });
+        if (writeQueue.empty())
+            break;
+
+        auto chunk = std::move(writeQueue.front());
+        writeQueue.pop_front();
+        lock.unlock();
+
+        writeChunk(*chunk);
+        chunk->clear();
+
+        lock.lock();
+        if (!stagingChunk)
+            stagingChunk = std::move(chunk);
+        else
+            freeChunks.push_back(std::move(chunk));
+    }
+}
+
+void ColumnarWriter::writeChunk(Chunk& chunk)
+{
+    // the chunks that were staged when the recording failed are discarded
+    if (failed)
+        return;
+
+    format::ChunkHeader header{};
+    header.magic = format::ChunkMagic;
+    header.signalCount = static_cast<uint32_t>(chunk.columnCount);
+
+    const size_t columnHeadersOffset = sizeof(format::ChunkHeader);
+    buffer.clear();
+    buffer.resize(columnHeadersOffset + chunk.columnCount * sizeof(format::ColumnHeader));
+
+    for (size_t i = 0; i < chunk.columnCount; i++)
+    {
+        const auto& column = chunk.columns[i];
+
+        format::ColumnHeader columnHeader{};
+        encodeColumn(column, columnHeader);
+        std::memcpy(buffer.data() + columnHeadersOffset + i * sizeof(format::ColumnHeader), &columnHeader, sizeof(columnHeader));
+    }
+
+    header.size = buffer.size() - sizeof(format::ChunkHeader);
+    std::memcpy(buffer.data(), &header, sizeof(header));
+
+    const uint64_t chunkOffset = fileOffset;
+    if (!writeBuffer(buffer.data(), buffer.size()))
+        return;
+
+    // the domain ranges are indexed per signal, as the ticks of different signals are not comparable
+    for (size_t i = 0; i < chunk.columnCount; i++)
+    {
+        const auto& column = chunk.columns[i];
+
+        format::IndexEntry entry{};
+        entry.fileOffset = chunkOffset;
+        entry.signalIndex = column.signalIndex;
+        entry.hasTime = column.hasTime ? 1 : 0;
+        entry.firstTick = column.firstTick;
+        entry.lastTick = column.lastTick;
+        index.push_back(entry);
+    }
+
+    chunksWritten++;
+}
+
+void ColumnarWriter::encodeColumn(const Column& column, format::ColumnHeader& header)
+{
+    header.signalIndex = column.signalIndex;
+    header.valueSampleSize = column.valueFormat.sampleSize;
+    header.domainSampleSize = column.domainFormat.sampleSize;
+    header.sampleCount = column.sampleCount;
+    header.runCount = static_cast<uint32_t>(column.runs.size());
+    header.recordCount = column.recordCount;
+    header.hasTime = column.hasTime ? 1 : 0;
+    header.firstTick = column.firstTick;
+    header.lastTick = column.lastTick;
+
+    // runs are a multiple of the section alignment in size, so the values that follow them stay aligned
+    append(buffer, column.runs.data(), column.runs.size() * sizeof(format::Run));
+
+    // delta encoding is only used when each sample of the column is stored, which excludes implicit rules
+    const auto encode = [this, &column](const std::vector<uint8_t>& data, const ColumnFormat& columnFormat, uint8_t& encoding) -> uint64_t
+    {
+        const size_t start = buffer.size();
+        const bool delta = settings.compress && columnFormat.integer && columnFormat.sampleSize > 0 &&
+                           columnFormat.sampleSize <= sizeof(uint64_t) && data.size() == column.sampleCount * columnFormat.sampleSize;
+
+        if (delta)
+            format::encodeDelta(data.data(), column.sampleCount, columnFormat.sampleSize, columnFormat.isSigned, buffer);
+        else
+            append(buffer, data.data(), data.size());
+
+        encoding = static_cast<uint8_t>(delta ? format::Encoding::Delta : format::Encoding::Raw);
+        const uint64_t size = buffer.size() - start;
+        alignSection(buffer);
+        return size;
+    };
+
+    header.valuesSize = encode(column.values, column.valueFormat, header.valueEncoding);
+    header.domainSize = encode(column.domain, column.domainFormat, header.domainEncoding);
+
+    append(buffer, column.records.data(), column.records.size());
+    header.recordsSize = column.records.size();
+    alignSection(buffer);
+}
+
+void ColumnarWriter::writeIndex()
+{
+    buffer.clear();
+
+    const format::IndexHeader header{format::IndexMagic, 0, index.size()};
+    append(buffer, &header, sizeof(header));
+    append(buffer, index.data(), index.size() * sizeof(format::IndexEntry));
+
+    format::Footer footer{};
+    footer.indexOffset = fileOffset;
+    std::memcpy(footer.magic, format::FooterMagic, sizeof(footer.magic));
+    append(buffer, &footer, sizeof(footer));
+
+    writeBuffer(buffer.data(), buffer.size());
+}
+
+bool ColumnarWriter::writeBuffer(const void* data, size_t size)
+{
+    if (failed)
+        return false;
+
+    // the file position is unknown after a short write, so the recording cannot be continued
+    if (std::fwrite(data, 1, size, file) != size)
+    {
+        writeErrors++;
+        failed = true;
+        return false;
+    }
+
+    fileOffset += size;
+    bytesWritten += size;
+    return true;
+}
+
+}
@@ -0,0 +1,60 @@
+#include <gtest/gtest.h>
+#include <columnar_recording/columnar_writer.h>
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+
+using namespace daq::columnar_recording;
+
+using ColumnarWriterBenchmark = testing::Test;
+
+TEST_F(ColumnarWriterBenchmark, WriteThroughput)
+{
+    // the temporary directory is usually on disk; /dev/shm is a tmpfs on Linux
+    std::vector<std::pair<std::string, std::filesystem::path>> locations{{"Temp", std::filesystem::temp_directory_path()}};
+    if (std::filesystem::is_directory("/dev/shm"))
+        locations.emplace_back("Tmpfs", "/dev/shm");
+
+    constexpr size_t SignalCount = 8;
+    constexpr size_t PacketSize = 1000;
+    constexpr size_t PacketsPerSignal = 1000;
+    std::vector<double> packet(PacketSize, 1.5);
+
+    for (const auto& [name, directory] : locations)
+    {
+        const auto fileName = (directory / "test_columnar_writer_throughput.daqrec").string();
+
+        ColumnarWriter writer;
+        ColumnarWriter::Settings settings;
+        settings.fileName = fileName;
+        settings.chunkCount = 4;
+        writer.open(settings);
+
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < PacketsPerSignal; i++)
+        {
+            for (uint32_t signal = 0; signal < SignalCount; signal++)
+            {
+                SampleBlock block;
+                block.sampleCount = PacketSize;
+                block.valueFormat = {sizeof(double), false, false};
+                block.values = packet.data();
+                block.valueBytes = PacketSize * sizeof(double);
+                block.domainOffset = static_cast<int64_t>(i * PacketSize);
+                writer.write(signal, block);
+            }
+        }
+        writer.close();
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+
+        const auto statistics = writer.getStatistics();
+        ASSERT_EQ(statistics.writeErrors, 0u);
+
+        const auto elapsedUs = std::max<int64_t>(std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count(), 1);
+        RecordProperty(name + "MBPerSecond", std::to_string(statistics.bytesWritten / elapsedUs));
+        RecordProperty(name + "DroppedBlocks", std::to_string(statistics.droppedBlocks));
+
+        std::filesystem::remove(fileName);
+    }
+}
@@ -0,0 +1,424 @@
+#include <gtest/gtest.h>
+#include <columnar_recording/columnar_reader.h>
+#include <columnar_recording/columnar_writer.h>
+
+#include <filesystem>
+#include <limits>
+#include <map>
+#include <random>
+
+using namespace daq::columnar_recording;
+
+using ColumnarWriterTest = testing::Test;
+using ColumnarReaderTest = testing::Test;
+
+namespace
+{
+
+struct ReadColumn
+{
+    std::vector<uint8_t> values;
+    std::vector<uint8_t> domain;
+    std::vector<format::Run> runs;
+    std::vector<std::pair<uint64_t, std::string>> records;
+    uint64_t sampleCount{0};
+};
+
+struct ReadFile
+{
+    size_t chunkCount{0};
+    std::vector<format::IndexEntry> index;
+    std::map<uint32_t, ReadColumn> columns;
+};
+
+std::vector<uint8_t> decodeColumnData(const uint8_t* data, uint64_t size, uint8_t encoding, uint64_t sampleCount, uint8_t sampleSize)
+{
+    if (encoding == static_cast<uint8_t>(format::Encoding::Raw))
+        return std::vector<uint8_t>(data, data + size);
+
+    std::vector<uint8_t> decoded(sampleCount * sampleSize);
+    EXPECT_EQ(format::decodeDelta(data, size, sampleCount, sampleSize, decoded.data()), size);
+    return decoded;
+}
+
+// Reads the whole recording through the chunk index and concatenates the columns of each signal.
+ReadFile readRecording(const std::string& fileName)
+{
+    ColumnarReader reader;
+    reader.open(fileName);
+
+    ReadFile file;
+    file.chunkCount = reader.getChunkCount();
+    for (size_t i = 0; i < reader.getChunkCount(); i++)
+    {
+        const auto entries = reader.getIndexEntries(i);
+        file.index.insert(file.index.end(), entries.begin(), entries.end());
+
+        const auto chunk = reader.getChunk(i);
+        EXPECT_EQ(entries.size(), chunk.columns.size());
+
+        for (size_t j = 0; j < chunk.columns.size(); j++)
+        {
+            const auto& columnView = chunk.columns[j];
+            const auto& header = columnView.header;
+            EXPECT_EQ(entries[j].signalIndex, header.signalIndex);
+            EXPECT_EQ(entries[j].hasTime, header.hasTime);
+            EXPECT_EQ(entries[j].firstTick, header.firstTick);
+            EXPECT_EQ(entries[j].lastTick, header.lastTick);
+
+            auto& column = file.columns[header.signalIndex];
+
+            column.runs.insert(column.runs.end(), columnView.runs, columnView.runs + header.runCount);
+
+            const auto values = decodeColumnData(columnView.values, header.valuesSize, header.valueEncoding, header.sampleCount, header.valueSampleSize);
+            column.values.insert(column.values.end(), values.begin(), values.end());
+
+            const auto domain = decodeColumnData(columnView.domain, header.domainSize, header.domainEncoding, header.sampleCount, header.domainSampleSize);
+            column.domain.insert(column.domain.end(), domain.begin(), domain.end());
+
+            for (const auto& record : columnView.getRecords())
+                column.records.emplace_back(column.sampleCount + record.sampleIndex, std::string(record.payload));
+
+            column.sampleCount += header.sampleCount;
+        }
+    }
+
+    return file;
+}
+
+std::string tempFileName(const std::string& name)
+{
+    return (std::filesystem::temp_directory_path() / name).string();
+}
+
+// Writes `packetCount` packets of Float64 samples with a linear domain to signal 0, with a chunk per packet.
+void writeLinearRecording(const std::string& fileName, size_t packetCount, size_t packetSize)
+{
+    ColumnarWriter writer;
+    ColumnarWriter::Settings settings;
+    settings.fileName = fileName;
+    settings.chunkSize = 1;
+    settings.chunkCount = packetCount + 1;
+    writer.open(settings);
+
+    std::vector<double> packet(packetSize);
+    for (size_t i = 0; i < packetCount; i++)
+    {
+        for (size_t j = 0; j < packetSize; j++)
+            packet[j] = static_cast<double>(i * packetSize + j);
+
+        SampleBlock block;
+        block.sampleCount = packetSize;
+        block.valueFormat = {sizeof(double), false, false};
+        block.values = packet.data();
+        block.valueBytes = packetSize * sizeof(double);
+        block.domainOffset = static_cast<int64_t>(i * packetSize);
+        block.hasTime = true;
+        block.firstTick = block.domainOffset;
+        block.lastTick = block.domainOffset + static_cast<int64_t>(packetSize) - 1;
+        writer.write(0, block);
+    }
+
+    writer.close();
+}
+
+}
+
+TEST_F(ColumnarWriterTest, DeltaRoundTrip)
+{
+    std::mt19937_64 random(42);
+
+    std::vector<int16_t> int16Samples{0, -1, 1, std::numeric_limits<int16_t>::min(), std::numeric_limits<int16_t>::max(), -2};
+    for (int i = 0; i < 1000; i++)
+        int16Samples.push_back(static_cast<int16_t>(random()));
+
+    std::vector<uint8_t> encoded;
+    format::encodeDelta(reinterpret_cast<const uint8_t*>(int16Samples.data()), int16Samples.size(), sizeof(int16_t), true, encoded);
+    std::vector<int16_t> int16Decoded(int16Samples.size());
+    ASSERT_EQ(format::decodeDelta(encoded.data(), encoded.size(), int16Samples.size(), sizeof(int16_t), reinterpret_cast<uint8_t*>(int16Decoded.data())),
+              encoded.size());
+    ASSERT_EQ(int16Decoded, int16Samples);
+
+    std::vector<uint64_t> uint64Samples{0, std::numeric_limits<uint64_t>::max(), 1, std::numeric_limits<uint64_t>::max() / 2};
+    for (int i = 0; i < 1000; i++)
+        uint64Samples.push_back(random());
+
+    encoded.clear();
+    format::encodeDelta(reinterpret_cast<const uint8_t*>(uint64Samples.data()), uint64Samples.size(), sizeof(uint64_t), false, encoded);
+    std::vector<uint64_t> uint64Decoded(uint64Samples.size());
+    ASSERT_EQ(format::decodeDelta(encoded.data(), encoded.size(), uint64Samples.size(), sizeof(uint64_t), reinterpret_cast<uint8_t*>(uint64Decoded.data())),
+              encoded.size());
+    ASSERT_EQ(uint64Decoded, uint64Samples);
+
+    ASSERT_EQ(format::decodeDelta(encoded.data(), 1, 2, sizeof(uint64_t), reinterpret_cast<uint8_t*>(uint64Decoded.data())), 0u);
+}
+
+TEST_F(ColumnarWriterTest, WriteAndReadBack)
+{
+    for (const bool compress : {false, true})
+    {
+        const auto fileName = tempFileName("test_columnar_writer.daqrec");
+
+        ColumnarWriter writer;
+        ColumnarWriter::Settings settings;
+        settings.fileName = fileName;
+        // enough chunks to hold the whole recording, so that nothing is dropped if the disk is slow
+        settings.chunkSize = 16 * 1024;
+        settings.chunkCount = 32;
+        settings.compress = compress;
+        writer.open(settings);
+        ASSERT_TRUE(writer.isOpen());
+
+        ASSERT_TRUE(writer.writeRecord(0, format::RecordKind::SignalInfo, "/dev/sig0"));
+        ASSERT_TRUE(writer.writeRecord(1, format::RecordKind::SignalInfo, "/dev/sig1"));
+
+        // signal 0: Float64 values with a linear domain; signal 1: Int32 values with an explicit Int64 domain
+        std::vector<double> values0;
+        std::vector<int32_t> values1;
+        std::vector<int64_t> domain1;
+        constexpr size_t PacketSize = 100;
+        for (size_t i = 0; i < 100; i++)
+        {
+            std::vector<double> packet0(PacketSize);
+            std::vector<int32_t> packet1(PacketSize);
+            std::vector<int64_t> packetDomain1(PacketSize);
+            for (size_t j = 0; j < PacketSize; j++)
+            {
+                const auto sample = static_cast<int64_t>(i * PacketSize + j);
+                packet0[j] = static_cast<double>(sample) / 3.0;
+                packet1[j] = static_cast<int32_t>(sample % 7) - 3;
+                packetDomain1[j] = sample * 10;
+            }
+
+            SampleBlock block0;
+            block0.sampleCount = PacketSize;
+            block0.valueFormat = {sizeof(double), false, false};
+            block0.values = packet0.data();
+            block0.valueBytes = PacketSize * sizeof(double);
+            block0.domainOffset = static_cast<int64_t>(i * PacketSize);
+            block0.hasTime = true;
+            block0.firstTick = block0.domainOffset;
+            block0.lastTick = block0.domainOffset + PacketSize - 1;
+            ASSERT_TRUE(writer.write(0, block0));
+
+            SampleBlock block1;
+            block1.sampleCount = PacketSize;
+            block1.valueFormat = {sizeof(int32_t), true, true};
+            block1.values = packet1.data();
+            block1.valueBytes = PacketSize * sizeof(int32_t);
+            block1.domainFormat = {sizeof(int64_t), true, true};
+            block1.domain = packetDomain1.data();
+            block1.domainBytes = PacketSize * sizeof(int64_t);
+            block1.hasTime = true;
+            block1.firstTick = packetDomain1.front();
+            block1.lastTick = packetDomain1.back();
+            ASSERT_TRUE(writer.write(1, block1));
+
+            if (i == 50)
+            {
+                ASSERT_TRUE(writer.writeRecord(1, format::RecordKind::Event, "{}"));
+            }
+
+            values0.insert(values0.end(), packet0.begin(), packet0.end());
+            values1.insert(values1.end(), packet1.begin(), packet1.end());
+            domain1.insert(domain1.end(), packetDomain1.begin(), packetDomain1.end());
+        }
+
+        writer.close();
+        ASSERT_FALSE(writer.isOpen());
+
+        const auto statistics = writer.getStatistics();
+        ASSERT_EQ(statistics.droppedBlocks, 0u);
+        ASSERT_EQ(statistics.writeErrors, 0u);
+        ASSERT_EQ(statistics.bytesWritten, std::filesystem::file_size(fileName));
+
+        const auto file = readRecording(fileName);
+        ASSERT_EQ(file.chunkCount, statistics.chunksWritten);
+        ASSERT_GT(file.chunkCount, 1u);
+
+        // each signal is indexed with the domain ranges of its own domain
+        std::map<uint32_t, int64_t> lastTicks;
+        for (const auto& entry : file.index)
+        {
+            ASSERT_TRUE(entry.hasTime);
+            if (lastTicks.count(entry.signalIndex))
+            {
+                ASSERT_LE(lastTicks[entry.signalIndex], entry.firstTick);
+            }
+            lastTicks[entry.signalIndex] = entry.lastTick;
+        }
+        ASSERT_EQ(lastTicks.at(0), 9999);
+        ASSERT_EQ(lastTicks.at(1), 99990);
+
+        const auto& column0 = file.columns.at(0);
+        ASSERT_EQ(column0.sampleCount, values0.size());
+        ASSERT_EQ(std::memcmp(column0.values.data(), values0.data(), column0.values.size()), 0);
+        ASSERT_TRUE(column0.domain.empty());
+        ASSERT_EQ(column0.runs.size(), 100u);
+        ASSERT_EQ(column0.runs[42].domainOffset, 4200);
+        ASSERT_EQ(column0.records.size(), 1u);
+        ASSERT_EQ(column0.records[0], std::make_pair(uint64_t(0), std::string("/dev/sig0")));
+
+        const auto& column1 = file.columns.at(1);
+        ASSERT_EQ(column1.values.size(), values1.size() * sizeof(int32_t));
+        ASSERT_EQ(std::memcmp(column1.values.data(), values1.data(), column1.values.size()), 0);
+        ASSERT_EQ(column1.domain.size(), domain1.size() * sizeof(int64_t));
+        ASSERT_EQ(std::memcmp(column1.domain.data(), domain1.data(), column1.domain.size()), 0);
+        ASSERT_EQ(column1.records.size(), 2u);
+        ASSERT_EQ(column1.records[1], std::make_pair(uint64_t(51 * PacketSize), std::string("{}")));
+
+        std::filesystem::remove(fileName);
+    }
+}
+
+TEST_F(ColumnarWriterTest, Compression)
+{
+    std::vector<uintmax_t> sizes;
+    for (const bool compress : {false, true})
+    {
+        const auto fileName = tempFileName("test_columnar_writer_compression.daqrec");
+
+        ColumnarWriter writer;
+        ColumnarWriter::Settings settings;
+        settings.fileName = fileName;
+        settings.compress = compress;
+        writer.open(settings);
+
+        std::vector<int64_t> timestamps(1000);
+        for (size_t i = 0; i < timestamps.size(); i++)
+            timestamps[i] = 1700000000000 + static_cast<int64_t>(i) * 1000;
+
+        SampleBlock block;
+        block.sampleCount = timestamps.size();
+        block.valueFormat = {sizeof(int64_t), true, true};
+        block.values = timestamps.data();
+        block.valueBytes = timestamps.size() * sizeof(int64_t);
+        ASSERT_TRUE(writer.write(0, block));
+        writer.close();
+
+        sizes.push_back(std::filesystem::file_size(fileName));
+        std::filesystem::remove(fileName);
+    }
+
+    ASSERT_LT(sizes[1] * 3, sizes[0]);
+}
+
+TEST_F(ColumnarWriterTest, NotOpen)
+{
+    ColumnarWriter writer;
+    ASSERT_FALSE(writer.isOpen());
+    ASSERT_FALSE(writer.write(0, SampleBlock()));
+    ASSERT_FALSE(writer.writeRecord(0, format::RecordKind::Event, ""));
+    ASSERT_NO_THROW(writer.close());
+
+    ColumnarWriter::Settings settings;
+    settings.fileName = (std::filesystem::temp_directory_path() / "missing_directory" / "file.daqrec").string();
+    ASSERT_THROW(writer.open(settings), std::runtime_error);
+}
+
+TEST_F(ColumnarWriterTest, WriteErrorFailsRecording)
+{
+    // writes to /dev/full fail with ENOSPC
+    if (!std::filesystem::exists("/dev/full"))
+        GTEST_SKIP() << "/dev/full is not available";
+
+    ColumnarWriter writer;
+    ColumnarWriter::Settings settings;
+    settings.fileName = "/dev/full";
+    ASSERT_THROW(writer.open(settings), std::runtime_error);
+    ASSERT_FALSE(writer.isOpen());
+    ASSERT_TRUE(writer.hasFailed());
+    ASSERT_EQ(writer.getStatistics().writeErrors, 1u);
+    ASSERT_EQ(writer.getStatistics().bytesWritten, 0u);
+    ASSERT_FALSE(writer.write(0, SampleBlock()));
+
+    // opening a new file resets the failure
+    settings.fileName = tempFileName("test_columnar_writer_reopen.daqrec");
+    writer.open(settings);
+    ASSERT_FALSE(writer.hasFailed());
+    writer.close();
+    std::filesystem::remove(settings.fileName);
+}
+
+TEST_F(ColumnarReaderTest, ReadInPlace)
+{
+    const auto fileName = tempFileName("test_columnar_reader.daqrec");
+    constexpr size_t PacketSize = 100;
+    writeLinearRecording(fileName, 10, PacketSize);
+
+    ColumnarReader reader;
+    reader.open(fileName);
+    ASSERT_TRUE(reader.isOpen());
+    ASSERT_EQ(reader.getChunkCount(), 10u);
+#if !defined(_WIN32)
+    ASSERT_TRUE(reader.getMapping()->isMemoryMapped());
+#endif
+
+    for (size_t i = 0; i < reader.getChunkCount(); i++)
+    {
+        const auto chunk = reader.getChunk(i);
+        ASSERT_EQ(chunk.columns.size(), 1u);
+
+        const auto& column = chunk.columns[0];
+        ASSERT_EQ(column.header.valueEncoding, static_cast<uint8_t>(format::Encoding::Raw));
+        ASSERT_EQ(column.header.sampleCount, PacketSize);
+        ASSERT_EQ(column.runs[0].domainOffset, static_cast<int64_t>(i * PacketSize));
+
+        // raw samples are aligned, so they can be used without copying
+        ASSERT_EQ(reinterpret_cast<uintptr_t>(column.values) % alignof(double), 0u);
+        const auto values = reinterpret_cast<const double*>(column.values);
+        ASSERT_EQ(values[0], static_cast<double>(i * PacketSize));
+        ASSERT_EQ(values[PacketSize - 1], static_cast<double>((i + 1) * PacketSize - 1));
+    }
+
+    // the mapping outlives the reader
+    const auto chunk = reader.getChunk(0);
+    const auto mapping = reader.getMapping();
+    reader.close();
+    ASSERT_FALSE(reader.isOpen());
+    ASSERT_EQ(reinterpret_cast<const double*>(chunk.columns[0].values)[1], 1.0);
+
+    std::filesystem::remove(fileName);
+}
+
+TEST_F(ColumnarReaderTest, FindChunk)
+{
+    const auto fileName = tempFileName("test_columnar_reader_seek.daqrec");
+    writeLinearRecording(fileName, 10, 100);
+
+    ColumnarReader reader;
+    reader.open(fileName);
+    ASSERT_EQ(reader.findChunk(0, std::numeric_limits<int64_t>::min()), 0u);
+    ASSERT_EQ(reader.findChunk(0, 99), 0u);
+    ASSERT_EQ(reader.findChunk(0, 100), 1u);
+    ASSERT_EQ(reader.findChunk(0, 555), 5u);
+    ASSERT_EQ(reader.findChunk(0, 999), 9u);
+    ASSERT_EQ(reader.findChunk(0, 1000), 10u);
+
+    // a signal that is not in the recording is never found
+    ASSERT_EQ(reader.findChunk(1, 0), 10u);
+
+    reader.close();
+    std::filesystem::remove(fileName);
+}
+
+TEST_F(ColumnarReaderTest, InvalidFiles)
+{
+    ColumnarReader reader;
+    ASSERT_THROW(reader.open(tempFileName("missing_recording.daqrec")), std::runtime_error);
+    ASSERT_THROW(reader.getChunk(0), std::runtime_error);
+
+    const auto fileName = tempFileName("test_columnar_reader_invalid.daqrec");
+    writeLinearRecording(fileName, 4, 100);
+    const auto size = std::filesystem::file_size(fileName);
+
+    // a recording that was not closed has no index
+    std::filesystem::resize_file(fileName, size - sizeof(format::Footer) / 2);
+    ASSERT_THROW(reader.open(fileName), std::runtime_error);
+    ASSERT_FALSE(reader.isOpen());
+
+    std::filesystem::resize_file(fileName, 4);
+    ASSERT_THROW(reader.open(fileName), std::runtime_error);
+
+    std::filesystem::remove(fileName);
+}
@@ -40,6 +40,9 @@ public:
 
     ErrCode INTERFACE_FUNC assignSignal(ISignal* signal) override;
 
+    // the statistics of the input port on the server; the local connection does not pass packets
+    ErrCode INTERFACE_FUNC getStatistics(IDict** statistics) override;
+
     static ErrCode Deserialize(ISerializedObject* serialized, IBaseObject* context, IFunction* factoryCallback, IBaseObject** obj);
 
 protected:
@@ -60,6 +63,18 @@ inline ConfigClientInputPortImpl::ConfigClientInputPortImpl(const ConfigProtocol
 {
 }
 
+inline ErrCode ConfigClientInputPortImpl::getStatistics(IDict** statistics)
+{
+    OPENDAQ_PARAM_NOT_NULL(statistics);
+
+    return daqTry(
+        [this, &statistics]
+        {
+            *statistics = clientComm->getPacketStatistics(remoteGlobalId).asPtr<IDict>().detach();
+            return OPENDAQ_SUCCESS;
+        });
+}
+
 inline ErrCode ConfigClientInputPortImpl::connect(ISignal* signal)
 {
     OPENDAQ_PARAM_NOT_NULL(signal);
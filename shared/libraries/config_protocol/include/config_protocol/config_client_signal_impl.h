@@ -41,6 +41,7 @@ public:
     // IConfigClientSignalPrivate
     void INTERFACE_FUNC assignDomainSignal(const SignalPtr& domainSignal) override;
     ErrCode INTERFACE_FUNC getLastValue(IBaseObject** value) override;
+    ErrCode INTERFACE_FUNC getStatistics(IDict** statistics) override;
 
     StringPtr onGetRemoteId() const override;
     Bool onTriggerEvent(const EventPacketPtr& eventPacket) override;
@@ -173,7 +174,7 @@ inline ErrCode ConfigClientSignalImpl::getLastValue(IBaseObject** value)
     {
         std::scoped_lock lock(this->sync);
 
-        if (lastDataPacket.assigned())
+        if (lastDataPacket.assigned() || lastValue.assigned())
             return Super::getLastValue(value);
     }
 
@@ -193,6 +194,28 @@ inline ErrCode ConfigClientSignalImpl::getLastValue(IBaseObject** value)
     return OPENDAQ_SUCCESS;
 }
 
+inline ErrCode ConfigClientSignalImpl::getStatistics(IDict** statistics)
+{
+    OPENDAQ_PARAM_NOT_NULL(statistics);
+
+    try
+    {
+        *statistics = this->clientComm->getPacketStatistics(this->remoteGlobalId).asPtr<IDict>().detach();
+        return OPENDAQ_SUCCESS;
+    }
+    catch (const DaqException& e)
+    {
+        // servers without packet statistics; the counters of the packets streamed to this client are returned instead
+        LOG_W("getPacketStatistics() RPC failed: {}", e.what());
+    }
+    catch (const std::exception& e)
+    {
+        return errorFromException(e);
+    }
+
+    return Super::getStatistics(statistics);
+}
+
 inline void ConfigClientSignalImpl::attributeChanged(const CoreEventArgsPtr& args)
 {
     const std::string attrName = args.getParameters().get("AttributeName");
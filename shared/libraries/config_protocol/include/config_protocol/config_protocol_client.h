@@ -54,6 +54,7 @@ public:
     BaseObjectPtr callProperty(const std::string& globalId, const std::string& propertyName, const BaseObjectPtr& params);
     void setAttributeValue(const std::string& globalId, const std::string& attributeName, const BaseObjectPtr& attributeValue);
     BaseObjectPtr getLastValue(const std::string& globalId);
+    BaseObjectPtr getPacketStatistics(const std::string& globalId);
 
     void beginUpdate(const std::string& globalId, const std::string& path);
     void endUpdate(const std::string& globalId, const std::string& path);
@@ -17,6 +17,7 @@
 #pragma once
 #include <opendaq/device_ptr.h>
 #include <coreobjects/property_object_protected.h>
+#include <opendaq/packet_statistics_ptr.h>
 
 namespace daq::config_protocol
 {
@@ -33,6 +34,7 @@ public:
     static BaseObjectPtr endUpdate(const ComponentPtr& component, const ParamsDictPtr& params);
     static BaseObjectPtr setAttributeValue(const ComponentPtr& component, const ParamsDictPtr& params);
     static BaseObjectPtr update(const ComponentPtr& component, const ParamsDictPtr& params);
+    static BaseObjectPtr getPacketStatistics(const ComponentPtr& component, const ParamsDictPtr& params);
 };
 
 inline BaseObjectPtr ConfigServerComponent::getPropertyValue(const ComponentPtr& component, const ParamsDictPtr& params)
@@ -158,4 +160,13 @@ inline BaseObjectPtr ConfigServerComponent::update(const ComponentPtr& component
     return nullptr;
 }
 
+inline BaseObjectPtr ConfigServerComponent::getPacketStatistics(const ComponentPtr& component, const ParamsDictPtr& /*params*/)
+{
+    const auto statistics = component.asPtrOrNull<IPacketStatistics>();
+    if (!statistics.assigned())
+        throw NoInterfaceException("Component does not provide packet statistics");
+
+    return statistics.getStatistics();
+}
+
 }
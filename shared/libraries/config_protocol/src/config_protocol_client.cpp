@@ -168,6 +168,16 @@ BaseObjectPtr ConfigProtocolClientComm::getLastValue(const std::string& globalId
     return parseRpcReplyPacketBuffer(getPropertyValueRpcReplyPacketBuffer, deserializeContext);
 }
 
+BaseObjectPtr ConfigProtocolClientComm::getPacketStatistics(const std::string& globalId)
+{
+    auto dict = Dict<IString, IBaseObject>();
+    dict.set("ComponentGlobalId", String(globalId));
+    auto getPacketStatisticsRpcRequestPacketBuffer = createRpcRequestPacketBuffer(generateId(), "GetPacketStatistics", dict);
+    const auto getPacketStatisticsRpcReplyPacketBuffer = sendRequestCallback(getPacketStatisticsRpcRequestPacketBuffer);
+
+    return parseRpcReplyPacketBuffer(getPacketStatisticsRpcReplyPacketBuffer);
+}
+
 BaseObjectPtr ConfigProtocolClientComm::createRpcRequest(const StringPtr& name, const ParamsDictPtr& params) const
 {
     auto obj = Dict<IString, IBaseObject>();
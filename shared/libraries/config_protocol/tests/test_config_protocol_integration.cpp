@@ -13,6 +13,7 @@
 #include <config_protocol/config_client_device_impl.h>
 
 #include "opendaq/packet_factory.h"
+#include <opendaq/packet_statistics_ptr.h>
 
 using namespace daq;
 using namespace config_protocol;
@@ -539,6 +540,20 @@ TEST_F(ConfigProtocolIntegrationTest, TestGetLastValue)
     ASSERT_EQ(integerPtr2, 7);
 }
 
+TEST_F(ConfigProtocolIntegrationTest, TestGetPacketStatistics)
+{
+    const SignalConfigPtr serverSignal = serverDevice.getSignals()[0];
+    const SignalConfigPtr clientSignal = clientDevice.getSignals()[0];
+
+    serverSignal.asPtr<IPacketStatistics>().resetStatistics();
+    serverSignal.sendPacket(DataPacket(serverSignal.getDescriptor(), 5));
+    serverSignal.sendPacket(DataPacket(serverSignal.getDescriptor(), 2));
+
+    const auto statistics = clientSignal.asPtr<IPacketStatistics>().getStatistics();
+    ASSERT_EQ(statistics.get("PacketsSent"), 2);
+    ASSERT_EQ(statistics.get("SamplesSent"), 7);
+}
+
 TEST_F(ConfigProtocolIntegrationTest, DeviceInfoChanges)
 {
     const auto serverDeviceInfo = serverDevice.getInfo();
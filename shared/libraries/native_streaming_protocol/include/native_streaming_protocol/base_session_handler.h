@@ -17,6 +17,7 @@
 #pragma once
 
 #include <native_streaming_protocol/native_streaming_protocol_types.h>
+#include <native_streaming_protocol/session_write_queue.h>
 #include <native_streaming/session.hpp>
 
 #include <opendaq/context_ptr.h>
@@ -47,7 +48,18 @@ public:
 
     void startConnectionActivityMonitoring(Int period, Int timeout);
 
+    /// Gets the size in bytes of the messages scheduled for writing which have not been written to the socket yet.
+    size_t getPendingWriteSize() const;
+
+    /// Sets the limits of the batches in which streaming packets are written. See SessionWriteQueue::setLimits.
+    void setWriteBatchLimits(size_t maxBatchSize, std::chrono::microseconds maxBatchDelay);
+
 protected:
+    /// Schedules the message for writing right away.
+    void scheduleWrite(std::vector<daq::native_streaming::WriteTask>& tasks);
+    /// Adds the message to the batch of streaming packets written together.
+    void scheduleBatchedWrite(std::vector<daq::native_streaming::WriteTask>& tasks);
+
     virtual daq::native_streaming::ReadTask readHeader(const void* data, size_t size);
     daq::native_streaming::ReadTask readConfigurationPacket(const void *data, size_t size);
     daq::native_streaming::ReadTask readPacketBuffer(const void* data, size_t size);
@@ -80,5 +92,6 @@ protected:
     std::shared_ptr<boost::asio::steady_timer> connectionInactivityTimer;
     LoggerComponentPtr loggerComponent;
     bool connectionActivityMonitoringStarted{false};
+    std::shared_ptr<SessionWriteQueue> writeQueue;
 };
 END_NAMESPACE_OPENDAQ_NATIVE_STREAMING_PROTOCOL
@@ -17,12 +17,17 @@
 #pragma once
 
 #include <native_streaming_protocol/base_session_handler.h>
+#include <native_streaming_protocol/shared_memory_ring.h>
 
 #include <opendaq/data_descriptor_ptr.h>
 
+#include <atomic>
+#include <mutex>
+#include <vector>
+
 BEGIN_NAMESPACE_OPENDAQ_NATIVE_STREAMING_PROTOCOL
 
-class ClientSessionHandler : public BaseSessionHandler
+class ClientSessionHandler : public BaseSessionHandler, public std::enable_shared_from_this<ClientSessionHandler>
 {
 public:
     ClientSessionHandler(const ContextPtr& daqContext,
@@ -38,6 +43,12 @@ public:
     void sendTransportLayerProperties(const PropertyObjectPtr& properties);
     void sendStreamingRequest();
 
+    /// Accepts shared memory segments offered by the server; must be called before reading starts.
+    /// Packets reference the read-only segment unless writable packets are requested, in which
+    /// case each payload is copied out of the segment.
+    void enableSharedMemory(bool writablePackets);
+    bool isSharedMemoryActive() const;
+
 private:
     daq::native_streaming::ReadTask readHeader(const void* data, size_t size) override;
 
@@ -45,9 +56,24 @@ private:
     daq::native_streaming::ReadTask readSignalUnavailable(const void* data, size_t size);
     daq::native_streaming::ReadTask readSignalSubscribedAck(const void* data, size_t size);
     daq::native_streaming::ReadTask readSignalUnsubscribedAck(const void* data, size_t size);
+    daq::native_streaming::ReadTask readSharedMemoryControl(const void* data, size_t size);
+    daq::native_streaming::ReadTask readSharedMemoryPacketBuffer(const void* data, size_t size);
+
+    void sendSharedMemoryControl(SharedMemoryControlType controlType);
+    void queueSharedMemoryRelease(uint64_t offset);
+    void flushSharedMemoryReleases();
 
     OnSignalCallback signalReceivedHandler;
     OnStreamingInitDoneCallback streamingInitDoneHandler;
     OnSubscriptionAckCallback subscriptionAckHandler;
+
+    bool sharedMemoryEnabled;
+    bool sharedMemoryWritablePackets;
+    std::atomic<bool> sharedMemoryActive;
+    SharedMemoryMappingPtr sharedMemoryMapping;
+
+    std::mutex sharedMemoryReleaseSync;
+    std::vector<uint64_t> pendingSharedMemoryReleases;
+    bool sharedMemoryReleaseScheduled;
 };
 END_NAMESPACE_OPENDAQ_NATIVE_STREAMING_PROTOCOL
@@ -30,6 +30,7 @@
 #include <packet_streaming/packet_streaming_server.h>
 
 #include <future>
+#include <vector>
 
 BEGIN_NAMESPACE_OPENDAQ_NATIVE_STREAMING_PROTOCOL
 
@@ -59,6 +60,14 @@ using OnSignalAvailableCallback = std::function<void(const StringPtr& signalStri
                                                      const StringPtr& serializedSignal)>;
 using OnSignalUnavailableCallback = std::function<void(const StringPtr& signalStringId)>;
 using OnPacketCallback = std::function<void(const StringPtr& signalStringId, const PacketPtr& packet)>;
+
+struct ReceivedPacket
+{
+    SignalNumericIdType signalNumericId;
+    PacketPtr packet;
+};
+using ReceivedPackets = std::vector<ReceivedPacket>;
+using OnPacketsCallback = std::function<void(ReceivedPackets&& packets)>;
 using OnSignalSubscriptionAckCallback = std::function<void(const StringPtr& signalStringId, bool subscribed)>;
 using OnConnectionStatusChangedCallback = std::function<void(ClientConnectionStatus status)>;
 
@@ -87,6 +96,9 @@ public:
 
     std::shared_ptr<boost::asio::io_context> getIoContext();
 
+    /// Returns true if packet payloads of the current session are received through shared memory.
+    bool isSharedMemoryActive();
+
     void resetStreamingHandlers();
     void setStreamingHandlers(const OnSignalAvailableCallback& signalAvailableHandler,
                               const OnSignalUnavailableCallback& signalUnavailableHandler,
@@ -95,6 +107,18 @@ public:
                               const OnConnectionStatusChangedCallback& connectionStatusChangedCb,
                               const OnStreamingInitDoneCallback& streamingInitDoneCb);
 
+    /*!
+     * @brief Sets a handler invoked once with all packets decoded from a single received packet buffer.
+     * When set, it is used instead of the per-packet handler passed to `setStreamingHandlers`.
+     */
+    void setPacketsHandler(const OnPacketsCallback& packetsHandler);
+
+    /*!
+     * @brief Gets the string Id of the signal currently registered under the numeric Id.
+     * @returns The string Id or nullptr if no signal with the numeric Id is available.
+     */
+    StringPtr getSignalStringId(SignalNumericIdType signalNumericId);
+
     void resetConfigHandlers();
     void setConfigHandlers(const ProcessConfigProtocolPacketCb& configPacketHandler,
                            const OnConnectionStatusChangedCallback& connectionStatusChangedCb);
@@ -102,6 +126,7 @@ public:
 protected:
     PropertyObjectPtr normalizeAuthenticationObject(const PropertyObjectPtr& authenticationObject);
     void manageTransportLayerProps();
+    static bool isLoopbackHost(const std::string& host);
     void initClientSessionHandler(SessionPtr session);
     daq::native_streaming::Authentication initClientAuthenticationObject(const PropertyObjectPtr& authenticationObject);
     void initClient(std::string host,
@@ -139,6 +164,7 @@ protected:
     OnSignalAvailableCallback signalAvailableHandler;
     OnSignalUnavailableCallback signalUnavailableHandler;
     OnPacketCallback packetHandler;
+    OnPacketsCallback packetsHandler;
     OnSignalSubscriptionAckCallback signalSubscriptionAckCallback;
     OnConnectionStatusChangedCallback connectionStatusChangedStreamingCb;
     OnStreamingInitDoneCallback streamingInitDoneCb;
@@ -169,6 +195,9 @@ protected:
     Int connectionInactivityTimeout;
     std::chrono::milliseconds connectionTimeout;
     std::chrono::milliseconds reconnectionPeriod;
+    bool sharedMemoryEnabled{false};
+    bool sharedMemoryRequested{false};
+    bool sharedMemoryWritablePackets{false};
 };
 
 END_NAMESPACE_OPENDAQ_NATIVE_STREAMING_PROTOCOL
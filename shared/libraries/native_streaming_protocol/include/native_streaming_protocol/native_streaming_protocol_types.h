@@ -72,7 +72,17 @@ enum class PayloadType
     PAYLOAD_TYPE_STREAMING_SIGNAL_UNSUBSCRIBE_ACK = 8,
     PAYLOAD_TYPE_CONFIGURATION_PACKET = 9,
     PAYLOAD_TYPE_TRANSPORT_LAYER_PROPERTIES = 10,
-    PAYLOAD_TYPE_STREAMING_PROTOCOL_INIT_REQUEST = 11
+    PAYLOAD_TYPE_STREAMING_PROTOCOL_INIT_REQUEST = 11,
+    PAYLOAD_TYPE_STREAMING_PACKET_SHARED_MEMORY = 12,
+    PAYLOAD_TYPE_SHARED_MEMORY_CONTROL = 13,
+    PAYLOAD_TYPE_SHARED_MEMORY_RELEASE = 14
+};
+
+enum class SharedMemoryControlType : uint8_t
+{
+    SHARED_MEMORY_OFFER = 0,
+    SHARED_MEMORY_ACCEPT = 1,
+    SHARED_MEMORY_DECLINE = 2
 };
 
 constexpr std::initializer_list<PayloadType> allPayloadTypes =
@@ -87,7 +97,10 @@ constexpr std::initializer_list<PayloadType> allPayloadTypes =
         PayloadType::PAYLOAD_TYPE_STREAMING_SIGNAL_UNSUBSCRIBE_ACK,
         PayloadType::PAYLOAD_TYPE_CONFIGURATION_PACKET,
         PayloadType::PAYLOAD_TYPE_TRANSPORT_LAYER_PROPERTIES,
-        PayloadType::PAYLOAD_TYPE_STREAMING_PROTOCOL_INIT_REQUEST
+        PayloadType::PAYLOAD_TYPE_STREAMING_PROTOCOL_INIT_REQUEST,
+        PayloadType::PAYLOAD_TYPE_STREAMING_PACKET_SHARED_MEMORY,
+        PayloadType::PAYLOAD_TYPE_SHARED_MEMORY_CONTROL,
+        PayloadType::PAYLOAD_TYPE_SHARED_MEMORY_RELEASE
     };
 
 inline std::string convertPayloadTypeToString(PayloadType type)
@@ -116,6 +129,12 @@ inline std::string convertPayloadTypeToString(PayloadType type)
             return "PAYLOAD_TYPE_TRANSPORT_LAYER_PROPERTIES";
         case PayloadType::PAYLOAD_TYPE_STREAMING_PROTOCOL_INIT_REQUEST:
             return "PAYLOAD_TYPE_STREAMING_PROTOCOL_INIT_REQUEST";
+        case PayloadType::PAYLOAD_TYPE_STREAMING_PACKET_SHARED_MEMORY:
+            return "PAYLOAD_TYPE_STREAMING_PACKET_SHARED_MEMORY";
+        case PayloadType::PAYLOAD_TYPE_SHARED_MEMORY_CONTROL:
+            return "PAYLOAD_TYPE_SHARED_MEMORY_CONTROL";
+        case PayloadType::PAYLOAD_TYPE_SHARED_MEMORY_RELEASE:
+            return "PAYLOAD_TYPE_SHARED_MEMORY_RELEASE";
     }
 
     return "PAYLOAD_TYPE_INVALID";
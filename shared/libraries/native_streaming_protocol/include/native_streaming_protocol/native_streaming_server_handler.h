@@ -53,6 +53,28 @@ public:
 
     void sendPacket(const SignalPtr& signal, const PacketPtr& packet);
 
+    /// Sets the size of the shared memory segment offered to same-host clients; 0 disables it.
+    void setSharedMemoryRingSize(size_t size);
+
+    /// Sets the bandwidth budget of clients connecting afterwards; 0 for both values disables it.
+    /// See StreamingManager::setClientBandwidthBudget.
+    void setClientBandwidthBudget(size_t bytesPerSecond, size_t maxPendingWriteSize);
+
+    /// Sets the codec of data packet payloads sent to clients which requested payload compression.
+    void setPayloadCodec(packet_streaming::PayloadCodec codec);
+
+    /// Sets the codec of data packet payloads of the signal sent to clients which requested payload compression.
+    /// @throw NativeStreamingProtocolException if the signal is not added.
+    void setSignalPayloadCodec(const SignalPtr& signal, packet_streaming::PayloadCodec codec);
+
+    /// Sets the policy applied to data of signals sent to clients which exceed the bandwidth budget.
+    /// @throw NativeStreamingProtocolException if the factor is not valid for the policy.
+    void setDegradationPolicy(DegradationPolicy policy, size_t factor);
+
+    /// Sets the policy applied to data of the signal sent to clients which exceed the bandwidth budget.
+    /// @throw NativeStreamingProtocolException if the signal is not added or the factor is not valid for the policy.
+    void setSignalDegradationPolicy(const SignalPtr& signal, DegradationPolicy policy, size_t factor);
+
 protected:
     void initSessionHandler(SessionPtr session);
     void handleTransportLayerProps(const PropertyObjectPtr& propertyObject, std::shared_ptr<ServerSessionHandler> sessionHandler);
@@ -66,6 +88,7 @@ protected:
                                   bool subscribe,
                                   const std::string& clientId);
     bool onAuthenticate(const daq::native_streaming::Authentication& authentication, std::shared_ptr<void>& userContextOut);
+    SharedMemoryRingPtr createSharedMemoryRing();
 
     ContextPtr context;
     std::shared_ptr<boost::asio::io_context> ioContextPtr;
@@ -84,6 +107,11 @@ protected:
 
     std::mutex sync;
     size_t connectedClientIndex;
+
+    size_t sharedMemoryRingSize;
+
+    size_t clientBandwidthBudget;
+    size_t clientMaxPendingWriteSize;
 };
 
 END_NAMESPACE_OPENDAQ_NATIVE_STREAMING_PROTOCOL
@@ -17,10 +17,14 @@
 #pragma once
 
 #include <native_streaming_protocol/base_session_handler.h>
+#include <native_streaming_protocol/shared_memory_ring.h>
 
 #include <opendaq/context_ptr.h>
 #include <opendaq/signal_ptr.h>
 
+#include <mutex>
+#include <unordered_map>
+
 BEGIN_NAMESPACE_OPENDAQ_NATIVE_STREAMING_PROTOCOL
 
 class ServerSessionHandler : public BaseSessionHandler
@@ -38,6 +42,15 @@ public:
     void sendStreamingInitDone();
     void sendSubscribingDone(const SignalNumericIdType signalNumericId);
     void sendUnsubscribingDone(const SignalNumericIdType signalNumericId);
+    void sendSharedMemoryOffer(const SharedMemoryRingPtr& ring);
+
+    /// Sends the packet payload through the shared memory ring once the client accepted it,
+    /// or inline when shared memory is not in use or the ring is full.
+    void sendStreamingPacketBuffer(const packet_streaming::PacketBufferPtr& packetBuffer);
+
+    /// Drops the shared memory ring of the session. Blocks the client has not released yet
+    /// stay readable through the client's mapping.
+    void releaseSharedMemory();
 
     void setTransportLayerPropsHandler(const OnTrasportLayerPropertiesCallback& transportLayerPropsHandler);
     void setStreamingInitHandler(const OnStreamingRequestCallback& streamingInitHandler);
@@ -47,6 +60,8 @@ public:
 
     void setReconnected(bool reconnected);
     bool getReconnected();
+    void setSupportedPayloadCodecs(uint32_t supportedPayloadCodecs);
+    uint32_t getSupportedPayloadCodecs();
     UserPtr getUser();
 
 private:
@@ -55,6 +70,8 @@ private:
     daq::native_streaming::ReadTask readSignalSubscribe(const void* data, size_t size);
     daq::native_streaming::ReadTask readSignalUnsubscribe(const void* data, size_t size);
     daq::native_streaming::ReadTask readTransportLayerProperties(const void* data, size_t size);
+    daq::native_streaming::ReadTask readSharedMemoryControl(const void* data, size_t size);
+    daq::native_streaming::ReadTask readSharedMemoryRelease(const void* data, size_t size);
 
     OnStreamingRequestCallback streamingInitHandler;
     OnSignalSubscriptionCallback signalSubscriptionHandler;
@@ -62,5 +79,11 @@ private:
 
     std::string clientId;
     bool reconnected;
+    uint32_t supportedPayloadCodecs;
+
+    std::mutex sharedMemorySync;
+    SharedMemoryRingPtr offeredSharedMemoryRing;
+    SharedMemoryRingPtr sharedMemoryRing;
+    std::unordered_map<uint64_t, size_t> sharedMemoryBlocks;
 };
 END_NAMESPACE_OPENDAQ_NATIVE_STREAMING_PROTOCOL
@@ -0,0 +1,112 @@
+/*
+ * Copyright 2022-2024 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <native_streaming_protocol/native_streaming_protocol_types.h>
+
+#include <boost/asio/steady_timer.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+BEGIN_NAMESPACE_OPENDAQ_NATIVE_STREAMING_PROTOCOL
+
+using WriteTasksCallback = std::function<void(std::vector<daq::native_streaming::WriteTask>& tasks)>;
+
+/// Gathers the messages written to a session into batches, each scheduled as a single write of all
+/// its buffers. Streaming packet buffers are held in the batch until it reaches the size limit, or
+/// until the batch delay expires; other messages are scheduled at once along with the batched ones,
+/// so the order of messages is kept. Batches are reused, so queuing a packet buffer does not allocate
+/// once the batch storage has grown to the usual batch size.
+class SessionWriteQueue : public std::enable_shared_from_this<SessionWriteQueue>
+{
+public:
+    static constexpr size_t DefaultMaxBatchSize = 256 * 1024;
+    static constexpr size_t MaxBatchMessages = 1024;
+
+    /// @param ioContextPtr The context running the delayed flushes of the batches.
+    /// @param writeTasksCb The callback scheduling the write of a batch, usually Session::scheduleWrite.
+    SessionWriteQueue(const std::shared_ptr<boost::asio::io_context>& ioContextPtr, WriteTasksCallback writeTasksCb);
+    ~SessionWriteQueue();
+
+    SessionWriteQueue(const SessionWriteQueue&) = delete;
+    SessionWriteQueue& operator=(const SessionWriteQueue&) = delete;
+
+    /// Sets the limits of a batch of packet buffers.
+    /// @param maxBatchSize The size in bytes at which a batch is scheduled for writing.
+    /// @param maxBatchDelay The time a batch waits for further packet buffers. With 0, the batch
+    /// is scheduled once the io context runs the pending handlers.
+    void setLimits(size_t maxBatchSize, std::chrono::microseconds maxBatchDelay);
+
+    /// Schedules the message for writing right away, together with the batched messages.
+    void write(std::vector<daq::native_streaming::WriteTask>& tasks);
+
+    /// Adds the message to the current batch.
+    void writeBatched(std::vector<daq::native_streaming::WriteTask>& tasks);
+
+    /// Adds a message with a transport header followed by the packet buffer to the current batch.
+    /// The packet buffer is kept alive until the batch is written.
+    void writePacketBuffer(PayloadType payloadType, const packet_streaming::PacketBufferPtr& packetBuffer);
+
+    /// Schedules the current batch for writing.
+    void flush();
+
+    /// Gets the size in bytes of the messages queued or scheduled for writing which have not been written yet.
+    size_t getPendingWriteSize() const;
+
+    /// Gets the number of writes scheduled so far.
+    size_t getWriteCount() const;
+
+private:
+    struct Batch
+    {
+        std::vector<daq::native_streaming::WriteTask> tasks;
+        std::vector<PackedHeaderType> headers;
+        std::vector<packet_streaming::PacketBufferPtr> packetBuffers;
+        size_t size{0};
+        size_t messageCount{0};
+        std::atomic<bool> completed{false};
+    };
+
+    void addTasks(std::vector<daq::native_streaming::WriteTask>& tasks);
+    void scheduleFlush();
+    void flushBatch();
+    std::unique_ptr<Batch> acquireBatch();
+    void releaseBatch(Batch* batch);
+
+    std::shared_ptr<boost::asio::io_context> ioContextPtr;
+    WriteTasksCallback writeTasksCb;
+    boost::asio::steady_timer flushTimer;
+
+    std::mutex sync;
+    std::unique_ptr<Batch> batch;
+    std::vector<daq::native_streaming::WriteTask> writeTasks;
+    bool flushScheduled;
+    size_t maxBatchSize;
+    std::chrono::microseconds maxBatchDelay;
+
+    std::mutex freeBatchesSync;
+    std::vector<std::unique_ptr<Batch>> freeBatches;
+
+    std::atomic<size_t> pendingWriteSize;
+    std::atomic<size_t> writeCount;
+};
+
+END_NAMESPACE_OPENDAQ_NATIVE_STREAMING_PROTOCOL
@@ -0,0 +1,109 @@
+/*
+ * Copyright 2022-2024 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <native_streaming_protocol/native_streaming_protocol.h>
+#include <coretypes/common.h>
+
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+BEGIN_NAMESPACE_OPENDAQ_NATIVE_STREAMING_PROTOCOL
+
+/// Server side of the same-host payload transport. Packet payloads are copied once into a named
+/// shared memory segment and referenced by offset in the streaming messages. A payload that is sent
+/// more than once is stored once and reference counted. Blocks are reclaimed in allocation order,
+/// so the segment behaves as a ring. The name is unlinked once the client has mapped the segment.
+class SharedMemoryRing
+{
+public:
+    static constexpr size_t BlockAlignment = 64;
+
+    explicit SharedMemoryRing(size_t capacity);
+    ~SharedMemoryRing();
+
+    SharedMemoryRing(const SharedMemoryRing&) = delete;
+    SharedMemoryRing& operator=(const SharedMemoryRing&) = delete;
+
+    static bool IsSupported();
+
+    const std::string& getName() const;
+
+    /// Removes the segment name; mappings that already exist stay valid.
+    void unlink();
+
+    size_t getCapacity() const;
+    size_t getUsedSize() const;
+
+    /// Stores the payload, or takes another reference to it if the packet is already stored.
+    /// Returns false if the ring has no room for the payload.
+    bool acquire(Int packetId, const void* data, size_t size, uint64_t& offset);
+
+    /// Drops one reference to the block at the offset. Returns false if no such block is stored.
+    bool release(uint64_t offset);
+
+private:
+    struct Block
+    {
+        uint64_t end;
+        uint64_t offset;
+        Int packetId;
+        size_t refCount;
+    };
+
+    Block* findBlock(uint64_t index);
+
+    std::string name;
+    size_t capacity;
+    void* memory;
+    bool linked;
+
+    mutable std::mutex sync;
+    std::deque<Block> blocks;
+    uint64_t firstBlockIndex;
+    uint64_t head;
+    uint64_t tail;
+    std::unordered_map<Int, uint64_t> packetBlocks;
+    std::unordered_map<uint64_t, uint64_t> offsetBlocks;
+};
+
+/// Client side of the same-host payload transport. Maps the segment published by the server
+/// read-only; packets built directly on top of it must not be written to.
+class SharedMemoryMapping
+{
+public:
+    SharedMemoryMapping(const std::string& name, size_t capacity);
+    ~SharedMemoryMapping();
+
+    SharedMemoryMapping(const SharedMemoryMapping&) = delete;
+    SharedMemoryMapping& operator=(const SharedMemoryMapping&) = delete;
+
+    size_t getCapacity() const;
+    const void* getData(uint64_t offset, size_t size) const;
+
+private:
+    size_t capacity;
+    void* memory;
+};
+
+using SharedMemoryRingPtr = std::shared_ptr<SharedMemoryRing>;
+using SharedMemoryMappingPtr = std::shared_ptr<SharedMemoryMapping>;
+
+END_NAMESPACE_OPENDAQ_NATIVE_STREAMING_PROTOCOL
@@ -0,0 +1,108 @@
+/*
+ * Copyright 2022-2024 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <native_streaming_protocol/native_streaming_protocol.h>
+
+#include <opendaq/data_descriptor_ptr.h>
+#include <opendaq/data_packet_ptr.h>
+
+#include <chrono>
+#include <vector>
+
+BEGIN_NAMESPACE_OPENDAQ_NATIVE_STREAMING_PROTOCOL
+
+/// Reduction applied to the data packets of a signal while the client receiving them exceeds its bandwidth budget.
+enum class DegradationPolicy : uint8_t
+{
+    DropPackets = 0,    // data packets are not sent
+    Decimate,           // every N-th sample is sent
+    MinMax              // minimum and maximum sample of each bucket of N samples are sent
+};
+
+/// Limits the data sent to one client. Combines a token bucket refilled at the configured rate with
+/// the amount of data scheduled for writing to the client but not yet written to the socket.
+class BandwidthBudget
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /// @param bytesPerSecond The sustained data rate, 0 for no rate limit. Bursts of up to one second are allowed.
+    /// @param maxPendingWriteSize The amount of data waiting to be written, 0 for no limit.
+    BandwidthBudget(size_t bytesPerSecond, size_t maxPendingWriteSize);
+
+    /// Refills the budget and updates the exceeded state. The budget is exceeded once it is used up or
+    /// the pending writes reach the limit, and is restored only when half of the budget is available and
+    /// the pending writes drop below half of the limit, so that clients do not toggle on every packet.
+    /// @return true if the budget is exceeded.
+    bool update(size_t pendingWriteSize, Clock::time_point now = Clock::now());
+
+    /// Charges the sent data to the budget.
+    void consume(size_t bytes);
+
+    bool isExceeded() const;
+
+private:
+    size_t bytesPerSecond;
+    size_t maxPendingWriteSize;
+    double tokens;
+    Clock::time_point lastUpdate;
+    bool exceeded;
+};
+
+/// State of a degraded signal kept between its data packets, so that decimation steps and min/max buckets
+/// span packet boundaries. Reset when the signal starts being degraded or its descriptors change.
+struct DegradationState
+{
+    size_t skipCount = 0;               // samples to skip before the next decimated sample
+    size_t bucketSampleCount = 0;       // samples of the unfinished min/max bucket
+    bool bucketMinFirst = true;         // the minimum of the unfinished bucket precedes its maximum
+    std::vector<uint8_t> bucketMin;     // raw value followed by the domain value of the unfinished bucket minimum
+    std::vector<uint8_t> bucketMax;     // raw value followed by the domain value of the unfinished bucket maximum
+};
+
+/// Gets the policy that can be applied to packets with the descriptors. Falls back from `MinMax` to `Decimate` for
+/// values that are not numeric scalars, and to `DropPackets` for implicit values or domains without a linear or explicit rule.
+DegradationPolicy getApplicableDegradationPolicy(const DataDescriptorPtr& valueDescriptor,
+                                                 const DataDescriptorPtr& domainDescriptor,
+                                                 DegradationPolicy policy);
+
+/// Gets the name of the policy as announced in the data descriptor metadata.
+std::string getDegradationPolicyName(DegradationPolicy policy);
+
+/// Creates the value descriptor announced for a degraded signal. The policy and factor are added to the metadata
+/// under the "DegradationPolicy" and "DegradationFactor" keys.
+DataDescriptorPtr createDegradedValueDescriptor(const DataDescriptorPtr& valueDescriptor, DegradationPolicy policy, size_t factor);
+
+/// Creates the domain descriptor announced for a degraded signal. With `Decimate`, the delta of a linear domain rule is
+/// scaled to the reduced sample rate. With `MinMax`, the domain is explicit, as the minimum and maximum samples are not
+/// evenly spaced. Returns nullptr if the policy cannot be applied to the domain.
+DataDescriptorPtr createDegradedDomainDescriptor(const DataDescriptorPtr& domainDescriptor, DegradationPolicy policy, size_t factor);
+
+/// Reduces a data packet with a domain packet according to the policy. The reduced packet references a new domain
+/// packet holding the reduced domain values. Samples of a bucket or decimation step not completed by the packet are
+/// carried over to the next packet of the signal in `state`. Returns nullptr if no samples are to be sent: with the
+/// `DropPackets` policy, when the policy cannot be applied to the packet (implicit values, non-numeric samples for
+/// `MinMax`, no domain packet), or when the packet completes no bucket or decimation step.
+DataPacketPtr degradeDataPacket(const DataPacketPtr& packet,
+                                DegradationPolicy policy,
+                                size_t factor,
+                                const DataDescriptorPtr& degradedValueDescriptor,
+                                const DataDescriptorPtr& degradedDomainDescriptor,
+                                DegradationState& state);
+
+END_NAMESPACE_OPENDAQ_NATIVE_STREAMING_PROTOCOL
@@ -17,6 +17,7 @@
 #pragma once
 
 #include <native_streaming_protocol/server_session_handler.h>
+#include <native_streaming_protocol/stream_degradation.h>
 
 #include <opendaq/context_ptr.h>
 #include <opendaq/logger_ptr.h>
@@ -30,6 +31,7 @@ BEGIN_NAMESPACE_OPENDAQ_NATIVE_STREAMING_PROTOCOL
 
 using SendPacketBufferCallback = std::function<void(const std::string& subscribedClientId,
                                                     const packet_streaming::PacketBufferPtr& packetBuffer)>;
+using GetPendingWriteSizeCallback = std::function<size_t()>;
 
 class StreamingManager
 {
@@ -63,8 +65,10 @@ public:
     /// Registers a connected client as a streaming client.
     /// @param clientId The unique string ID provided by the client or automatically assigned by the server.
     /// @param reconnected true if the client was reconnected, false otherwise.
+    /// @param supportedPayloadCodecs The set of payload codecs the client can decode, 0 if the client
+    /// did not request payload compression.
     /// @throw NativeStreamingProtocolException if the client is already registered.
-    void registerClient(const std::string& clientId, bool reconnected);
+    void registerClient(const std::string& clientId, bool reconnected, uint32_t supportedPayloadCodecs = 0);
 
     /// Removes a registered client on disconnection.
     /// @param clientId The unique string ID provided by the client or automatically assigned by the server.
@@ -112,6 +116,44 @@ public:
     /// @return A std::vector containing the client IDs of the registered streaming clients.
     std::vector<std::string> getRegisteredClientsIds();
 
+    /// Limits the data sent to a registered client. While the budget is exceeded, data packets of signals
+    /// with a domain are degraded according to the degradation policy of the signal. Packets without a domain
+    /// packet are always sent, as other packets may reference them as domain packets.
+    /// @param clientId The ID of the registered client.
+    /// @param bytesPerSecond The sustained data rate allowed for the client, 0 for no rate limit.
+    /// @param maxPendingWriteSize The amount of data waiting to be written to the client at which the budget
+    /// is considered exceeded, 0 for no limit.
+    /// @param pendingWriteSizeCb The callback returning the amount of data waiting to be written to the client.
+    /// @throw NativeStreamingProtocolException if the client is not registered.
+    void setClientBandwidthBudget(const std::string& clientId,
+                                  size_t bytesPerSecond,
+                                  size_t maxPendingWriteSize,
+                                  const GetPendingWriteSizeCallback& pendingWriteSizeCb);
+
+    /// Sets the degradation policy of the signals without a signal specific policy.
+    /// @param policy The policy applied to data packets sent to clients which exceed the bandwidth budget.
+    /// @param factor The decimation factor or bucket size, must be at least 2 for `Decimate`, and even for `MinMax`.
+    /// @throw NativeStreamingProtocolException if the factor is not valid for the policy.
+    void setDegradationPolicy(DegradationPolicy policy, size_t factor);
+
+    /// Sets the degradation policy of a signal.
+    /// @param signalStringId The unique string ID of the signal.
+    /// @param policy The policy applied to data packets sent to clients which exceed the bandwidth budget.
+    /// @param factor The decimation factor or bucket size, must be at least 2 for `Decimate`, and even for `MinMax`.
+    /// @throw NativeStreamingProtocolException if the signal is not registered or the factor is not valid for the policy.
+    void setSignalDegradationPolicy(const std::string& signalStringId, DegradationPolicy policy, size_t factor);
+
+    /// Sets the codec of data packet payloads of signals without a signal specific codec, sent to
+    /// clients which requested payload compression.
+    /// @param codec The payload codec, `PayloadCodec::automatic` selects it from the sample type.
+    void setPayloadCodec(packet_streaming::PayloadCodec codec);
+
+    /// Sets the codec of data packet payloads of a signal, sent to clients which requested payload compression.
+    /// @param signalStringId The unique string ID of the signal.
+    /// @param codec The payload codec, `PayloadCodec::none` sends the payloads of the signal as they are.
+    /// @throw NativeStreamingProtocolException if the signal is not registered.
+    void setSignalPayloadCodec(const std::string& signalStringId, packet_streaming::PayloadCodec codec);
+
 private:
     using PacketStreamingServerPtr = std::shared_ptr<packet_streaming::PacketStreamingServer>;
     struct RegisteredSignal
@@ -122,8 +164,48 @@ private:
         SignalNumericIdType numericId;
         std::unordered_set<std::string> subscribedClientsIds;
         DataDescriptorPtr lastDataDescriptor;
+        DataDescriptorPtr lastDomainDataDescriptor;
+
+        bool hasSignalPayloadCodec;
+        packet_streaming::PayloadCodec signalPayloadCodec;
+
+        bool hasSignalDegradationPolicy;
+        DegradationPolicy signalDegradationPolicy;
+        size_t signalDegradationFactor;
+
+        // policy applicable to the current descriptors and the descriptors announced while degraded
+        DegradationPolicy degradationPolicy;
+        size_t degradationFactor;
+        DataDescriptorPtr degradedDataDescriptor;
+        DataDescriptorPtr degradedDomainDataDescriptor;
     };
 
+    struct DegradedSignal
+    {
+        // the value descriptor announced to the client
+        DataDescriptorPtr dataDescriptor;
+        DegradationState state;
+    };
+
+    struct ClientBudget
+    {
+        BandwidthBudget budget;
+        GetPendingWriteSizeCallback pendingWriteSizeCb;
+
+        // key: numeric id of a degraded signal
+        std::unordered_map<SignalNumericIdType, DegradedSignal> degradedSignals;
+    };
+
+    static void validateDegradationPolicy(DegradationPolicy policy, size_t factor);
+    void applyPayloadCodecs(const std::string& clientId);
+    void updateDegradedDescriptors(RegisteredSignal& registeredSignal);
+    EventPacketPtr createDescriptorChangedEventPacket(const RegisteredSignal& registeredSignal, bool degraded);
+    void sendToBudgetedClient(const SendPacketBufferCallback& sendPacketBufferCb,
+                              ClientBudget& clientBudget,
+                              RegisteredSignal& registeredSignal,
+                              const PacketPtr& packet,
+                              const std::string& clientId);
+
     void sendDaqPacket(const SendPacketBufferCallback& sendPacketBufferCb,
                        const PacketStreamingServerPtr& registeredSignal,
                        const PacketPtr& packet,
@@ -139,6 +221,14 @@ private:
 
     std::unordered_map<std::string, PacketStreamingServerPtr> packetStreamingServers;
     std::unordered_set<std::string> streamingClientsIds;
+    std::unordered_map<std::string, ClientBudget> clientBudgets;
+
+    // key: id of a client which requested payload compression, value: the codecs the client can decode
+    std::unordered_map<std::string, uint32_t> clientPayloadCodecs;
+    packet_streaming::PayloadCodec payloadCodec;
+
+    DegradationPolicy degradationPolicy;
+    size_t degradationFactor;
 
     std::mutex sync;
 };
@@ -19,6 +19,33 @@ BaseSessionHandler::BaseSessionHandler(const ContextPtr& daqContext,
     , connectionInactivityTimer(std::make_shared<boost::asio::steady_timer>(*(this->ioContextPtr)))
     , loggerComponent(daqContext.getLogger().getOrAddComponent(loggerComponentName))
 {
+    std::weak_ptr<Session> sessionWeak = session;
+    writeQueue = std::make_shared<SessionWriteQueue>(this->ioContextPtr,
+                                                     [sessionWeak](std::vector<WriteTask>& tasks)
+                                                     {
+                                                         if (auto session = sessionWeak.lock())
+                                                             session->scheduleWrite(tasks);
+                                                     });
+}
+
+size_t BaseSessionHandler::getPendingWriteSize() const
+{
+    return writeQueue->getPendingWriteSize();
+}
+
+void BaseSessionHandler::setWriteBatchLimits(size_t maxBatchSize, std::chrono::microseconds maxBatchDelay)
+{
+    writeQueue->setLimits(maxBatchSize, maxBatchDelay);
+}
+
+void BaseSessionHandler::scheduleWrite(std::vector<WriteTask>& tasks)
+{
+    writeQueue->write(tasks);
+}
+
+void BaseSessionHandler::scheduleBatchedWrite(std::vector<WriteTask>& tasks)
+{
+    writeQueue->writeBatched(tasks);
 }
 
 void BaseSessionHandler::startConnectionActivityMonitoring(Int heartbeatPeriod, Int inactivityTimeout)
@@ -191,7 +218,7 @@ void BaseSessionHandler::sendConfigurationPacket(const config_protocol::PacketBu
     auto writeHeaderTask = createWriteHeaderTask(PayloadType::PAYLOAD_TYPE_CONFIGURATION_PACKET, payloadSize);
     tasks.insert(tasks.begin(), writeHeaderTask);
 
-    session->scheduleWrite(tasks);
+    scheduleWrite(tasks);
 }
 
 ReadTask BaseSessionHandler::discardPayload(const void* /*data*/, size_t /*size*/)
@@ -330,29 +357,7 @@ ReadTask BaseSessionHandler::readPacketBuffer(const void* data, size_t size)
 
 void BaseSessionHandler::sendPacketBuffer(const PacketBufferPtr& packetBuffer)
 {
-    std::vector<WriteTask> tasks;
-
-    // create write task for packet buffer header
-    boost::asio::const_buffer packetBufferHeader(packetBuffer->packetHeader,
-                                                 packetBuffer->packetHeader->size);
-    WriteHandler packetBufferHeaderHandler = [packetBuffer]() {};
-    tasks.push_back(WriteTask(packetBufferHeader, packetBufferHeaderHandler));
-
-    if (packetBuffer->packetHeader->payloadSize > 0)
-    {
-        // create write task for packet buffer payload
-        boost::asio::const_buffer packetBufferPayload(packetBuffer->payload,
-                                                      packetBuffer->packetHeader->payloadSize);
-        WriteHandler packetBufferPayloadHandler = [packetBuffer]() {};
-        tasks.push_back(WriteTask(packetBufferPayload, packetBufferPayloadHandler));
-    }
-
-    // create write task for transport header
-    size_t payloadSize = calculatePayloadSize(tasks);
-    auto writeHeaderTask = createWriteHeaderTask(PayloadType::PAYLOAD_TYPE_STREAMING_PACKET, payloadSize);
-    tasks.insert(tasks.begin(), writeHeaderTask);
-
-    session->scheduleWrite(tasks);
+    writeQueue->writePacketBuffer(PayloadType::PAYLOAD_TYPE_STREAMING_PACKET, packetBuffer);
 }
 
 END_NAMESPACE_OPENDAQ_NATIVE_STREAMING_PROTOCOL
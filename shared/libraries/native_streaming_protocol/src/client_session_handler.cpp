@@ -4,6 +4,8 @@
 #include <opendaq/custom_log.h>
 #include <opendaq/signal_factory.h>
 
+#include <cstring>
+
 BEGIN_NAMESPACE_OPENDAQ_NATIVE_STREAMING_PROTOCOL
 
 using namespace daq::native_streaming;
@@ -20,6 +22,10 @@ ClientSessionHandler::ClientSessionHandler(const ContextPtr& daqContext,
     , signalReceivedHandler(signalReceivedHandler)
     , streamingInitDoneHandler(protocolInitDoneHandler)
     , subscriptionAckHandler(subscriptionAckHandler)
+    , sharedMemoryEnabled(false)
+    , sharedMemoryWritablePackets(false)
+    , sharedMemoryActive(false)
+    , sharedMemoryReleaseScheduled(false)
 {
 }
 
@@ -38,7 +44,7 @@ void ClientSessionHandler::sendSignalSubscribe(const SignalNumericIdType& signal
     auto writeHeaderTask = createWriteHeaderTask(PayloadType::PAYLOAD_TYPE_STREAMING_SIGNAL_SUBSCRIBE_COMMAND, payloadSize);
     tasks.insert(tasks.begin(), writeHeaderTask);
 
-    session->scheduleWrite(tasks);
+    scheduleWrite(tasks);
 }
 
 void ClientSessionHandler::sendSignalUnsubscribe(const SignalNumericIdType& signalNumericId, const std::string& signalStringId)
@@ -56,7 +62,7 @@ void ClientSessionHandler::sendSignalUnsubscribe(const SignalNumericIdType& sign
     auto writeHeaderTask = createWriteHeaderTask(PayloadType::PAYLOAD_TYPE_STREAMING_SIGNAL_UNSUBSCRIBE_COMMAND, payloadSize);
     tasks.insert(tasks.begin(), writeHeaderTask);
 
-    session->scheduleWrite(tasks);
+    scheduleWrite(tasks);
 }
 
 void ClientSessionHandler::sendTransportLayerProperties(const PropertyObjectPtr& properties)
@@ -74,7 +80,7 @@ void ClientSessionHandler::sendTransportLayerProperties(const PropertyObjectPtr&
     auto writeHeaderTask = createWriteHeaderTask(PayloadType::PAYLOAD_TYPE_TRANSPORT_LAYER_PROPERTIES, payloadSize);
     tasks.insert(tasks.begin(), writeHeaderTask);
 
-    session->scheduleWrite(tasks);
+    scheduleWrite(tasks);
 }
 
 void ClientSessionHandler::sendStreamingRequest()
@@ -83,7 +89,222 @@ void ClientSessionHandler::sendStreamingRequest()
 
     tasks.push_back(createWriteHeaderTask(PayloadType::PAYLOAD_TYPE_STREAMING_PROTOCOL_INIT_REQUEST, 0));
 
-    session->scheduleWrite(tasks);
+    scheduleWrite(tasks);
+}
+
+void ClientSessionHandler::enableSharedMemory(bool writablePackets)
+{
+    sharedMemoryEnabled = true;
+    sharedMemoryWritablePackets = writablePackets;
+}
+
+bool ClientSessionHandler::isSharedMemoryActive() const
+{
+    return sharedMemoryActive;
+}
+
+void ClientSessionHandler::sendSharedMemoryControl(SharedMemoryControlType controlType)
+{
+    std::vector<WriteTask> tasks;
+
+    // create write task for control type
+    tasks.push_back(createWriteNumberTask<SharedMemoryControlType>(controlType));
+
+    // create write task for transport header
+    size_t payloadSize = calculatePayloadSize(tasks);
+    auto writeHeaderTask = createWriteHeaderTask(PayloadType::PAYLOAD_TYPE_SHARED_MEMORY_CONTROL, payloadSize);
+    tasks.insert(tasks.begin(), writeHeaderTask);
+
+    scheduleWrite(tasks);
+}
+
+void ClientSessionHandler::queueSharedMemoryRelease(uint64_t offset)
+{
+    std::scoped_lock lock(sharedMemoryReleaseSync);
+
+    pendingSharedMemoryReleases.push_back(offset);
+    if (sharedMemoryReleaseScheduled)
+        return;
+
+    // releases of packets dropped before the flush runs are sent within the same message
+    sharedMemoryReleaseScheduled = true;
+    boost::asio::post(*ioContextPtr,
+                      [weakThis = weak_from_this()]()
+                      {
+                          if (auto handler = weakThis.lock())
+                              handler->flushSharedMemoryReleases();
+                      });
+}
+
+void ClientSessionHandler::flushSharedMemoryReleases()
+{
+    auto offsets = std::make_shared<std::vector<uint64_t>>();
+    {
+        std::scoped_lock lock(sharedMemoryReleaseSync);
+        offsets->swap(pendingSharedMemoryReleases);
+        sharedMemoryReleaseScheduled = false;
+    }
+
+    if (offsets->empty())
+        return;
+
+    std::vector<WriteTask> tasks;
+
+    // create write task for released block offsets
+    boost::asio::const_buffer offsetsPayload(offsets->data(), offsets->size() * sizeof(uint64_t));
+    WriteHandler offsetsPayloadHandler = [offsets]() {};
+    tasks.push_back(WriteTask(offsetsPayload, offsetsPayloadHandler));
+
+    // create write task for transport header
+    size_t payloadSize = calculatePayloadSize(tasks);
+    auto writeHeaderTask = createWriteHeaderTask(PayloadType::PAYLOAD_TYPE_SHARED_MEMORY_RELEASE, payloadSize);
+    tasks.insert(tasks.begin(), writeHeaderTask);
+
+    scheduleWrite(tasks);
+}
+
+ReadTask ClientSessionHandler::readSharedMemoryControl(const void* data, size_t size)
+{
+    size_t bytesDone = 0;
+
+    SharedMemoryControlType controlType;
+    uint64_t capacity;
+    std::string name;
+
+    try
+    {
+        // Get control type from received buffer
+        copyData(&controlType, data, sizeof(controlType), bytesDone, size);
+        bytesDone += sizeof(controlType);
+
+        if (controlType != SharedMemoryControlType::SHARED_MEMORY_OFFER)
+        {
+            LOG_W("Unexpected shared memory control type: {}", static_cast<uint8_t>(controlType));
+            return createReadHeaderTask();
+        }
+
+        // Get segment capacity from received buffer
+        copyData(&capacity, data, sizeof(capacity), bytesDone, size);
+        bytesDone += sizeof(capacity);
+
+        // Get segment name from received buffer
+        name = getStringFromData(data, size - bytesDone, bytesDone, size);
+        LOG_T("Received shared memory offer: segment {}, capacity {}", name, capacity);
+    }
+    catch (const DaqException& e)
+    {
+        LOG_E("Protocol error: {}", e.what());
+        errorHandler(std::string("Protocol error - readSharedMemoryControl - ") + e.what(), session);
+        return createReadStopTask();
+    }
+
+    if (!sharedMemoryEnabled)
+    {
+        sendSharedMemoryControl(SharedMemoryControlType::SHARED_MEMORY_DECLINE);
+        return createReadHeaderTask();
+    }
+
+    try
+    {
+        sharedMemoryMapping = std::make_shared<SharedMemoryMapping>(name, static_cast<size_t>(capacity));
+        LOG_I("Mapped shared memory segment {}, packet payloads are received through shared memory", name);
+        sendSharedMemoryControl(SharedMemoryControlType::SHARED_MEMORY_ACCEPT);
+        sharedMemoryActive = true;
+    }
+    catch (const std::exception& e)
+    {
+        LOG_W("Declined shared memory segment {}: {}", name, e.what());
+        sendSharedMemoryControl(SharedMemoryControlType::SHARED_MEMORY_DECLINE);
+    }
+
+    return createReadHeaderTask();
+}
+
+ReadTask ClientSessionHandler::readSharedMemoryPacketBuffer(const void* data, size_t size)
+{
+    size_t bytesDone = 0;
+
+    GenericPacketHeader* packetBufferHeader {};
+    uint64_t offset;
+    const void* packetBufferPayload;
+
+    try
+    {
+        if (!sharedMemoryMapping)
+            throw NativeStreamingProtocolException("Shared memory packet received without mapped segment");
+
+        decltype(GenericPacketHeader::size) headerSize;
+
+        // Get packet buffer header size from received buffer
+        copyData(&headerSize, data, sizeof(headerSize), bytesDone, size);
+
+        if (headerSize < sizeof(GenericPacketHeader))
+        {
+            LOG_E("Unsupported streaming packet buffer header size: {}. Skipping payload.", headerSize);
+            return createReadHeaderTask();
+        }
+
+        // Get packet buffer header from received buffer
+        packetBufferHeader = static_cast<GenericPacketHeader*>(std::malloc(headerSize));
+        copyData(packetBufferHeader, data, headerSize, bytesDone, size);
+        bytesDone += headerSize;
+
+        // Get offset of packet buffer payload in shared memory from received buffer
+        copyData(&offset, data, sizeof(offset), bytesDone, size);
+        LOG_T("Received shared memory packet buffer header: header size {}, payload size {}, offset {}",
+              packetBufferHeader->size, packetBufferHeader->payloadSize, offset);
+
+        packetBufferPayload = sharedMemoryMapping->getData(offset, packetBufferHeader->payloadSize);
+    }
+    catch (const std::exception& e)
+    {
+        std::free(packetBufferHeader);
+        LOG_E("Protocol error: {}", e.what());
+        errorHandler(std::string("Protocol error - readSharedMemoryPacket - ") + e.what(), session);
+        return createReadStopTask();
+    }
+
+    if (!packetBufferReceivedHandler)
+    {
+        std::free(packetBufferHeader);
+        queueSharedMemoryRelease(offset);
+        return createReadHeaderTask();
+    }
+
+    if (sharedMemoryWritablePackets)
+    {
+        // the payload is copied out of the read-only segment and its block is released right away
+        void* packetBufferPayloadCopy = std::malloc(packetBufferHeader->payloadSize);
+        std::memcpy(packetBufferPayloadCopy, packetBufferPayload, packetBufferHeader->payloadSize);
+        queueSharedMemoryRelease(offset);
+
+        auto recvPacketBuffer =
+            std::make_shared<PacketBuffer>(packetBufferHeader,
+                                           packetBufferPayloadCopy,
+                                           [packetBufferHeader, packetBufferPayloadCopy]()
+                                           {
+                                               std::free(packetBufferHeader);
+                                               std::free(packetBufferPayloadCopy);
+                                           });
+
+        packetBufferReceivedHandler(recvPacketBuffer);
+        return createReadHeaderTask();
+    }
+
+    // the mapping stays alive while any packet built on top of it exists
+    auto recvPacketBuffer =
+        std::make_shared<PacketBuffer>(packetBufferHeader,
+                                       packetBufferPayload,
+                                       [packetBufferHeader, offset, mapping = sharedMemoryMapping, weakThis = weak_from_this()]()
+                                       {
+                                           std::free(packetBufferHeader);
+                                           if (auto handler = weakThis.lock())
+                                               handler->queueSharedMemoryRelease(offset);
+                                       });
+
+    packetBufferReceivedHandler(recvPacketBuffer);
+
+    return createReadHeaderTask();
 }
 
 ReadTask ClientSessionHandler::readSignalAvailable(const void* data, size_t size)
@@ -237,6 +458,26 @@ ReadTask ClientSessionHandler::readHeader(const void* data, size_t size)
             payloadSize
         );
     }
+    else if (payloadType == PayloadType::PAYLOAD_TYPE_STREAMING_PACKET_SHARED_MEMORY)
+    {
+        return ReadTask(
+            [this](const void* data, size_t size)
+            {
+                return readSharedMemoryPacketBuffer(data, size);
+            },
+            payloadSize
+        );
+    }
+    else if (payloadType == PayloadType::PAYLOAD_TYPE_SHARED_MEMORY_CONTROL)
+    {
+        return ReadTask(
+            [this](const void* data, size_t size)
+            {
+                return readSharedMemoryControl(data, size);
+            },
+            payloadSize
+        );
+    }
     else if (payloadType == PayloadType::PAYLOAD_TYPE_STREAMING_PROTOCOL_INIT_DONE)
     {
         streamingInitDoneHandler();
@@ -6,6 +6,7 @@
 
 #include <coreobjects/property_factory.h>
 #include <coreobjects/property_object_factory.h>
+#include <packet_streaming/payload_codec.h>
 
 BEGIN_NAMESPACE_OPENDAQ_NATIVE_STREAMING_PROTOCOL
 
@@ -90,8 +91,32 @@ void NativeStreamingClientHandler::manageTransportLayerProps()
     connectionTimeout = std::chrono::milliseconds(transportLayerProperties.getPropertyValue("ConnectionTimeout"));
     reconnectionPeriod = std::chrono::milliseconds(transportLayerProperties.getPropertyValue("ReconnectionPeriod"));
 
+    if (transportLayerProperties.hasProperty("SharedMemory") &&
+        transportLayerProperties.getProperty("SharedMemory").getValueType() == ctBool)
+        sharedMemoryEnabled = transportLayerProperties.getPropertyValue("SharedMemory");
+    if (transportLayerProperties.hasProperty("SharedMemoryWritablePackets") &&
+        transportLayerProperties.getProperty("SharedMemoryWritablePackets").getValueType() == ctBool)
+        sharedMemoryWritablePackets = transportLayerProperties.getPropertyValue("SharedMemoryWritablePackets");
+
     if (!transportLayerProperties.hasProperty("Reconnected"))
         transportLayerProperties.addProperty(BoolProperty("Reconnected", False));
+    if (!transportLayerProperties.hasProperty("SharedMemoryRequested"))
+        transportLayerProperties.addProperty(BoolProperty("SharedMemoryRequested", False));
+
+    // the server encodes payloads only with the codecs listed by the client
+    if (!transportLayerProperties.hasProperty("SupportedPayloadCodecs"))
+        transportLayerProperties.addProperty(IntProperty("SupportedPayloadCodecs", packet_streaming::SupportedPayloadCodecs));
+}
+
+bool NativeStreamingClientHandler::isLoopbackHost(const std::string& host)
+{
+    return host == "localhost" || host == "::1" || host.rfind("127.", 0) == 0;
+}
+
+bool NativeStreamingClientHandler::isSharedMemoryActive()
+{
+    const auto handler = sessionHandler;
+    return handler && handler->isSharedMemoryActive();
 }
 
 void NativeStreamingClientHandler::resetStreamingHandlers()
@@ -99,6 +124,7 @@ void NativeStreamingClientHandler::resetStreamingHandlers()
     this->signalAvailableHandler = [](const StringPtr&, const StringPtr&) {};
     this->signalUnavailableHandler = [](const StringPtr&) {};
     this->packetHandler = [](const StringPtr&, const PacketPtr&) {};
+    this->packetsHandler = nullptr;
     this->signalSubscriptionAckCallback = [](const StringPtr&, bool) {};
     this->connectionStatusChangedStreamingCb = [](ClientConnectionStatus) {};
     this->streamingInitDoneCb = []() {};
@@ -119,6 +145,19 @@ void NativeStreamingClientHandler::setStreamingHandlers(const OnSignalAvailableC
     this->signalAvailableHandler = signalAvailableHandler;
 }
 
+void NativeStreamingClientHandler::setPacketsHandler(const OnPacketsCallback& packetsHandler)
+{
+    this->packetsHandler = packetsHandler;
+}
+
+StringPtr NativeStreamingClientHandler::getSignalStringId(SignalNumericIdType signalNumericId)
+{
+    std::scoped_lock lock(registeredSignalsSync);
+    if (const auto it = signalIds.find(signalNumericId); it != signalIds.end())
+        return it->second;
+    return nullptr;
+}
+
 void NativeStreamingClientHandler::resetConfigHandlers()
 {
     this->connectionStatusChangedConfigCb = [](ClientConnectionStatus) {};
@@ -187,6 +226,10 @@ bool NativeStreamingClientHandler::connect(std::string host,
                                            std::string port,
                                            std::string path)
 {
+    // payloads are only exchanged through shared memory when both ends are on the same host
+    sharedMemoryRequested = sharedMemoryEnabled && isLoopbackHost(host) && SharedMemoryRing::IsSupported();
+    transportLayerProperties.setPropertyValue("SharedMemoryRequested", sharedMemoryRequested);
+
     initClient(host, port, path);
     connectedFuture = connectedPromise.get_future();
     client->connect();
@@ -326,6 +369,9 @@ void NativeStreamingClientHandler::initClientSessionHandler(SessionPtr session)
     };
     sessionHandler->setConfigPacketReceivedHandler(configPacketReceivedHandler);
 
+    if (sharedMemoryRequested)
+        sessionHandler->enableSharedMemory(sharedMemoryWritablePackets);
+
     OnPacketBufferReceivedCallback packetBufferReceivedHandler =
         [this](const packet_streaming::PacketBufferPtr& packetBuffer)
     {
@@ -334,10 +380,24 @@ void NativeStreamingClientHandler::initClientSessionHandler(SessionPtr session)
             packetStreamingClientPtr->addPacketBuffer(packetBuffer);
 
             auto [signalNumericId, packet] = packetStreamingClientPtr->getNextDaqPacket();
-            while (packet.assigned())
+            if (packetsHandler)
+            {
+                ReceivedPackets packets;
+                while (packet.assigned())
+                {
+                    packets.push_back({signalNumericId, std::move(packet)});
+                    std::tie(signalNumericId, packet) = packetStreamingClientPtr->getNextDaqPacket();
+                }
+                if (!packets.empty())
+                    packetsHandler(std::move(packets));
+            }
+            else
             {
-                packetHandler(signalIds.at(signalNumericId), packet);
-                std::tie(signalNumericId, packet) = packetStreamingClientPtr->getNextDaqPacket();
+                while (packet.assigned())
+                {
+                    packetHandler(signalIds.at(signalNumericId), packet);
+                    std::tie(signalNumericId, packet) = packetStreamingClientPtr->getNextDaqPacket();
+                }
             }
         }
     };
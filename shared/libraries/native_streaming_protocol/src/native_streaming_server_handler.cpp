@@ -37,6 +37,9 @@ NativeStreamingServerHandler::NativeStreamingServerHandler(const ContextPtr& con
     , signalUnsubscribedHandler(signalUnsubscribedHandler)
     , setUpConfigProtocolServerCb(setUpConfigProtocolServerCb)
     , connectedClientIndex(0)
+    , sharedMemoryRingSize(0)
+    , clientBandwidthBudget(0)
+    , clientMaxPendingWriteSize(0)
 {
     for (const auto& signal : signalsList)
     {
@@ -131,7 +134,7 @@ bool NativeStreamingServerHandler::handleSignalSubscription(const SignalNumericI
                 clientId,
                 [this](const std::string& subscribedClientId, const packet_streaming::PacketBufferPtr& packetBuffer)
                 {
-                    sessionHandlers.at(subscribedClientId)->sendPacketBuffer(packetBuffer);
+                    sessionHandlers.at(subscribedClientId)->sendStreamingPacketBuffer(packetBuffer);
                 });
             if (doSignalSubscribe)
             {
@@ -209,11 +212,70 @@ void NativeStreamingServerHandler::sendPacket(const SignalPtr& signal, const Pac
         packet,
         [this](const std::string& subscribedClientId, const packet_streaming::PacketBufferPtr& packetBuffer)
         {
-            sessionHandlers.at(subscribedClientId)->sendPacketBuffer(packetBuffer);
+            sessionHandlers.at(subscribedClientId)->sendStreamingPacketBuffer(packetBuffer);
         }
     );
 }
 
+void NativeStreamingServerHandler::setSharedMemoryRingSize(size_t size)
+{
+    std::scoped_lock lock(sync);
+    sharedMemoryRingSize = size;
+}
+
+void NativeStreamingServerHandler::setClientBandwidthBudget(size_t bytesPerSecond, size_t maxPendingWriteSize)
+{
+    std::scoped_lock lock(sync);
+    clientBandwidthBudget = bytesPerSecond;
+    clientMaxPendingWriteSize = maxPendingWriteSize;
+}
+
+void NativeStreamingServerHandler::setPayloadCodec(packet_streaming::PayloadCodec codec)
+{
+    streamingManager.setPayloadCodec(codec);
+}
+
+void NativeStreamingServerHandler::setSignalPayloadCodec(const SignalPtr& signal, packet_streaming::PayloadCodec codec)
+{
+    streamingManager.setSignalPayloadCodec(signal.getGlobalId().toStdString(), codec);
+}
+
+void NativeStreamingServerHandler::setDegradationPolicy(DegradationPolicy policy, size_t factor)
+{
+    streamingManager.setDegradationPolicy(policy, factor);
+}
+
+void NativeStreamingServerHandler::setSignalDegradationPolicy(const SignalPtr& signal, DegradationPolicy policy, size_t factor)
+{
+    streamingManager.setSignalDegradationPolicy(signal.getGlobalId().toStdString(), policy, factor);
+}
+
+SharedMemoryRingPtr NativeStreamingServerHandler::createSharedMemoryRing()
+{
+    size_t ringSize;
+    {
+        std::scoped_lock lock(sync);
+        ringSize = sharedMemoryRingSize;
+    }
+
+    if (ringSize == 0 || !SharedMemoryRing::IsSupported())
+        return nullptr;
+
+    // each session gets its own segment, so blocks still held by a disconnected client
+    // are never overwritten by payloads sent to other clients
+    try
+    {
+        auto ring = std::make_shared<SharedMemoryRing>(ringSize);
+        LOG_I("Created shared memory segment {} with size {} bytes", ring->getName(), ringSize);
+        return ring;
+    }
+    catch (const std::exception& e)
+    {
+        LOG_W("Shared memory is not available: {}", e.what());
+        return nullptr;
+    }
+}
+
 void NativeStreamingServerHandler::releaseSessionHandler(SessionPtr session)
 {
     auto clientIter = std::find_if(sessionHandlers.begin(),
@@ -231,6 +293,8 @@ void NativeStreamingServerHandler::releaseSessionHandler(SessionPtr session)
         {
             signalUnsubscribedHandler(signal);
         }
+
+        clientIter->second->releaseSharedMemory();
     }
     else
     {
@@ -268,6 +332,35 @@ void NativeStreamingServerHandler::handleTransportLayerProps(const PropertyObjec
         LOG_W("Invalid transport layer properties - missing connection activity monitoring parameters");
     }
 
+    if (propertyObject.hasProperty("SharedMemoryRequested") &&
+        propertyObject.getProperty("SharedMemoryRequested").getValueType() == ctBool)
+    {
+        Bool sharedMemoryRequested = propertyObject.getPropertyValue("SharedMemoryRequested");
+        if (sharedMemoryRequested)
+        {
+            if (const auto ring = createSharedMemoryRing())
+                sessionHandler->sendSharedMemoryOffer(ring);
+        }
+    }
+
+    if (propertyObject.hasProperty("PayloadCompression") &&
+        propertyObject.getProperty("PayloadCompression").getValueType() == ctBool)
+    {
+        Bool payloadCompression = propertyObject.getPropertyValue("PayloadCompression");
+        if (payloadCompression)
+        {
+            // only codecs both sides know are used; clients not listing them support the ones of this version
+            uint32_t supportedPayloadCodecs = packet_streaming::SupportedPayloadCodecs;
+            if (propertyObject.hasProperty("SupportedPayloadCodecs") &&
+                propertyObject.getProperty("SupportedPayloadCodecs").getValueType() == ctInt)
+            {
+                const Int clientPayloadCodecs = propertyObject.getPropertyValue("SupportedPayloadCodecs");
+                supportedPayloadCodecs &= static_cast<uint32_t>(clientPayloadCodecs);
+            }
+            sessionHandler->setSupportedPayloadCodecs(supportedPayloadCodecs);
+        }
+    }
+
     if (propertyObject.hasProperty("Reconnected") &&
         propertyObject.hasProperty("ClientId") &&
         propertyObject.getProperty("Reconnected").getValueType() == ctBool &&
@@ -351,7 +444,30 @@ void NativeStreamingServerHandler::setUpStreamingInitCallback(std::shared_ptr<Se
 
 void NativeStreamingServerHandler::handleStreamingInit(std::shared_ptr<ServerSessionHandler> sessionHandler)
 {
-    streamingManager.registerClient(sessionHandler->getClientId(), sessionHandler->getReconnected());
+    streamingManager.registerClient(sessionHandler->getClientId(),
+                                    sessionHandler->getReconnected(),
+                                    sessionHandler->getSupportedPayloadCodecs());
+
+    size_t bytesPerSecond;
+    size_t maxPendingWriteSize;
+    {
+        std::scoped_lock lock(sync);
+        bytesPerSecond = clientBandwidthBudget;
+        maxPendingWriteSize = clientMaxPendingWriteSize;
+    }
+    if (bytesPerSecond > 0 || maxPendingWriteSize > 0)
+    {
+        std::weak_ptr<ServerSessionHandler> sessionHandlerWeak = sessionHandler;
+        streamingManager.setClientBandwidthBudget(sessionHandler->getClientId(),
+                                                  bytesPerSecond,
+                                                  maxPendingWriteSize,
+                                                  [sessionHandlerWeak]() -> size_t
+                                                  {
+                                                      if (auto sessionHandler = sessionHandlerWeak.lock())
+                                                          return sessionHandler->getPendingWriteSize();
+                                                      return 0;
+                                                  });
+    }
 
     auto registeredSignals = streamingManager.getRegisteredSignals();
     for (const auto& [signalNumericId, signalPtr] : registeredSignals)
@@ -8,6 +8,7 @@
 BEGIN_NAMESPACE_OPENDAQ_NATIVE_STREAMING_PROTOCOL
 
 using namespace daq::native_streaming;
+using namespace packet_streaming;
 
 ServerSessionHandler::ServerSessionHandler(const ContextPtr& daqContext,
                                            const std::shared_ptr<boost::asio::io_context>& ioContextPtr,
@@ -20,6 +21,7 @@ ServerSessionHandler::ServerSessionHandler(const ContextPtr& daqContext,
     , transportLayerPropsHandler(nullptr)
     , clientId(clientId)
     , reconnected(false)
+    , supportedPayloadCodecs(0)
 {
 }
 
@@ -52,7 +54,7 @@ void ServerSessionHandler::sendSignalAvailable(const SignalNumericIdType& signal
     auto writeHeaderTask = createWriteHeaderTask(PayloadType::PAYLOAD_TYPE_STREAMING_SIGNAL_AVAILABLE, payloadSize);
     tasks.insert(tasks.begin(), writeHeaderTask);
 
-    session->scheduleWrite(tasks);
+    scheduleWrite(tasks);
 }
 
 void ServerSessionHandler::sendSignalUnavailable(const SignalNumericIdType& signalNumericId,
@@ -71,7 +73,7 @@ void ServerSessionHandler::sendSignalUnavailable(const SignalNumericIdType& sign
     auto writeHeaderTask = createWriteHeaderTask(PayloadType::PAYLOAD_TYPE_STREAMING_SIGNAL_UNAVAILABLE, payloadSize);
     tasks.insert(tasks.begin(), writeHeaderTask);
 
-    session->scheduleWrite(tasks);
+    scheduleWrite(tasks);
 }
 
 void ServerSessionHandler::sendStreamingInitDone()
@@ -80,7 +82,7 @@ void ServerSessionHandler::sendStreamingInitDone()
 
     tasks.push_back(createWriteHeaderTask(PayloadType::PAYLOAD_TYPE_STREAMING_PROTOCOL_INIT_DONE, 0));
 
-    session->scheduleWrite(tasks);
+    scheduleWrite(tasks);
 }
 
 void ServerSessionHandler::sendSubscribingDone(const SignalNumericIdType signalNumericId)
@@ -95,7 +97,7 @@ void ServerSessionHandler::sendSubscribingDone(const SignalNumericIdType signalN
     auto writeHeaderTask = createWriteHeaderTask(PayloadType::PAYLOAD_TYPE_STREAMING_SIGNAL_SUBSCRIBE_ACK, payloadSize);
     tasks.insert(tasks.begin(), writeHeaderTask);
 
-    session->scheduleWrite(tasks);
+    scheduleWrite(tasks);
 }
 
 void ServerSessionHandler::sendUnsubscribingDone(const SignalNumericIdType signalNumericId)
@@ -110,7 +112,144 @@ void ServerSessionHandler::sendUnsubscribingDone(const SignalNumericIdType signa
     auto writeHeaderTask = createWriteHeaderTask(PayloadType::PAYLOAD_TYPE_STREAMING_SIGNAL_UNSUBSCRIBE_ACK, payloadSize);
     tasks.insert(tasks.begin(), writeHeaderTask);
 
-    session->scheduleWrite(tasks);
+    scheduleWrite(tasks);
+}
+
+void ServerSessionHandler::sendSharedMemoryOffer(const SharedMemoryRingPtr& ring)
+{
+    {
+        std::scoped_lock lock(sharedMemorySync);
+        offeredSharedMemoryRing = ring;
+    }
+
+    std::vector<WriteTask> tasks;
+
+    // create write tasks for control type, segment capacity and segment name
+    tasks.push_back(createWriteNumberTask<SharedMemoryControlType>(SharedMemoryControlType::SHARED_MEMORY_OFFER));
+    tasks.push_back(createWriteNumberTask<uint64_t>(ring->getCapacity()));
+    tasks.push_back(createWriteStringTask(ring->getName()));
+
+    // create write task for transport header
+    size_t payloadSize = calculatePayloadSize(tasks);
+    auto writeHeaderTask = createWriteHeaderTask(PayloadType::PAYLOAD_TYPE_SHARED_MEMORY_CONTROL, payloadSize);
+    tasks.insert(tasks.begin(), writeHeaderTask);
+
+    scheduleWrite(tasks);
+}
+
+void ServerSessionHandler::sendStreamingPacketBuffer(const PacketBufferPtr& packetBuffer)
+{
+    const auto packetHeader = packetBuffer->packetHeader;
+
+    // encoded payloads are specific to this client, so they are not shared by packet id
+    if (packetHeader->type == packet_streaming::PacketType::data &&
+        packetHeader->payloadSize > 0 &&
+        (packetHeader->flags & PACKET_FLAG_CODEC_MASK) == 0 &&
+        packetHeader->size >= sizeof(packet_streaming::DataPacketHeader))
+    {
+        std::scoped_lock lock(sharedMemorySync);
+
+        uint64_t offset;
+        const auto packetId = reinterpret_cast<const packet_streaming::DataPacketHeader*>(packetHeader)->packetId;
+        if (sharedMemoryRing && sharedMemoryRing->acquire(packetId, packetBuffer->payload, packetHeader->payloadSize, offset))
+        {
+            sharedMemoryBlocks[offset]++;
+
+            std::vector<WriteTask> tasks;
+
+            // create write task for packet buffer header, payload size in the header stays the real one
+            boost::asio::const_buffer packetBufferHeader(packetHeader, packetHeader->size);
+            WriteHandler packetBufferHeaderHandler = [packetBuffer]() {};
+            tasks.push_back(WriteTask(packetBufferHeader, packetBufferHeaderHandler));
+
+            // create write task for offset of the payload in shared memory
+            tasks.push_back(createWriteNumberTask<uint64_t>(offset));
+
+            // create write task for transport header
+            size_t payloadSize = calculatePayloadSize(tasks);
+            auto writeHeaderTask = createWriteHeaderTask(PayloadType::PAYLOAD_TYPE_STREAMING_PACKET_SHARED_MEMORY, payloadSize);
+            tasks.insert(tasks.begin(), writeHeaderTask);
+
+            scheduleBatchedWrite(tasks);
+            return;
+        }
+    }
+
+    sendPacketBuffer(packetBuffer);
+}
+
+void ServerSessionHandler::releaseSharedMemory()
+{
+    std::scoped_lock lock(sharedMemorySync);
+
+    sharedMemoryBlocks.clear();
+    sharedMemoryRing.reset();
+    offeredSharedMemoryRing.reset();
+}
+
+ReadTask ServerSessionHandler::readSharedMemoryControl(const void* data, size_t size)
+{
+    SharedMemoryControlType controlType;
+
+    try
+    {
+        // Get control type from received buffer
+        copyData(&controlType, data, sizeof(controlType), 0, size);
+        LOG_T("Received shared memory control type: {}", static_cast<uint8_t>(controlType));
+    }
+    catch (const DaqException& e)
+    {
+        LOG_E("Protocol error: {}", e.what());
+        errorHandler(std::string("Protocol error - readSharedMemoryControl - ") + e.what(), session);
+        return createReadStopTask();
+    }
+
+    std::scoped_lock lock(sharedMemorySync);
+    if (controlType == SharedMemoryControlType::SHARED_MEMORY_ACCEPT && offeredSharedMemoryRing)
+    {
+        LOG_I("Client {} accepted shared memory segment {}", clientId, offeredSharedMemoryRing->getName());
+        sharedMemoryRing = offeredSharedMemoryRing;
+
+        // the client has mapped the segment, so the name is not needed anymore
+        sharedMemoryRing->unlink();
+    }
+    else if (controlType == SharedMemoryControlType::SHARED_MEMORY_DECLINE)
+    {
+        LOG_I("Client {} declined shared memory, packet payloads are sent inline", clientId);
+    }
+    offeredSharedMemoryRing.reset();
+
+    return createReadHeaderTask();
+}
+
+ReadTask ServerSessionHandler::readSharedMemoryRelease(const void* data, size_t size)
+{
+    if (size % sizeof(uint64_t) != 0)
+    {
+        LOG_E("Protocol error: invalid shared memory release payload size {}", size);
+        errorHandler("Protocol error - readSharedMemoryRelease - invalid payload size", session);
+        return createReadStopTask();
+    }
+
+    std::scoped_lock lock(sharedMemorySync);
+    for (size_t bytesDone = 0; bytesDone < size; bytesDone += sizeof(uint64_t))
+    {
+        uint64_t offset;
+        copyData(&offset, data, sizeof(offset), bytesDone, size);
+
+        auto it = sharedMemoryBlocks.find(offset);
+        if (it == sharedMemoryBlocks.end() || !sharedMemoryRing)
+        {
+            LOG_W("Client {} released unknown shared memory block at offset {}", clientId, offset);
+            continue;
+        }
+
+        if (--it->second == 0)
+            sharedMemoryBlocks.erase(it);
+        sharedMemoryRing->release(offset);
+    }
+
+    return createReadHeaderTask();
 }
 
 ReadTask ServerSessionHandler::readSignalSubscribe(const void* data, size_t size)
@@ -225,6 +364,16 @@ bool ServerSessionHandler::getReconnected()
     return this->reconnected;
 }
 
+void ServerSessionHandler::setSupportedPayloadCodecs(uint32_t supportedPayloadCodecs)
+{
+    this->supportedPayloadCodecs = supportedPayloadCodecs;
+}
+
+uint32_t ServerSessionHandler::getSupportedPayloadCodecs()
+{
+    return this->supportedPayloadCodecs;
+}
+
 UserPtr ServerSessionHandler::getUser()
 {
     auto user = (IUser*) session->getUserContext().get();
@@ -306,6 +455,26 @@ ReadTask ServerSessionHandler::readHeader(const void* data, size_t size)
             streamingInitHandler();
         return createReadHeaderTask();
     }
+    else if (payloadType == PayloadType::PAYLOAD_TYPE_SHARED_MEMORY_CONTROL)
+    {
+        return ReadTask(
+            [this](const void* data, size_t size)
+            {
+                return readSharedMemoryControl(data, size);
+            },
+            payloadSize
+        );
+    }
+    else if (payloadType == PayloadType::PAYLOAD_TYPE_SHARED_MEMORY_RELEASE)
+    {
+        return ReadTask(
+            [this](const void* data, size_t size)
+            {
+                return readSharedMemoryRelease(data, size);
+            },
+            payloadSize
+        );
+    }
     else
     {
         LOG_W("Received type: {} cannot be handled by server side", convertPayloadTypeToString(payloadType));
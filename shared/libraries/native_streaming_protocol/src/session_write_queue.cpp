@@ -0,0 +1,219 @@
+#include <native_streaming_protocol/session_write_queue.h>
+
+#include <boost/asio/post.hpp>
+
+BEGIN_NAMESPACE_OPENDAQ_NATIVE_STREAMING_PROTOCOL
+
+using namespace daq::native_streaming;
+
+namespace
+{
+
+// buffers of a batch are kept alive by the batch itself, so its tasks share a handler without captures
+const WriteHandler batchedTaskHandler = []() {};
+
+constexpr size_t MaxFreeBatches = 4;
+
+}
+
+SessionWriteQueue::SessionWriteQueue(const std::shared_ptr<boost::asio::io_context>& ioContextPtr, WriteTasksCallback writeTasksCb)
+    : ioContextPtr(ioContextPtr)
+    , writeTasksCb(std::move(writeTasksCb))
+    , flushTimer(*this->ioContextPtr)
+    , flushScheduled(false)
+    , maxBatchSize(DefaultMaxBatchSize)
+    , maxBatchDelay(0)
+    , pendingWriteSize(0)
+    , writeCount(0)
+{
+    batch = acquireBatch();
+}
+
+SessionWriteQueue::~SessionWriteQueue() = default;
+
+void SessionWriteQueue::setLimits(size_t maxBatchSize, std::chrono::microseconds maxBatchDelay)
+{
+    std::scoped_lock lock(sync);
+    this->maxBatchSize = maxBatchSize;
+    this->maxBatchDelay = maxBatchDelay;
+}
+
+void SessionWriteQueue::write(std::vector<WriteTask>& tasks)
+{
+    std::scoped_lock lock(sync);
+
+    addTasks(tasks);
+    flushBatch();
+}
+
+void SessionWriteQueue::writeBatched(std::vector<WriteTask>& tasks)
+{
+    std::scoped_lock lock(sync);
+
+    addTasks(tasks);
+    if (batch->size >= maxBatchSize || batch->messageCount >= MaxBatchMessages)
+        flushBatch();
+    else
+        scheduleFlush();
+}
+
+void SessionWriteQueue::writePacketBuffer(PayloadType payloadType, const packet_streaming::PacketBufferPtr& packetBuffer)
+{
+    const auto packetHeader = packetBuffer->packetHeader;
+    const size_t payloadSize = packetHeader->size + packetHeader->payloadSize;
+    if (payloadSize > TransportHeader::MAX_PAYLOAD_SIZE)
+        throw NativeStreamingProtocolException("Size of message payload exceeds limit");
+
+    std::scoped_lock lock(sync);
+
+    // the storage of headers is reserved for the maximum number of messages, so the buffers stay valid
+    batch->headers.push_back(*TransportHeader(payloadType, payloadSize).getPackedHeaderPtr());
+    batch->tasks.emplace_back(boost::asio::const_buffer(&batch->headers.back(), TransportHeader::PACKED_HEADER_SIZE),
+                              batchedTaskHandler);
+    batch->tasks.emplace_back(boost::asio::const_buffer(packetHeader, packetHeader->size), batchedTaskHandler);
+    if (packetHeader->payloadSize > 0)
+        batch->tasks.emplace_back(boost::asio::const_buffer(packetBuffer->payload, packetHeader->payloadSize), batchedTaskHandler);
+    batch->packetBuffers.push_back(packetBuffer);
+
+    const size_t size = TransportHeader::PACKED_HEADER_SIZE + payloadSize;
+    batch->size += size;
+    batch->messageCount++;
+    pendingWriteSize += size;
+
+    if (batch->size >= maxBatchSize || batch->messageCount >= MaxBatchMessages)
+        flushBatch();
+    else
+        scheduleFlush();
+}
+
+void SessionWriteQueue::flush()
+{
+    std::scoped_lock lock(sync);
+    flushBatch();
+}
+
+size_t SessionWriteQueue::getPendingWriteSize() const
+{
+    return pendingWriteSize;
+}
+
+size_t SessionWriteQueue::getWriteCount() const
+{
+    return writeCount;
+}
+
+void SessionWriteQueue::addTasks(std::vector<WriteTask>& tasks)
+{
+    size_t size = 0;
+    for (auto& task : tasks)
+    {
+        size += task.getBuffer().size();
+        batch->tasks.push_back(std::move(task));
+    }
+
+    batch->size += size;
+    batch->messageCount++;
+    pendingWriteSize += size;
+}
+
+void SessionWriteQueue::scheduleFlush()
+{
+    if (flushScheduled)
+        return;
+    flushScheduled = true;
+
+    std::weak_ptr<SessionWriteQueue> thisWeak = weak_from_this();
+    if (maxBatchDelay.count() == 0)
+    {
+        boost::asio::post(*ioContextPtr,
+                          [thisWeak]()
+                          {
+                              if (auto queue = thisWeak.lock())
+                                  queue->flush();
+                          });
+    }
+    else
+    {
+        flushTimer.expires_from_now(maxBatchDelay);
+        flushTimer.async_wait(
+            [thisWeak](const boost::system::error_code& ec)
+            {
+                if (ec)
+                    return;
+                if (auto queue = thisWeak.lock())
+                    queue->flush();
+            });
+    }
+}
+
+void SessionWriteQueue::flushBatch()
+{
+    flushScheduled = false;
+    if (batch->tasks.empty())
+        return;
+
+    std::weak_ptr<SessionWriteQueue> thisWeak = weak_from_this();
+
+    // the batch returns to the pool once the session drops the tasks, either written or discarded
+    std::shared_ptr<Batch> writtenBatch(batch.release(),
+                                        [thisWeak](Batch* writtenBatch)
+                                        {
+                                            if (auto queue = thisWeak.lock())
+                                                queue->releaseBatch(writtenBatch);
+                                            else
+                                                delete writtenBatch;
+                                        });
+    batch = acquireBatch();
+
+    // tasks are handed over in a separate vector, so the batch does not hold its own completion handler
+    writeTasks.swap(writtenBatch->tasks);
+    writeTasks.emplace_back(boost::asio::const_buffer(),
+                            [writtenBatch, thisWeak]()
+                            {
+                                if (writtenBatch->completed.exchange(true))
+                                    return;
+                                if (auto queue = thisWeak.lock())
+                                    queue->pendingWriteSize -= writtenBatch->size;
+                            });
+
+    writeCount++;
+    writeTasksCb(writeTasks);
+    writeTasks.clear();
+}
+
+std::unique_ptr<SessionWriteQueue::Batch> SessionWriteQueue::acquireBatch()
+{
+    {
+        std::scoped_lock lock(freeBatchesSync);
+        if (!freeBatches.empty())
+        {
+            auto freeBatch = std::move(freeBatches.back());
+            freeBatches.pop_back();
+            return freeBatch;
+        }
+    }
+
+    auto newBatch = std::make_unique<Batch>();
+    newBatch->headers.reserve(MaxBatchMessages);
+    return newBatch;
+}
+
+void SessionWriteQueue::releaseBatch(Batch* releasedBatch)
+{
+    std::unique_ptr<Batch> freeBatch(releasedBatch);
+    if (!freeBatch->completed.exchange(true))
+        pendingWriteSize -= freeBatch->size;
+
+    freeBatch->tasks.clear();
+    freeBatch->headers.clear();
+    freeBatch->packetBuffers.clear();
+    freeBatch->size = 0;
+    freeBatch->messageCount = 0;
+    freeBatch->completed = false;
+
+    std::scoped_lock lock(freeBatchesSync);
+    if (freeBatches.size() < MaxFreeBatches)
+        freeBatches.push_back(std::move(freeBatch));
+}
+
+END_NAMESPACE_OPENDAQ_NATIVE_STREAMING_PROTOCOL
@@ -0,0 +1,260 @@
+#include <native_streaming_protocol/shared_memory_ring.h>
+#include <native_streaming_protocol/native_streaming_protocol_types.h>
+
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <random>
+
+#include <fmt/format.h>
+
+#if !defined(_WIN32)
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+BEGIN_NAMESPACE_OPENDAQ_NATIVE_STREAMING_PROTOCOL
+
+#if !defined(_WIN32)
+
+static std::string generateSegmentName()
+{
+    static std::atomic<uint32_t> segmentIndex{0};
+    std::random_device randomDevice;
+
+    // kept short as some platforms limit shared memory names to 31 characters
+    return fmt::format("/daqns_{:x}_{:x}_{:x}", static_cast<uint32_t>(getpid()), segmentIndex++, randomDevice() & 0xFFFF);
+}
+
+SharedMemoryRing::SharedMemoryRing(size_t capacity)
+    : name(generateSegmentName())
+    , capacity(capacity)
+    , memory(nullptr)
+    , linked(true)
+    , firstBlockIndex(0)
+    , head(0)
+    , tail(0)
+{
+    if (capacity == 0)
+        throw NativeStreamingProtocolException("Shared memory ring capacity must be greater than zero");
+
+    const int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR);
+    if (fd < 0)
+        throw NativeStreamingProtocolException(fmt::format("Failed to create shared memory segment {}: {}", name, std::strerror(errno)));
+
+    if (ftruncate(fd, static_cast<off_t>(capacity)) != 0)
+    {
+        const int error = errno;
+        close(fd);
+        shm_unlink(name.c_str());
+        throw NativeStreamingProtocolException(fmt::format("Failed to resize shared memory segment {}: {}", name, std::strerror(error)));
+    }
+
+    memory = mmap(nullptr, capacity, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    const int error = errno;
+    close(fd);
+
+    if (memory == MAP_FAILED)
+    {
+        memory = nullptr;
+        shm_unlink(name.c_str());
+        throw NativeStreamingProtocolException(fmt::format("Failed to map shared memory segment {}: {}", name, std::strerror(error)));
+    }
+}
+
+SharedMemoryRing::~SharedMemoryRing()
+{
+    munmap(memory, capacity);
+    unlink();
+}
+
+void SharedMemoryRing::unlink()
+{
+    std::scoped_lock lock(sync);
+    if (linked)
+    {
+        shm_unlink(name.c_str());
+        linked = false;
+    }
+}
+
+bool SharedMemoryRing::IsSupported()
+{
+    return true;
+}
+
+SharedMemoryMapping::SharedMemoryMapping(const std::string& name, size_t capacity)
+    : capacity(capacity)
+    , memory(nullptr)
+{
+    const int fd = shm_open(name.c_str(), O_RDONLY, 0);
+    if (fd < 0)
+        throw NativeStreamingProtocolException(fmt::format("Failed to open shared memory segment {}: {}", name, std::strerror(errno)));
+
+    struct stat segmentStat{};
+    if (fstat(fd, &segmentStat) != 0 || static_cast<size_t>(segmentStat.st_size) < capacity)
+    {
+        close(fd);
+        throw NativeStreamingProtocolException(fmt::format("Shared memory segment {} is smaller than announced", name));
+    }
+
+    memory = mmap(nullptr, capacity, PROT_READ, MAP_SHARED, fd, 0);
+    const int error = errno;
+    close(fd);
+
+    if (memory == MAP_FAILED)
+    {
+        memory = nullptr;
+        throw NativeStreamingProtocolException(fmt::format("Failed to map shared memory segment {}: {}", name, std::strerror(error)));
+    }
+}
+
+SharedMemoryMapping::~SharedMemoryMapping()
+{
+    munmap(memory, capacity);
+}
+
+#else
+
+SharedMemoryRing::SharedMemoryRing(size_t capacity)
+    : capacity(capacity)
+    , memory(nullptr)
+    , linked(false)
+    , firstBlockIndex(0)
+    , head(0)
+    , tail(0)
+{
+    throw NativeStreamingProtocolException("Shared memory transport is not supported on this platform");
+}
+
+SharedMemoryRing::~SharedMemoryRing() = default;
+
+void SharedMemoryRing::unlink()
+{
+}
+
+bool SharedMemoryRing::IsSupported()
+{
+    return false;
+}
+
+SharedMemoryMapping::SharedMemoryMapping(const std::string& name, size_t capacity)
+    : capacity(capacity)
+    , memory(nullptr)
+{
+    throw NativeStreamingProtocolException("Shared memory transport is not supported on this platform");
+}
+
+SharedMemoryMapping::~SharedMemoryMapping() = default;
+
+#endif
+
+const std::string& SharedMemoryRing::getName() const
+{
+    return name;
+}
+
+size_t SharedMemoryRing::getCapacity() const
+{
+    return capacity;
+}
+
+size_t SharedMemoryRing::getUsedSize() const
+{
+    std::scoped_lock lock(sync);
+    return static_cast<size_t>(head - tail);
+}
+
+SharedMemoryRing::Block* SharedMemoryRing::findBlock(uint64_t index)
+{
+    if (index < firstBlockIndex || index - firstBlockIndex >= blocks.size())
+        return nullptr;
+    return &blocks[static_cast<size_t>(index - firstBlockIndex)];
+}
+
+bool SharedMemoryRing::acquire(Int packetId, const void* data, size_t size, uint64_t& offset)
+{
+    std::scoped_lock lock(sync);
+
+    if (const auto it = packetBlocks.find(packetId); it != packetBlocks.end())
+    {
+        if (auto block = findBlock(it->second))
+        {
+            block->refCount++;
+            offset = block->offset;
+            return true;
+        }
+    }
+
+    const uint64_t alignedSize = (size + BlockAlignment - 1) / BlockAlignment * BlockAlignment;
+    if (size == 0 || alignedSize > capacity)
+        return false;
+
+    // blocks never wrap; the remainder at the end of the segment is accounted to the block
+    uint64_t start = head;
+    const uint64_t position = head % capacity;
+    if (position + alignedSize > capacity)
+        start += capacity - position;
+
+    const uint64_t end = start + alignedSize;
+    if (end - tail > capacity)
+        return false;
+
+    offset = start % capacity;
+    std::memcpy(static_cast<char*>(memory) + offset, data, size);
+
+    const uint64_t index = firstBlockIndex + blocks.size();
+    blocks.push_back({end, offset, packetId, 1});
+    packetBlocks[packetId] = index;
+    offsetBlocks[offset] = index;
+    head = end;
+
+    return true;
+}
+
+bool SharedMemoryRing::release(uint64_t offset)
+{
+    std::scoped_lock lock(sync);
+
+    const auto it = offsetBlocks.find(offset);
+    if (it == offsetBlocks.end())
+        return false;
+
+    auto block = findBlock(it->second);
+    if (block == nullptr)
+        return false;
+
+    if (--block->refCount > 0)
+        return true;
+
+    if (const auto packetIt = packetBlocks.find(block->packetId); packetIt != packetBlocks.end() && packetIt->second == it->second)
+        packetBlocks.erase(packetIt);
+    offsetBlocks.erase(it);
+
+    while (!blocks.empty() && blocks.front().refCount == 0)
+    {
+        tail = blocks.front().end;
+        blocks.pop_front();
+        firstBlockIndex++;
+    }
+
+    return true;
+}
+
+size_t SharedMemoryMapping::getCapacity() const
+{
+    return capacity;
+}
+
+const void* SharedMemoryMapping::getData(uint64_t offset, size_t size) const
+{
+    if (offset > capacity || size > capacity - offset)
+        throw NativeStreamingProtocolException(
+            fmt::format("Shared memory block at offset {} with size {} exceeds segment size {}", offset, size, capacity));
+
+    return static_cast<const char*>(memory) + offset;
+}
+
+END_NAMESPACE_OPENDAQ_NATIVE_STREAMING_PROTOCOL
@@ -0,0 +1,411 @@
+#include <native_streaming_protocol/stream_degradation.h>
+#include <packet_streaming/payload_codec.h>
+
+#include <opendaq/data_descriptor_factory.h>
+#include <opendaq/data_rule_factory.h>
+#include <opendaq/packet_factory.h>
+#include <coretypes/dictobject_factory.h>
+#include <coretypes/float_factory.h>
+#include <coretypes/integer_factory.h>
+
+#include <algorithm>
+#include <cstring>
+
+BEGIN_NAMESPACE_OPENDAQ_NATIVE_STREAMING_PROTOCOL
+
+BandwidthBudget::BandwidthBudget(size_t bytesPerSecond, size_t maxPendingWriteSize)
+    : bytesPerSecond(bytesPerSecond)
+    , maxPendingWriteSize(maxPendingWriteSize)
+    , tokens(static_cast<double>(bytesPerSecond))
+    , lastUpdate(Clock::now())
+    , exceeded(false)
+{
+}
+
+bool BandwidthBudget::update(size_t pendingWriteSize, Clock::time_point now)
+{
+    const auto burst = static_cast<double>(bytesPerSecond);
+    if (bytesPerSecond > 0)
+    {
+        const auto elapsed = std::chrono::duration<double>(now - lastUpdate).count();
+        tokens = std::min(burst, tokens + elapsed * burst);
+    }
+    lastUpdate = now;
+
+    const bool rateExceeded = bytesPerSecond > 0 && (exceeded ? tokens < burst / 2 : tokens <= 0);
+    const bool pendingExceeded = maxPendingWriteSize > 0 &&
+                                 (exceeded ? pendingWriteSize > maxPendingWriteSize / 2 : pendingWriteSize >= maxPendingWriteSize);
+
+    exceeded = rateExceeded || pendingExceeded;
+    return exceeded;
+}
+
+void BandwidthBudget::consume(size_t bytes)
+{
+    if (bytesPerSecond > 0)
+        tokens -= static_cast<double>(bytes);
+}
+
+bool BandwidthBudget::isExceeded() const
+{
+    return exceeded;
+}
+
+static bool isMinMaxSampleType(SampleType sampleType)
+{
+    switch (sampleType)
+    {
+        case SampleType::Float32:
+        case SampleType::Float64:
+        case SampleType::Int8:
+        case SampleType::UInt8:
+        case SampleType::Int16:
+        case SampleType::UInt16:
+        case SampleType::Int32:
+        case SampleType::UInt32:
+        case SampleType::Int64:
+        case SampleType::UInt64:
+            return true;
+        default:
+            return false;
+    }
+}
+
+DegradationPolicy getApplicableDegradationPolicy(const DataDescriptorPtr& valueDescriptor,
+                                                 const DataDescriptorPtr& domainDescriptor,
+                                                 DegradationPolicy policy)
+{
+    if (policy == DegradationPolicy::DropPackets || !valueDescriptor.assigned() || !domainDescriptor.assigned())
+        return DegradationPolicy::DropPackets;
+
+    const auto valueRuleType = valueDescriptor.getRule().getType();
+    const auto domainRuleType = domainDescriptor.getRule().getType();
+    if (valueRuleType != DataRuleType::Explicit || (domainRuleType != DataRuleType::Explicit && domainRuleType != DataRuleType::Linear))
+        return DegradationPolicy::DropPackets;
+
+    if (policy == DegradationPolicy::MinMax &&
+        (valueDescriptor.getDimensions().getCount() > 0 || !isMinMaxSampleType(packet_streaming::getPayloadSampleType(valueDescriptor))))
+        return DegradationPolicy::Decimate;
+
+    return policy;
+}
+
+std::string getDegradationPolicyName(DegradationPolicy policy)
+{
+    switch (policy)
+    {
+        case DegradationPolicy::DropPackets:
+            return "DropPackets";
+        case DegradationPolicy::Decimate:
+            return "Decimate";
+        case DegradationPolicy::MinMax:
+            return "MinMax";
+    }
+    return "Unknown";
+}
+
+DataDescriptorPtr createDegradedValueDescriptor(const DataDescriptorPtr& valueDescriptor, DegradationPolicy policy, size_t factor)
+{
+    auto metadata = Dict<IString, IString>();
+    if (const auto originalMetadata = valueDescriptor.getMetadata(); originalMetadata.assigned())
+    {
+        for (const auto& [key, value] : originalMetadata)
+            metadata.set(key, value);
+    }
+
+    metadata.set("DegradationPolicy", getDegradationPolicyName(policy));
+    if (policy != DegradationPolicy::DropPackets)
+        metadata.set("DegradationFactor", std::to_string(factor));
+
+    return DataDescriptorBuilderCopy(valueDescriptor).setMetadata(metadata).build();
+}
+
+DataDescriptorPtr createDegradedDomainDescriptor(const DataDescriptorPtr& domainDescriptor, DegradationPolicy policy, size_t factor)
+{
+    if (!domainDescriptor.assigned())
+        return nullptr;
+
+    if (policy == DegradationPolicy::DropPackets)
+        return domainDescriptor;
+
+    const auto rule = domainDescriptor.getRule();
+    switch (rule.getType())
+    {
+        case DataRuleType::Explicit:
+            return domainDescriptor;
+        case DataRuleType::Linear:
+        {
+            if (policy == DegradationPolicy::MinMax)
+                return DataDescriptorBuilderCopy(domainDescriptor).setRule(ExplicitDataRule()).build();
+
+            const NumberPtr delta = rule.getParameters().get("delta");
+            const NumberPtr start = rule.getParameters().get("start");
+            const NumberPtr degradedDelta = delta.getCoreType() == ctFloat
+                                               ? NumberPtr(Floating(delta.getFloatValue() * static_cast<Float>(factor)))
+                                               : NumberPtr(Integer(delta.getIntValue() * static_cast<Int>(factor)));
+
+            return DataDescriptorBuilderCopy(domainDescriptor).setRule(LinearDataRule(degradedDelta, start)).build();
+        }
+        default:
+            return nullptr;
+    }
+}
+
+namespace
+{
+
+struct BucketSample
+{
+    const uint8_t* value;
+    const uint8_t* domainValue;
+    size_t position;    // samples carried over from the previous packet precede the samples of the packet
+};
+
+void appendSample(const uint8_t* value,
+                  const uint8_t* domainValue,
+                  size_t valueSize,
+                  size_t domainSize,
+                  std::vector<uint8_t>& values,
+                  std::vector<uint8_t>& domainValues)
+{
+    values.insert(values.end(), value, value + valueSize);
+    domainValues.insert(domainValues.end(), domainValue, domainValue + domainSize);
+}
+
+std::vector<uint8_t> copyBucketSample(const BucketSample& sample, size_t valueSize, size_t domainSize)
+{
+    std::vector<uint8_t> bytes(sample.value, sample.value + valueSize);
+    bytes.insert(bytes.end(), sample.domainValue, sample.domainValue + domainSize);
+    return bytes;
+}
+
+template <typename T>
+T readSample(const uint8_t* data)
+{
+    T value;
+    std::memcpy(&value, data, sizeof(T));
+    return value;
+}
+
+template <typename T>
+void reduceMinMax(const uint8_t* valueData,
+                  const uint8_t* domainData,
+                  size_t sampleCount,
+                  size_t domainSize,
+                  size_t bucketSize,
+                  DegradationState& state,
+                  std::vector<uint8_t>& values,
+                  std::vector<uint8_t>& domainValues)
+{
+    constexpr size_t valueSize = sizeof(T);
+    const auto typedValues = reinterpret_cast<const T*>(valueData);
+
+    size_t index = 0;
+    while (index < sampleCount)
+    {
+        const auto count = std::min(bucketSize - state.bucketSampleCount, sampleCount - index);
+        const auto [minIt, maxIt] = std::minmax_element(typedValues + index, typedValues + index + count);
+        const auto minIndex = static_cast<size_t>(minIt - typedValues);
+        const auto maxIndex = static_cast<size_t>(maxIt - typedValues);
+
+        BucketSample minSample{valueData + minIndex * valueSize, domainData + minIndex * domainSize, minIndex + 2};
+        BucketSample maxSample{valueData + maxIndex * valueSize, domainData + maxIndex * domainSize, maxIndex + 2};
+        if (state.bucketSampleCount > 0)
+        {
+            if (readSample<T>(state.bucketMin.data()) <= *minIt)
+                minSample = {state.bucketMin.data(), state.bucketMin.data() + valueSize, state.bucketMinFirst ? 0u : 1u};
+            if (readSample<T>(state.bucketMax.data()) > *maxIt)
+                maxSample = {state.bucketMax.data(), state.bucketMax.data() + valueSize, state.bucketMinFirst ? 1u : 0u};
+        }
+
+        index += count;
+        state.bucketSampleCount += count;
+        if (state.bucketSampleCount < bucketSize)
+        {
+            // only the last bucket of a packet is unfinished
+            state.bucketMinFirst = minSample.position <= maxSample.position;
+            auto bucketMin = copyBucketSample(minSample, valueSize, domainSize);
+            state.bucketMax = copyBucketSample(maxSample, valueSize, domainSize);
+            state.bucketMin = std::move(bucketMin);
+            break;
+        }
+
+        // pairs keep the order of the original samples
+        const auto& first = minSample.position <= maxSample.position ? minSample : maxSample;
+        const auto& second = minSample.position <= maxSample.position ? maxSample : minSample;
+        appendSample(first.value, first.domainValue, valueSize, domainSize, values, domainValues);
+        appendSample(second.value, second.domainValue, valueSize, domainSize, values, domainValues);
+        state.bucketSampleCount = 0;
+    }
+}
+
+bool reduceMinMax(SampleType sampleType,
+                  const uint8_t* valueData,
+                  const uint8_t* domainData,
+                  size_t sampleCount,
+                  size_t domainSize,
+                  size_t bucketSize,
+                  DegradationState& state,
+                  std::vector<uint8_t>& values,
+                  std::vector<uint8_t>& domainValues)
+{
+    switch (sampleType)
+    {
+        case SampleType::Float32:
+            reduceMinMax<float>(valueData, domainData, sampleCount, domainSize, bucketSize, state, values, domainValues);
+            return true;
+        case SampleType::Float64:
+            reduceMinMax<double>(valueData, domainData, sampleCount, domainSize, bucketSize, state, values, domainValues);
+            return true;
+        case SampleType::Int8:
+            reduceMinMax<int8_t>(valueData, domainData, sampleCount, domainSize, bucketSize, state, values, domainValues);
+            return true;
+        case SampleType::UInt8:
+            reduceMinMax<uint8_t>(valueData, domainData, sampleCount, domainSize, bucketSize, state, values, domainValues);
+            return true;
+        case SampleType::Int16:
+            reduceMinMax<int16_t>(valueData, domainData, sampleCount, domainSize, bucketSize, state, values, domainValues);
+            return true;
+        case SampleType::UInt16:
+            reduceMinMax<uint16_t>(valueData, domainData, sampleCount, domainSize, bucketSize, state, values, domainValues);
+            return true;
+        case SampleType::Int32:
+            reduceMinMax<int32_t>(valueData, domainData, sampleCount, domainSize, bucketSize, state, values, domainValues);
+            return true;
+        case SampleType::UInt32:
+            reduceMinMax<uint32_t>(valueData, domainData, sampleCount, domainSize, bucketSize, state, values, domainValues);
+            return true;
+        case SampleType::Int64:
+            reduceMinMax<int64_t>(valueData, domainData, sampleCount, domainSize, bucketSize, state, values, domainValues);
+            return true;
+        case SampleType::UInt64:
+            reduceMinMax<uint64_t>(valueData, domainData, sampleCount, domainSize, bucketSize, state, values, domainValues);
+            return true;
+        default:
+            return false;
+    }
+}
+
+NumberPtr getDecimatedDomainOffset(const DataPacketPtr& domainPacket, size_t firstIndex)
+{
+    const NumberPtr offset = domainPacket.getOffset();
+    const NumberPtr delta = domainPacket.getDataDescriptor().getRule().getParameters().get("delta");
+    const auto index = static_cast<Int>(firstIndex);
+
+    if (delta.getCoreType() == ctFloat || (offset.assigned() && offset.getCoreType() == ctFloat))
+        return Floating((offset.assigned() ? offset.getFloatValue() : 0.0) + delta.getFloatValue() * static_cast<Float>(index));
+    return Integer((offset.assigned() ? offset.getIntValue() : 0) + delta.getIntValue() * index);
+}
+
+DataPacketPtr decimateDataPacket(const DataPacketPtr& packet,
+                                 size_t factor,
+                                 const DataDescriptorPtr& degradedValueDescriptor,
+                                 const DataDescriptorPtr& degradedDomainDescriptor,
+                                 DegradationState& state)
+{
+    const auto domainPacket = packet.getDomainPacket();
+    const auto sampleCount = packet.getSampleCount();
+    const bool linearDomain = degradedDomainDescriptor.getRule().getType() == DataRuleType::Linear;
+    const auto domainData = linearDomain ? nullptr : static_cast<const uint8_t*>(domainPacket.getData());
+    if (!linearDomain && domainData == nullptr)
+        return nullptr;
+
+    const auto firstIndex = state.skipCount;
+    if (firstIndex >= sampleCount)
+    {
+        state.skipCount -= sampleCount;
+        return nullptr;
+    }
+
+    const auto degradedSampleCount = (sampleCount - firstIndex + factor - 1) / factor;
+    state.skipCount = firstIndex + degradedSampleCount * factor - sampleCount;
+
+    DataPacketPtr degradedDomainPacket;
+    if (linearDomain)
+    {
+        degradedDomainPacket =
+            DataPacket(degradedDomainDescriptor, degradedSampleCount, getDecimatedDomainOffset(domainPacket, firstIndex));
+    }
+    else
+    {
+        const auto domainSize = domainPacket.getDataDescriptor().getSampleSize();
+        degradedDomainPacket = DataPacket(degradedDomainDescriptor, degradedSampleCount);
+
+        auto destination = static_cast<uint8_t*>(degradedDomainPacket.getRawData());
+        for (size_t index = firstIndex; index < sampleCount; index += factor, destination += domainSize)
+            std::memcpy(destination, domainData + index * domainSize, domainSize);
+    }
+
+    const auto valueData = static_cast<const uint8_t*>(packet.getRawData());
+    const auto valueSize = packet.getRawDataSize() / sampleCount;
+    auto degradedPacket = DataPacketWithDomain(degradedDomainPacket, degradedValueDescriptor, degradedSampleCount, packet.getOffset());
+
+    auto destination = static_cast<uint8_t*>(degradedPacket.getRawData());
+    for (size_t index = firstIndex; index < sampleCount; index += factor, destination += valueSize)
+        std::memcpy(destination, valueData + index * valueSize, valueSize);
+
+    return degradedPacket;
+}
+
+}
+
+DataPacketPtr degradeDataPacket(const DataPacketPtr& packet,
+                                DegradationPolicy policy,
+                                size_t factor,
+                                const DataDescriptorPtr& degradedValueDescriptor,
+                                const DataDescriptorPtr& degradedDomainDescriptor,
+                                DegradationState& state)
+{
+    if (policy == DegradationPolicy::DropPackets || !degradedDomainDescriptor.assigned())
+        return nullptr;
+
+    const auto domainPacket = packet.getDomainPacket();
+    if (!domainPacket.assigned())
+        return nullptr;
+
+    const auto sampleCount = packet.getSampleCount();
+    const auto valueData = static_cast<const uint8_t*>(packet.getRawData());
+    if (valueData == nullptr || sampleCount == 0 || domainPacket.getSampleCount() != sampleCount)
+        return nullptr;
+
+    const auto degradedRuleType = degradedDomainDescriptor.getRule().getType();
+    if (degradedRuleType != DataRuleType::Linear && degradedRuleType != DataRuleType::Explicit)
+        return nullptr;
+
+    if (policy == DegradationPolicy::Decimate)
+        return decimateDataPacket(packet, factor, degradedValueDescriptor, degradedDomainDescriptor, state);
+
+    // linear domain values are calculated, so that each min/max sample is sent with its own domain value
+    const auto valueDescriptor = packet.getDataDescriptor();
+    const auto domainData = static_cast<const uint8_t*>(domainPacket.getData());
+    if (valueDescriptor.getDimensions().getCount() > 0 || degradedRuleType != DataRuleType::Explicit || domainData == nullptr)
+        return nullptr;
+
+    const auto domainSize = domainPacket.getDataDescriptor().getSampleSize();
+    std::vector<uint8_t> values;
+    std::vector<uint8_t> domainValues;
+    if (!reduceMinMax(packet_streaming::getPayloadSampleType(valueDescriptor),
+                      valueData,
+                      domainData,
+                      sampleCount,
+                      domainSize,
+                      factor,
+                      state,
+                      values,
+                      domainValues))
+        return nullptr;
+
+    const auto degradedSampleCount = domainValues.size() / domainSize;
+    if (degradedSampleCount == 0)
+        return nullptr;
+
+    auto degradedDomainPacket = DataPacket(degradedDomainDescriptor, degradedSampleCount);
+    std::memcpy(degradedDomainPacket.getRawData(), domainValues.data(), domainValues.size());
+
+    auto degradedPacket = DataPacketWithDomain(degradedDomainPacket, degradedValueDescriptor, degradedSampleCount, packet.getOffset());
+    std::memcpy(degradedPacket.getRawData(), values.data(), values.size());
+
+    return degradedPacket;
+}
+
+END_NAMESPACE_OPENDAQ_NATIVE_STREAMING_PROTOCOL
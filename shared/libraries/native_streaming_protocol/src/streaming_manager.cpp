@@ -11,6 +11,9 @@ using namespace daq::native_streaming;
 StreamingManager::StreamingManager(const ContextPtr& context)
     : context(context)
     , signalNumericIdCounter(0)
+    , degradationPolicy(DegradationPolicy::DropPackets)
+    , degradationFactor(1)
+    , payloadCodec(packet_streaming::PayloadCodec::automatic)
 {
     auto logger = this->context.getLogger();
     if (!logger.assigned())
@@ -38,11 +41,23 @@ void StreamingManager::sendPacketToSubscribers(const std::string& signalStringId
                 {
                     registeredSignal.lastDataDescriptor = dataDescriptor;
                 }
+                auto domainDataDescriptor = eventPacket.getParameters().get(event_packet_param::DOMAIN_DATA_DESCRIPTOR);
+                if (domainDataDescriptor.assigned())
+                {
+                    registeredSignal.lastDomainDataDescriptor = domainDataDescriptor;
+                }
+                updateDegradedDescriptors(registeredSignal);
             }
         }
 
         for (const auto& subscribedClientId : registeredSignal.subscribedClientsIds)
         {
+            if (auto budgetIter = clientBudgets.find(subscribedClientId); budgetIter != clientBudgets.end())
+            {
+                sendToBudgetedClient(sendPacketBufferCb, budgetIter->second, registeredSignal, packet, subscribedClientId);
+                continue;
+            }
+
             sendDaqPacket(sendPacketBufferCb,
                           packetStreamingServers.at(subscribedClientId),
                           packet,
@@ -69,6 +84,179 @@ void StreamingManager::sendDaqPacket(const SendPacketBufferCallback& sendPacketB
     }
 }
 
+void StreamingManager::sendToBudgetedClient(const SendPacketBufferCallback& sendPacketBufferCb,
+                                            ClientBudget& clientBudget,
+                                            RegisteredSignal& registeredSignal,
+                                            const PacketPtr& packet,
+                                            const std::string& clientId)
+{
+    const auto& packetStreamingServer = packetStreamingServers.at(clientId);
+    const auto signalNumericId = registeredSignal.numericId;
+    auto degradedIter = clientBudget.degradedSignals.find(signalNumericId);
+
+    if (packet.getType() == PacketType::Event)
+    {
+        // descriptor changes of a degraded signal are announced in the degraded form
+        const auto eventPacket = packet.asPtr<IEventPacket>();
+        if (degradedIter != clientBudget.degradedSignals.end() && eventPacket.getEventId() == event_packet_id::DATA_DESCRIPTOR_CHANGED)
+        {
+            degradedIter->second = DegradedSignal{registeredSignal.degradedDataDescriptor, DegradationState()};
+            sendDaqPacket(sendPacketBufferCb,
+                          packetStreamingServer,
+                          createDescriptorChangedEventPacket(registeredSignal, true),
+                          clientId,
+                          signalNumericId);
+            return;
+        }
+
+        sendDaqPacket(sendPacketBufferCb, packetStreamingServer, packet, clientId, signalNumericId);
+        return;
+    }
+
+    const auto dataPacket = packet.asPtr<IDataPacket>();
+    const bool exceeded = clientBudget.budget.update(clientBudget.pendingWriteSizeCb());
+
+    // packets without a domain packet may be domain packets of other signals, so they are never degraded
+    if ((!exceeded && degradedIter == clientBudget.degradedSignals.end()) ||
+        !dataPacket.getDomainPacket().assigned() ||
+        !registeredSignal.degradedDataDescriptor.assigned())
+    {
+        clientBudget.budget.consume(dataPacket.getRawDataSize());
+        sendDaqPacket(sendPacketBufferCb, packetStreamingServer, packet, clientId, signalNumericId);
+        return;
+    }
+
+    if (!exceeded)
+    {
+        LOG_D("Signal {} is no longer degraded for client {}", registeredSignal.daqSignal.getGlobalId().toStdString(), clientId);
+        clientBudget.degradedSignals.erase(degradedIter);
+        sendDaqPacket(sendPacketBufferCb,
+                      packetStreamingServer,
+                      createDescriptorChangedEventPacket(registeredSignal, false),
+                      clientId,
+                      signalNumericId);
+
+        clientBudget.budget.consume(dataPacket.getRawDataSize());
+        sendDaqPacket(sendPacketBufferCb, packetStreamingServer, packet, clientId, signalNumericId);
+        return;
+    }
+
+    if (degradedIter == clientBudget.degradedSignals.end() || degradedIter->second.dataDescriptor != registeredSignal.degradedDataDescriptor)
+    {
+        LOG_D("Signal {} is degraded for client {} with policy {}",
+              registeredSignal.daqSignal.getGlobalId().toStdString(),
+              clientId,
+              getDegradationPolicyName(registeredSignal.degradationPolicy));
+        degradedIter = clientBudget.degradedSignals
+                           .insert_or_assign(signalNumericId, DegradedSignal{registeredSignal.degradedDataDescriptor, DegradationState()})
+                           .first;
+        sendDaqPacket(sendPacketBufferCb,
+                      packetStreamingServer,
+                      createDescriptorChangedEventPacket(registeredSignal, true),
+                      clientId,
+                      signalNumericId);
+    }
+
+    const auto degradedPacket = degradeDataPacket(dataPacket,
+                                                  registeredSignal.degradationPolicy,
+                                                  registeredSignal.degradationFactor,
+                                                  registeredSignal.degradedDataDescriptor,
+                                                  registeredSignal.degradedDomainDataDescriptor,
+                                                  degradedIter->second.state);
+    if (!degradedPacket.assigned())
+        return;
+
+    // the degraded domain packet is sent along with the value packet, as the domain signal is not degraded
+    packetStreamingServer->addDomainReferencePacket(signalNumericId, degradedPacket.getDomainPacket());
+    clientBudget.budget.consume(degradedPacket.getRawDataSize() + degradedPacket.getDomainPacket().getRawDataSize());
+    sendDaqPacket(sendPacketBufferCb, packetStreamingServer, degradedPacket, clientId, signalNumericId);
+}
+
+EventPacketPtr StreamingManager::createDescriptorChangedEventPacket(const RegisteredSignal& registeredSignal, bool degraded)
+{
+    if (degraded)
+        return DataDescriptorChangedEventPacket(registeredSignal.degradedDataDescriptor, registeredSignal.degradedDomainDataDescriptor);
+    return DataDescriptorChangedEventPacket(registeredSignal.lastDataDescriptor, registeredSignal.lastDomainDataDescriptor);
+}
+
+void StreamingManager::validateDegradationPolicy(DegradationPolicy policy, size_t factor)
+{
+    if (policy == DegradationPolicy::Decimate && factor < 2)
+        throw NativeStreamingProtocolException("Decimation factor must be at least 2");
+    if (policy == DegradationPolicy::MinMax && (factor < 2 || factor % 2 != 0))
+        throw NativeStreamingProtocolException("Min/max bucket size must be an even number of at least 2");
+}
+
+void StreamingManager::updateDegradedDescriptors(RegisteredSignal& registeredSignal)
+{
+    const auto policy = registeredSignal.hasSignalDegradationPolicy ? registeredSignal.signalDegradationPolicy : degradationPolicy;
+    const auto factor = registeredSignal.hasSignalDegradationPolicy ? registeredSignal.signalDegradationFactor : degradationFactor;
+
+    if (!registeredSignal.lastDataDescriptor.assigned())
+        return;
+
+    registeredSignal.degradationPolicy =
+        getApplicableDegradationPolicy(registeredSignal.lastDataDescriptor, registeredSignal.lastDomainDataDescriptor, policy);
+    registeredSignal.degradationFactor = factor;
+    registeredSignal.degradedDataDescriptor =
+        createDegradedValueDescriptor(registeredSignal.lastDataDescriptor, registeredSignal.degradationPolicy, factor);
+    registeredSignal.degradedDomainDataDescriptor =
+        createDegradedDomainDescriptor(registeredSignal.lastDomainDataDescriptor, registeredSignal.degradationPolicy, factor);
+}
+
+void StreamingManager::setClientBandwidthBudget(const std::string& clientId,
+                                                size_t bytesPerSecond,
+                                                size_t maxPendingWriteSize,
+                                                const GetPendingWriteSizeCallback& pendingWriteSizeCb)
+{
+    std::scoped_lock lock(sync);
+
+    if (streamingClientsIds.find(clientId) == streamingClientsIds.end())
+        throw NativeStreamingProtocolException(fmt::format("Client with id {} is not registered", clientId));
+
+    clientBudgets.erase(clientId);
+    if (bytesPerSecond == 0 && maxPendingWriteSize == 0)
+        return;
+
+    LOG_I("Client with ID \"{}\" has a bandwidth budget of {} bytes/s and {} bytes pending", clientId, bytesPerSecond, maxPendingWriteSize);
+    clientBudgets.insert({clientId, ClientBudget{BandwidthBudget(bytesPerSecond, maxPendingWriteSize), pendingWriteSizeCb, {}}});
+}
+
+void StreamingManager::setDegradationPolicy(DegradationPolicy policy, size_t factor)
+{
+    validateDegradationPolicy(policy, factor);
+
+    std::scoped_lock lock(sync);
+
+    degradationPolicy = policy;
+    degradationFactor = factor;
+    for (auto& [_, registeredSignal] : registeredSignals)
+    {
+        if (!registeredSignal.hasSignalDegradationPolicy)
+            updateDegradedDescriptors(registeredSignal);
+    }
+}
+
+void StreamingManager::setSignalDegradationPolicy(const std::string& signalStringId, DegradationPolicy policy, size_t factor)
+{
+    validateDegradationPolicy(policy, factor);
+
+    std::scoped_lock lock(sync);
+
+    if (auto iter = registeredSignals.find(signalStringId); iter != registeredSignals.end())
+    {
+        auto& registeredSignal = iter->second;
+        registeredSignal.hasSignalDegradationPolicy = true;
+        registeredSignal.signalDegradationPolicy = policy;
+        registeredSignal.signalDegradationFactor = factor;
+        updateDegradedDescriptors(registeredSignal);
+    }
+    else
+    {
+        throw NativeStreamingProtocolException(fmt::format("Signal {} is not registered in streaming", signalStringId));
+    }
+}
+
 SignalNumericIdType StreamingManager::registerSignal(const SignalPtr& signal)
 {
     auto signalStringId = signal.getGlobalId().toStdString();
@@ -108,7 +296,7 @@ bool StreamingManager::removeSignal(const SignalPtr& signal)
     return doSignalUnsubscribe;
 }
 
-void StreamingManager::registerClient(const std::string& clientId, bool reconnected)
+void StreamingManager::registerClient(const std::string& clientId, bool reconnected, uint32_t supportedPayloadCodecs)
 {
     std::scoped_lock lock(sync);
 
@@ -130,6 +318,60 @@ void StreamingManager::registerClient(const std::string& clientId, bool reconnec
     // create new associated packet server if required
     if (auto it = packetStreamingServers.find(clientId); it == packetStreamingServers.end())
         packetStreamingServers.insert({clientId, std::make_shared<packet_streaming::PacketStreamingServer>(10)});
+
+    if (supportedPayloadCodecs != 0)
+        clientPayloadCodecs.insert_or_assign(clientId, supportedPayloadCodecs);
+    else
+        clientPayloadCodecs.erase(clientId);
+    applyPayloadCodecs(clientId);
+}
+
+void StreamingManager::applyPayloadCodecs(const std::string& clientId)
+{
+    const auto& packetStreamingServer = packetStreamingServers.at(clientId);
+
+    const auto codecsIter = clientPayloadCodecs.find(clientId);
+    if (codecsIter == clientPayloadCodecs.end())
+    {
+        // also disables per-signal codecs kept by a cached server of a reconnected client
+        packetStreamingServer->setSupportedPayloadCodecs(0);
+        return;
+    }
+
+    packetStreamingServer->setSupportedPayloadCodecs(codecsIter->second);
+    packetStreamingServer->setPayloadCodec(payloadCodec);
+    for (const auto& [_, registeredSignal] : registeredSignals)
+    {
+        if (registeredSignal.hasSignalPayloadCodec)
+            packetStreamingServer->setSignalPayloadCodec(registeredSignal.numericId, registeredSignal.signalPayloadCodec);
+    }
+}
+
+void StreamingManager::setPayloadCodec(packet_streaming::PayloadCodec codec)
+{
+    std::scoped_lock lock(sync);
+
+    payloadCodec = codec;
+    for (const auto& [clientId, _] : clientPayloadCodecs)
+        packetStreamingServers.at(clientId)->setPayloadCodec(codec);
+}
+
+void StreamingManager::setSignalPayloadCodec(const std::string& signalStringId, packet_streaming::PayloadCodec codec)
+{
+    std::scoped_lock lock(sync);
+
+    if (auto iter = registeredSignals.find(signalStringId); iter != registeredSignals.end())
+    {
+        auto& registeredSignal = iter->second;
+        registeredSignal.hasSignalPayloadCodec = true;
+        registeredSignal.signalPayloadCodec = codec;
+        for (const auto& [clientId, _] : clientPayloadCodecs)
+            packetStreamingServers.at(clientId)->setSignalPayloadCodec(registeredSignal.numericId, codec);
+    }
+    else
+    {
+        throw NativeStreamingProtocolException(fmt::format("Signal {} is not registered in streaming", signalStringId));
+    }
 }
 
 ListPtr<ISignal> StreamingManager::unregisterClient(const std::string& clientId)
@@ -155,6 +397,9 @@ ListPtr<ISignal> StreamingManager::unregisterClient(const std::string& clientId)
         // FIXME keep and reuse packet server when packet retransmission feature will be enabled
         if (auto it = packetStreamingServers.find(clientId); it != packetStreamingServers.end())
             packetStreamingServers.erase(it);
+
+        clientBudgets.erase(clientId);
+        clientPayloadCodecs.erase(clientId);
     }
 
     // find and remove client Id from subscribers
@@ -230,6 +475,8 @@ bool StreamingManager::removeSignalSubscriber(const std::string& signalStringId,
         if (auto subscribersIter = subscribers.find(subscribedClientId); subscribersIter != subscribers.end())
         {
             subscribers.erase(subscribersIter);
+            if (auto budgetIter = clientBudgets.find(subscribedClientId); budgetIter != clientBudgets.end())
+                budgetIter->second.degradedSignals.erase(iter->second.numericId);
             if (subscribers.empty())
             {
                 LOG_D("Signal: {} has not subscribers", signalStringId);
@@ -291,6 +538,13 @@ std::vector<std::string> StreamingManager::getRegisteredClientsIds()
 StreamingManager::RegisteredSignal::RegisteredSignal(SignalPtr daqSignal, SignalNumericIdType numericId)
     : daqSignal(daqSignal)
     , numericId(numericId)
+    , hasSignalPayloadCodec(false)
+    , signalPayloadCodec(packet_streaming::PayloadCodec::none)
+    , hasSignalDegradationPolicy(false)
+    , signalDegradationPolicy(DegradationPolicy::DropPackets)
+    , signalDegradationFactor(1)
+    , degradationPolicy(DegradationPolicy::DropPackets)
+    , degradationFactor(1)
 {}
 
 END_NAMESPACE_OPENDAQ_NATIVE_STREAMING_PROTOCOL
@@ -0,0 +1,90 @@
+#include <gtest/gtest.h>
+#include <opendaq/opendaq.h>
+#include <native_streaming_protocol/streaming_manager.h>
+#include <packet_streaming/packet_streaming_client.h>
+
+#include <cmath>
+#include <tuple>
+
+using namespace daq;
+using namespace daq::opendaq_native_streaming_protocol;
+
+class StreamDegradationBenchmark : public testing::Test
+{
+protected:
+    static DataDescriptorPtr createValueDescriptor()
+    {
+        return DataDescriptorBuilder().setSampleType(SampleType::Float64).build();
+    }
+
+    static DataDescriptorPtr createDomainDescriptor()
+    {
+        return DataDescriptorBuilder().setSampleType(SampleType::Int64).setRule(LinearDataRule(1, 0)).setTickResolution(Ratio(1, 1000)).build();
+    }
+
+    // sends packets of a sine wave to a client whose socket is never drained, and returns the bytes sent
+    size_t sendDegraded(DegradationPolicy policy, size_t factor, size_t packetCount, size_t samplesPerPacket)
+    {
+        const auto context = NullContext();
+        const auto domainSignal = SignalWithDescriptor(context, createDomainDescriptor(), nullptr, "domain");
+        const auto valueSignal = SignalWithDescriptor(context, createValueDescriptor(), nullptr, "value");
+        const auto domainSignalId = domainSignal.getGlobalId().toStdString();
+        const auto valueSignalId = valueSignal.getGlobalId().toStdString();
+
+        StreamingManager manager(context);
+        manager.registerSignal(domainSignal);
+        manager.registerSignal(valueSignal);
+        manager.registerClient("client", false);
+        manager.setClientBandwidthBudget("client", 0, 1000, []() { return size_t(2000); });
+        manager.setSignalDegradationPolicy(valueSignalId, policy, factor);
+
+        size_t bytesSent = 0;
+        packet_streaming::PacketStreamingClient client;
+        const SendPacketBufferCallback sendCb = [&](const std::string&, const packet_streaming::PacketBufferPtr& packetBuffer)
+        {
+            bytesSent += packetBuffer->packetHeader->payloadSize;
+            client.addPacketBuffer(packetBuffer);
+        };
+
+        manager.registerSignalSubscriber(domainSignalId, "client", sendCb);
+        manager.registerSignalSubscriber(valueSignalId, "client", sendCb);
+        manager.sendPacketToSubscribers(domainSignalId, DataDescriptorChangedEventPacket(createDomainDescriptor(), nullptr), sendCb);
+        manager.sendPacketToSubscribers(
+            valueSignalId, DataDescriptorChangedEventPacket(createValueDescriptor(), createDomainDescriptor()), sendCb);
+
+        bytesSent = 0;
+        for (size_t packetIndex = 0; packetIndex < packetCount; packetIndex++)
+        {
+            const auto offset = static_cast<Int>(packetIndex * samplesPerPacket);
+            const auto domainPacket = DataPacket(createDomainDescriptor(), samplesPerPacket, offset);
+            auto packet = DataPacketWithDomain(domainPacket, createValueDescriptor(), samplesPerPacket);
+
+            auto values = static_cast<double*>(packet.getRawData());
+            for (size_t i = 0; i < samplesPerPacket; i++)
+                values[i] = std::sin(static_cast<double>(offset + static_cast<Int>(i)) / 100.0);
+
+            manager.sendPacketToSubscribers(domainSignalId, domainPacket, sendCb);
+            manager.sendPacketToSubscribers(valueSignalId, packet, sendCb);
+            while (std::get<1>(client.getNextDaqPacket()).assigned())
+            {
+            }
+        }
+
+        return bytesSent;
+    }
+};
+
+TEST_F(StreamDegradationBenchmark, SentDataReduction)
+{
+    constexpr size_t packetCount = 100;
+    constexpr size_t samplesPerPacket = 1000;
+    const auto fullSize = packetCount * samplesPerPacket * sizeof(double);
+
+    const auto decimatedSize = sendDegraded(DegradationPolicy::Decimate, 10, packetCount, samplesPerPacket);
+    const auto minMaxSize = sendDegraded(DegradationPolicy::MinMax, 10, packetCount, samplesPerPacket);
+    ASSERT_LT(decimatedSize, fullSize);
+    ASSERT_LT(minMaxSize, fullSize);
+
+    RecordProperty("DecimateReductionRatio", std::to_string(static_cast<double>(fullSize) / static_cast<double>(decimatedSize)));
+    RecordProperty("MinMaxReductionRatio", std::to_string(static_cast<double>(fullSize) / static_cast<double>(minMaxSize)));
+}
@@ -0,0 +1,185 @@
+#include "test_base.h"
+
+#include <opendaq/opendaq.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+
+using namespace daq;
+using namespace daq::opendaq_native_streaming_protocol;
+
+class StreamingProtocolBenchmarkClient : public ClientAttributesBase
+{
+public:
+    std::promise<void> streamingInitPromise;
+    std::promise<StringPtr> signalAvailablePromise;
+    std::promise<void> subscribedAckPromise;
+    OnPacketCallback packetHandler;
+
+    void connect(const std::string& address, const std::string& port)
+    {
+        clientHandler = std::make_shared<NativeStreamingClientHandler>(
+            clientContext, createTransportLayerConfig(), createAuthenticationConfig());
+
+        clientHandler->setStreamingHandlers(
+            [this](const StringPtr& signalStringId, const StringPtr& /*serializedSignal*/) { signalAvailablePromise.set_value(signalStringId); },
+            [](const StringPtr& /*signalStringId*/) {},
+            [this](const StringPtr& signalStringId, const PacketPtr& packet) { packetHandler(signalStringId, packet); },
+            [this](const StringPtr& /*signalStringId*/, bool subscribed)
+            {
+                if (subscribed)
+                    subscribedAckPromise.set_value();
+            },
+            [](ClientConnectionStatus /*status*/) {},
+            [this]() { streamingInitPromise.set_value(); });
+
+        ASSERT_TRUE(clientHandler->connect(address, port));
+        clientHandler->sendStreamingRequest();
+    }
+};
+
+class StreamingProtocolBenchmark : public ProtocolTestBase
+{
+public:
+    void SetUp() override
+    {
+        ProtocolTestBase::SetUp();
+
+        clients = std::vector<StreamingProtocolBenchmarkClient>(std::get<0>(GetParam()));
+        for (auto& client : clients)
+            client.setUp();
+    }
+
+    void TearDown() override
+    {
+        for (auto& client : clients)
+            client.tearDown();
+        stopIoOperations();
+        serverHandler.reset();
+        ProtocolTestBase::TearDown();
+    }
+
+    void startServer(const SignalPtr& signal, const EventPacketPtr& eventPacket)
+    {
+        startIoOperations();
+        serverHandler = std::make_shared<NativeStreamingServerHandler>(
+            serverContext,
+            ioContextPtrServer,
+            List<ISignal>(signal),
+            [this, eventPacket](const SignalPtr& subscribedSignal)
+            {
+                serverHandler->sendPacket(subscribedSignal, eventPacket);
+                if (++subscribedCount == clients.size())
+                    signalSubscribedPromise.set_value();
+            },
+            [](const SignalPtr& /*signal*/) {},
+            [](SendConfigProtocolPacketCb /*sendPacketCb*/, const UserPtr& /*user*/) { return std::make_pair(nullptr, nullptr); });
+        serverHandler->startServer(NATIVE_STREAMING_SERVER_PORT);
+    }
+
+protected:
+    std::vector<StreamingProtocolBenchmarkClient> clients;
+    std::atomic<size_t> subscribedCount{0};
+    std::promise<void> signalSubscribedPromise;
+};
+
+TEST_P(StreamingProtocolBenchmark, SendDataPacketsLoopbackRate)
+{
+    using namespace std::chrono;
+
+    // a burst measures the message rate, packets paced at 10 kHz measure the latency
+    constexpr size_t burstCount = 10000;
+    constexpr size_t pacedCount = 2000;
+    constexpr size_t packetCount = burstCount + pacedCount;
+
+    struct ReceivedPackets
+    {
+        std::vector<int64_t> latencies = std::vector<int64_t>(packetCount);
+        size_t count = 0;
+        std::promise<void> burstReceivedPromise;
+        std::promise<void> allReceivedPromise;
+    };
+
+    const auto valueDescriptor = DataDescriptorBuilder().setSampleType(SampleType::Int64).build();
+    auto serverSignal = SignalWithDescriptor(serverContext, valueDescriptor, nullptr, "signal");
+
+    std::vector<std::atomic<int64_t>> sendTimes(packetCount);
+    std::vector<std::unique_ptr<ReceivedPackets>> receivedPackets;
+
+    startServer(serverSignal, DataDescriptorChangedEventPacket(valueDescriptor, nullptr));
+    auto signalSubscribedFuture = signalSubscribedPromise.get_future();
+
+    for (auto& client : clients)
+    {
+        auto& received = *receivedPackets.emplace_back(std::make_unique<ReceivedPackets>());
+        client.packetHandler = [&received, &sendTimes](const StringPtr& /*signalStringId*/, const PacketPtr& packet)
+        {
+            if (packet.getType() != PacketType::Data)
+                return;
+
+            const auto now = duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+            const auto index = *static_cast<int64_t*>(packet.asPtr<IDataPacket>().getData());
+            received.latencies[index] = now - sendTimes[index];
+            if (++received.count == burstCount)
+                received.burstReceivedPromise.set_value();
+            else if (received.count == packetCount)
+                received.allReceivedPromise.set_value();
+        };
+
+        auto streamingInitFuture = client.streamingInitPromise.get_future();
+        auto signalAvailableFuture = client.signalAvailablePromise.get_future();
+        auto subscribedAckFuture = client.subscribedAckPromise.get_future();
+
+        client.connect(SERVER_ADDRESS, NATIVE_STREAMING_LISTENING_PORT);
+        ASSERT_EQ(streamingInitFuture.wait_for(timeout), std::future_status::ready);
+        ASSERT_EQ(signalAvailableFuture.wait_for(timeout), std::future_status::ready);
+
+        client.clientHandler->subscribeSignal(signalAvailableFuture.get());
+        ASSERT_EQ(subscribedAckFuture.wait_for(timeout), std::future_status::ready);
+    }
+
+    ASSERT_EQ(signalSubscribedFuture.wait_for(timeout), std::future_status::ready);
+
+    const auto sendPacket = [&](size_t index)
+    {
+        auto packet = DataPacket(valueDescriptor, 1);
+        *static_cast<int64_t*>(packet.getRawData()) = static_cast<int64_t>(index);
+        sendTimes[index] = duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+        serverHandler->sendPacket(serverSignal, packet);
+    };
+
+    const auto burstStart = steady_clock::now();
+    for (size_t i = 0; i < burstCount; ++i)
+        sendPacket(i);
+    for (const auto& received : receivedPackets)
+        ASSERT_EQ(received->burstReceivedPromise.get_future().wait_for(seconds(10)), std::future_status::ready);
+    const auto burstDuration = duration<double>(steady_clock::now() - burstStart).count();
+
+    auto nextSendTime = steady_clock::now();
+    for (size_t i = burstCount; i < packetCount; ++i)
+    {
+        std::this_thread::sleep_until(nextSendTime);
+        sendPacket(i);
+        nextSendTime += microseconds(100);
+    }
+    for (const auto& received : receivedPackets)
+        ASSERT_EQ(received->allReceivedPromise.get_future().wait_for(seconds(10)), std::future_status::ready);
+
+    std::vector<int64_t> latencies;
+    for (const auto& received : receivedPackets)
+        latencies.insert(latencies.end(), received->latencies.begin() + burstCount, received->latencies.end());
+    std::sort(latencies.begin(), latencies.end());
+
+    RecordProperty("MessagesPerSecond", std::to_string(static_cast<double>(burstCount * clients.size()) / burstDuration));
+    RecordProperty("P99LatencyUs", std::to_string(static_cast<double>(latencies[latencies.size() * 99 / 100]) / 1000.0));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    ProtocolBenchmarkGroup,
+    StreamingProtocolBenchmark,
+    testing::Values(std::make_tuple(1, true),
+                    std::make_tuple(4, true))
+);
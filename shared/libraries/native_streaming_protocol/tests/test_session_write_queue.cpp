@@ -0,0 +1,137 @@
+#include <gtest/gtest.h>
+#include <native_streaming_protocol/session_write_queue.h>
+
+using namespace daq;
+using namespace daq::opendaq_native_streaming_protocol;
+using namespace daq::native_streaming;
+
+class SessionWriteQueueTest : public testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        ioContext = std::make_shared<boost::asio::io_context>();
+        queue = std::make_shared<SessionWriteQueue>(ioContext, [this](std::vector<WriteTask>& tasks) { writes.push_back(tasks); });
+    }
+
+    packet_streaming::PacketBufferPtr createPacketBuffer(size_t payloadSize)
+    {
+        auto header = std::make_shared<packet_streaming::GenericPacketHeader>();
+        header->size = sizeof(packet_streaming::GenericPacketHeader);
+        header->type = packet_streaming::PacketType::data;
+        header->version = 0;
+        header->flags = 0;
+        header->signalId = 1;
+        header->payloadSize = static_cast<uint32_t>(payloadSize);
+
+        auto payload = std::make_shared<std::vector<uint8_t>>(payloadSize);
+        return std::make_shared<packet_streaming::PacketBuffer>(header.get(),
+                                                                payload->data(),
+                                                                [this, header, payload]() { releasedPacketBuffers++; });
+    }
+
+    static constexpr size_t messageSize(size_t payloadSize)
+    {
+        return TransportHeader::PACKED_HEADER_SIZE + sizeof(packet_streaming::GenericPacketHeader) + payloadSize;
+    }
+
+    std::shared_ptr<boost::asio::io_context> ioContext;
+    std::shared_ptr<SessionWriteQueue> queue;
+    std::vector<std::vector<WriteTask>> writes;
+    size_t releasedPacketBuffers = 0;
+};
+
+TEST_F(SessionWriteQueueTest, PacketBuffersBatched)
+{
+    for (size_t i = 0; i < 10; ++i)
+        queue->writePacketBuffer(PayloadType::PAYLOAD_TYPE_STREAMING_PACKET, createPacketBuffer(100));
+
+    ASSERT_TRUE(writes.empty());
+    ASSERT_EQ(queue->getPendingWriteSize(), 10 * messageSize(100));
+
+    ioContext->run();
+    ASSERT_EQ(writes.size(), 1u);
+    ASSERT_EQ(queue->getWriteCount(), 1u);
+
+    // transport header, packet header and payload of each packet buffer, then the completion task
+    const auto& tasks = writes[0];
+    ASSERT_EQ(tasks.size(), 31u);
+    for (size_t i = 0; i < 10; ++i)
+    {
+        const TransportHeader header(static_cast<const PackedHeaderType*>(tasks[i * 3].getBuffer().data()));
+        ASSERT_EQ(header.getPayloadType(), PayloadType::PAYLOAD_TYPE_STREAMING_PACKET);
+        ASSERT_EQ(header.getPayloadSize(), sizeof(packet_streaming::GenericPacketHeader) + 100);
+        ASSERT_EQ(tasks[i * 3 + 1].getBuffer().size(), sizeof(packet_streaming::GenericPacketHeader));
+        ASSERT_EQ(tasks[i * 3 + 2].getBuffer().size(), 100u);
+    }
+    ASSERT_EQ(tasks.back().getBuffer().size(), 0u);
+
+    // packet buffers are held until the session drops the tasks
+    ASSERT_EQ(releasedPacketBuffers, 0u);
+    writes.clear();
+    ASSERT_EQ(releasedPacketBuffers, 10u);
+    ASSERT_EQ(queue->getPendingWriteSize(), 0u);
+}
+
+TEST_F(SessionWriteQueueTest, SizeLimit)
+{
+    queue->setLimits(5 * messageSize(100), std::chrono::microseconds(0));
+
+    for (size_t i = 0; i < 7; ++i)
+        queue->writePacketBuffer(PayloadType::PAYLOAD_TYPE_STREAMING_PACKET, createPacketBuffer(100));
+
+    ASSERT_EQ(writes.size(), 1u);
+    ASSERT_EQ(writes[0].size(), 16u);
+
+    ioContext->run();
+    ASSERT_EQ(writes.size(), 2u);
+    ASSERT_EQ(writes[1].size(), 7u);
+}
+
+TEST_F(SessionWriteQueueTest, BatchDelay)
+{
+    queue->setLimits(SessionWriteQueue::DefaultMaxBatchSize, std::chrono::microseconds(1000));
+
+    queue->writePacketBuffer(PayloadType::PAYLOAD_TYPE_STREAMING_PACKET, createPacketBuffer(10));
+    ioContext->poll();
+    ASSERT_TRUE(writes.empty());
+
+    ioContext->run();
+    ASSERT_EQ(writes.size(), 1u);
+}
+
+TEST_F(SessionWriteQueueTest, ImmediateWriteKeepsOrder)
+{
+    queue->writePacketBuffer(PayloadType::PAYLOAD_TYPE_STREAMING_PACKET, createPacketBuffer(10));
+    queue->writePacketBuffer(PayloadType::PAYLOAD_TYPE_STREAMING_PACKET, createPacketBuffer(0));
+
+    const uint64_t value = 42;
+    std::vector<WriteTask> tasks;
+    tasks.push_back(WriteTask(boost::asio::const_buffer(&value, sizeof(value)), []() {}));
+    queue->write(tasks);
+
+    ASSERT_EQ(writes.size(), 1u);
+    ASSERT_EQ(writes[0].size(), 7u);
+    ASSERT_EQ(writes[0][5].getBuffer().data(), &value);
+
+    // the flush scheduled by the batched packet buffers finds an empty batch
+    ioContext->run();
+    ASSERT_EQ(writes.size(), 1u);
+}
+
+TEST_F(SessionWriteQueueTest, BatchedWrite)
+{
+    const uint64_t value = 42;
+    std::vector<WriteTask> tasks;
+    tasks.push_back(WriteTask(boost::asio::const_buffer(&value, sizeof(value)), []() {}));
+    queue->writeBatched(tasks);
+    queue->writePacketBuffer(PayloadType::PAYLOAD_TYPE_STREAMING_PACKET, createPacketBuffer(10));
+
+    ASSERT_TRUE(writes.empty());
+    ASSERT_EQ(queue->getPendingWriteSize(), sizeof(value) + messageSize(10));
+
+    queue->flush();
+    ASSERT_EQ(writes.size(), 1u);
+    ASSERT_EQ(writes[0].size(), 5u);
+    ASSERT_EQ(writes[0][0].getBuffer().data(), &value);
+}
@@ -0,0 +1,150 @@
+#include <gtest/gtest.h>
+#include <testutils/memcheck_listener.h>
+#include <native_streaming_protocol/shared_memory_ring.h>
+#include <native_streaming_protocol/native_streaming_protocol_types.h>
+
+#include <cstring>
+#include <numeric>
+#include <vector>
+
+using namespace daq;
+using namespace daq::opendaq_native_streaming_protocol;
+
+class SharedMemoryRingTest : public testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        if (!SharedMemoryRing::IsSupported())
+            GTEST_SKIP() << "Shared memory transport is not supported on this platform";
+    }
+
+    static std::vector<uint8_t> createData(size_t size, uint8_t seed)
+    {
+        std::vector<uint8_t> data(size);
+        std::iota(data.begin(), data.end(), seed);
+        return data;
+    }
+};
+
+TEST_F(SharedMemoryRingTest, AcquireAndMap)
+{
+    SharedMemoryRing ring(4096);
+    SharedMemoryMapping mapping(ring.getName(), ring.getCapacity());
+
+    const auto data = createData(100, 1);
+    uint64_t offset;
+    ASSERT_TRUE(ring.acquire(1, data.data(), data.size(), offset));
+    ASSERT_EQ(offset % SharedMemoryRing::BlockAlignment, 0u);
+    ASSERT_EQ(ring.getUsedSize(), 128u);
+
+    ASSERT_EQ(std::memcmp(mapping.getData(offset, data.size()), data.data(), data.size()), 0);
+}
+
+TEST_F(SharedMemoryRingTest, SamePacketStoredOnce)
+{
+    SharedMemoryRing ring(4096);
+
+    const auto data = createData(64, 1);
+    uint64_t offset1;
+    uint64_t offset2;
+    ASSERT_TRUE(ring.acquire(1, data.data(), data.size(), offset1));
+    ASSERT_TRUE(ring.acquire(1, data.data(), data.size(), offset2));
+
+    ASSERT_EQ(offset1, offset2);
+    ASSERT_EQ(ring.getUsedSize(), 64u);
+
+    // block is reclaimed only after every reference is released
+    ASSERT_TRUE(ring.release(offset1));
+    ASSERT_EQ(ring.getUsedSize(), 64u);
+    ASSERT_TRUE(ring.release(offset2));
+    ASSERT_EQ(ring.getUsedSize(), 0u);
+    ASSERT_FALSE(ring.release(offset1));
+}
+
+TEST_F(SharedMemoryRingTest, ReclaimedInAllocationOrder)
+{
+    SharedMemoryRing ring(256);
+
+    const auto data = createData(64, 1);
+    uint64_t offsets[4];
+    for (Int i = 0; i < 4; ++i)
+        ASSERT_TRUE(ring.acquire(i, data.data(), data.size(), offsets[i]));
+
+    uint64_t offset;
+    ASSERT_FALSE(ring.acquire(4, data.data(), data.size(), offset));
+
+    // releasing a block behind the oldest one does not free space yet
+    ASSERT_TRUE(ring.release(offsets[1]));
+    ASSERT_EQ(ring.getUsedSize(), 256u);
+    ASSERT_FALSE(ring.acquire(4, data.data(), data.size(), offset));
+
+    ASSERT_TRUE(ring.release(offsets[0]));
+    ASSERT_EQ(ring.getUsedSize(), 128u);
+    ASSERT_TRUE(ring.acquire(4, data.data(), data.size(), offset));
+    ASSERT_EQ(offset, offsets[0]);
+}
+
+TEST_F(SharedMemoryRingTest, BlocksDoNotWrap)
+{
+    SharedMemoryRing ring(256);
+    SharedMemoryMapping mapping(ring.getName(), ring.getCapacity());
+
+    const auto small = createData(64, 1);
+    const auto large = createData(128, 7);
+
+    uint64_t offset1;
+    uint64_t offset2;
+    uint64_t offset3;
+    ASSERT_TRUE(ring.acquire(1, small.data(), small.size(), offset1));
+    ASSERT_TRUE(ring.acquire(2, small.data(), small.size(), offset2));
+    ASSERT_TRUE(ring.acquire(3, small.data(), small.size(), offset3));
+    ASSERT_TRUE(ring.release(offset1));
+    ASSERT_TRUE(ring.release(offset2));
+
+    // 64 bytes left at the end are skipped; the block starts at the beginning of the segment
+    uint64_t offset;
+    ASSERT_TRUE(ring.acquire(4, large.data(), large.size(), offset));
+    ASSERT_EQ(offset, 0u);
+    ASSERT_EQ(std::memcmp(mapping.getData(offset, large.size()), large.data(), large.size()), 0);
+
+    ASSERT_FALSE(ring.acquire(5, small.data(), small.size(), offset));
+    ASSERT_TRUE(ring.release(offset3));
+    ASSERT_TRUE(ring.acquire(5, small.data(), small.size(), offset));
+    ASSERT_EQ(offset, 128u);
+}
+
+TEST_F(SharedMemoryRingTest, PayloadLargerThanRing)
+{
+    SharedMemoryRing ring(256);
+
+    const auto data = createData(512, 1);
+    uint64_t offset;
+    ASSERT_FALSE(ring.acquire(1, data.data(), data.size(), offset));
+    ASSERT_EQ(ring.getUsedSize(), 0u);
+}
+
+TEST_F(SharedMemoryRingTest, UnlinkKeepsMappings)
+{
+    SharedMemoryRing ring(4096);
+    SharedMemoryMapping mapping(ring.getName(), ring.getCapacity());
+
+    ring.unlink();
+    ASSERT_THROW(SharedMemoryMapping(ring.getName(), ring.getCapacity()), NativeStreamingProtocolException);
+
+    // the segment itself lives on for the mappings that already exist
+    const auto data = createData(64, 1);
+    uint64_t offset;
+    ASSERT_TRUE(ring.acquire(1, data.data(), data.size(), offset));
+    ASSERT_EQ(std::memcmp(mapping.getData(offset, data.size()), data.data(), data.size()), 0);
+}
+
+TEST_F(SharedMemoryRingTest, MappingBoundsChecked)
+{
+    SharedMemoryRing ring(4096);
+    SharedMemoryMapping mapping(ring.getName(), ring.getCapacity());
+
+    ASSERT_THROW(mapping.getData(4000, 100), NativeStreamingProtocolException);
+    ASSERT_THROW(SharedMemoryMapping(ring.getName(), 8192), NativeStreamingProtocolException);
+    ASSERT_THROW(SharedMemoryMapping("/daqns_missing", 4096), NativeStreamingProtocolException);
+}
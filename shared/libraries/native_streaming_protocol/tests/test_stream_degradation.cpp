@@ -0,0 +1,413 @@
+#include <gtest/gtest.h>
+#include <opendaq/opendaq.h>
+#include <native_streaming_protocol/stream_degradation.h>
+#include <native_streaming_protocol/streaming_manager.h>
+#include <packet_streaming/packet_streaming_client.h>
+
+#include <cstring>
+
+using namespace daq;
+using namespace daq::opendaq_native_streaming_protocol;
+
+class StreamDegradationTest : public testing::Test
+{
+protected:
+    static DataDescriptorPtr createValueDescriptor()
+    {
+        return DataDescriptorBuilder().setSampleType(SampleType::Float64).build();
+    }
+
+    static DataDescriptorPtr createLinearDomainDescriptor()
+    {
+        return DataDescriptorBuilder().setSampleType(SampleType::Int64).setRule(LinearDataRule(1, 0)).setTickResolution(Ratio(1, 1000)).build();
+    }
+
+    static DataDescriptorPtr createExplicitDomainDescriptor()
+    {
+        return DataDescriptorBuilder().setSampleType(SampleType::Int64).setTickResolution(Ratio(1, 1000)).build();
+    }
+
+    template <typename T>
+    static DataPacketPtr createPacket(const DataDescriptorPtr& descriptor, const std::vector<T>& values, const DataPacketPtr& domainPacket = nullptr)
+    {
+        auto packet = domainPacket.assigned() ? DataPacketWithDomain(domainPacket, descriptor, values.size())
+                                              : DataPacket(descriptor, values.size());
+        std::memcpy(packet.getRawData(), values.data(), values.size() * sizeof(T));
+        return packet;
+    }
+
+    template <typename T>
+    static std::vector<T> getValues(const DataPacketPtr& packet)
+    {
+        const auto data = static_cast<T*>(packet.getData());
+        return std::vector<T>(data, data + packet.getSampleCount());
+    }
+
+    const std::vector<double> values{0.0, 5.0, -3.0, 1.0, 2.0, 2.0, 9.0, -1.0};
+};
+
+TEST_F(StreamDegradationTest, BudgetRate)
+{
+    BandwidthBudget budget(1000, 0);
+    const auto start = BandwidthBudget::Clock::now();
+
+    ASSERT_FALSE(budget.update(0, start));
+    budget.consume(1500);
+    ASSERT_TRUE(budget.update(0, start));
+
+    // restored only after half of the budget is refilled
+    ASSERT_TRUE(budget.update(0, start + std::chrono::milliseconds(700)));
+    ASSERT_FALSE(budget.update(0, start + std::chrono::milliseconds(1100)));
+    ASSERT_FALSE(budget.isExceeded());
+}
+
+TEST_F(StreamDegradationTest, BudgetPendingWrites)
+{
+    BandwidthBudget budget(0, 1000);
+
+    ASSERT_FALSE(budget.update(999));
+    ASSERT_TRUE(budget.update(1000));
+    ASSERT_TRUE(budget.update(600));
+    ASSERT_FALSE(budget.update(500));
+
+    budget.consume(1000000);
+    ASSERT_FALSE(budget.update(0));
+}
+
+TEST_F(StreamDegradationTest, ApplicablePolicy)
+{
+    const auto valueDescriptor = createValueDescriptor();
+    const auto linearDomainDescriptor = createLinearDomainDescriptor();
+
+    ASSERT_EQ(getApplicableDegradationPolicy(valueDescriptor, linearDomainDescriptor, DegradationPolicy::MinMax), DegradationPolicy::MinMax);
+    ASSERT_EQ(getApplicableDegradationPolicy(valueDescriptor, createExplicitDomainDescriptor(), DegradationPolicy::Decimate),
+              DegradationPolicy::Decimate);
+    ASSERT_EQ(getApplicableDegradationPolicy(valueDescriptor, nullptr, DegradationPolicy::Decimate), DegradationPolicy::DropPackets);
+
+    const auto structDescriptor =
+        DataDescriptorBuilder()
+            .setSampleType(SampleType::Struct)
+            .setStructFields(List<IDataDescriptor>(DataDescriptorBuilder().setName("Field").setSampleType(SampleType::Int32).build()))
+            .build();
+    ASSERT_EQ(getApplicableDegradationPolicy(structDescriptor, linearDomainDescriptor, DegradationPolicy::MinMax), DegradationPolicy::Decimate);
+
+    const auto constantDescriptor = DataDescriptorBuilder().setSampleType(SampleType::Float64).setRule(ConstantDataRule()).build();
+    ASSERT_EQ(getApplicableDegradationPolicy(constantDescriptor, linearDomainDescriptor, DegradationPolicy::Decimate),
+              DegradationPolicy::DropPackets);
+}
+
+TEST_F(StreamDegradationTest, DegradedDescriptors)
+{
+    const auto valueDescriptor = createValueDescriptor();
+    const auto domainDescriptor = createLinearDomainDescriptor();
+
+    const auto degradedValueDescriptor = createDegradedValueDescriptor(valueDescriptor, DegradationPolicy::MinMax, 8);
+    ASSERT_EQ(degradedValueDescriptor.getMetadata().get("DegradationPolicy"), "MinMax");
+    ASSERT_EQ(degradedValueDescriptor.getMetadata().get("DegradationFactor"), "8");
+    ASSERT_EQ(degradedValueDescriptor.getSampleType(), SampleType::Float64);
+
+    const auto decimatedDomainDescriptor = createDegradedDomainDescriptor(domainDescriptor, DegradationPolicy::Decimate, 8);
+    ASSERT_EQ(static_cast<Int>(decimatedDomainDescriptor.getRule().getParameters().get("delta")), 8);
+    const auto minMaxDomainDescriptor = createDegradedDomainDescriptor(domainDescriptor, DegradationPolicy::MinMax, 8);
+    ASSERT_EQ(minMaxDomainDescriptor.getRule().getType(), DataRuleType::Explicit);
+    ASSERT_EQ(minMaxDomainDescriptor.getSampleType(), SampleType::Int64);
+    ASSERT_EQ(minMaxDomainDescriptor.getTickResolution(), Ratio(1, 1000));
+
+    ASSERT_EQ(createDegradedDomainDescriptor(createExplicitDomainDescriptor(), DegradationPolicy::Decimate, 8),
+              createExplicitDomainDescriptor());
+}
+
+TEST_F(StreamDegradationTest, Decimate)
+{
+    const auto domainDescriptor = createExplicitDomainDescriptor();
+    const auto domainPacket = createPacket<int64_t>(domainDescriptor, {10, 11, 13, 14, 17, 18, 20, 25});
+    const auto packet = createPacket(createValueDescriptor(), values, domainPacket);
+
+    const auto degradedValueDescriptor = createDegradedValueDescriptor(createValueDescriptor(), DegradationPolicy::Decimate, 3);
+    const auto degradedDomainDescriptor = createDegradedDomainDescriptor(domainDescriptor, DegradationPolicy::Decimate, 3);
+    DegradationState state;
+    const auto degradedPacket =
+        degradeDataPacket(packet, DegradationPolicy::Decimate, 3, degradedValueDescriptor, degradedDomainDescriptor, state);
+
+    ASSERT_EQ(degradedPacket.getDataDescriptor(), degradedValueDescriptor);
+    ASSERT_EQ(getValues<double>(degradedPacket), (std::vector<double>{0.0, 1.0, 9.0}));
+    ASSERT_EQ(getValues<int64_t>(degradedPacket.getDomainPacket()), (std::vector<int64_t>{10, 14, 20}));
+    ASSERT_EQ(state.skipCount, 1u);
+}
+
+TEST_F(StreamDegradationTest, DecimateAcrossPackets)
+{
+    const auto domainDescriptor = createLinearDomainDescriptor();
+    const auto degradedValueDescriptor = createDegradedValueDescriptor(createValueDescriptor(), DegradationPolicy::Decimate, 3);
+    const auto degradedDomainDescriptor = createDegradedDomainDescriptor(domainDescriptor, DegradationPolicy::Decimate, 3);
+    DegradationState state;
+
+    // samples 0, 3, 6, ... of the stream are sent, regardless of the packet boundaries
+    std::vector<double> sentValues;
+    std::vector<int64_t> sentDomainValues;
+    for (Int offset = 0; offset < 24; offset += 8)
+    {
+        const auto packet = createPacket(createValueDescriptor(), values, DataPacket(domainDescriptor, values.size(), offset));
+        const auto degradedPacket =
+            degradeDataPacket(packet, DegradationPolicy::Decimate, 3, degradedValueDescriptor, degradedDomainDescriptor, state);
+        ASSERT_EQ(degradedPacket.getDomainPacket().getDataDescriptor(), degradedDomainDescriptor);
+
+        const auto packetValues = getValues<double>(degradedPacket);
+        const auto packetDomainValues = getValues<int64_t>(degradedPacket.getDomainPacket());
+        sentValues.insert(sentValues.end(), packetValues.begin(), packetValues.end());
+        sentDomainValues.insert(sentDomainValues.end(), packetDomainValues.begin(), packetDomainValues.end());
+    }
+
+    ASSERT_EQ(sentValues, (std::vector<double>{0.0, 1.0, 9.0, 5.0, 2.0, -1.0, -3.0, 2.0}));
+    ASSERT_EQ(sentDomainValues, (std::vector<int64_t>{0, 3, 6, 9, 12, 15, 18, 21}));
+}
+
+TEST_F(StreamDegradationTest, MinMax)
+{
+    const auto domainDescriptor = createLinearDomainDescriptor();
+    const auto domainPacket = DataPacket(domainDescriptor, values.size(), 100);
+    const auto packet = createPacket(createValueDescriptor(), values, domainPacket);
+
+    const auto degradedValueDescriptor = createDegradedValueDescriptor(createValueDescriptor(), DegradationPolicy::MinMax, 4);
+    const auto degradedDomainDescriptor = createDegradedDomainDescriptor(domainDescriptor, DegradationPolicy::MinMax, 4);
+    DegradationState state;
+    const auto degradedPacket =
+        degradeDataPacket(packet, DegradationPolicy::MinMax, 4, degradedValueDescriptor, degradedDomainDescriptor, state);
+
+    // pairs keep the order of the samples in each bucket and carry the domain values of the samples
+    ASSERT_EQ(getValues<double>(degradedPacket), (std::vector<double>{5.0, -3.0, 9.0, -1.0}));
+    ASSERT_EQ(getValues<int64_t>(degradedPacket.getDomainPacket()), (std::vector<int64_t>{101, 102, 106, 107}));
+    ASSERT_EQ(state.bucketSampleCount, 0u);
+
+    ASSERT_FALSE(
+        degradeDataPacket(packet, DegradationPolicy::DropPackets, 4, degradedValueDescriptor, degradedDomainDescriptor, state).assigned());
+}
+
+TEST_F(StreamDegradationTest, MinMaxAcrossPackets)
+{
+    const auto domainDescriptor = createLinearDomainDescriptor();
+    const auto degradedValueDescriptor = createDegradedValueDescriptor(createValueDescriptor(), DegradationPolicy::MinMax, 6);
+    const auto degradedDomainDescriptor = createDegradedDomainDescriptor(domainDescriptor, DegradationPolicy::MinMax, 6);
+    DegradationState state;
+
+    const auto degrade = [&](Int offset)
+    {
+        const auto packet = createPacket(createValueDescriptor(), values, DataPacket(domainDescriptor, values.size(), offset));
+        return degradeDataPacket(packet, DegradationPolicy::MinMax, 6, degradedValueDescriptor, degradedDomainDescriptor, state);
+    };
+
+    // buckets: {0, 5, -3, 1, 2, 2}, {9, -1 | 0, 5, -3, 1}, {2, 2, 9, -1 | ...
+    auto degradedPacket = degrade(0);
+    ASSERT_EQ(getValues<double>(degradedPacket), (std::vector<double>{5.0, -3.0}));
+    ASSERT_EQ(getValues<int64_t>(degradedPacket.getDomainPacket()), (std::vector<int64_t>{1, 2}));
+    ASSERT_EQ(state.bucketSampleCount, 2u);
+
+    // the maximum of the second bucket is carried over from the previous packet
+    degradedPacket = degrade(8);
+    ASSERT_EQ(getValues<double>(degradedPacket), (std::vector<double>{9.0, -3.0}));
+    ASSERT_EQ(getValues<int64_t>(degradedPacket.getDomainPacket()), (std::vector<int64_t>{6, 10}));
+    ASSERT_EQ(state.bucketSampleCount, 4u);
+}
+
+TEST_F(StreamDegradationTest, MinMaxSmallPackets)
+{
+    const auto domainDescriptor = createExplicitDomainDescriptor();
+    const auto degradedValueDescriptor = createDegradedValueDescriptor(createValueDescriptor(), DegradationPolicy::MinMax, 4);
+    const auto degradedDomainDescriptor = createDegradedDomainDescriptor(domainDescriptor, DegradationPolicy::MinMax, 4);
+    ASSERT_EQ(degradedDomainDescriptor, domainDescriptor);
+    DegradationState state;
+
+    // packets smaller than a bucket are combined until the bucket is complete
+    std::vector<DataPacketPtr> degradedPackets;
+    for (size_t index = 0; index < values.size(); index++)
+    {
+        const auto domainPacket = createPacket<int64_t>(domainDescriptor, {static_cast<int64_t>(index * 10)});
+        const auto packet = createPacket(createValueDescriptor(), std::vector<double>{values[index]}, domainPacket);
+        const auto degradedPacket =
+            degradeDataPacket(packet, DegradationPolicy::MinMax, 4, degradedValueDescriptor, degradedDomainDescriptor, state);
+        if (degradedPacket.assigned())
+            degradedPackets.push_back(degradedPacket);
+    }
+
+    ASSERT_EQ(degradedPackets.size(), 2u);
+    ASSERT_EQ(getValues<double>(degradedPackets[0]), (std::vector<double>{5.0, -3.0}));
+    ASSERT_EQ(getValues<int64_t>(degradedPackets[0].getDomainPacket()), (std::vector<int64_t>{10, 20}));
+    ASSERT_EQ(getValues<double>(degradedPackets[1]), (std::vector<double>{9.0, -1.0}));
+    ASSERT_EQ(getValues<int64_t>(degradedPackets[1].getDomainPacket()), (std::vector<int64_t>{60, 70}));
+}
+
+class ThrottledClientTest : public StreamDegradationTest
+{
+protected:
+    void SetUp() override
+    {
+        context = NullContext();
+        domainSignal = SignalWithDescriptor(context, createLinearDomainDescriptor(), nullptr, "domain");
+        valueSignal = SignalWithDescriptor(context, createValueDescriptor(), nullptr, "value");
+        domainSignalId = domainSignal.getGlobalId().toStdString();
+        valueSignalId = valueSignal.getGlobalId().toStdString();
+
+        manager = std::make_unique<StreamingManager>(context);
+        domainNumericId = manager->registerSignal(domainSignal);
+        valueNumericId = manager->registerSignal(valueSignal);
+
+        // loopback client which does not drain its socket until told to
+        manager->registerClient(clientId, false, supportedPayloadCodecs);
+        manager->setClientBandwidthBudget(clientId, 0, 1000, [this]() { return pendingWriteSize; });
+
+        sendCb = [this](const std::string&, const packet_streaming::PacketBufferPtr& packetBuffer)
+        {
+            bytesSent += packetBuffer->packetHeader->payloadSize;
+            client.addPacketBuffer(packetBuffer);
+        };
+
+        manager->registerSignalSubscriber(domainSignalId, clientId, sendCb);
+        manager->registerSignalSubscriber(valueSignalId, clientId, sendCb);
+        manager->sendPacketToSubscribers(domainSignalId, DataDescriptorChangedEventPacket(createLinearDomainDescriptor(), nullptr), sendCb);
+        manager->sendPacketToSubscribers(
+            valueSignalId, DataDescriptorChangedEventPacket(createValueDescriptor(), createLinearDomainDescriptor()), sendCb);
+        receivePackets();
+    }
+
+    void sendData(Int offset)
+    {
+        const auto domainPacket = DataPacket(createLinearDomainDescriptor(), values.size(), offset);
+        manager->sendPacketToSubscribers(domainSignalId, domainPacket, sendCb);
+        manager->sendPacketToSubscribers(valueSignalId, createPacket(createValueDescriptor(), values, domainPacket), sendCb);
+    }
+
+    std::vector<PacketPtr> receivePackets()
+    {
+        std::vector<PacketPtr> valuePackets;
+        while (true)
+        {
+            const auto [signalNumericId, packet] = client.getNextDaqPacket();
+            if (!packet.assigned())
+                break;
+            if (signalNumericId == valueNumericId)
+                valuePackets.push_back(packet);
+        }
+        return valuePackets;
+    }
+
+    ContextPtr context;
+    SignalConfigPtr domainSignal;
+    SignalConfigPtr valueSignal;
+    std::string domainSignalId;
+    std::string valueSignalId;
+    SignalNumericIdType domainNumericId;
+    SignalNumericIdType valueNumericId;
+
+    const std::string clientId = "client";
+    std::unique_ptr<StreamingManager> manager;
+    packet_streaming::PacketStreamingClient client;
+    SendPacketBufferCallback sendCb;
+    size_t pendingWriteSize = 0;
+    size_t bytesSent = 0;
+    uint32_t supportedPayloadCodecs = 0;
+};
+
+TEST_F(ThrottledClientTest, DegradeAndRecover)
+{
+    manager->setSignalDegradationPolicy(valueSignalId, DegradationPolicy::MinMax, 4);
+
+    sendData(0);
+    auto packets = receivePackets();
+    ASSERT_EQ(packets.size(), 1u);
+    ASSERT_EQ(getValues<double>(packets[0].asPtr<IDataPacket>()), values);
+
+    pendingWriteSize = 2000;
+    sendData(8);
+    packets = receivePackets();
+    ASSERT_EQ(packets.size(), 2u);
+
+    const auto eventPacket = packets[0].asPtr<IEventPacket>();
+    ASSERT_EQ(eventPacket.getEventId(), event_packet_id::DATA_DESCRIPTOR_CHANGED);
+    const DataDescriptorPtr degradedValueDescriptor = eventPacket.getParameters().get(event_packet_param::DATA_DESCRIPTOR);
+    const DataDescriptorPtr degradedDomainDescriptor = eventPacket.getParameters().get(event_packet_param::DOMAIN_DATA_DESCRIPTOR);
+    ASSERT_EQ(degradedValueDescriptor.getMetadata().get("DegradationPolicy"), "MinMax");
+    ASSERT_EQ(degradedDomainDescriptor.getRule().getType(), DataRuleType::Explicit);
+
+    const auto degradedPacket = packets[1].asPtr<IDataPacket>();
+    ASSERT_EQ(getValues<double>(degradedPacket), (std::vector<double>{5.0, -3.0, 9.0, -1.0}));
+    ASSERT_EQ(getValues<int64_t>(degradedPacket.getDomainPacket()), (std::vector<int64_t>{9, 10, 14, 15}));
+
+    // still above the restore threshold
+    pendingWriteSize = 600;
+    sendData(16);
+    packets = receivePackets();
+    ASSERT_EQ(packets.size(), 1u);
+    ASSERT_EQ(packets[0].asPtr<IDataPacket>().getSampleCount(), 4u);
+
+    pendingWriteSize = 0;
+    sendData(24);
+    packets = receivePackets();
+    ASSERT_EQ(packets.size(), 2u);
+    const DataDescriptorPtr restoredValueDescriptor =
+        packets[0].asPtr<IEventPacket>().getParameters().get(event_packet_param::DATA_DESCRIPTOR);
+    ASSERT_EQ(restoredValueDescriptor, createValueDescriptor());
+    ASSERT_EQ(getValues<double>(packets[1].asPtr<IDataPacket>()), values);
+}
+
+TEST_F(ThrottledClientTest, DropPackets)
+{
+    pendingWriteSize = 2000;
+    sendData(0);
+    auto packets = receivePackets();
+    ASSERT_EQ(packets.size(), 1u);
+    ASSERT_EQ(packets[0].getType(), PacketType::Event);
+
+    sendData(8);
+    ASSERT_TRUE(receivePackets().empty());
+}
+
+TEST_F(ThrottledClientTest, InvalidPolicy)
+{
+    ASSERT_THROW(manager->setDegradationPolicy(DegradationPolicy::Decimate, 1), NativeStreamingProtocolException);
+    ASSERT_THROW(manager->setSignalDegradationPolicy(valueSignalId, DegradationPolicy::MinMax, 5), NativeStreamingProtocolException);
+    ASSERT_THROW(manager->setSignalDegradationPolicy("unknown", DegradationPolicy::Decimate, 2), NativeStreamingProtocolException);
+    ASSERT_THROW(manager->setClientBandwidthBudget("unknown", 0, 1000, nullptr), NativeStreamingProtocolException);
+}
+
+class CompressingClientTest : public ThrottledClientTest
+{
+protected:
+    CompressingClientTest()
+    {
+        supportedPayloadCodecs = packet_streaming::SupportedPayloadCodecs;
+    }
+};
+
+TEST_F(CompressingClientTest, SignalPayloadCodec)
+{
+    ASSERT_THROW(manager->setSignalPayloadCodec("unknown", packet_streaming::PayloadCodec::shuffleLz), NativeStreamingProtocolException);
+
+    manager->setPayloadCodec(packet_streaming::PayloadCodec::none);
+    manager->setSignalPayloadCodec(valueSignalId, packet_streaming::PayloadCodec::shuffleLz);
+
+    const std::vector<double> samples(1024, 1.5);
+    const auto domainPacket = DataPacket(createLinearDomainDescriptor(), samples.size(), 0);
+    bytesSent = 0;
+    manager->sendPacketToSubscribers(domainSignalId, domainPacket, sendCb);
+    manager->sendPacketToSubscribers(valueSignalId, createPacket(createValueDescriptor(), samples, domainPacket), sendCb);
+
+    const auto packets = receivePackets();
+    ASSERT_EQ(packets.size(), 1u);
+    ASSERT_EQ(getValues<double>(packets[0].asPtr<IDataPacket>()), samples);
+    ASSERT_LT(bytesSent, samples.size() * sizeof(double));
+}
+
+TEST_F(ThrottledClientTest, PayloadCodecNotRequested)
+{
+    manager->setSignalPayloadCodec(valueSignalId, packet_streaming::PayloadCodec::shuffleLz);
+
+    const std::vector<double> samples(1024, 1.5);
+    const auto domainPacket = DataPacket(createLinearDomainDescriptor(), samples.size(), 0);
+    bytesSent = 0;
+    manager->sendPacketToSubscribers(domainSignalId, domainPacket, sendCb);
+    manager->sendPacketToSubscribers(valueSignalId, createPacket(createValueDescriptor(), samples, domainPacket), sendCb);
+
+    const auto packets = receivePackets();
+    ASSERT_EQ(packets.size(), 1u);
+    ASSERT_GE(bytesSent, samples.size() * sizeof(double));
+}
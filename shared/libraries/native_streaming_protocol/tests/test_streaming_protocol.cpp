@@ -191,10 +191,11 @@ public:
     }
 
     std::shared_ptr<NativeStreamingClientHandler> createClient(StreamingProtocolAttributes& client,
-                                                               OnSignalAvailableCallback signalAvailableHandler)
+                                                               OnSignalAvailableCallback signalAvailableHandler,
+                                                               const PropertyObjectPtr& transportLayerConfig = ClientAttributesBase::createTransportLayerConfig())
     {
         auto clientHandler = std::make_shared<NativeStreamingClientHandler>(
-            client.clientContext, ClientAttributesBase::createTransportLayerConfig(), ClientAttributesBase::createAuthenticationConfig());
+            client.clientContext, transportLayerConfig, ClientAttributesBase::createAuthenticationConfig());
 
         clientHandler->setStreamingHandlers(signalAvailableHandler,
                                             client.signalUnavailableHandler,
@@ -225,6 +226,72 @@ public:
         serverHandler.reset();
     }
 
+    void sendDataPacketsSharedMemory(bool writablePackets)
+    {
+        if (!SharedMemoryRing::IsSupported())
+            GTEST_SKIP() << "Shared memory transport is not supported on this platform";
+
+        const auto valueDescriptor = DataDescriptorBuilder().setSampleType(SampleType::Int64).build();
+        auto serverEventPacket = DataDescriptorChangedEventPacket(valueDescriptor, nullptr);
+        auto serverSignal = SignalWithDescriptor(serverContext, valueDescriptor, nullptr, "signal");
+
+        startServer(List<ISignal>(serverSignal), serverEventPacket);
+        serverHandler->setSharedMemoryRingSize(4096);
+
+        for (auto& client : clients)
+        {
+            auto transportLayerConfig = ClientAttributesBase::createTransportLayerConfig();
+            transportLayerConfig.addProperty(BoolProperty("SharedMemory", True));
+            transportLayerConfig.addProperty(BoolProperty("SharedMemoryWritablePackets", writablePackets));
+
+            client.clientHandler = createClient(client, client.signalAvailableHandler, transportLayerConfig);
+            ASSERT_TRUE(client.clientHandler->connect(SERVER_ADDRESS, NATIVE_STREAMING_LISTENING_PORT));
+            client.clientHandler->sendStreamingRequest();
+            ASSERT_EQ(client.streamingInitFuture.wait_for(timeout), std::future_status::ready);
+            ASSERT_TRUE(client.clientHandler->isSharedMemoryActive());
+
+            ASSERT_EQ(client.signalAvailableFuture.wait_for(timeout), std::future_status::ready);
+            auto clientSignalStringId = std::get<0>(client.signalAvailableFuture.get());
+
+            client.clientHandler->subscribeSignal(clientSignalStringId);
+            ASSERT_EQ(client.subscribedAckFuture.wait_for(timeout), std::future_status::ready);
+
+            // wait for event packet, which is always sent inline
+            ASSERT_EQ(client.packetReceivedFuture.wait_for(timeout), std::future_status::ready);
+            client.packetReceivedPromise = std::promise< std::tuple<StringPtr, PacketPtr> >();
+            client.packetReceivedFuture = client.packetReceivedPromise.get_future();
+        }
+
+        ASSERT_EQ(signalSubscribedFuture.wait_for(timeout), std::future_status::ready);
+
+        // more payload than the ring holds at once, so blocks released by the clients get reused
+        constexpr size_t packetCount = 200;
+        constexpr size_t sampleCount = 8;
+        for (size_t i = 0; i < packetCount; ++i)
+        {
+            auto serverDataPacket = DataPacket(valueDescriptor, sampleCount);
+            auto data = static_cast<int64_t*>(serverDataPacket.getRawData());
+            for (size_t j = 0; j < sampleCount; ++j)
+                data[j] = static_cast<int64_t>(i * sampleCount + j);
+
+            serverHandler->sendPacket(serverSignal, serverDataPacket);
+            for (auto& client : clients)
+            {
+                ASSERT_EQ(client.packetReceivedFuture.wait_for(timeout), std::future_status::ready);
+                auto [signalId, packet] = client.packetReceivedFuture.get();
+                ASSERT_EQ(signalId, serverSignal.getGlobalId());
+                ASSERT_EQ(packet, serverDataPacket);
+
+                // packets built on top of the read-only segment must not be written to
+                if (writablePackets)
+                    static_cast<int64_t*>(packet.asPtr<IDataPacket>().getRawData())[0] = -1;
+
+                client.packetReceivedPromise = std::promise< std::tuple<StringPtr, PacketPtr> >();
+                client.packetReceivedFuture = client.packetReceivedPromise.get_future();
+            }
+        }
+    }
+
 protected:
     std::vector<StreamingProtocolAttributes> clients;
 
@@ -742,6 +809,16 @@ TEST_P(StreamingProtocolTest, SendDataPacket)
     }
 }
 
+TEST_P(StreamingProtocolTest, SendDataPacketsSharedMemory)
+{
+    sendDataPacketsSharedMemory(false);
+}
+
+TEST_P(StreamingProtocolTest, SendDataPacketsSharedMemoryWritablePackets)
+{
+    sendDataPacketsSharedMemory(true);
+}
+
 TEST_P(StreamingProtocolTest, AddNotPublicSignal)
 {
     startServer(List<ISignal>());
@@ -32,6 +32,12 @@ enum PacketType: uint8_t { event = 0, data, release, alreadySent };
 
 #define PACKET_FLAG_OFFSET_TYPE_SHIFT      1
 
+#define PACKET_FLAG_CODEC_MASK             (0x8 | 0x10 | 0x20)
+#define PACKET_FLAG_CODEC_SHIFT            3
+
+// domain packet referenced by the data packets of the signal, not a packet of the signal itself
+#define PACKET_FLAG_DOMAIN_REFERENCE       0x40
+
 struct GenericPacketHeader
 {
     uint8_t size;
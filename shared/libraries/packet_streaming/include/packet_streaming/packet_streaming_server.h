@@ -17,6 +17,7 @@
 #pragma once
 
 #include <packet_streaming/packet_streaming.h>
+#include <packet_streaming/payload_codec.h>
 #include <opendaq/data_packet_ptr.h>
 #include <opendaq/event_packet_ptr.h>
 #include <queue>
@@ -47,12 +48,27 @@ public:
     void checkAndSendReleasePacket(bool force);
     void addAlreadySentPacket(uint32_t signalId, Int packetId, Int domainPacketId, bool markForRelease);
 
+    /// Sets the codec used for data packet payloads of signals without a signal specific codec.
+    void setPayloadCodec(PayloadCodec codec);
+    void setSignalPayloadCodec(uint32_t signalId, PayloadCodec codec);
+
+    /// Limits the codecs to the set the client can decode, as returned by `getPayloadCodecBit`.
+    void setSupportedPayloadCodecs(uint32_t codecs);
+
+    /// Adds a domain packet which is only referenced by data packets of the signal that follow. The client creates it
+    /// with the domain descriptor of the signal and does not forward it as a packet of the signal.
+    void addDomainReferencePacket(const uint32_t signalId, const DataPacketPtr& domainPacket);
+
 private:
     SerializerPtr jsonSerializer;
     std::queue<PacketBufferPtr> queue;
     std::unordered_map<uint32_t, DataDescriptorPtr> dataDescriptors;
     PacketCollectionPtr packetCollection;
     size_t releaseThreshold;
+    PayloadCodec payloadCodec;
+    std::unordered_map<uint32_t, PayloadCodec> signalPayloadCodecs;
+    uint32_t supportedPayloadCodecs;
+    PayloadEncoder payloadEncoder;
 
     void addEventPacket(const uint32_t signalId, const EventPacketPtr& packet);
     template <bool CheckRefCount>
@@ -60,9 +76,10 @@ private:
     bool shouldSendPacket(const DataPacketPtr& packet, Int packetId, bool markForRelease) const;
     static void setOffset(const DataPacketPtr& packet, DataPacketHeader* packetHeader);
     static Int getDomainPacketId(const DataPacketPtr& packet);
+    PayloadCodec getPayloadCodec(uint32_t signalId) const;
 
     template <class DataPacket>
-    void addDataPacket(const uint32_t signalId, DataPacket&& packet);
+    void addDataPacket(const uint32_t signalId, DataPacket&& packet, bool domainReference = false);
 };
 
 }
@@ -0,0 +1,92 @@
+/*
+ * Copyright 2022-2024 openDAQ d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <opendaq/data_descriptor_ptr.h>
+#include <opendaq/sample_type.h>
+#include <cstdint>
+#include <vector>
+
+namespace daq::packet_streaming
+{
+
+/// Lossless codecs applied to data packet payloads. The codec of a packet is stored in the
+/// codec bits of the packet header flags; encoded payloads start with the decoded size as uint32.
+enum class PayloadCodec : uint8_t
+{
+    none = 0,
+    deltaZigZag = 1,    // integer samples: delta to previous sample, zigzag, bit-packed in blocks
+    xorFloat = 2,       // floating point samples: XOR with previous sample, zero bits compacted
+    shuffleLz = 3,      // any samples: bytes grouped by significance, then LZ77 compressed
+    automatic = 7       // server configuration only; selects a codec from the sample type
+};
+
+/// Gets the bit of the codec in a set of codecs, as exchanged when a client negotiates payload codecs.
+constexpr uint32_t getPayloadCodecBit(PayloadCodec codec)
+{
+    return 1u << static_cast<uint8_t>(codec);
+}
+
+/// The set of codecs that can be decoded by this version.
+constexpr uint32_t SupportedPayloadCodecs = getPayloadCodecBit(PayloadCodec::deltaZigZag) |
+                                            getPayloadCodecBit(PayloadCodec::xorFloat) |
+                                            getPayloadCodecBit(PayloadCodec::shuffleLz);
+
+/// Gets the sample type of the raw (pre-scaling) payload described by the descriptor.
+SampleType getPayloadSampleType(const DataDescriptorPtr& descriptor);
+
+/// Resolves `PayloadCodec::automatic` to the codec suited to the sample type.
+PayloadCodec selectPayloadCodec(PayloadCodec codec, SampleType sampleType);
+
+/// Encodes payloads, keeping the scratch memory of the codecs between payloads.
+class PayloadEncoder
+{
+public:
+    PayloadEncoder();
+
+    /// Encodes the payload and returns the codec used. Returns `PayloadCodec::none` if the codec does not
+    /// support the sample type, is not in the set of allowed codecs, or the encoded payload would not be
+    /// smaller than the original one.
+    PayloadCodec encode(PayloadCodec codec,
+                        SampleType sampleType,
+                        const void* data,
+                        size_t size,
+                        std::vector<uint8_t>& encoded,
+                        uint32_t allowedCodecs = SupportedPayloadCodecs);
+
+private:
+    bool encodeWithCodec(PayloadCodec codec, SampleType sampleType, const void* data, size_t size, std::vector<uint8_t>& encoded);
+    void encodeLz(const uint8_t* data, size_t size, std::vector<uint8_t>& encoded);
+
+    // entries below lzTableBase are stale, so the table is not cleared for every payload
+    std::vector<uint32_t> lzTable;
+    uint32_t lzTableBase;
+    std::vector<uint8_t> shuffled;
+};
+
+/// Encodes the payload with a temporary encoder; see `PayloadEncoder::encode`.
+PayloadCodec encodePayload(PayloadCodec codec, SampleType sampleType, const void* data, size_t size, std::vector<uint8_t>& encoded);
+
+/// Gets the size of the payload after decoding.
+/// @throw PacketStreamingException if the encoded payload is malformed.
+size_t getDecodedPayloadSize(const void* encoded, size_t encodedSize);
+
+/// Decodes the payload into memory of exactly the decoded payload size.
+/// @throw PacketStreamingException if the encoded payload is malformed or does not match the output size.
+void decodePayload(PayloadCodec codec, SampleType sampleType, const void* encoded, size_t encodedSize, void* decoded, size_t decodedSize);
+
+}
@@ -1,4 +1,5 @@
 #include <packet_streaming/packet_streaming_client.h>
+#include <packet_streaming/payload_codec.h>
 #include <opendaq/event_packet_ids.h>
 #include <opendaq/event_packet_params.h>
 #include <opendaq/packet_factory.h>
@@ -122,9 +123,11 @@ DataPacketPtr PacketStreamingClient::addDataPacketBuffer(const PacketBufferPtr&
     }
 
     auto signalId = dataPacketHeader->genericHeader.signalId;
+    const bool domainReference = dataPacketHeader->genericHeader.flags & PACKET_FLAG_DOMAIN_REFERENCE;
 
-    const auto sigIt = dataDescriptors.find(signalId);
-    if (sigIt == dataDescriptors.end())
+    const auto& descriptors = domainReference ? domainDescriptors : dataDescriptors;
+    const auto sigIt = descriptors.find(signalId);
+    if (sigIt == descriptors.end())
         throw PacketStreamingException("Descriptor not registered");
 
     const auto valueDescriptor = sigIt->second;
@@ -143,11 +146,24 @@ DataPacketPtr PacketStreamingClient::addDataPacketBuffer(const PacketBufferPtr&
 
     DataPacketPtr packet;
 
+    const auto codec = static_cast<PayloadCodec>((dataPacketHeader->genericHeader.flags & PACKET_FLAG_CODEC_MASK) >> PACKET_FLAG_CODEC_SHIFT);
+
     if (packetBuffer->payload == nullptr)
     {
         packet = DataPacketWithDomain(domPacket, valueDescriptor, dataPacketHeader->sampleCount, offset);
         assert(packet.getRawData() == nullptr);
     }
+    else if (codec != PayloadCodec::none)
+    {
+        // decoded straight into the packet memory; the received buffer is not referenced by the packet
+        packet = DataPacketWithDomain(domPacket, valueDescriptor, dataPacketHeader->sampleCount, offset);
+        decodePayload(codec,
+                      getPayloadSampleType(valueDescriptor),
+                      packetBuffer->payload,
+                      dataPacketHeader->genericHeader.payloadSize,
+                      packet.getRawData(),
+                      packet.getRawDataSize());
+    }
     else
     {
         packet = DataPacketWithExternalMemory(domPacket,
@@ -159,7 +175,8 @@ DataPacketPtr PacketStreamingClient::addDataPacketBuffer(const PacketBufferPtr&
                                               dataPacketHeader->genericHeader.payloadSize);
     }
 
-    queue.push({signalId, packet});
+    if (!domainReference)
+        queue.push({signalId, packet});
 
     // check if this is domain packet that other value packets have been waiting for
     const auto packetsWaitingIt = packetBuffersWaitingForDomainPackets.find(dataPacketHeader->packetId);
@@ -10,9 +10,32 @@ PacketStreamingServer::PacketStreamingServer(size_t releaseThreshold)
     : jsonSerializer(JsonSerializer())
     , packetCollection(std::make_shared<PacketCollection>())
     , releaseThreshold(releaseThreshold)
+    , payloadCodec(PayloadCodec::none)
+    , supportedPayloadCodecs(SupportedPayloadCodecs)
 {
 }
 
+void PacketStreamingServer::setPayloadCodec(PayloadCodec codec)
+{
+    payloadCodec = codec;
+}
+
+void PacketStreamingServer::setSignalPayloadCodec(uint32_t signalId, PayloadCodec codec)
+{
+    signalPayloadCodecs.insert_or_assign(signalId, codec);
+}
+
+void PacketStreamingServer::setSupportedPayloadCodecs(uint32_t codecs)
+{
+    supportedPayloadCodecs = codecs;
+}
+
+PayloadCodec PacketStreamingServer::getPayloadCodec(uint32_t signalId) const
+{
+    const auto it = signalPayloadCodecs.find(signalId);
+    return it != signalPayloadCodecs.end() ? it->second : payloadCodec;
+}
+
 void PacketStreamingServer::addDaqPacket(const uint32_t signalId, const PacketPtr& packet)
 {
     switch (packet.getType())
@@ -50,6 +73,12 @@ void PacketStreamingServer::addDaqPacket(const uint32_t signalId, PacketPtr&& pa
     checkAndSendReleasePacket(false);
 }
 
+void PacketStreamingServer::addDomainReferencePacket(const uint32_t signalId, const DataPacketPtr& domainPacket)
+{
+    addDataPacket(signalId, domainPacket, true);
+    checkAndSendReleasePacket(false);
+}
+
 PacketBufferPtr PacketStreamingServer::getNextPacketBuffer()
 {
     if (!queue.empty())
@@ -169,7 +198,7 @@ Int PacketStreamingServer::getDomainPacketId(const DataPacketPtr& packet)
 }
 
 template <class DataPacket>
-void PacketStreamingServer::addDataPacket(const uint32_t signalId, DataPacket&& packet)
+void PacketStreamingServer::addDataPacket(const uint32_t signalId, DataPacket&& packet, bool domainReference)
 {
     if (dataDescriptors.find(signalId) == dataDescriptors.end())
         throw PacketStreamingException("No signal descriptor event received");
@@ -183,6 +212,10 @@ void PacketStreamingServer::addDataPacket(const uint32_t signalId, DataPacket&&
     auto doSendPacket = shouldSendPacket(packet, packetId, markPacketForRelease);
     if (!doSendPacket)
     {
+        // the client already holds the referenced domain packet
+        if (domainReference)
+            return;
+
         addAlreadySentPacket(signalId, packetId, domainPacketId, markPacketForRelease);
         return;
     }
@@ -192,6 +225,8 @@ void PacketStreamingServer::addDataPacket(const uint32_t signalId, DataPacket&&
     packetHeader->genericHeader.type = PacketType::data;
     packetHeader->genericHeader.version = 0;
     packetHeader->genericHeader.flags = markPacketForRelease ? PACKET_FLAG_CAN_RELEASE : 0;
+    if (domainReference)
+        packetHeader->genericHeader.flags |= PACKET_FLAG_DOMAIN_REFERENCE;
     packetHeader->genericHeader.signalId = signalId;
     packetHeader->packetId = packetId;
     packetHeader->domainPacketId = domainPacketId;
@@ -203,15 +238,43 @@ void PacketStreamingServer::addDataPacket(const uint32_t signalId, DataPacket&&
     const auto packetDataSize = packetDataPtr != nullptr ? packet.getRawDataSize() : 0;
     packetHeader->genericHeader.payloadSize = static_cast<uint32_t>(packetDataSize);
 
-    const auto packetBuffer = std::make_shared<PacketBuffer>(
-        reinterpret_cast<GenericPacketHeader*>(packetHeader),
-        packetDataPtr,
-        [packetHeader, packet = packet]() mutable
+    PacketBufferPtr packetBuffer;
+
+    const auto codec = getPayloadCodec(signalId);
+    if (codec != PayloadCodec::none && packetDataSize > 0)
+    {
+        auto encodedPayload = std::make_shared<std::vector<uint8_t>>();
+        const auto sampleType = getPayloadSampleType(domainReference ? packet.getDataDescriptor() : dataDescriptors.at(signalId));
+        const auto usedCodec = payloadEncoder.encode(codec, sampleType, packetDataPtr, packetDataSize, *encodedPayload, supportedPayloadCodecs);
+        if (usedCodec != PayloadCodec::none)
         {
-            std::free(packetHeader);
-            packet.release();
+            packetHeader->genericHeader.flags |= static_cast<uint8_t>(usedCodec) << PACKET_FLAG_CODEC_SHIFT;
+            packetHeader->genericHeader.payloadSize = static_cast<uint32_t>(encodedPayload->size());
+
+            packetBuffer = std::make_shared<PacketBuffer>(
+                reinterpret_cast<GenericPacketHeader*>(packetHeader),
+                encodedPayload->data(),
+                [packetHeader, encodedPayload, packet = packet]() mutable
+                {
+                    std::free(packetHeader);
+                    packet.release();
+                }
+            );
         }
-    );
+    }
+
+    if (!packetBuffer)
+    {
+        packetBuffer = std::make_shared<PacketBuffer>(
+            reinterpret_cast<GenericPacketHeader*>(packetHeader),
+            packetDataPtr,
+            [packetHeader, packet = packet]() mutable
+            {
+                std::free(packetHeader);
+                packet.release();
+            }
+        );
+    }
 
     if constexpr (isPacketRValue)
         packet.release();
@@ -0,0 +1,690 @@
+#include <packet_streaming/payload_codec.h>
+#include <packet_streaming/packet_streaming.h>
+#include <opendaq/scaling_ptr.h>
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+namespace daq::packet_streaming
+{
+
+namespace
+{
+
+constexpr size_t DeltaBlockSize = 128;
+constexpr size_t LzMinMatch = 4;
+constexpr size_t LzMaxOffset = 65535;
+constexpr size_t LzHashBits = 14;
+
+uint64_t bitMask(unsigned bits)
+{
+    return bits >= 64 ? ~uint64_t(0) : (uint64_t(1) << bits) - 1;
+}
+
+template <typename U>
+unsigned countLeadingZeros(U value)
+{
+    constexpr unsigned width = sizeof(U) * 8;
+    unsigned count = 0;
+    for (unsigned shift = width / 2; shift > 0; shift /= 2)
+    {
+        if ((value >> (width - shift)) == 0)
+        {
+            count += shift;
+            value = static_cast<U>(value << shift);
+        }
+    }
+    return value == 0 ? width : count;
+}
+
+template <typename U>
+unsigned countTrailingZeros(U value)
+{
+    if (value == 0)
+        return sizeof(U) * 8;
+
+    unsigned count = 0;
+    while ((value & 1) == 0)
+    {
+        value >>= 1;
+        count++;
+    }
+    return count;
+}
+
+class BitWriter
+{
+public:
+    explicit BitWriter(std::vector<uint8_t>& output)
+        : output(output)
+    {
+    }
+
+    void write(uint64_t value, unsigned bits)
+    {
+        if (bits > 32)
+        {
+            write(value & 0xFFFFFFFF, 32);
+            write(value >> 32, bits - 32);
+            return;
+        }
+
+        buffer |= (value & bitMask(bits)) << count;
+        count += bits;
+        while (count >= 8)
+        {
+            output.push_back(static_cast<uint8_t>(buffer));
+            buffer >>= 8;
+            count -= 8;
+        }
+    }
+
+    void flush()
+    {
+        if (count > 0)
+            output.push_back(static_cast<uint8_t>(buffer));
+        buffer = 0;
+        count = 0;
+    }
+
+private:
+    std::vector<uint8_t>& output;
+    uint64_t buffer = 0;
+    unsigned count = 0;
+};
+
+class BitReader
+{
+public:
+    BitReader(const uint8_t* data, size_t size)
+        : data(data)
+        , end(data + size)
+    {
+    }
+
+    uint64_t read(unsigned bits)
+    {
+        if (bits > 32)
+        {
+            const uint64_t low = read(32);
+            return low | (read(bits - 32) << 32);
+        }
+
+        while (count < bits)
+        {
+            if (data == end)
+                throw PacketStreamingException("Encoded payload is truncated");
+            buffer |= uint64_t(*data++) << count;
+            count += 8;
+        }
+
+        const uint64_t value = buffer & bitMask(bits);
+        buffer >>= bits;
+        count -= bits;
+        return value;
+    }
+
+private:
+    const uint8_t* data;
+    const uint8_t* end;
+    uint64_t buffer = 0;
+    unsigned count = 0;
+};
+
+template <typename U>
+void encodeDeltaZigZag(const U* values, size_t count, std::vector<uint8_t>& encoded)
+{
+    using S = std::make_signed_t<U>;
+    constexpr unsigned width = sizeof(U) * 8;
+
+    BitWriter writer(encoded);
+    U previous = 0;
+    U zigZag[DeltaBlockSize];
+
+    for (size_t blockStart = 0; blockStart < count; blockStart += DeltaBlockSize)
+    {
+        const size_t blockCount = std::min(DeltaBlockSize, count - blockStart);
+
+        U combined = 0;
+        for (size_t i = 0; i < blockCount; ++i)
+        {
+            const U value = values[blockStart + i];
+            const auto delta = static_cast<S>(static_cast<U>(value - previous));
+            zigZag[i] = static_cast<U>(static_cast<U>(delta) << 1) ^ static_cast<U>(delta >> (width - 1));
+            combined |= zigZag[i];
+            previous = value;
+        }
+
+        const unsigned bits = width - countLeadingZeros(combined);
+        writer.write(bits, 7);
+        if (bits > 0)
+        {
+            for (size_t i = 0; i < blockCount; ++i)
+                writer.write(zigZag[i], bits);
+        }
+    }
+
+    writer.flush();
+}
+
+template <typename U>
+void decodeDeltaZigZag(const uint8_t* data, size_t size, U* values, size_t count)
+{
+    using S = std::make_signed_t<U>;
+    constexpr unsigned width = sizeof(U) * 8;
+
+    BitReader reader(data, size);
+    U previous = 0;
+
+    for (size_t blockStart = 0; blockStart < count; blockStart += DeltaBlockSize)
+    {
+        const size_t blockCount = std::min(DeltaBlockSize, count - blockStart);
+
+        const auto bits = static_cast<unsigned>(reader.read(7));
+        if (bits > width)
+            throw PacketStreamingException("Invalid bit width in encoded payload");
+
+        for (size_t i = 0; i < blockCount; ++i)
+        {
+            const U zigZag = bits > 0 ? static_cast<U>(reader.read(bits)) : 0;
+            const U delta = static_cast<U>(zigZag >> 1) ^ static_cast<U>(-static_cast<S>(zigZag & 1));
+            previous = static_cast<U>(previous + delta);
+            values[blockStart + i] = previous;
+        }
+    }
+}
+
+template <typename U>
+void encodeXorFloat(const U* values, size_t count, std::vector<uint8_t>& encoded)
+{
+    constexpr unsigned width = sizeof(U) * 8;
+
+    BitWriter writer(encoded);
+    U previous = 0;
+    unsigned windowLeading = width;
+    unsigned windowTrailing = 0;
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        const U value = values[i];
+        const U xored = value ^ previous;
+        previous = value;
+
+        if (xored == 0)
+        {
+            writer.write(0, 1);
+            continue;
+        }
+
+        const unsigned leading = std::min(countLeadingZeros(xored), 31u);
+        const unsigned trailing = countTrailingZeros(xored);
+
+        if (windowLeading < width && leading >= windowLeading && trailing >= windowTrailing)
+        {
+            // meaningful bits fit into the previous window
+            writer.write(0b01, 2);
+            writer.write(xored >> windowTrailing, width - windowLeading - windowTrailing);
+        }
+        else
+        {
+            const unsigned meaningful = width - leading - trailing;
+            writer.write(0b11, 2);
+            writer.write(leading, 5);
+            writer.write(meaningful - 1, 6);
+            writer.write(xored >> trailing, meaningful);
+            windowLeading = leading;
+            windowTrailing = trailing;
+        }
+    }
+
+    writer.flush();
+}
+
+template <typename U>
+void decodeXorFloat(const uint8_t* data, size_t size, U* values, size_t count)
+{
+    constexpr unsigned width = sizeof(U) * 8;
+
+    BitReader reader(data, size);
+    U previous = 0;
+    unsigned windowLeading = width;
+    unsigned windowTrailing = 0;
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (reader.read(1) != 0)
+        {
+            if (reader.read(1) != 0)
+            {
+                windowLeading = static_cast<unsigned>(reader.read(5));
+                const auto meaningful = static_cast<unsigned>(reader.read(6)) + 1;
+                if (windowLeading + meaningful > width)
+                    throw PacketStreamingException("Invalid bit window in encoded payload");
+                windowTrailing = width - windowLeading - meaningful;
+            }
+            else if (windowLeading >= width)
+            {
+                throw PacketStreamingException("Missing bit window in encoded payload");
+            }
+
+            const auto meaningfulBits = static_cast<U>(reader.read(width - windowLeading - windowTrailing));
+            previous ^= static_cast<U>(meaningfulBits << windowTrailing);
+        }
+
+        values[i] = previous;
+    }
+}
+
+void shuffleBytes(const uint8_t* input, uint8_t* output, size_t size, size_t elementSize)
+{
+    const size_t count = size / elementSize;
+    for (size_t byte = 0; byte < elementSize; ++byte)
+        for (size_t i = 0; i < count; ++i)
+            output[byte * count + i] = input[i * elementSize + byte];
+
+    const size_t tail = count * elementSize;
+    std::memcpy(output + tail, input + tail, size - tail);
+}
+
+void unshuffleBytes(const uint8_t* input, uint8_t* output, size_t size, size_t elementSize)
+{
+    const size_t count = size / elementSize;
+    for (size_t byte = 0; byte < elementSize; ++byte)
+        for (size_t i = 0; i < count; ++i)
+            output[i * elementSize + byte] = input[byte * count + i];
+
+    const size_t tail = count * elementSize;
+    std::memcpy(output + tail, input + tail, size - tail);
+}
+
+uint32_t read32(const uint8_t* data)
+{
+    uint32_t value;
+    std::memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+void writeLength(std::vector<uint8_t>& encoded, size_t length)
+{
+    while (length >= 255)
+    {
+        encoded.push_back(255);
+        length -= 255;
+    }
+    encoded.push_back(static_cast<uint8_t>(length));
+}
+
+size_t readLength(const uint8_t*& data, const uint8_t* end, size_t length)
+{
+    if (length != 15)
+        return length;
+
+    uint8_t byte;
+    do
+    {
+        if (data == end)
+            throw PacketStreamingException("Encoded payload is truncated");
+        byte = *data++;
+        length += byte;
+    }
+    while (byte == 255);
+
+    return length;
+}
+
+// Sequences of a token (literal count, match length), literals, and a 16-bit match offset;
+// the last sequence has literals only.
+void emitLzSequence(std::vector<uint8_t>& encoded, const uint8_t* literals, size_t literalCount, size_t offset, size_t matchLength)
+{
+    const size_t matchCode = matchLength > 0 ? matchLength - LzMinMatch : 0;
+    encoded.push_back(static_cast<uint8_t>((std::min<size_t>(literalCount, 15) << 4) | std::min<size_t>(matchCode, 15)));
+    if (literalCount >= 15)
+        writeLength(encoded, literalCount - 15);
+
+    encoded.insert(encoded.end(), literals, literals + literalCount);
+    if (matchLength == 0)
+        return;
+
+    encoded.push_back(static_cast<uint8_t>(offset));
+    encoded.push_back(static_cast<uint8_t>(offset >> 8));
+    if (matchCode >= 15)
+        writeLength(encoded, matchCode - 15);
+}
+
+void decodeLz(const uint8_t* data, size_t size, uint8_t* output, size_t outputSize)
+{
+    const uint8_t* end = data + size;
+    size_t written = 0;
+
+    while (data < end)
+    {
+        const uint8_t token = *data++;
+
+        const size_t literalCount = readLength(data, end, token >> 4);
+        if (literalCount > static_cast<size_t>(end - data) || literalCount > outputSize - written)
+            throw PacketStreamingException("Encoded payload literals exceed bounds");
+        std::memcpy(output + written, data, literalCount);
+        data += literalCount;
+        written += literalCount;
+
+        if (data == end)
+            break;
+
+        if (end - data < 2)
+            throw PacketStreamingException("Encoded payload is truncated");
+        const size_t offset = data[0] | (size_t(data[1]) << 8);
+        data += 2;
+
+        const size_t matchLength = readLength(data, end, token & 0x0F) + LzMinMatch;
+        if (offset == 0 || offset > written || matchLength > outputSize - written)
+            throw PacketStreamingException("Encoded payload match exceeds bounds");
+
+        // matches may overlap their own output
+        for (size_t i = 0; i < matchLength; ++i, ++written)
+            output[written] = output[written - offset];
+    }
+
+    if (written != outputSize)
+        throw PacketStreamingException("Encoded payload size mismatch");
+}
+
+size_t getIntegerWidth(SampleType sampleType)
+{
+    switch (sampleType)
+    {
+        case SampleType::Int8:
+        case SampleType::UInt8:
+            return 1;
+        case SampleType::Int16:
+        case SampleType::UInt16:
+            return 2;
+        case SampleType::Int32:
+        case SampleType::UInt32:
+            return 4;
+        case SampleType::Int64:
+        case SampleType::UInt64:
+        case SampleType::RangeInt64:
+            return 8;
+        default:
+            return 0;
+    }
+}
+
+size_t getFloatWidth(SampleType sampleType)
+{
+    switch (sampleType)
+    {
+        case SampleType::Float32:
+        case SampleType::ComplexFloat32:
+            return 4;
+        case SampleType::Float64:
+        case SampleType::ComplexFloat64:
+            return 8;
+        default:
+            return 0;
+    }
+}
+
+size_t getShuffleElementSize(SampleType sampleType)
+{
+    if (const auto width = getIntegerWidth(sampleType))
+        return width;
+    if (const auto width = getFloatWidth(sampleType))
+        return width;
+    return 1;
+}
+
+template <template <typename> class Coder, typename... Args>
+bool dispatchWidth(size_t width, Args&&... args)
+{
+    switch (width)
+    {
+        case 1:
+            Coder<uint8_t>::run(std::forward<Args>(args)...);
+            return true;
+        case 2:
+            Coder<uint16_t>::run(std::forward<Args>(args)...);
+            return true;
+        case 4:
+            Coder<uint32_t>::run(std::forward<Args>(args)...);
+            return true;
+        case 8:
+            Coder<uint64_t>::run(std::forward<Args>(args)...);
+            return true;
+        default:
+            return false;
+    }
+}
+
+template <typename U>
+struct DeltaEncoder
+{
+    static void run(const void* data, size_t size, std::vector<uint8_t>& encoded)
+    {
+        encodeDeltaZigZag(static_cast<const U*>(data), size / sizeof(U), encoded);
+    }
+};
+
+template <typename U>
+struct DeltaDecoder
+{
+    static void run(const uint8_t* data, size_t size, void* decoded, size_t decodedSize)
+    {
+        decodeDeltaZigZag(data, size, static_cast<U*>(decoded), decodedSize / sizeof(U));
+    }
+};
+
+template <typename U>
+struct XorEncoder
+{
+    static void run(const void* data, size_t size, std::vector<uint8_t>& encoded)
+    {
+        encodeXorFloat(static_cast<const U*>(data), size / sizeof(U), encoded);
+    }
+};
+
+template <typename U>
+struct XorDecoder
+{
+    static void run(const uint8_t* data, size_t size, void* decoded, size_t decodedSize)
+    {
+        decodeXorFloat(data, size, static_cast<U*>(decoded), decodedSize / sizeof(U));
+    }
+};
+
+}
+
+SampleType getPayloadSampleType(const DataDescriptorPtr& descriptor)
+{
+    const auto postScaling = descriptor.getPostScaling();
+    if (postScaling.assigned())
+        return postScaling.getInputSampleType();
+    return descriptor.getSampleType();
+}
+
+PayloadCodec selectPayloadCodec(PayloadCodec codec, SampleType sampleType)
+{
+    if (codec != PayloadCodec::automatic)
+        return codec;
+
+    if (getIntegerWidth(sampleType) > 0)
+        return PayloadCodec::deltaZigZag;
+    if (getFloatWidth(sampleType) > 0)
+        return PayloadCodec::xorFloat;
+    return PayloadCodec::shuffleLz;
+}
+
+void PayloadEncoder::encodeLz(const uint8_t* data, size_t size, std::vector<uint8_t>& encoded)
+{
+    // positions are stored offset by the table base; the table is only cleared when the base would overflow
+    if (lzTable.empty() || size >= std::numeric_limits<uint32_t>::max() - lzTableBase)
+    {
+        lzTable.assign(size_t(1) << LzHashBits, 0);
+        lzTableBase = 1;
+    }
+
+    size_t anchor = 0;
+    size_t position = 0;
+    while (size >= LzMinMatch && position <= size - LzMinMatch)
+    {
+        const uint32_t sequence = read32(data + position);
+        const uint32_t hash = (sequence * 2654435761u) >> (32 - LzHashBits);
+        const uint32_t entry = lzTable[hash];
+        lzTable[hash] = lzTableBase + static_cast<uint32_t>(position);
+
+        if (entry < lzTableBase)
+        {
+            position++;
+            continue;
+        }
+
+        const size_t candidate = entry - lzTableBase;
+        if (position - candidate > LzMaxOffset || read32(data + candidate) != sequence)
+        {
+            position++;
+            continue;
+        }
+
+        size_t matchLength = LzMinMatch;
+        while (position + matchLength < size && data[candidate + matchLength] == data[position + matchLength])
+            matchLength++;
+
+        emitLzSequence(encoded, data + anchor, position - anchor, position - candidate, matchLength);
+        position += matchLength;
+        anchor = position;
+    }
+
+    emitLzSequence(encoded, data + anchor, size - anchor, 0, 0);
+    lzTableBase += static_cast<uint32_t>(size) + 1;
+}
+
+PayloadEncoder::PayloadEncoder()
+    : lzTableBase(1)
+{
+}
+
+bool PayloadEncoder::encodeWithCodec(PayloadCodec codec, SampleType sampleType, const void* data, size_t size, std::vector<uint8_t>& encoded)
+{
+    encoded.clear();
+    encoded.reserve(size);
+
+    const auto decodedSize = static_cast<uint32_t>(size);
+    encoded.resize(sizeof(decodedSize));
+    std::memcpy(encoded.data(), &decodedSize, sizeof(decodedSize));
+
+    switch (codec)
+    {
+        case PayloadCodec::deltaZigZag:
+        {
+            const auto width = getIntegerWidth(sampleType);
+            if (width == 0 || size % width != 0)
+                return false;
+            dispatchWidth<DeltaEncoder>(width, data, size, encoded);
+            break;
+        }
+        case PayloadCodec::xorFloat:
+        {
+            const auto width = getFloatWidth(sampleType);
+            if (width == 0 || size % width != 0)
+                return false;
+            dispatchWidth<XorEncoder>(width, data, size, encoded);
+            break;
+        }
+        case PayloadCodec::shuffleLz:
+        {
+            const auto elementSize = getShuffleElementSize(sampleType);
+            if (elementSize > 1)
+            {
+                shuffled.resize(size);
+                shuffleBytes(static_cast<const uint8_t*>(data), shuffled.data(), size, elementSize);
+                encodeLz(shuffled.data(), size, encoded);
+            }
+            else
+            {
+                encodeLz(static_cast<const uint8_t*>(data), size, encoded);
+            }
+            break;
+        }
+        default:
+            return false;
+    }
+
+    return encoded.size() < size;
+}
+
+PayloadCodec PayloadEncoder::encode(
+    PayloadCodec codec, SampleType sampleType, const void* data, size_t size, std::vector<uint8_t>& encoded, uint32_t allowedCodecs)
+{
+    if (size == 0 || size > std::numeric_limits<uint32_t>::max())
+        return PayloadCodec::none;
+
+    const auto selectedCodec = selectPayloadCodec(codec, sampleType);
+    if ((allowedCodecs & getPayloadCodecBit(selectedCodec)) && encodeWithCodec(selectedCodec, sampleType, data, size, encoded))
+        return selectedCodec;
+
+    // with automatic selection, fall back to the general purpose codec
+    if (codec == PayloadCodec::automatic && selectedCodec != PayloadCodec::shuffleLz &&
+        (allowedCodecs & getPayloadCodecBit(PayloadCodec::shuffleLz)) &&
+        encodeWithCodec(PayloadCodec::shuffleLz, sampleType, data, size, encoded))
+        return PayloadCodec::shuffleLz;
+
+    return PayloadCodec::none;
+}
+
+PayloadCodec encodePayload(PayloadCodec codec, SampleType sampleType, const void* data, size_t size, std::vector<uint8_t>& encoded)
+{
+    PayloadEncoder encoder;
+    return encoder.encode(codec, sampleType, data, size, encoded);
+}
+
+size_t getDecodedPayloadSize(const void* encoded, size_t encodedSize)
+{
+    uint32_t decodedSize;
+    if (encodedSize < sizeof(decodedSize))
+        throw PacketStreamingException("Encoded payload is truncated");
+
+    std::memcpy(&decodedSize, encoded, sizeof(decodedSize));
+    return decodedSize;
+}
+
+void decodePayload(PayloadCodec codec, SampleType sampleType, const void* encoded, size_t encodedSize, void* decoded, size_t decodedSize)
+{
+    if (getDecodedPayloadSize(encoded, encodedSize) != decodedSize)
+        throw PacketStreamingException("Encoded payload size does not match the packet size");
+
+    const auto data = static_cast<const uint8_t*>(encoded) + sizeof(uint32_t);
+    const auto size = encodedSize - sizeof(uint32_t);
+
+    switch (codec)
+    {
+        case PayloadCodec::deltaZigZag:
+            if (!dispatchWidth<DeltaDecoder>(getIntegerWidth(sampleType), data, size, decoded, decodedSize))
+                throw PacketStreamingException("Payload codec does not support the sample type");
+            break;
+        case PayloadCodec::xorFloat:
+            if (!dispatchWidth<XorDecoder>(getFloatWidth(sampleType), data, size, decoded, decodedSize))
+                throw PacketStreamingException("Payload codec does not support the sample type");
+            break;
+        case PayloadCodec::shuffleLz:
+        {
+            const auto elementSize = getShuffleElementSize(sampleType);
+            if (elementSize > 1)
+            {
+                std::vector<uint8_t> shuffled(decodedSize);
+                decodeLz(data, size, shuffled.data(), decodedSize);
+                unshuffleBytes(shuffled.data(), static_cast<uint8_t*>(decoded), decodedSize, elementSize);
+            }
+            else
+            {
+                decodeLz(data, size, static_cast<uint8_t*>(decoded), decodedSize);
+            }
+            break;
+        }
+        default:
+            throw PacketStreamingException("Unsupported payload codec");
+    }
+}
+
+}
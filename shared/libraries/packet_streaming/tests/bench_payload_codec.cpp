@@ -0,0 +1,162 @@
+#include <gtest/gtest.h>
+#include <packet_streaming/payload_codec.h>
+#include <coretypes/filesystem.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <tuple>
+
+using namespace daq;
+using namespace packet_streaming;
+
+static constexpr double Pi = 3.14159265358979323846;
+
+// Directory with recorded signal data, one raw little-endian file per signal. The file extension gives
+// the sample type: ".int16", ".int32", ".int64", ".float32" or ".float64".
+static constexpr const char* RecordedDataEnv = "OPENDAQ_PAYLOAD_CODEC_DATA";
+
+class PayloadCodecBenchmark : public testing::Test
+{
+protected:
+    template <typename T>
+    static std::vector<T> createSine(size_t count, double amplitude, double scale)
+    {
+        std::vector<T> values(count);
+        for (size_t i = 0; i < count; i++)
+            values[i] = static_cast<T>(std::round(amplitude * std::sin(2.0 * Pi * static_cast<double>(i) / 1000.0) * scale) / scale);
+        return values;
+    }
+
+    template <typename T>
+    static std::vector<T> createNoise24(size_t count)
+    {
+        std::mt19937 generator(42);
+        std::normal_distribution<double> noise(0.0, 50.0);
+
+        std::vector<T> values(count);
+        for (size_t i = 0; i < count; i++)
+            values[i] = static_cast<T>(4000000.0 * std::sin(2.0 * Pi * static_cast<double>(i) / 480.0) + noise(generator));
+        return values;
+    }
+
+    template <typename T>
+    void measure(const std::string& name, PayloadCodec codec, SampleType sampleType, const std::vector<T>& values)
+    {
+        const auto* bytes = reinterpret_cast<const uint8_t*>(values.data());
+        measureBytes(name, codec, sampleType, sizeof(T), std::vector<uint8_t>(bytes, bytes + values.size() * sizeof(T)));
+    }
+
+    // encodes the data in packet sized payloads with one encoder, as the streaming server does
+    void measureBytes(const std::string& name, PayloadCodec codec, SampleType sampleType, size_t sampleSize, const std::vector<uint8_t>& data)
+    {
+        using namespace std::chrono;
+
+        constexpr int iterations = 20;
+        const size_t packetSize = 4096 * sampleSize;
+        const size_t packetCount = (data.size() + packetSize - 1) / packetSize;
+
+        PayloadEncoder encoder;
+        std::vector<std::vector<uint8_t>> encoded(packetCount);
+        std::vector<PayloadCodec> usedCodecs(packetCount, PayloadCodec::none);
+
+        const auto encodeStart = steady_clock::now();
+        for (int i = 0; i < iterations; i++)
+        {
+            for (size_t packet = 0; packet < packetCount; packet++)
+            {
+                const size_t offset = packet * packetSize;
+                const size_t size = std::min(packetSize, data.size() - offset);
+                usedCodecs[packet] = encoder.encode(codec, sampleType, data.data() + offset, size, encoded[packet]);
+            }
+        }
+        const auto encodeTime = duration<double>(steady_clock::now() - encodeStart).count();
+
+        size_t encodedSize = 0;
+        std::vector<uint8_t> decoded(data.size());
+        const auto decodeStart = steady_clock::now();
+        for (int i = 0; i < iterations; i++)
+        {
+            encodedSize = 0;
+            for (size_t packet = 0; packet < packetCount; packet++)
+            {
+                const size_t offset = packet * packetSize;
+                const size_t size = std::min(packetSize, data.size() - offset);
+                if (usedCodecs[packet] == PayloadCodec::none)
+                {
+                    std::memcpy(decoded.data() + offset, data.data() + offset, size);
+                    encodedSize += size;
+                    continue;
+                }
+                decodePayload(usedCodecs[packet], sampleType, encoded[packet].data(), encoded[packet].size(), decoded.data() + offset, size);
+                encodedSize += encoded[packet].size();
+            }
+        }
+        const auto decodeTime = duration<double>(steady_clock::now() - decodeStart).count();
+
+        ASSERT_EQ(decoded, data);
+
+        const double megabytes = static_cast<double>(data.size()) * iterations / 1e6;
+        RecordProperty(name + "Ratio", std::to_string(static_cast<double>(data.size()) / static_cast<double>(encodedSize)));
+        RecordProperty(name + "EncodeMBps", std::to_string(megabytes / encodeTime));
+        RecordProperty(name + "DecodeMBps", std::to_string(megabytes / decodeTime));
+    }
+
+    static bool getRecordedSampleType(const std::string& extension, SampleType& sampleType, size_t& sampleSize)
+    {
+        static const std::vector<std::tuple<std::string, SampleType, size_t>> types = {
+            {".int16", SampleType::Int16, sizeof(int16_t)},
+            {".int32", SampleType::Int32, sizeof(int32_t)},
+            {".int64", SampleType::Int64, sizeof(int64_t)},
+            {".float32", SampleType::Float32, sizeof(float)},
+            {".float64", SampleType::Float64, sizeof(double)}};
+
+        for (const auto& [typeExtension, type, size] : types)
+        {
+            if (typeExtension == extension)
+            {
+                sampleType = type;
+                sampleSize = size;
+                return true;
+            }
+        }
+        return false;
+    }
+};
+
+TEST_F(PayloadCodecBenchmark, Throughput)
+{
+    constexpr size_t sampleCount = 1 << 18;
+
+    measure("Int32Sine", PayloadCodec::automatic, SampleType::Int32, createSine<int32_t>(sampleCount, 1 << 20, 1));
+    measure("Int32Noise24", PayloadCodec::automatic, SampleType::Int32, createNoise24<int32_t>(sampleCount));
+    measure("Float64Sine", PayloadCodec::automatic, SampleType::Float64, createSine<double>(sampleCount, 10, 1000));
+    measure("Float32Step", PayloadCodec::automatic, SampleType::Float32, std::vector<float>(sampleCount, 0.5f));
+}
+
+TEST_F(PayloadCodecBenchmark, RecordedThroughput)
+{
+    const char* directory = std::getenv(RecordedDataEnv);
+    if (directory == nullptr || !fs::is_directory(directory))
+        GTEST_SKIP() << "Set " << RecordedDataEnv << " to a directory with recorded signal data";
+
+    for (const auto& entry : fs::directory_iterator(directory))
+    {
+        SampleType sampleType;
+        size_t sampleSize;
+        if (!entry.is_regular_file() || !getRecordedSampleType(entry.path().extension().string(), sampleType, sampleSize))
+            continue;
+
+        std::ifstream file(entry.path(), std::ios::binary);
+        std::vector<uint8_t> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+        data.resize(data.size() - data.size() % sampleSize);
+        if (data.empty())
+            continue;
+
+        measureBytes(entry.path().stem().string(), PayloadCodec::automatic, sampleType, sampleSize, data);
+    }
+}
@@ -309,6 +309,123 @@ TEST_F(PacketStreamingTest, DataPacketTwice)
     ASSERT_EQ(nullptr, packet10);
 }
 
+TEST_F(PacketStreamingTest, CompressedDataPacket)
+{
+    const auto valueDescriptor = DataDescriptorBuilder().setSampleType(SampleType::Int32).build();
+
+    server.setPayloadCodec(PayloadCodec::automatic);
+    server.addDaqPacket(1, DataDescriptorChangedEventPacket(valueDescriptor, nullptr));
+
+    constexpr size_t sampleCount = 1000;
+    auto serverDataPacket = DataPacket(valueDescriptor, sampleCount, 1024);
+    auto data = static_cast<int32_t*>(serverDataPacket.getRawData());
+    for (size_t i = 0; i < sampleCount; i++)
+        *data++ = static_cast<int32_t>(100000 + i * 3);
+
+    server.addDaqPacket(1, serverDataPacket);
+
+    transmission.sendPacketBuffer(server.getNextPacketBuffer());
+    const auto dataPacketBuffer = server.getNextPacketBuffer();
+    ASSERT_EQ((dataPacketBuffer->packetHeader->flags & PACKET_FLAG_CODEC_MASK) >> PACKET_FLAG_CODEC_SHIFT,
+              static_cast<uint8_t>(PayloadCodec::deltaZigZag));
+    ASSERT_LT(dataPacketBuffer->packetHeader->payloadSize, serverDataPacket.getRawDataSize() / 4);
+    transmission.sendPacketBuffer(dataPacketBuffer);
+
+    while (const auto clientPacketBuffer = transmission.recvPacketBuffer())
+        client.addPacketBuffer(clientPacketBuffer);
+
+    client.getNextDaqPacket();
+    auto [signalId, clientDataPacket] = client.getNextDaqPacket();
+
+    ASSERT_EQ(signalId, 1u);
+    ASSERT_EQ(serverDataPacket, clientDataPacket);
+
+    serverDataPacket.release();
+
+    completeTransmitAll();
+    ASSERT_TRUE(client.areReferencesCleared());
+}
+
+TEST_F(PacketStreamingTest, SignalPayloadCodec)
+{
+    const auto valueDescriptor = DataDescriptorBuilder().setSampleType(SampleType::Float64).build();
+
+    server.setSignalPayloadCodec(2, PayloadCodec::shuffleLz);
+    server.addDaqPacket(1, DataDescriptorChangedEventPacket(valueDescriptor, nullptr));
+    server.addDaqPacket(2, DataDescriptorChangedEventPacket(valueDescriptor, nullptr));
+
+    constexpr size_t sampleCount = 1000;
+    auto serverDataPacket1 = DataPacket(valueDescriptor, sampleCount, 0);
+    auto serverDataPacket2 = DataPacket(valueDescriptor, sampleCount, 0);
+    auto data1 = static_cast<double*>(serverDataPacket1.getRawData());
+    auto data2 = static_cast<double*>(serverDataPacket2.getRawData());
+    for (size_t i = 0; i < sampleCount; i++)
+        *data1++ = *data2++ = static_cast<double>(i % 10);
+
+    server.addDaqPacket(1, serverDataPacket1);
+    server.addDaqPacket(2, serverDataPacket2);
+
+    std::vector<uint8_t> codecs;
+    while (const auto serverPacketBuffer = server.getNextPacketBuffer())
+    {
+        if (serverPacketBuffer->packetHeader->type == packet_streaming::PacketType::data)
+            codecs.push_back((serverPacketBuffer->packetHeader->flags & PACKET_FLAG_CODEC_MASK) >> PACKET_FLAG_CODEC_SHIFT);
+        transmission.sendPacketBuffer(serverPacketBuffer);
+        while (const auto clientPacketBuffer = transmission.recvPacketBuffer())
+            client.addPacketBuffer(clientPacketBuffer);
+    }
+
+    ASSERT_EQ(codecs, std::vector<uint8_t>({static_cast<uint8_t>(PayloadCodec::none), static_cast<uint8_t>(PayloadCodec::shuffleLz)}));
+
+    client.getNextDaqPacket();
+    client.getNextDaqPacket();
+    auto [signalId1, clientDataPacket1] = client.getNextDaqPacket();
+    auto [signalId2, clientDataPacket2] = client.getNextDaqPacket();
+
+    ASSERT_EQ(serverDataPacket1, clientDataPacket1);
+    ASSERT_EQ(serverDataPacket2, clientDataPacket2);
+}
+
+TEST_F(PacketStreamingTest, DomainReferencePacket)
+{
+    const auto valueDescriptor = DataDescriptorBuilder().setSampleType(SampleType::Float32).build();
+    const auto domainDescriptor =
+        DataDescriptorBuilder().setSampleType(SampleType::Int64).setRule(LinearDataRule(10, 0)).setTickResolution(Ratio(1, 1000)).build();
+
+    server.addDaqPacket(1, DataDescriptorChangedEventPacket(valueDescriptor, domainDescriptor));
+
+    constexpr size_t sampleCount = 10;
+    auto serverDomainPacket = DataPacket(domainDescriptor, sampleCount, 100);
+    auto serverValuePacket = DataPacketWithDomain(serverDomainPacket, valueDescriptor, sampleCount);
+    auto data = static_cast<float*>(serverValuePacket.getRawData());
+    for (size_t i = 0; i < sampleCount; i++)
+        *data++ = static_cast<float>(i);
+
+    server.addDomainReferencePacket(1, serverDomainPacket);
+    server.addDaqPacket(1, serverValuePacket);
+
+    transmitAll();
+
+    client.getNextDaqPacket();
+    auto [signalId, clientPacket] = client.getNextDaqPacket();
+    ASSERT_EQ(signalId, 1u);
+    ASSERT_EQ(serverValuePacket, clientPacket);
+
+    const DataPacketPtr clientValuePacket = clientPacket;
+    ASSERT_EQ(serverDomainPacket, clientValuePacket.getDomainPacket());
+
+    // the domain packet is not forwarded as a packet of the signal
+    auto [noSignalId, noPacket] = client.getNextDaqPacket();
+    ASSERT_EQ(noPacket, nullptr);
+
+    serverValuePacket.release();
+    serverDomainPacket.release();
+    clientPacket.release();
+
+    completeTransmitAll();
+    ASSERT_TRUE(client.areReferencesCleared());
+}
+
 class DataWithDomainPacketStreamingTest : public PacketStreamingTest, public testing::WithParamInterface<bool>
 {
 };
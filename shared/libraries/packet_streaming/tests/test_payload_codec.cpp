@@ -0,0 +1,179 @@
+#include <gtest/gtest.h>
+#include <packet_streaming/payload_codec.h>
+#include <packet_streaming/packet_streaming.h>
+
+#include <cmath>
+#include <cstring>
+#include <random>
+
+using namespace daq;
+using namespace packet_streaming;
+
+static constexpr double Pi = 3.14159265358979323846;
+
+class PayloadCodecTest : public testing::Test
+{
+protected:
+    template <typename T>
+    static std::vector<T> createSine(size_t count, double amplitude, double scale)
+    {
+        std::vector<T> values(count);
+        for (size_t i = 0; i < count; i++)
+            values[i] = static_cast<T>(std::round(amplitude * std::sin(2.0 * Pi * static_cast<double>(i) / 1000.0) * scale) / scale);
+        return values;
+    }
+
+    template <typename T>
+    static std::vector<T> createNoise24(size_t count)
+    {
+        std::mt19937 generator(42);
+        std::normal_distribution<double> noise(0.0, 50.0);
+
+        std::vector<T> values(count);
+        for (size_t i = 0; i < count; i++)
+            values[i] = static_cast<T>(4000000.0 * std::sin(2.0 * Pi * static_cast<double>(i) / 480.0) + noise(generator));
+        return values;
+    }
+
+    template <typename T>
+    static void roundTrip(PayloadCodec codec, SampleType sampleType, const std::vector<T>& values, PayloadCodec expectedCodec)
+    {
+        const size_t size = values.size() * sizeof(T);
+
+        std::vector<uint8_t> encoded;
+        const auto usedCodec = encodePayload(codec, sampleType, values.data(), size, encoded);
+        ASSERT_EQ(usedCodec, expectedCodec);
+        if (usedCodec == PayloadCodec::none)
+            return;
+
+        ASSERT_LT(encoded.size(), size);
+        ASSERT_EQ(getDecodedPayloadSize(encoded.data(), encoded.size()), size);
+
+        std::vector<T> decoded(values.size());
+        decodePayload(usedCodec, sampleType, encoded.data(), encoded.size(), decoded.data(), size);
+        ASSERT_EQ(std::memcmp(decoded.data(), values.data(), size), 0);
+    }
+};
+
+TEST_F(PayloadCodecTest, DeltaZigZag)
+{
+    roundTrip(PayloadCodec::deltaZigZag, SampleType::Int8, createSine<int8_t>(1000, 100, 1), PayloadCodec::deltaZigZag);
+    roundTrip(PayloadCodec::deltaZigZag, SampleType::UInt16, createSine<uint16_t>(1000, 1000, 1), PayloadCodec::deltaZigZag);
+    roundTrip(PayloadCodec::deltaZigZag, SampleType::Int32, createNoise24<int32_t>(1000), PayloadCodec::deltaZigZag);
+    roundTrip(PayloadCodec::deltaZigZag, SampleType::Int64, createNoise24<int64_t>(1001), PayloadCodec::deltaZigZag);
+}
+
+TEST_F(PayloadCodecTest, DeltaZigZagExtremes)
+{
+    std::vector<int32_t> values(256);
+    for (size_t i = 0; i < values.size(); i++)
+        values[i] = i % 2 ? std::numeric_limits<int32_t>::max() : std::numeric_limits<int32_t>::min();
+    values.resize(1024, 0);
+
+    roundTrip(PayloadCodec::deltaZigZag, SampleType::Int32, values, PayloadCodec::deltaZigZag);
+}
+
+TEST_F(PayloadCodecTest, XorFloat)
+{
+    std::vector<float> values(1000, 1.5f);
+    for (size_t i = 0; i < values.size(); i += 10)
+        values[i] = static_cast<float>(i);
+
+    roundTrip(PayloadCodec::xorFloat, SampleType::Float32, values, PayloadCodec::xorFloat);
+    roundTrip(PayloadCodec::xorFloat, SampleType::Float64, std::vector<double>(1000, -2.25), PayloadCodec::xorFloat);
+}
+
+TEST_F(PayloadCodecTest, ShuffleLz)
+{
+    roundTrip(PayloadCodec::shuffleLz, SampleType::Float64, createSine<double>(4096, 10, 1000), PayloadCodec::shuffleLz);
+    roundTrip(PayloadCodec::shuffleLz, SampleType::Int16, createSine<int16_t>(4096, 1000, 1), PayloadCodec::shuffleLz);
+    roundTrip(PayloadCodec::shuffleLz, SampleType::Struct, std::vector<uint8_t>(333, 7), PayloadCodec::shuffleLz);
+}
+
+TEST_F(PayloadCodecTest, AutomaticSelection)
+{
+    ASSERT_EQ(selectPayloadCodec(PayloadCodec::automatic, SampleType::Int32), PayloadCodec::deltaZigZag);
+    ASSERT_EQ(selectPayloadCodec(PayloadCodec::automatic, SampleType::Float32), PayloadCodec::xorFloat);
+    ASSERT_EQ(selectPayloadCodec(PayloadCodec::automatic, SampleType::Struct), PayloadCodec::shuffleLz);
+    ASSERT_EQ(selectPayloadCodec(PayloadCodec::deltaZigZag, SampleType::Float32), PayloadCodec::deltaZigZag);
+
+    // falls back to the generic codec when the float codec does not reduce the size
+    roundTrip(PayloadCodec::automatic, SampleType::Float64, createSine<double>(4096, 10, 1000), PayloadCodec::shuffleLz);
+}
+
+TEST_F(PayloadCodecTest, IncompressibleNotEncoded)
+{
+    std::mt19937 generator(1);
+    std::vector<uint32_t> values(1024);
+    for (auto& value : values)
+        value = generator();
+
+    roundTrip(PayloadCodec::shuffleLz, SampleType::UInt32, values, PayloadCodec::none);
+    roundTrip(PayloadCodec::xorFloat, SampleType::Int32, std::vector<int32_t>(16, 1), PayloadCodec::none);
+}
+
+TEST_F(PayloadCodecTest, MalformedPayload)
+{
+    const auto values = createNoise24<int32_t>(1000);
+    const size_t size = values.size() * sizeof(int32_t);
+
+    std::vector<uint8_t> encoded;
+    ASSERT_EQ(encodePayload(PayloadCodec::deltaZigZag, SampleType::Int32, values.data(), size, encoded), PayloadCodec::deltaZigZag);
+
+    std::vector<int32_t> decoded(values.size());
+    ASSERT_THROW(decodePayload(PayloadCodec::deltaZigZag, SampleType::Int32, encoded.data(), encoded.size() / 2, decoded.data(), size),
+                 PacketStreamingException);
+    ASSERT_THROW(decodePayload(PayloadCodec::deltaZigZag, SampleType::Int32, encoded.data(), encoded.size(), decoded.data(), size - 4),
+                 PacketStreamingException);
+    ASSERT_THROW(getDecodedPayloadSize(encoded.data(), 2), PacketStreamingException);
+}
+
+TEST_F(PayloadCodecTest, EncoderReuse)
+{
+    PayloadEncoder encoder;
+    const auto first = createSine<int16_t>(4096, 1000, 1);
+    const auto second = createSine<int16_t>(2048, 300, 1);
+
+    for (const auto& values : {first, second, first})
+    {
+        const size_t size = values.size() * sizeof(int16_t);
+
+        std::vector<uint8_t> encoded;
+        ASSERT_EQ(encoder.encode(PayloadCodec::shuffleLz, SampleType::Int16, values.data(), size, encoded), PayloadCodec::shuffleLz);
+
+        std::vector<int16_t> decoded(values.size());
+        decodePayload(PayloadCodec::shuffleLz, SampleType::Int16, encoded.data(), encoded.size(), decoded.data(), size);
+        ASSERT_EQ(decoded, values);
+    }
+}
+
+TEST_F(PayloadCodecTest, AllowedCodecs)
+{
+    PayloadEncoder encoder;
+    const auto values = createSine<double>(4096, 10, 1000);
+    const size_t size = values.size() * sizeof(double);
+    std::vector<uint8_t> encoded;
+
+    ASSERT_EQ(encoder.encode(PayloadCodec::xorFloat, SampleType::Float64, values.data(), size, encoded, 0), PayloadCodec::none);
+    ASSERT_EQ(encoder.encode(PayloadCodec::shuffleLz,
+                             SampleType::Float64,
+                             values.data(),
+                             size,
+                             encoded,
+                             getPayloadCodecBit(PayloadCodec::xorFloat)),
+              PayloadCodec::none);
+    ASSERT_EQ(encoder.encode(PayloadCodec::automatic,
+                             SampleType::Float64,
+                             values.data(),
+                             size,
+                             encoded,
+                             getPayloadCodecBit(PayloadCodec::xorFloat)),
+              PayloadCodec::none);
+    ASSERT_EQ(encoder.encode(PayloadCodec::automatic,
+                             SampleType::Float64,
+                             values.data(),
+                             size,
+                             encoded,
+                             getPayloadCodecBit(PayloadCodec::shuffleLz)),
+              PayloadCodec::shuffleLz);
+}
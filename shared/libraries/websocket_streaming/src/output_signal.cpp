@@ -132,6 +132,11 @@ void OutputSignalBase::submitTimeConfigChange(const DataDescriptorPtr& domainDes
 
 bool OutputSignalBase::isTimeConfigChanged(const DataDescriptorPtr& domainDescriptor)
 {
+    // Data packets usually reference the very descriptor object that was last submitted,
+    // which makes the per-packet check a pointer comparison.
+    if (this->domainDescriptor.getObject() == domainDescriptor.getObject())
+        return false;
+
     return this->domainDescriptor.getRule() != domainDescriptor.getRule() ||
            this->domainDescriptor.getTickResolution() != domainDescriptor.getTickResolution();
 }